@@ -0,0 +1,124 @@
+// Measures cg_iRIC_Combine_Solutions() for a case with many separate solution files.
+// The case is written to the current folder (bench_combine.cgn and result/).
+//
+// usage: bench_combine [steps] [isize] [jsize]
+
+#include <iriclib.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* FILENAME = "bench_combine.cgn";
+
+std::string solutionFileName(int id)
+{
+	std::ostringstream ss;
+	ss << "result/Solution" << id << ".cgn";
+	return ss.str();
+}
+
+void removeFiles(int steps)
+{
+	std::remove(FILENAME);
+	for (int i = 1; i <= steps; ++i) {
+		std::remove(solutionFileName(i).c_str());
+	}
+}
+
+int writeCase(int steps, int isize, int jsize)
+{
+	int fid;
+	int ier = cg_iRIC_Open(FILENAME, IRIC_MODE_WRITE, &fid);
+	if (ier != IRIC_NO_ERROR) {return ier;}
+
+	std::vector<double> x(isize * jsize), y(isize * jsize);
+	for (int j = 0; j < jsize; ++j) {
+		for (int i = 0; i < isize; ++i) {
+			x[i + j * isize] = i;
+			y[i + j * isize] = j;
+		}
+	}
+	ier = cg_iRIC_Write_Grid2d_Coords(fid, isize, jsize, x.data(), y.data());
+	if (ier != IRIC_NO_ERROR) {return ier;}
+
+	std::vector<double> depth(isize * jsize);
+	std::vector<double> cellDepth((isize - 1) * (jsize - 1));
+	for (int s = 0; s < steps; ++s) {
+		for (size_t i = 0; i < depth.size(); ++i) {
+			depth[i] = s * 0.01 + i * 0.001;
+		}
+		for (size_t i = 0; i < cellDepth.size(); ++i) {
+			cellDepth[i] = s * 0.02 + i * 0.001;
+		}
+		cg_iRIC_Write_Sol_Start(fid);
+		cg_iRIC_Write_Sol_Time(fid, s * 10.0);
+		cg_iRIC_Write_Sol_Node_Real(fid, "Depth", depth.data());
+		cg_iRIC_Write_Sol_Cell_Real(fid, "Depth", cellDepth.data());
+		ier = cg_iRIC_Write_Sol_End(fid);
+		if (ier != IRIC_NO_ERROR) {return ier;}
+	}
+
+	return cg_iRIC_Close(fid);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	int steps = 2000;
+	int isize = 100;
+	int jsize = 100;
+	if (argc > 1) {steps = std::atoi(argv[1]);}
+	if (argc > 2) {isize = std::atoi(argv[2]);}
+	if (argc > 3) {jsize = std::atoi(argv[3]);}
+	if (steps <= 0 || isize < 2 || jsize < 2) {
+		std::cerr << "usage: bench_combine [steps] [isize] [jsize]" << std::endl;
+		return 1;
+	}
+
+	removeFiles(steps);
+
+	iRIC_InitOption(IRIC_OPTION_DIVIDESOLUTIONS);
+	auto start = std::chrono::steady_clock::now();
+	int ier = writeCase(steps, isize, jsize);
+	auto end = std::chrono::steady_clock::now();
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+	if (ier != IRIC_NO_ERROR) {
+		std::cerr << "writing separate solutions failed: " << ier << std::endl;
+		return 1;
+	}
+	double writeSec = std::chrono::duration<double>(end - start).count();
+
+	int fid;
+	ier = cg_iRIC_Open(FILENAME, IRIC_MODE_MODIFY, &fid);
+	if (ier != IRIC_NO_ERROR) {
+		std::cerr << "opening " << FILENAME << " failed: " << ier << std::endl;
+		return 1;
+	}
+
+	int progress = 0;
+	start = std::chrono::steady_clock::now();
+	ier = cg_iRIC_Combine_Solutions(fid, &progress);
+	end = std::chrono::steady_clock::now();
+	cg_iRIC_Close(fid);
+	if (ier != IRIC_NO_ERROR) {
+		std::cerr << "cg_iRIC_Combine_Solutions() failed: " << ier << std::endl;
+		return 1;
+	}
+	double combineSec = std::chrono::duration<double>(end - start).count();
+
+	std::cout << "steps: " << steps << ", grid: " << isize << " x " << jsize << std::endl;
+	std::cout << "write separate : " << writeSec << " s" << std::endl;
+	std::cout << "combine        : " << combineSec << " s (" << steps / combineSec << " steps/s, progress " << progress << ")" << std::endl;
+
+	removeFiles(steps);
+
+	return 0;
+}
@@ -0,0 +1,171 @@
+// Measures loading a point map file, with PointMap::load() and with a loader that reads one value at a time
+// as PointMap::load() did before, for comparison.
+// The point map is written to the current folder (bench_geo_load.dat).
+//
+// usage: bench_geo_load [points]
+
+#include <iriclib_pointmap.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+const char* FILENAME = "bench_geo_load.dat";
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// points on a grid of width columns, with two triangles for each cell
+int writePointMap(int points)
+{
+	iRICLib::PointMap pm;
+	pm.valueType = iRICLib::PointMap::vtReal;
+
+	int width = 1000;
+	for (int i = 0; i < points; ++i) {
+		pm.x.push_back(i % width);
+		pm.y.push_back(i / width);
+		pm.realValue.push_back((i % 997) * 0.01);
+	}
+	for (int i = 0; i + width + 1 < points; ++i) {
+		if (i % width == width - 1) {continue;}
+
+		iRICLib::PointMapTriangle tri1, tri2;
+		tri1.index1 = i; tri1.index2 = i + 1; tri1.index3 = i + width;
+		tri2.index1 = i + 1; tri2.index2 = i + width + 1; tri2.index3 = i + width;
+		pm.triangles.push_back(tri1);
+		pm.triangles.push_back(tri2);
+	}
+	iRICLib::PointMapBreakline bl;
+	for (int i = 0; i < width && i < points; ++i) {
+		bl.indices.push_back(i);
+	}
+	pm.breaklines.push_back(bl);
+
+	return pm.save(FILENAME);
+}
+
+template <typename V>
+void readValue(std::istream& s, V* value)
+{
+	s.read(reinterpret_cast<char*>(value), sizeof(V));
+}
+
+// reads the file one value at a time
+int loadPerValue(iRICLib::PointMap* pm)
+{
+	std::ifstream s(FILENAME, std::ios::in | std::ios::binary);
+	if (! s) {return -1;}
+
+	int vt, count;
+	readValue(s, &vt);
+	readValue(s, &count);
+	pm->valueType = static_cast<iRICLib::PointMap::ValueType>(vt);
+	pm->pointCount = count;
+	for (int i = 0; i < count; ++i) {
+		double v;
+		readValue(s, &v);
+		pm->x.push_back(v);
+	}
+	for (int i = 0; i < count; ++i) {
+		double v;
+		readValue(s, &v);
+		pm->y.push_back(v);
+	}
+	for (int i = 0; i < count; ++i) {
+		double v;
+		readValue(s, &v);
+		pm->realValue.push_back(v);
+	}
+	int triCount;
+	readValue(s, &triCount);
+	for (int i = 0; i < triCount; ++i) {
+		iRICLib::PointMapTriangle tri;
+		readValue(s, &tri.index1);
+		readValue(s, &tri.index2);
+		readValue(s, &tri.index3);
+		pm->triangles.push_back(tri);
+	}
+	int blCount;
+	readValue(s, &blCount);
+	for (int i = 0; i < blCount; ++i) {
+		iRICLib::PointMapBreakline bl;
+		int length;
+		readValue(s, &length);
+		for (int j = 0; j < length; ++j) {
+			int index;
+			readValue(s, &index);
+			bl.indices.push_back(index);
+		}
+		pm->breaklines.push_back(bl);
+	}
+	return 0;
+}
+
+bool isSame(const iRICLib::PointMap& pm1, const iRICLib::PointMap& pm2)
+{
+	if (pm1.x != pm2.x || pm1.y != pm2.y || pm1.realValue != pm2.realValue) {return false;}
+	if (pm1.triangles.size() != pm2.triangles.size() || pm1.breaklines.size() != pm2.breaklines.size()) {return false;}
+
+	for (size_t i = 0; i < pm1.triangles.size(); ++i) {
+		const auto& t1 = pm1.triangles[i];
+		const auto& t2 = pm2.triangles[i];
+		if (t1.index1 != t2.index1 || t1.index2 != t2.index2 || t1.index3 != t2.index3) {return false;}
+	}
+	for (size_t i = 0; i < pm1.breaklines.size(); ++i) {
+		if (pm1.breaklines[i].indices != pm2.breaklines[i].indices) {return false;}
+	}
+	return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	int points = 5000000;
+	if (argc > 1) {points = std::atoi(argv[1]);}
+	if (points < 1) {
+		std::cerr << "usage: bench_geo_load [points]" << std::endl;
+		return 1;
+	}
+
+	std::remove(FILENAME);
+
+	auto start = std::chrono::steady_clock::now();
+	if (writePointMap(points) != 0) {
+		std::cerr << "writing " << FILENAME << " failed" << std::endl;
+		return 1;
+	}
+	double writeSec = secondsSince(start);
+
+	iRICLib::PointMap pm1;
+	start = std::chrono::steady_clock::now();
+	int ret = loadPerValue(&pm1);
+	double perValueSec = secondsSince(start);
+
+	iRICLib::PointMap pm2;
+	start = std::chrono::steady_clock::now();
+	ret = ret | pm2.load(FILENAME);
+	double loadSec = secondsSince(start);
+
+	if (ret != 0 || ! isSame(pm1, pm2)) {
+		std::cerr << "loading " << FILENAME << " failed" << std::endl;
+		return 1;
+	}
+
+	std::cout << "points: " << points << ", triangles: " << pm2.triangles.size() << std::endl;
+	std::cout << "write (PointMap::save)   : " << writeSec << " s" << std::endl;
+	std::cout << "load (one value per read): " << perValueSec << " s" << std::endl;
+	std::cout << "load (PointMap::load)    : " << loadSec << " s" << std::endl;
+
+	std::remove(FILENAME);
+
+	return 0;
+}
@@ -0,0 +1,190 @@
+// Compares build time and findCell() latency of the Grid2D spatial indices
+// (uniform back grid and BVH) on synthetic meshes.
+//
+// usage: bench_grid2d_index [isize] [jsize] [queries]
+
+#include <iricsolverlib_grid2d.h>
+#include <iricsolverlib_point2d.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace iRICSolverLib;
+
+namespace {
+
+const double PI = 3.14159265358979;
+
+enum class MeshType {
+	Uniform,
+	GradedRiver,
+	GradedRiverTriangles
+};
+
+const char* meshName(MeshType type)
+{
+	if (type == MeshType::Uniform) {return "uniform";}
+	if (type == MeshType::GradedRiver) {return "graded river";}
+	return "graded river (tri)";
+}
+
+// spacing grows geometrically, so the last cell is "ratio" times larger than the first one
+std::vector<double> gradedCoords(int count, double length, double ratio)
+{
+	std::vector<double> ret(count, 0);
+	double r = std::pow(ratio, 1.0 / (std::max)(1, count - 2));
+	double d = 1;
+	double sum = 0;
+	for (int i = 1; i < count; ++i) {
+		sum += d;
+		ret[i] = sum;
+		d *= r;
+	}
+	for (int i = 0; i < count; ++i) {
+		ret[i] *= length / sum;
+	}
+	return ret;
+}
+
+void buildMesh(Grid2D* grid, MeshType type, int isize, int jsize)
+{
+	if (type == MeshType::Uniform) {
+		for (int j = 0; j < jsize; ++j) {
+			for (int i = 0; i < isize; ++i) {
+				grid->addNode(i, j);
+			}
+		}
+	} else {
+		// long, thin meandering channel, refined toward the downstream end and both banks
+		double length = 100000;
+		double width = 200;
+		std::vector<double> s = gradedCoords(isize, length, 100);
+		std::vector<double> half = gradedCoords(jsize / 2 + 1, 0.5, 20);
+		std::vector<double> n(jsize, 0);
+		for (int j = 0; j < jsize; ++j) {
+			int k = (std::min)(j, jsize - 1 - j);
+			double t = 0.5 - half[half.size() - 1 - (std::min)(k, static_cast<int> (half.size()) - 1)];
+			n[j] = (j <= jsize / 2) ? t : 1 - t;
+		}
+		for (int j = 0; j < jsize; ++j) {
+			for (int i = 0; i < isize; ++i) {
+				double theta = 2 * PI * s[i] / 10000;
+				double cx = s[i];
+				double cy = 3000 * std::sin(theta);
+				double dx = 1;
+				double dy = 3000 * 2 * PI / 10000 * std::cos(theta);
+				double len = std::sqrt(dx * dx + dy * dy);
+				double off = (n[j] - 0.5) * width;
+				grid->addNode(cx - dy / len * off, cy + dx / len * off);
+			}
+		}
+	}
+
+	for (int j = 0; j < jsize - 1; ++j) {
+		for (int i = 0; i < isize - 1; ++i) {
+			int id = i + j * isize + 1;
+			if (type == MeshType::GradedRiverTriangles) {
+				grid->addTriCell(id, id + 1, id + 1 + isize);
+				grid->addTriCell(id, id + 1 + isize, id + isize);
+			} else {
+				grid->addQuadCell(id, id + 1, id + 1 + isize, id + isize);
+			}
+		}
+	}
+}
+
+// random points that are inside the grid, uniformly distributed over cells
+void buildQueries(const Grid2D& grid, int isize, int jsize, int count, std::vector<Point2D>* points)
+{
+	std::mt19937 gen(12345);
+	std::uniform_int_distribution<int> iDist(0, isize - 2);
+	std::uniform_int_distribution<int> jDist(0, jsize - 2);
+	std::uniform_real_distribution<double> uDist(0.05, 0.95);
+
+	points->clear();
+	for (int q = 0; q < count; ++q) {
+		int i = iDist(gen);
+		int j = jDist(gen);
+		double u = uDist(gen);
+		double v = uDist(gen);
+		Point2D p1 = grid.node(i + j * isize + 1);
+		Point2D p2 = grid.node(i + 1 + j * isize + 1);
+		Point2D p3 = grid.node(i + 1 + (j + 1) * isize + 1);
+		Point2D p4 = grid.node(i + (j + 1) * isize + 1);
+		double x = (1 - u) * (1 - v) * p1.x() + u * (1 - v) * p2.x() + u * v * p3.x() + (1 - u) * v * p4.x();
+		double y = (1 - u) * (1 - v) * p1.y() + u * (1 - v) * p2.y() + u * v * p3.y() + (1 - u) * v * p4.y();
+		points->push_back(Point2D(x, y));
+	}
+}
+
+double percentile(std::vector<double> values, double p)
+{
+	std::sort(values.begin(), values.end());
+	size_t idx = static_cast<size_t> (p * (values.size() - 1));
+	return values.at(idx);
+}
+
+void runCase(MeshType type, Grid2D::SpatialIndex index, int isize, int jsize, int queries)
+{
+	Grid2D grid;
+	buildMesh(&grid, type, isize, jsize);
+	grid.setSpatialIndex(index);
+
+	auto t0 = std::chrono::steady_clock::now();
+	grid.setupBackGrid();
+	auto t1 = std::chrono::steady_clock::now();
+	double buildMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+	std::vector<Point2D> points;
+	buildQueries(grid, isize, jsize, queries, &points);
+
+	std::vector<double> samples;
+	samples.reserve(points.size());
+	int found = 0;
+	for (size_t q = 0; q < points.size(); ++q) {
+		auto s0 = std::chrono::steady_clock::now();
+		int cellId;
+		bool ok = grid.findCell(points[q], &cellId);
+		auto s1 = std::chrono::steady_clock::now();
+		if (ok) {++ found;}
+		samples.push_back(std::chrono::duration<double, std::nano>(s1 - s0).count());
+	}
+
+	double sum = 0;
+	for (double v : samples) {sum += v;}
+
+	std::printf("%-20s %-9s %10d %10.1f %10.1f %10.1f %10.1f %10.1f %9d\n",
+		meshName(type), (index == Grid2D::SpatialIndex::BVH) ? "bvh" : "backgrid",
+		grid.cellCount(), buildMs, sum / samples.size(), percentile(samples, 0.5), percentile(samples, 0.99),
+		percentile(samples, 0.999), found);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	int isize = 2000;
+	int jsize = 100;
+	int queries = 1000000;
+
+	if (argc > 1) {isize = std::atoi(argv[1]);}
+	if (argc > 2) {jsize = std::atoi(argv[2]);}
+	if (argc > 3) {queries = std::atoi(argv[3]);}
+
+	std::printf("grid: %d x %d, %d queries, query latency in ns\n", isize, jsize, queries);
+	std::printf("%-20s %-9s %10s %10s %10s %10s %10s %10s %9s\n",
+		"mesh", "index", "cells", "build(ms)", "mean", "p50", "p99", "p99.9", "found");
+
+	MeshType types[] = {MeshType::Uniform, MeshType::GradedRiver, MeshType::GradedRiverTriangles};
+	for (MeshType type : types) {
+		runCase(type, Grid2D::SpatialIndex::BackGrid, isize, jsize, queries);
+		runCase(type, Grid2D::SpatialIndex::BVH, isize, jsize, queries);
+	}
+
+	return 0;
+}
@@ -0,0 +1,100 @@
+// Measures the cost of _IRIC_LOGGER_TRACE_CALL_START/END around a trivial call,
+// with the logger level left at its default value (fatal).
+//
+// usage: bench_logger [count]
+
+#include "internal/iric_logger.h"
+
+#include <Poco/Logger.h>
+#include <Poco/LogStream.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace iRICLib;
+
+int bench_logger_stripped_loop(int count, volatile int* sink);
+
+namespace {
+
+// what the macros did before the level check: a LogStream built for every message
+void legacy_call_start(const std::string& f_name, const std::string& c_name)
+{
+	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_TRACE);
+	s << "Entering " << f_name << "() in " << c_name << std::endl;
+}
+
+void legacy_call_end(const std::string& f_name, const std::string& c_name)
+{
+	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_TRACE);
+	s << "Returned from " << f_name << "() in " << c_name << std::endl;
+}
+
+int legacy_loop(int count, volatile int* sink)
+{
+	for (int i = 0; i < count; ++i) {
+		legacy_call_start("H5Dread", __func__);
+		*sink = i;
+		legacy_call_end("H5Dread", __func__);
+	}
+	return *sink;
+}
+
+int gated_loop(int count, volatile int* sink)
+{
+	for (int i = 0; i < count; ++i) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Dread");
+		*sink = i;
+		_IRIC_LOGGER_TRACE_CALL_END("H5Dread");
+	}
+	return *sink;
+}
+
+int plain_loop(int count, volatile int* sink)
+{
+	for (int i = 0; i < count; ++i) {
+		*sink = i;
+	}
+	return *sink;
+}
+
+template <typename F>
+double measure(F f, int count)
+{
+	volatile int sink = 0;
+	auto start = std::chrono::steady_clock::now();
+	f(count, &sink);
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / count;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	int count = 1000000;
+	if (argc > 1) {
+		count = std::atoi(argv[1]);
+	}
+	if (count <= 0) {
+		std::cerr << "usage: bench_logger [count]" << std::endl;
+		return 1;
+	}
+
+	_iric_logger_init();
+
+	if (_iric_logger_enabled(_IRIC_LOGGER_PRIO_TRACE)) {
+		std::cerr << "IRIC_LOG_LEVEL should not be trace while running this benchmark" << std::endl;
+		return 1;
+	}
+
+	std::cout << "calls: " << count << std::endl;
+	std::cout << "no logging            : " << measure(plain_loop, count) << " ns/call" << std::endl;
+	std::cout << "LogStream per message : " << measure(legacy_loop, count) << " ns/call" << std::endl;
+	std::cout << "level checked macros  : " << measure(gated_loop, count) << " ns/call" << std::endl;
+	std::cout << "compile-time stripped : " << measure(bench_logger_stripped_loop, count) << " ns/call" << std::endl;
+
+	return 0;
+}
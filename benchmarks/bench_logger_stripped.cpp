@@ -0,0 +1,14 @@
+// compiled with trace logging removed, to compare with the runtime checked macros.
+#define IRIC_LOGGER_DISABLE_TRACE
+
+#include "internal/iric_logger.h"
+
+int bench_logger_stripped_loop(int count, volatile int* sink)
+{
+	for (int i = 0; i < count; ++i) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Dread");
+		*sink = i;
+		_IRIC_LOGGER_TRACE_CALL_END("H5Dread");
+	}
+	return *sink;
+}
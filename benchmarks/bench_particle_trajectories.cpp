@@ -0,0 +1,173 @@
+// Measures writing particle groups of many steps, and reading the trajectories of some particles,
+// with the particle groups stored in each step (layout 0) or in trajectories (layout 1).
+// The case is written to the current folder (bench_particle_trajectories.cgn).
+//
+// usage: bench_particle_trajectories [particles] [steps] [layout]
+
+#include <iriclib.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+const char* FILENAME = "bench_particle_trajectories.cgn";
+const int TRAJECTORY_COUNT = 10;
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// the particles are written in a different order in each step
+int particleId(int i, int step, int particles)
+{
+	return static_cast<int> ((static_cast<long long> (i) * 7919 + step) % particles);
+}
+
+int writeCase(int particles, int steps, int layout, double* closeSec)
+{
+	int fid;
+	int ier = cg_iRIC_Open(FILENAME, IRIC_MODE_WRITE, &fid);
+	if (ier != IRIC_NO_ERROR) {return ier;}
+
+	std::vector<double> gx(4), gy(4);
+	gx[1] = 1; gx[3] = 1; gy[2] = 1; gy[3] = 1;
+	ier = cg_iRIC_Write_Grid2d_Coords(fid, 2, 2, gx.data(), gy.data());
+	if (ier != IRIC_NO_ERROR) {return ier;}
+
+	if (layout == 1) {
+		ier = cg_iRIC_Set_ParticleGroupTrajectory(fid, "id");
+		if (ier != IRIC_NO_ERROR) {return ier;}
+	}
+
+	std::vector<double> x(particles), y(particles);
+	std::vector<int> ids(particles);
+	for (int s = 1; s <= steps; ++s) {
+		for (int i = 0; i < particles; ++i) {
+			int id = particleId(i, s, particles);
+			ids[i] = id;
+			x[i] = id + s * 0.001;
+			y[i] = s;
+		}
+		cg_iRIC_Write_Sol_Start(fid);
+		cg_iRIC_Write_Sol_Time(fid, s * 10.0);
+		cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(fid, "particles");
+		cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, particles, x.data(), y.data());
+		cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, "id", particles, ids.data());
+		ier = cg_iRIC_Write_Sol_ParticleGroup_GroupEnd(fid);
+		if (ier != IRIC_NO_ERROR) {return ier;}
+		ier = cg_iRIC_Write_Sol_End(fid);
+		if (ier != IRIC_NO_ERROR) {return ier;}
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	ier = cg_iRIC_Close(fid);
+	*closeSec = secondsSince(start);
+
+	return ier;
+}
+
+// reads the trajectories by reading the ids and the positions of all steps
+int readTrajectoriesFromSteps(int fid, int steps, const std::vector<int>& ids, std::vector<double>* xs)
+{
+	std::vector<int> stepIds;
+	std::vector<double> x, y;
+	for (int s = 1; s <= steps; ++s) {
+		int count;
+		int ier = cg_iRIC_Read_Sol_ParticleGroup_Count(fid, s, "particles", &count);
+		if (ier != IRIC_NO_ERROR) {return ier;}
+
+		stepIds.assign(count, 0);
+		x.assign(count, 0);
+		y.assign(count, 0);
+		ier = cg_iRIC_Read_Sol_ParticleGroup_Integer(fid, s, "particles", "id", stepIds.data());
+		if (ier != IRIC_NO_ERROR) {return ier;}
+		ier = cg_iRIC_Read_Sol_ParticleGroup_Pos2d(fid, s, "particles", x.data(), y.data());
+		if (ier != IRIC_NO_ERROR) {return ier;}
+
+		for (int id : ids) {
+			for (int i = 0; i < count; ++i) {
+				if (stepIds[i] == id) {xs->push_back(x[i]);}
+			}
+		}
+	}
+	return IRIC_NO_ERROR;
+}
+
+int readTrajectories(int fid, int steps, std::vector<int> ids, std::vector<double>* xs)
+{
+	int count = static_cast<int> (ids.size());
+	int size;
+	int ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(fid, "particles", count, ids.data(), 1, steps, &size);
+	if (ier != IRIC_NO_ERROR) {return ier;}
+
+	std::vector<int> pids(size), stepArr(size);
+	std::vector<double> y(size);
+	xs->assign(size, 0);
+	return cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(fid, "particles", count, ids.data(), 1, steps, pids.data(), stepArr.data(), xs->data(), y.data());
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	int particles = 100000;
+	int steps = 200;
+	int layout = 1;
+	if (argc > 1) {particles = std::atoi(argv[1]);}
+	if (argc > 2) {steps = std::atoi(argv[2]);}
+	if (argc > 3) {layout = std::atoi(argv[3]);}
+	if (particles < TRAJECTORY_COUNT || steps < 1 || (layout != 0 && layout != 1)) {
+		std::cerr << "usage: bench_particle_trajectories [particles] [steps] [layout]" << std::endl;
+		return 1;
+	}
+
+	std::remove(FILENAME);
+
+	double closeSec;
+	auto start = std::chrono::steady_clock::now();
+	int ier = writeCase(particles, steps, layout, &closeSec);
+	if (ier != IRIC_NO_ERROR) {
+		std::cerr << "writing solutions failed: " << ier << std::endl;
+		return 1;
+	}
+	double writeSec = secondsSince(start);
+
+	int fid;
+	ier = cg_iRIC_Open(FILENAME, IRIC_MODE_READ, &fid);
+	if (ier != IRIC_NO_ERROR) {
+		std::cerr << "opening " << FILENAME << " failed: " << ier << std::endl;
+		return 1;
+	}
+
+	std::vector<int> ids;
+	for (int i = 0; i < TRAJECTORY_COUNT; ++i) {
+		ids.push_back(particles / TRAJECTORY_COUNT * i);
+	}
+	std::vector<double> xs;
+	start = std::chrono::steady_clock::now();
+	if (layout == 0) {
+		ier = readTrajectoriesFromSteps(fid, steps, ids, &xs);
+	} else {
+		ier = readTrajectories(fid, steps, ids, &xs);
+	}
+	double readSec = secondsSince(start);
+	cg_iRIC_Close(fid);
+
+	if (ier != IRIC_NO_ERROR || xs.size() != ids.size() * steps) {
+		std::cerr << "reading trajectories failed: " << ier << std::endl;
+		return 1;
+	}
+
+	std::cout << "particles: " << particles << ", steps: " << steps << ", layout: " << layout << std::endl;
+	std::cout << "write          : " << writeSec << " s (close: " << closeSec << " s)" << std::endl;
+	std::cout << "read " << TRAJECTORY_COUNT << " trajectories: " << readSec << " s" << std::endl;
+
+	std::remove(FILENAME);
+
+	return 0;
+}
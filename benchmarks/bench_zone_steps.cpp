@@ -0,0 +1,127 @@
+// Measures opening a file with many solution steps, and reading the first and the last steps.
+// The case is written to the current folder (bench_zone_steps.cgn).
+//
+// usage: bench_zone_steps [steps] [isize] [jsize]
+
+#include <iriclib.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+const char* FILENAME = "bench_zone_steps.cgn";
+const int READ_COUNT = 20;
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int writeCase(int steps, int isize, int jsize)
+{
+	int fid;
+	int ier = cg_iRIC_Open(FILENAME, IRIC_MODE_WRITE, &fid);
+	if (ier != IRIC_NO_ERROR) {return ier;}
+
+	std::vector<double> x(isize * jsize), y(isize * jsize);
+	for (int j = 0; j < jsize; ++j) {
+		for (int i = 0; i < isize; ++i) {
+			x[i + j * isize] = i;
+			y[i + j * isize] = j;
+		}
+	}
+	ier = cg_iRIC_Write_Grid2d_Coords(fid, isize, jsize, x.data(), y.data());
+	if (ier != IRIC_NO_ERROR) {return ier;}
+
+	std::vector<double> depth(isize * jsize);
+	std::vector<double> cellDepth((isize - 1) * (jsize - 1));
+	for (int s = 1; s <= steps; ++s) {
+		depth.assign(depth.size(), s);
+		cellDepth.assign(cellDepth.size(), s);
+		cg_iRIC_Write_Sol_Start(fid);
+		cg_iRIC_Write_Sol_Time(fid, s * 10.0);
+		cg_iRIC_Write_Sol_Node_Real(fid, "Depth", depth.data());
+		cg_iRIC_Write_Sol_Cell_Real(fid, "Depth", cellDepth.data());
+		ier = cg_iRIC_Write_Sol_End(fid);
+		if (ier != IRIC_NO_ERROR) {return ier;}
+	}
+
+	return cg_iRIC_Close(fid);
+}
+
+// average time to read Depth of READ_COUNT steps starting from firstStep
+double readSteps(int fid, int firstStep, int size, int* ier)
+{
+	std::vector<double> depth(size);
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < READ_COUNT; ++i) {
+		*ier = cg_iRIC_Read_Sol_Node_Real(fid, firstStep + i, "Depth", depth.data());
+		if (*ier != IRIC_NO_ERROR) {return 0;}
+		if (depth[0] != firstStep + i) {
+			*ier = -1;
+			return 0;
+		}
+	}
+	return secondsSince(start) / READ_COUNT;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	int steps = 5000;
+	int isize = 20;
+	int jsize = 10;
+	if (argc > 1) {steps = std::atoi(argv[1]);}
+	if (argc > 2) {isize = std::atoi(argv[2]);}
+	if (argc > 3) {jsize = std::atoi(argv[3]);}
+	if (steps < READ_COUNT || isize < 2 || jsize < 2) {
+		std::cerr << "usage: bench_zone_steps [steps] [isize] [jsize]" << std::endl;
+		return 1;
+	}
+
+	std::remove(FILENAME);
+
+	auto start = std::chrono::steady_clock::now();
+	int ier = writeCase(steps, isize, jsize);
+	if (ier != IRIC_NO_ERROR) {
+		std::cerr << "writing solutions failed: " << ier << std::endl;
+		return 1;
+	}
+	double writeSec = secondsSince(start);
+
+	int fid;
+	start = std::chrono::steady_clock::now();
+	ier = cg_iRIC_Open(FILENAME, IRIC_MODE_READ, &fid);
+	if (ier != IRIC_NO_ERROR) {
+		std::cerr << "opening " << FILENAME << " failed: " << ier << std::endl;
+		return 1;
+	}
+	double openSec = secondsSince(start);
+
+	double firstSec = readSteps(fid, 1, isize * jsize, &ier);
+	if (ier == IRIC_NO_ERROR) {
+		double lastSec = readSteps(fid, steps - READ_COUNT + 1, isize * jsize, &ier);
+		if (ier == IRIC_NO_ERROR) {
+			std::cout << "steps: " << steps << ", grid: " << isize << " x " << jsize << std::endl;
+			std::cout << "write          : " << writeSec << " s" << std::endl;
+			std::cout << "open           : " << openSec << " s" << std::endl;
+			std::cout << "read first     : " << firstSec * 1000 << " ms/step" << std::endl;
+			std::cout << "read last      : " << lastSec * 1000 << " ms/step" << std::endl;
+		}
+	}
+	cg_iRIC_Close(fid);
+
+	if (ier != IRIC_NO_ERROR) {
+		std::cerr << "reading solutions failed: " << ier << std::endl;
+		return 1;
+	}
+
+	std::remove(FILENAME);
+
+	return 0;
+}
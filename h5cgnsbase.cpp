@@ -291,6 +291,16 @@ int H5CgnsBase::copyGridsTo(H5CgnsBase* target)
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsBase::linkGridsTo(H5CgnsBase* target, const std::string& fileName)
+{
+	for (auto zone : impl->m_zones) {
+		auto zone2 = target->createZone(zone->name(), zone->type(), zone->size());
+		int ier = zone2->linkGridTo(fileName);
+		RETURN_IF_ERR;
+	}
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsBase::copyExceptSolution(H5CgnsBase* target)
 {
 	// copy UserDefinedData
@@ -323,6 +333,25 @@ int H5CgnsBase::copyExceptSolution(H5CgnsBase* target)
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsBase::copySolutionTo(H5CgnsBase* target)
+{
+	for (auto zone : impl->m_zones) {
+		auto zone2 = target->zone(zone->name());
+		if (zone2 == nullptr) {
+			std::ostringstream ss;
+			ss << "In H5CgnsBase::copySolutionTo(), zone " << zone->name() << " does not exist in target. Skipped";
+			_iric_logger_warn(ss.str());
+			continue;
+		}
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::copySolutionTo");
+		int ier = zone->copySolutionTo(zone2);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::copySolutionTo", ier);
+		RETURN_IF_ERR;
+	}
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsBase::flush()
 {
 	if (impl->m_biterData != nullptr) {
@@ -342,6 +371,18 @@ int H5CgnsBase::flush()
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsBase::buildParticleGroupTrajectoryIndex()
+{
+	for (auto zone : impl->m_zones) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::buildParticleGroupTrajectoryIndex");
+		int ier = zone->buildParticleGroupTrajectoryIndex();
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::buildParticleGroupTrajectoryIndex", ier);
+		RETURN_IF_ERR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
 H5CgnsFile* H5CgnsBase::file() const
 {
 	return impl->m_file;
@@ -54,8 +54,11 @@ public:
 
 	int setSolutionId(int solutionId);
 	int copyGridsTo(H5CgnsBase* target);
+	int linkGridsTo(H5CgnsBase* target, const std::string& fileName);
 	int copyExceptSolution(H5CgnsBase* target);
+	int copySolutionTo(H5CgnsBase* target);
 	int flush();
+	int buildParticleGroupTrajectoryIndex();
 
 	H5CgnsFile* file() const;
 
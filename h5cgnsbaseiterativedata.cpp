@@ -55,13 +55,22 @@ int writeDataT(const std::string& name, const std::vector<V>& value, std::map<st
 }
 
 template <typename V>
-int flushT(hid_t groupId, const std::map<std::string, std::vector<V> > values)
+int flushT(hid_t groupId, const std::map<std::string, std::vector<V> >& values, std::map<std::string, size_t>* writtenCounts, std::unordered_set<std::string>* names)
 {
 	for (const auto& pair : values) {
-		_IRIC_LOGGER_TRACE_CALL_START("H5Util::updateOrCreateDataArray");
-		int ier = H5Util::updateOrCreateDataArray(groupId, pair.first, pair.second);
-		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::updateOrCreateDataArray", ier);
+		size_t writtenCount = 0;
+		auto it = writtenCounts->find(pair.first);
+		if (it != writtenCounts->end()) {
+			if (it->second == pair.second.size()) {continue;}
+			writtenCount = it->second;
+		}
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5Util::appendOrCreateDataArray");
+		int ier = H5Util::appendOrCreateDataArray(groupId, pair.first, pair.second, writtenCount, names);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::appendOrCreateDataArray", ier);
 		RETURN_IF_ERR;
+
+		(*writtenCounts)[pair.first] = pair.second.size();
 	}
 
 	return IRIC_NO_ERROR;
@@ -169,16 +178,22 @@ int H5CgnsBaseIterativeData::writeData(const std::string& name, const std::strin
 
 int H5CgnsBaseIterativeData::writeData(const std::string& name, const std::vector<double>& values)
 {
+	// the whole array is written again in flush()
+	impl->m_writtenCounts.erase(name);
 	return writeDataT(name, values, &(impl->m_realValues));
 }
 
 int H5CgnsBaseIterativeData::writeData(const std::string& name, std::vector<int>& values)
 {
+	// the whole array is written again in flush()
+	impl->m_writtenCounts.erase(name);
 	return writeDataT(name, values, &(impl->m_intValues));
 }
 
 int H5CgnsBaseIterativeData::writeData(const std::string& name, std::vector<std::string>& values)
 {
+	// the whole array is written again in flush()
+	impl->m_writtenCounts.erase(name);
 	return writeDataT(name, values, &(impl->m_stringValues));
 }
 
@@ -201,26 +216,32 @@ int H5CgnsBaseIterativeData::clearData()
 
 	impl->m_intValues.clear();
 	impl->m_realValues.clear();
+	impl->m_writtenCounts.clear();
 
 	return IRIC_NO_ERROR;
 }
 
 int H5CgnsBaseIterativeData::flush()
 {
-	int ier;
+	std::unordered_set<std::string> names;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getGroupNames");
+	int ier = H5Util::getGroupNames(impl->m_groupId, &names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getGroupNames", ier);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_CALL_START("flushT");
-	ier = flushT(impl->m_groupId, impl->m_realValues);
+	ier = flushT(impl->m_groupId, impl->m_realValues, &(impl->m_writtenCounts), &names);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("flushT", ier);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_CALL_START("flushT");
-	ier = flushT(impl->m_groupId, impl->m_intValues);
+	ier = flushT(impl->m_groupId, impl->m_intValues, &(impl->m_writtenCounts), &names);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("flushT", ier);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_CALL_START("flushT");
-	ier = flushT(impl->m_groupId, impl->m_stringValues);
+	ier = flushT(impl->m_groupId, impl->m_stringValues, &(impl->m_writtenCounts), &names);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("flushT", ier);
 	RETURN_IF_ERR;
 
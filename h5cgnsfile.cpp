@@ -33,7 +33,7 @@ void _initCgnsFile(hid_t fileId)
 
 } // namespace
 
-H5CgnsFile::H5CgnsFile(const std::string &fileName, Mode mode, const std::string& resultFolder) :
+H5CgnsFile::H5CgnsFile(const std::string &fileName, Mode mode, const std::string& resultFolder, bool swmr, const H5FileAccessProfile& accessProfile) :
 	impl {new Impl {this}}
 {
 	_iric_logger_init();
@@ -41,8 +41,13 @@ H5CgnsFile::H5CgnsFile(const std::string &fileName, Mode mode, const std::string
 	impl->m_mode = mode;
 	impl->m_fileName = fileName;
 	impl->m_resultFolder = resultFolder;
+	impl->m_swmr = swmr;
+	impl->m_accessProfile = accessProfile;
 
 	if (mode == Mode::Create) {
+		hid_t fileAccessProperty = impl->createFileAccessProperty(accessProfile.pageSize() != 0);
+		H5PropertyListCloser fileAccessPropertyCloser(fileAccessProperty);
+
 		_IRIC_LOGGER_TRACE_CALL_START("H5Pcreate");
 		hid_t fileCreationProperty = H5Pcreate(H5P_FILE_CREATE);
 		_IRIC_LOGGER_TRACE_CALL_END("H5Pcreate");
@@ -57,7 +62,16 @@ H5CgnsFile::H5CgnsFile(const std::string &fileName, Mode mode, const std::string
 		H5Pset_link_creation_order(fileCreationProperty, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED);
 		_IRIC_LOGGER_TRACE_CALL_END("H5Pset_link_creation_order");
 
-		impl->m_fileId = H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, fileCreationProperty, H5P_DEFAULT);
+		int ier = accessProfile.setupCreationProperty(fileCreationProperty);
+		if (ier != IRIC_NO_ERROR) {
+			_iric_logger_error("H5CgnsFile::H5CgnsFile", "H5FileAccessProfile::setupCreationProperty", ier);
+			delete impl;
+			std::ostringstream ss;
+			ss << "Creating " << fileName << " failed.";
+			throw std::runtime_error(ss.str());
+		}
+
+		impl->m_fileId = H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, fileCreationProperty, fileAccessProperty);
 		if (impl->m_fileId >= 0) {
 			_initCgnsFile(impl->m_fileId);
 			auto iricBase = impl->createBase(2);
@@ -66,11 +80,7 @@ H5CgnsFile::H5CgnsFile(const std::string &fileName, Mode mode, const std::string
 			impl->m_ccBase = iricBase;
 		}
 	} else {
-		unsigned int flags = H5F_ACC_RDWR;
-		if (mode == Mode::OpenReadOnly) {
-			flags = H5F_ACC_RDONLY;
-		}
-		impl->m_fileId = H5Fopen(fileName.c_str(), flags, H5P_DEFAULT);
+		impl->m_fileId = impl->openFile();
 
 		if (impl->m_fileId >= 0) {
 			impl->open();
@@ -96,13 +106,10 @@ H5CgnsFile::~H5CgnsFile()
 
 int H5CgnsFile::open()
 {
-	unsigned int flags = H5F_ACC_RDWR;
-	if (impl->m_mode == Mode::OpenReadOnly) {
-		flags = H5F_ACC_RDONLY;
-	}
-	impl->m_fileId = H5Fopen(impl->m_fileName.c_str(), flags, H5P_DEFAULT);
+	impl->m_fileId = impl->openFile();
 
 	if (impl->m_fileId >= 0) {
+		H5Util::setStoragePolicy(impl->m_fileId, impl->m_storagePolicy);
 		return impl->open();
 	} else {
 		return IRIC_H5_OPEN_FAIL;
@@ -115,6 +122,37 @@ int H5CgnsFile::close()
 	RETURN_IF_ERR;
 
 	impl->m_fileId = 0;
+	impl->m_swmrWriting = false;
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsFile::refresh()
+{
+	if (impl->m_mode != Mode::OpenReadOnly) {
+		return IRIC_WRONG_FILEMODE;
+	}
+
+	// the solution reader detects the mode again, because solution files may have been added
+	int cacheCapacity = 1;
+	bool prefetchEnabled = false;
+	bool hadReader = (impl->m_solutionReader != nullptr);
+	if (hadReader) {
+		cacheCapacity = impl->m_solutionReader->cacheCapacity();
+		prefetchEnabled = impl->m_solutionReader->prefetchEnabled();
+		delete impl->m_solutionReader;
+		impl->m_solutionReader = nullptr;
+	}
+
+	int ier = close();
+	RETURN_IF_ERR;
+
+	ier = open();
+	RETURN_IF_ERR;
+
+	if (hadReader) {
+		solutionReader()->setCacheCapacity(cacheCapacity);
+		solutionReader()->setPrefetchEnabled(prefetchEnabled);
+	}
 	return IRIC_NO_ERROR;
 }
 
@@ -203,7 +241,8 @@ int H5CgnsFile::deleteResult()
 
 	auto tmpFName = ss.str();
 
-	H5CgnsFile tmpFile(tmpFName, Mode::Create);
+	H5CgnsFile tmpFile(tmpFName, Mode::Create, impl->m_resultFolder, impl->m_swmr, impl->m_accessProfile);
+	tmpFile.setStoragePolicy(impl->m_storagePolicy);
 
 	copyExceptSolution(&tmpFile);
 
@@ -296,6 +335,34 @@ int H5CgnsFile::copyGridsTo(H5CgnsFile* target)
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsFile::linkGridsTo(H5CgnsFile* target, const std::string& fileName)
+{
+	for (auto base : impl->m_bases) {
+		auto base2 = target->base(base->dimension());
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsBase::linkGridsTo");
+		int ier = base->linkGridsTo(base2, fileName);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsBase::linkGridsTo", ier);
+		RETURN_IF_ERR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsFile::copySolutionTo(H5CgnsFile* target)
+{
+	for (auto base : impl->m_bases) {
+		auto base2 = target->base(base->dimension());
+		if (base2 == nullptr) {continue;}
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsBase::copySolutionTo");
+		int ier = base->copySolutionTo(base2);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsBase::copySolutionTo", ier);
+		RETURN_IF_ERR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsFile::flush()
 {
 	for (auto base : impl->m_bases) {
@@ -315,6 +382,85 @@ int H5CgnsFile::flush()
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsFile::buildParticleGroupTrajectoryIndex()
+{
+	if (impl->m_mode == Mode::OpenReadOnly) {return IRIC_NO_ERROR;}
+
+	for (auto base : impl->m_bases) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsBase::buildParticleGroupTrajectoryIndex");
+		int ier = base->buildParticleGroupTrajectoryIndex();
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsBase::buildParticleGroupTrajectoryIndex", ier);
+		RETURN_IF_ERR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+bool H5CgnsFile::swmrCapable() const
+{
+	H5F_info2_t info;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Fget_info2");
+	herr_t status = H5Fget_info2(impl->m_fileId, &info);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Fget_info2");
+	if (status < 0) {
+		_iric_logger_error("H5CgnsFile::swmrCapable", "H5Fget_info2", status);
+		return false;
+	}
+
+	// SWMR needs superblock version 3, that is written only when the file is created in the latest file format
+	return info.super.version >= 3;
+}
+
+bool H5CgnsFile::swmrWriting() const
+{
+	return impl->m_swmrWriting;
+}
+
+int H5CgnsFile::setupSwmrWrite()
+{
+	if (impl->m_mode == Mode::OpenReadOnly) {
+		return IRIC_WRONG_FILEMODE;
+	}
+
+	impl->m_swmr = true;
+	if (! swmrCapable()) {
+		// rewrite the file in the latest file format. results are removed, like cg_iRIC_Clear_Sol()
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::deleteResult");
+		int ier = deleteResult();
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::deleteResult", ier);
+		return ier;
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Fset_libver_bounds");
+	herr_t status = H5Fset_libver_bounds(impl->m_fileId, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Fset_libver_bounds");
+	if (status < 0) {
+		_iric_logger_error("H5CgnsFile::setupSwmrWrite", "H5Fset_libver_bounds", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsFile::startSwmrWrite()
+{
+	if (impl->m_swmrWriting) {return IRIC_NO_ERROR;}
+
+	int ier = flush();
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Fstart_swmr_write");
+	herr_t status = H5Fstart_swmr_write(impl->m_fileId);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Fstart_swmr_write");
+	if (status < 0) {
+		_iric_logger_error("H5CgnsFile::startSwmrWrite", "H5Fstart_swmr_write", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	impl->m_swmrWriting = true;
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsFile::getGridId(H5CgnsZone* zone, int* gridId)
 {
 	return impl->getGridId(zone, gridId);
@@ -343,7 +489,64 @@ H5CgnsFileSolutionWriter* H5CgnsFile::solutionWriter()
 	return impl->m_solutionWriter;
 }
 
+int H5CgnsFile::waitForAsyncWrites()
+{
+	if (impl->m_solutionWriter == nullptr) {return IRIC_NO_ERROR;}
+
+	return impl->m_solutionWriter->waitForAsyncWrites();
+}
+
+void H5CgnsFile::drainAsyncWrites()
+{
+	if (impl->m_solutionWriter == nullptr) {return;}
+
+	impl->m_solutionWriter->drainAsyncWrites();
+}
+
 void H5CgnsFile::setWriterMode(H5CgnsFileSolutionWriter::Mode mode)
 {
 	impl->m_writerMode = mode;
 }
+
+const H5DatasetStoragePolicy& H5CgnsFile::storagePolicy() const
+{
+	return impl->m_storagePolicy;
+}
+
+void H5CgnsFile::setStoragePolicy(const H5DatasetStoragePolicy& policy)
+{
+	impl->m_storagePolicy = policy;
+	if (impl->m_fileId > 0) {
+		H5Util::setStoragePolicy(impl->m_fileId, policy);
+	}
+}
+
+const H5FileAccessProfile& H5CgnsFile::accessProfile() const
+{
+	return impl->m_accessProfile;
+}
+
+void H5CgnsFile::setAccessProfile(const H5FileAccessProfile& profile)
+{
+	impl->m_accessProfile = profile;
+}
+
+const std::string& H5CgnsFile::particleGroupTrajectoryIdName() const
+{
+	return impl->m_particleGroupTrajectoryIdName;
+}
+
+void H5CgnsFile::setParticleGroupTrajectoryIdName(const std::string& name)
+{
+	impl->m_particleGroupTrajectoryIdName = name;
+}
+
+int H5CgnsFile::particleBinLevel() const
+{
+	return impl->m_particleBinLevel;
+}
+
+void H5CgnsFile::setParticleBinLevel(int level)
+{
+	impl->m_particleBinLevel = level;
+}
@@ -2,6 +2,8 @@
 #define H5CGNSFILE_H
 
 #include "h5cgnsfilesolutionwriter.h"
+#include "h5datasetstoragepolicy.h"
+#include "h5fileaccessprofile.h"
 #include "iriclib_global.h"
 
 #include <string>
@@ -22,11 +24,14 @@ public:
 		OpenReadOnly
 	};
 
-	H5CgnsFile(const std::string& fileName, Mode mode, const std::string& resultFolder = "result");
+	// when swmr is true, files are created in the latest file format so that they can be written
+	// in SWMR (single writer / multiple readers) mode, and read-only files are opened for SWMR reading
+	H5CgnsFile(const std::string& fileName, Mode mode, const std::string& resultFolder = "result", bool swmr = false, const H5FileAccessProfile& accessProfile = H5FileAccessProfile());
 	~H5CgnsFile();
 
 	int open();
 	int close();
+	int refresh(); // reopens a read-only file, to read data appended by the writer
 
 	Mode mode() const;
 	std::string fileName() const;
@@ -56,16 +61,47 @@ public:
 	int setSolutionId(int solutionId);
 
 	int copyGridsTo(H5CgnsFile* target);
+	// creates zones in target that refer to the grids in fileName, that has the grids copied with copyGridsTo()
+	int linkGridsTo(H5CgnsFile* target, const std::string& fileName);
+	int copySolutionTo(H5CgnsFile* target);
 	int flush();
+	// builds the index of the particle group trajectories written after the last build.
+	// The index is rebuilt from all steps, so it is built once, when the file is closed by cg_iRIC_Close().
+	int buildParticleGroupTrajectoryIndex();
+
+	bool swmrCapable() const;
+	bool swmrWriting() const;
+	int setupSwmrWrite();
+	int startSwmrWrite();
 
 	int getGridId(H5CgnsZone* zone, int* gridId);
 	int lastGridId(int* id);
 
 	H5CgnsFileSolutionReader* solutionReader();
 	H5CgnsFileSolutionWriter* solutionWriter();
+	// waits for the solution writes done in the background thread, if the writer exists
+	int waitForAsyncWrites();
+	// same as waitForAsyncWrites(), but keeps the error of the writes for the next call on this file
+	void drainAsyncWrites();
 
 	void setWriterMode(H5CgnsFileSolutionWriter::Mode mode);
 
+	const H5DatasetStoragePolicy& storagePolicy() const;
+	void setStoragePolicy(const H5DatasetStoragePolicy& policy);
+
+	// the profile is applied when the file is opened next time, by open() or refresh()
+	const H5FileAccessProfile& accessProfile() const;
+	void setAccessProfile(const H5FileAccessProfile& profile);
+
+	// when not empty, particle group solutions are written to H5CgnsParticleGroupTrajectories of the zones,
+	// with the integer value with this name as the particle ids
+	const std::string& particleGroupTrajectoryIdName() const;
+	void setParticleGroupTrajectoryIdName(const std::string& name);
+
+	// when larger than 0, particles are sorted into 2^level x 2^level spatial bins when written (see H5ParticleBins)
+	int particleBinLevel() const;
+	void setParticleBinLevel(int level);
+
 private:
 	class Impl;
 	Impl* impl;
@@ -3,18 +3,332 @@
 #include "h5cgnsbaseiterativedata.h"
 #include "h5cgnsfile.h"
 #include "h5cgnsfileseparatesolutionutil.h"
+#include "h5cgnsflowsolution.h"
+#include "h5cgnszone.h"
+#include "h5datasetcloser.h"
+#include "h5dataspacecloser.h"
+#include "h5datatypecloser.h"
+#include "h5propertylistcloser.h"
 #include "iriclib_errorcodes.h"
 #include "internal/iric_logger.h"
 
 #include <Poco/File.h>
+#include <Poco/FileStream.h>
 #include <Poco/Path.h>
 
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <sstream>
-#include <stdexcept>
+#include <thread>
+#include <vector>
 
 using namespace iRICLib;
 
 #define BACKUP_FILENAME "Case1_input.cgn"
+#define SHAREDGRID_FILENAME "Grid.cgn"
+#define SOLUTIONINDEX_FILENAME "SolutionIndex.h5"
+#define STEPCOUNT_ATTRIBUTE "StepCount"
+
+namespace {
+
+const int PREFETCH_FILES = 4;
+const std::streamsize PREFETCH_BUFFER_SIZE = 1024 * 1024;
+
+// Reads result files ahead of the HDF5 calls in a background thread, so that
+// disk reads overlap with copying. HDF5 is only called from the caller's thread,
+// because the library is not guaranteed to be built thread-safe; this thread
+// only pulls the files into the OS cache.
+class ResultFilePrefetcher
+{
+public:
+	ResultFilePrefetcher(const std::string& resultFolder, int count) :
+		m_resultFolder {resultFolder},
+		m_count {count},
+		m_consumed {0},
+		m_stop {false},
+		m_thread {&ResultFilePrefetcher::run, this}
+	{}
+
+	~ResultFilePrefetcher()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_condition.notify_all();
+		m_thread.join();
+	}
+
+	void setConsumed(int id)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_consumed = id;
+		}
+		m_condition.notify_all();
+	}
+
+private:
+	void run()
+	{
+		for (int id = 1; id <= m_count; ++id) {
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this, id] {return m_stop || id <= m_consumed + PREFETCH_FILES;});
+				if (m_stop) {return;}
+			}
+
+			auto fName = H5CgnsFileSeparateSolutionUtil::fileNameForSolution(m_resultFolder, id);
+			H5CgnsFileSeparateSolutionUtil::readAhead(fName);
+		}
+	}
+
+	std::string m_resultFolder;
+	int m_count;
+	int m_consumed;
+	bool m_stop;
+
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::thread m_thread;
+};
+
+// solution variable, that is mapped from solution files to a virtual dataset in the index file
+struct IndexVariable {
+	std::string indexPath;
+	std::string sourcePath;
+	std::vector<hsize_t> sourceDims;
+	bool isInt;
+};
+
+std::string objectPath(hid_t objectId)
+{
+	ssize_t len = H5Iget_name(objectId, nullptr, 0);
+	if (len <= 0) {return "";}
+
+	std::vector<char> buffer(len + 1);
+	H5Iget_name(objectId, buffer.data(), buffer.size());
+	return buffer.data();
+}
+
+std::string solutionPrefix(H5CgnsZone::SolutionPosition pos)
+{
+	switch (pos) {
+	case H5CgnsZone::SolutionPosition::Node:
+		return "FlowSolution";
+	case H5CgnsZone::SolutionPosition::Cell:
+		return "FlowCellSolution";
+	case H5CgnsZone::SolutionPosition::IFace:
+		return "FlowIFaceSolution";
+	case H5CgnsZone::SolutionPosition::JFace:
+		return "FlowJFaceSolution";
+	case H5CgnsZone::SolutionPosition::KFace:
+		return "FlowKFaceSolution";
+	default:
+		return "";
+	}
+}
+
+int collectIndexVariables(H5CgnsFile* solFile, std::vector<IndexVariable>* vars)
+{
+	std::vector<H5CgnsZone::SolutionPosition> positions;
+	positions.push_back(H5CgnsZone::SolutionPosition::Node);
+	positions.push_back(H5CgnsZone::SolutionPosition::Cell);
+	positions.push_back(H5CgnsZone::SolutionPosition::IFace);
+	positions.push_back(H5CgnsZone::SolutionPosition::JFace);
+	positions.push_back(H5CgnsZone::SolutionPosition::KFace);
+
+	int ier = solFile->setSolutionId(1);
+	RETURN_IF_ERR;
+
+	for (int i = 0; i < solFile->baseNum(); ++i) {
+		auto base = solFile->baseById(i + 1);
+		for (int j = 0; j < base->zoneNum(); ++j) {
+			auto zone = base->zoneById(j + 1);
+			auto zonePath = objectPath(zone->groupId());
+
+			for (auto pos : positions) {
+				if (! zone->solutionExists(pos)) {continue;}
+
+				auto sol = zone->solution(pos);
+				std::vector<std::string> names;
+				ier = sol->readValueNames(&names);
+				RETURN_IF_ERR;
+
+				for (const auto& name : names) {
+					auto dataName = sol->name() + "/" + name + "/ data";
+					hid_t dataSetId = H5Dopen2(zone->groupId(), dataName.c_str(), H5P_DEFAULT);
+					if (dataSetId < 0) {continue;}
+					H5DatasetCloser dataSetCloser(dataSetId);
+
+					hid_t dataTypeId = H5Dget_type(dataSetId);
+					H5DataTypeCloser dataTypeCloser(dataTypeId);
+					auto typeClass = H5Tget_class(dataTypeId);
+					if (typeClass != H5T_INTEGER && typeClass != H5T_FLOAT) {continue;}
+
+					hid_t dataSpaceId = H5Dget_space(dataSetId);
+					H5DataSpaceCloser dataSpaceCloser(dataSpaceId);
+
+					IndexVariable v;
+					v.indexPath = "/" + base->name() + "/" + zone->name() + "/" + solutionPrefix(pos) + "/" + name;
+					v.sourcePath = zonePath + "/" + dataName;
+					v.sourceDims.assign(H5Sget_simple_extent_ndims(dataSpaceId), 0);
+					H5Sget_simple_extent_dims(dataSpaceId, v.sourceDims.data(), nullptr);
+					v.isInt = (typeClass == H5T_INTEGER);
+
+					vars->push_back(v);
+				}
+			}
+		}
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int writeIndexVariable(hid_t fileId, const IndexVariable& v, int stepCount, hid_t linkCreationProperty)
+{
+	hsize_t count = 1;
+	for (auto d : v.sourceDims) {
+		count *= d;
+	}
+
+	hsize_t dims[2] = {static_cast<hsize_t> (stepCount), count};
+	hid_t virtualSpaceId = H5Screate_simple(2, dims, nullptr);
+	H5DataSpaceCloser virtualSpaceCloser(virtualSpaceId);
+
+	hid_t sourceSpaceId = H5Screate_simple(static_cast<int> (v.sourceDims.size()), v.sourceDims.data(), nullptr);
+	H5DataSpaceCloser sourceSpaceCloser(sourceSpaceId);
+
+	hid_t dataSetCreationProperty = H5Pcreate(H5P_DATASET_CREATE);
+	H5PropertyListCloser dataSetCreationPropertyCloser(dataSetCreationProperty);
+
+	hid_t dataType;
+	if (v.isInt) {
+		dataType = H5T_NATIVE_INT;
+	} else {
+		// steps without the variable are read as NaN
+		dataType = H5T_NATIVE_DOUBLE;
+		double fill = std::numeric_limits<double>::quiet_NaN();
+		H5Pset_fill_value(dataSetCreationProperty, dataType, &fill);
+	}
+
+	for (int step = 1; step <= stepCount; ++step) {
+		hsize_t start[2] = {static_cast<hsize_t> (step - 1), 0};
+		hsize_t block[2] = {1, count};
+		H5Sselect_hyperslab(virtualSpaceId, H5S_SELECT_SET, start, nullptr, block, nullptr);
+
+		// solution files are referred to with names relative to the index file
+		auto solFileName = Poco::Path(H5CgnsFileSeparateSolutionUtil::fileNameForSolution("", step)).getFileName();
+		herr_t status = H5Pset_virtual(dataSetCreationProperty, virtualSpaceId, solFileName.c_str(), v.sourcePath.c_str(), sourceSpaceId);
+		if (status < 0) {
+			_iric_logger_error("H5CgnsFileSeparateSolutionUtil::updateSolutionIndex", "H5Pset_virtual", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+	H5Sselect_all(virtualSpaceId);
+
+	hid_t dataSetId = H5Dcreate2(fileId, v.indexPath.c_str(), dataType, virtualSpaceId, linkCreationProperty, dataSetCreationProperty, H5P_DEFAULT);
+	if (dataSetId < 0) {
+		_iric_logger_error("H5CgnsFileSeparateSolutionUtil::updateSolutionIndex", "H5Dcreate2", dataSetId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DatasetCloser dataSetCloser(dataSetId);
+
+	return IRIC_NO_ERROR;
+}
+
+template <typename V>
+int writeIndexValues(hid_t fileId, const std::string& name, const std::vector<V>& values, int stepCount, hid_t dataType)
+{
+	if (values.size() == 0) {return IRIC_NO_ERROR;}
+
+	hsize_t dims = (std::min)(values.size(), static_cast<size_t> (stepCount));
+	hid_t dataSpaceId = H5Screate_simple(1, &dims, nullptr);
+	H5DataSpaceCloser dataSpaceCloser(dataSpaceId);
+
+	hid_t dataSetId = H5Dcreate2(fileId, name.c_str(), dataType, dataSpaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+	if (dataSetId < 0) {
+		_iric_logger_error("H5CgnsFileSeparateSolutionUtil::updateSolutionIndex", "H5Dcreate2", dataSetId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DatasetCloser dataSetCloser(dataSetId);
+
+	herr_t status = H5Dwrite(dataSetId, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data());
+	if (status < 0) {
+		_iric_logger_error("H5CgnsFileSeparateSolutionUtil::updateSolutionIndex", "H5Dwrite", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int writeIndexContents(hid_t fileId, H5CgnsFile* file, int stepCount, const std::vector<IndexVariable>& vars)
+{
+	hid_t linkCreationProperty = H5Pcreate(H5P_LINK_CREATE);
+	H5PropertyListCloser linkCreationPropertyCloser(linkCreationProperty);
+	H5Pset_create_intermediate_group(linkCreationProperty, 1);
+
+	int ier;
+	for (const auto& v : vars) {
+		ier = writeIndexVariable(fileId, v, stepCount, linkCreationProperty);
+		RETURN_IF_ERR;
+	}
+
+	std::vector<double> times;
+	std::vector<int> iterations;
+	auto biterData = file->ccBase()->biterData();
+	if (biterData != nullptr) {
+		biterData->readTime(&times);
+		biterData->readIteration(&iterations);
+	}
+	ier = writeIndexValues(fileId, "TimeValues", times, stepCount, H5T_NATIVE_DOUBLE);
+	RETURN_IF_ERR;
+	ier = writeIndexValues(fileId, "IterationValues", iterations, stepCount, H5T_NATIVE_INT);
+	RETURN_IF_ERR;
+
+	// written last, so that an index that was not completed is rebuilt next time
+	hid_t attSpaceId = H5Screate(H5S_SCALAR);
+	H5DataSpaceCloser attSpaceCloser(attSpaceId);
+	hid_t attId = H5Acreate2(fileId, STEPCOUNT_ATTRIBUTE, H5T_NATIVE_INT, attSpaceId, H5P_DEFAULT, H5P_DEFAULT);
+	if (attId < 0) {
+		_iric_logger_error("H5CgnsFileSeparateSolutionUtil::updateSolutionIndex", "H5Acreate2", attId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	herr_t status = H5Awrite(attId, H5T_NATIVE_INT, &stepCount);
+	H5Aclose(attId);
+	if (status < 0) {
+		_iric_logger_error("H5CgnsFileSeparateSolutionUtil::updateSolutionIndex", "H5Awrite", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int readIndexStepCount(const std::string& indexName, int* stepCount)
+{
+	*stepCount = 0;
+
+	Poco::File f(indexName);
+	if (! f.exists()) {return IRIC_NO_ERROR;}
+
+	hid_t fileId = H5Fopen(indexName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+	if (fileId < 0) {return IRIC_NO_ERROR;}
+
+	if (H5Aexists(fileId, STEPCOUNT_ATTRIBUTE) > 0) {
+		hid_t attId = H5Aopen(fileId, STEPCOUNT_ATTRIBUTE, H5P_DEFAULT);
+		if (attId >= 0) {
+			H5Aread(attId, H5T_NATIVE_INT, stepCount);
+			H5Aclose(attId);
+		}
+	}
+	H5Fclose(fileId);
+
+	return IRIC_NO_ERROR;
+}
+
+} // namespace
 
 int H5CgnsFileSeparateSolutionUtil::createResultFolderIfNotExists(const std::string& fileName)
 {
@@ -133,8 +447,134 @@ int H5CgnsFileSeparateSolutionUtil::rebuildBaseIterativeData(const std::string&
 
 int H5CgnsFileSeparateSolutionUtil::buildFromSeparateResultFiles(const std::string& fileName)
 {
-	// @todo implement this
-	throw std::runtime_error("Not implemented");
+	try {
+		H5CgnsFile file(fileName, H5CgnsFile::Mode::OpenModify);
+		int progress;
+		return combineSolutions(&file, &progress);
+	} catch (...) {
+		std::ostringstream ss;
+		ss << "In H5CgnsFileSeparateSolutionUtil::buildFromSeparateResultFiles(), opening " << fileName << " failed";
+		_iric_logger_error(ss.str());
+		return IRIC_H5_OPEN_FAIL;
+	}
+}
+
+int H5CgnsFileSeparateSolutionUtil::combineSolutions(H5CgnsFile* file, int* progress)
+{
+	*progress = 0;
+
+	if (file->mode() == H5CgnsFile::Mode::OpenReadOnly) {
+		return IRIC_WRONG_FILEMODE;
+	}
+
+	auto folder = file->resultFolder();
+	int count;
+	int ier = getMaxSeparateResultSolutionId(folder, &count);
+	RETURN_IF_ERR;
+
+	if (count == 0) {
+		*progress = 100;
+		return IRIC_NO_ERROR;
+	}
+
+	for (int i = 0; i < file->baseNum(); ++i) {
+		auto base = file->baseById(i + 1);
+		for (int j = 0; j < base->zoneNum(); ++j) {
+			_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::deleteAllResults");
+			ier = base->zoneById(j + 1)->deleteAllResults();
+			_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::deleteAllResults", ier);
+			RETURN_IF_ERR;
+		}
+	}
+
+	ResultFilePrefetcher prefetcher(folder, count);
+
+	for (int id = 1; id <= count; ++id) {
+		auto fName = fileNameForSolution(folder, id);
+		H5CgnsFile* resultFile = nullptr;
+		try {
+			resultFile = new H5CgnsFile(fName, H5CgnsFile::Mode::OpenReadOnly);
+		} catch (...) {
+			std::ostringstream ss;
+			ss << "In H5CgnsFileSeparateSolutionUtil::combineSolutions(), opening " << fName << " failed";
+			_iric_logger_error(ss.str());
+			return IRIC_H5_OPEN_FAIL;
+		}
+
+		ier = resultFile->setSolutionId(1);
+		if (ier == IRIC_NO_ERROR) {
+			ier = file->setSolutionId(id);
+		}
+		if (ier == IRIC_NO_ERROR) {
+			_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::copySolutionTo");
+			ier = resultFile->copySolutionTo(file);
+			_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::copySolutionTo", ier);
+		}
+		delete resultFile;
+		RETURN_IF_ERR;
+
+		prefetcher.setConsumed(id);
+		*progress = static_cast<int> ((100LL * id) / (count + 1));
+	}
+
+	// pointers in ZoneIterativeData are written for the last solution id
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::flush");
+	ier = file->flush();
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::flush", ier);
+	RETURN_IF_ERR;
+
+	*progress = 100;
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsFileSeparateSolutionUtil::updateSolutionIndex(H5CgnsFile* file, int* stepCount)
+{
+	auto folder = file->resultFolder();
+	int ier = getMaxSeparateResultSolutionId(folder, stepCount);
+	RETURN_IF_ERR;
+
+	if (*stepCount == 0) {return IRIC_NO_ERROR;}
+
+	auto indexName = solutionIndexFileName(folder);
+	int indexedCount;
+	ier = readIndexStepCount(indexName, &indexedCount);
+	RETURN_IF_ERR;
+
+	if (indexedCount == *stepCount) {return IRIC_NO_ERROR;}
+
+	// variables are taken from the last solution. Steps that do not have them are read as fill values.
+	std::vector<IndexVariable> vars;
+	auto solFileName = fileNameForSolution(folder, *stepCount);
+	try {
+		H5CgnsFile solFile(solFileName, H5CgnsFile::Mode::OpenReadOnly);
+		ier = collectIndexVariables(&solFile, &vars);
+		RETURN_IF_ERR;
+	} catch (...) {
+		std::ostringstream ss;
+		ss << "In H5CgnsFileSeparateSolutionUtil::updateSolutionIndex(), opening " << solFileName << " failed";
+		_iric_logger_error(ss.str());
+		return IRIC_H5_OPEN_FAIL;
+	}
+
+	// only the mappings are written, so the index is written again instead of being modified
+	hid_t fileId = H5Fcreate(indexName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+	if (fileId < 0) {
+		std::ostringstream ss;
+		ss << "In H5CgnsFileSeparateSolutionUtil::updateSolutionIndex(), creating " << indexName << " failed";
+		_iric_logger_error(ss.str());
+		return IRIC_H5_CREATE_FAIL;
+	}
+
+	ier = writeIndexContents(fileId, file, *stepCount, vars);
+	H5Fclose(fileId);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+std::string H5CgnsFileSeparateSolutionUtil::solutionIndexFileName(const std::string& resultFolder)
+{
+	return Poco::Path(resultFolder).append(SOLUTIONINDEX_FILENAME).toString();
 }
 
 int H5CgnsFileSeparateSolutionUtil::clearResultFolder(const std::string& fileName)
@@ -163,6 +603,22 @@ std::string H5CgnsFileSeparateSolutionUtil::fileNameForSolution(const std::strin
 	return Poco::Path(resultFolder).append(solFileName).toString();
 }
 
+std::string H5CgnsFileSeparateSolutionUtil::sharedGridFileName()
+{
+	return SHAREDGRID_FILENAME;
+}
+
+void H5CgnsFileSeparateSolutionUtil::readAhead(const std::string& fileName)
+{
+	std::vector<char> buffer(PREFETCH_BUFFER_SIZE);
+	try {
+		Poco::FileInputStream stream(fileName, std::ios::in | std::ios::binary);
+		while (stream.read(buffer.data(), PREFETCH_BUFFER_SIZE)) {}
+	} catch (...) {
+		// errors are reported when the file is opened with HDF5
+	}
+}
+
 int H5CgnsFileSeparateSolutionUtil::getMaxSeparateResultSolutionId(const std::string& fileName, int* solutionId)
 {
 	int prevMaxExistId = 0;
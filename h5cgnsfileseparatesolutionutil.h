@@ -7,6 +7,8 @@
 
 namespace iRICLib {
 
+class H5CgnsFile;
+
 class IRICLIBDLL H5CgnsFileSeparateSolutionUtil
 {
 public:
@@ -21,10 +23,23 @@ public:
 	static int checkFileStatus(const std::string& fileName, Status* status);
 	static int rebuildBaseIterativeData(const std::string& fileName, int stepCount);
 	static int buildFromSeparateResultFiles(const std::string& fileName);
+	// copies solutions in result folder into file, as standard solutions.
+	// progress is updated while copying, from 0 to 100 (%).
+	static int combineSolutions(H5CgnsFile* file, int* progress);
+
+	// writes the index file in the result folder, that has a virtual dataset (step x value) for each
+	// solution variable. the datasets refer to the solution files, and no values are copied.
+	// the index is written again only when solutions were added after the last update.
+	static int updateSolutionIndex(H5CgnsFile* file, int* stepCount);
 
 	static int clearResultFolder(const std::string& fileName);
 
 	static std::string fileNameForSolution(const std::string& resultFolder, int solId);
+	// name of the file that holds the grids shared by solution files, relative to the result folder
+	static std::string sharedGridFileName();
+	static std::string solutionIndexFileName(const std::string& resultFolder);
+	// reads the whole file once, so that it is in the OS cache when HDF5 opens it
+	static void readAhead(const std::string& fileName);
 
 private:
 	static int getMaxSeparateResultSolutionId(const std::string& fileName, int* solutionId);
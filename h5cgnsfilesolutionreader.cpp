@@ -1,5 +1,7 @@
 #include "h5cgnsfilesolutionreader.h"
 
+#include <algorithm>
+
 #include "private/h5cgnsfilesolutionreader_impl.h"
 
 using namespace iRICLib;
@@ -40,3 +42,39 @@ H5CgnsFile* H5CgnsFileSolutionReader::targetFile() const
 		return impl->m_targetFile;
 	}
 }
+
+int H5CgnsFileSolutionReader::cacheCapacity() const
+{
+	return impl->m_cacheCapacity;
+}
+
+void H5CgnsFileSolutionReader::setCacheCapacity(int capacity)
+{
+	impl->m_cacheCapacity = (std::max)(1, capacity);
+	impl->shrinkCache();
+}
+
+bool H5CgnsFileSolutionReader::prefetchEnabled() const
+{
+	return impl->m_prefetchEnabled;
+}
+
+void H5CgnsFileSolutionReader::setPrefetchEnabled(bool enabled)
+{
+	impl->m_prefetchEnabled = enabled;
+}
+
+int H5CgnsFileSolutionReader::cacheHitCount() const
+{
+	return impl->m_cacheHitCount;
+}
+
+int H5CgnsFileSolutionReader::cacheMissCount() const
+{
+	return impl->m_cacheMissCount;
+}
+
+void H5CgnsFileSolutionReader::clearCache()
+{
+	impl->clearCache();
+}
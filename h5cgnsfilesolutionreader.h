@@ -25,6 +25,18 @@ public:
 
 	H5CgnsFile* targetFile() const;
 
+	// number of solution files kept open in separate mode
+	int cacheCapacity() const;
+	void setCacheCapacity(int capacity);
+
+	// when enabled, the file for the next solution is opened in background
+	bool prefetchEnabled() const;
+	void setPrefetchEnabled(bool enabled);
+
+	int cacheHitCount() const;
+	int cacheMissCount() const;
+	void clearCache();
+
 private:
 	class Impl;
 	Impl* impl;
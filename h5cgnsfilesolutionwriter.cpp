@@ -5,8 +5,12 @@
 
 #include "private/h5cgnsfilesolutionwriter_impl.h"
 
+#include "internal/iric_logger.h"
+
 #include <Poco/File.h>
 
+#include <hdf5.h>
+
 using namespace iRICLib;
 
 H5CgnsFileSolutionWriter::H5CgnsFileSolutionWriter(Mode mode, H5CgnsFile* file) :
@@ -21,34 +25,39 @@ H5CgnsFileSolutionWriter::~H5CgnsFileSolutionWriter()
 	delete impl;
 }
 
+H5CgnsFileSolutionWriter::Mode H5CgnsFileSolutionWriter::mode() const
+{
+	return impl->m_mode;
+}
+
 int H5CgnsFileSolutionWriter::writeSolStart()
 {
-	return impl->writeSolStart();
+	return impl->writeAsync([this] {return impl->writeSolStart();});
 }
 
 int H5CgnsFileSolutionWriter::writeTime(double time)
 {
-	return impl->writeTime(time);
+	return impl->writeAsync([this, time] {return impl->writeTime(time);});
 }
 
 int H5CgnsFileSolutionWriter::writeIteration(int iteration)
 {
-	return impl->writeIteration(iteration);
+	return impl->writeAsync([this, iteration] {return impl->writeIteration(iteration);});
 }
 
 int H5CgnsFileSolutionWriter::writeBaseIterativeData(const std::string& name, int value)
 {
-	return impl->writeBaseIterativeData(name, value);
+	return impl->writeAsync([this, name, value] {return impl->writeBaseIterativeData(name, value);});
 }
 
 int H5CgnsFileSolutionWriter::writeBaseIterativeData(const std::string& name, double value)
 {
-	return impl->writeBaseIterativeData(name, value);
+	return impl->writeAsync([this, name, value] {return impl->writeBaseIterativeData(name, value);});
 }
 
 int H5CgnsFileSolutionWriter::writeBaseIterativeData(const std::string& name, const std::string value)
 {
-	return impl->writeBaseIterativeData(name, value);
+	return impl->writeAsync([this, name, value] {return impl->writeBaseIterativeData(name, value);});
 }
 
 H5CgnsFile* H5CgnsFileSolutionWriter::targetFile() const
@@ -60,12 +69,76 @@ H5CgnsFile* H5CgnsFileSolutionWriter::targetFile() const
 	}
 }
 
+int H5CgnsFileSolutionWriter::setAsyncQueueSize(int size)
+{
+	int ret = IRIC_NO_ERROR;
+	if (size > 0 && ! asyncWriteSupported()) {
+		_iric_logger_error("In H5CgnsFileSolutionWriter::setAsyncQueueSize(), the HDF5 library is not thread-safe. Solutions are written synchronously");
+		size = 0;
+		ret = IRIC_INVALID_ARGUMENT;
+	}
+	if (size != impl->m_asyncQueueSize) {
+		impl->stopAsyncThread();
+		impl->m_asyncQueueSize = size;
+	}
+	return ret;
+}
+
+int H5CgnsFileSolutionWriter::asyncQueueSize() const
+{
+	return impl->m_asyncQueueSize;
+}
+
+int H5CgnsFileSolutionWriter::asyncMaxQueueDepth() const
+{
+	std::lock_guard<std::mutex> lock(impl->m_asyncMutex);
+	return impl->m_asyncMaxQueueDepth;
+}
+
+double H5CgnsFileSolutionWriter::asyncStallSeconds() const
+{
+	std::lock_guard<std::mutex> lock(impl->m_asyncMutex);
+	return impl->m_asyncStallSeconds;
+}
+
+int H5CgnsFileSolutionWriter::writeAsync(const std::function<int()>& task)
+{
+	return impl->writeAsync(task);
+}
+
+int H5CgnsFileSolutionWriter::waitForAsyncWrites()
+{
+	return impl->waitForAsyncWrites();
+}
+
+void H5CgnsFileSolutionWriter::drainAsyncWrites()
+{
+	impl->drainAsyncWrites();
+}
+
+bool H5CgnsFileSolutionWriter::asyncWriteSupported()
+{
+	hbool_t threadSafe = false;
+	_IRIC_LOGGER_TRACE_CALL_START("H5is_library_threadsafe");
+	herr_t status = H5is_library_threadsafe(&threadSafe);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5is_library_threadsafe", status);
+
+	return status >= 0 && threadSafe;
+}
+
 int H5CgnsFileSolutionWriter::flush()
 {
+	int ier = impl->waitForAsyncWrites();
+	RETURN_IF_ERR;
+
+	if (impl->m_mode == Mode::SeparateSwmr) {
+		return impl->flushSwmr();
+	}
+
 	delete impl->m_targetFile;
 	impl->m_targetFile = nullptr;
 
-	int ier = impl->m_file->flush();
+	ier = impl->m_file->flush();
 	RETURN_IF_ERR;
 
 	ier = impl->m_file->close();
@@ -96,6 +169,8 @@ int H5CgnsFileSolutionWriter::flush()
 
 int H5CgnsFileSolutionWriter::close()
 {
+	impl->stopAsyncThread();
+
 	Poco::File tmpFile(impl->m_file->tmpFileName());
 	if (tmpFile.exists()) {
 		try {
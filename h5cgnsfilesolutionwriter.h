@@ -3,6 +3,7 @@
 
 #include "iriclib_global.h"
 
+#include <functional>
 #include <string>
 
 namespace iRICLib {
@@ -15,11 +16,19 @@ public:
 	enum Mode {
 		Standard,
 		Separate,
+		// solutions are written to separate files, and the main file is written in SWMR mode,
+		// so that it can be read while the solver runs
+		SeparateSwmr,
+		// solutions are written to separate files, that refer to the grids in one shared grid file
+		// with external links, instead of having copies of them
+		SeparateSharedGrid,
 	};
 
 	H5CgnsFileSolutionWriter(Mode mode, H5CgnsFile* file);
 	~H5CgnsFileSolutionWriter();
 
+	Mode mode() const;
+
 	int writeSolStart();
 	int writeTime(double time);
 	int writeIteration(int iteration);
@@ -30,6 +39,26 @@ public:
 
 	H5CgnsFile* targetFile() const;
 
+	// When size is larger than 0, writes are done in order by a background thread, and
+	// the caller waits only when size writes are already queued. 0 means synchronous writing (default).
+	// The background thread is not used unless the HDF5 library is thread-safe: IRIC_INVALID_ARGUMENT is
+	// returned for size larger than 0 then, and solutions are written synchronously.
+	int setAsyncQueueSize(int size);
+	int asyncQueueSize() const;
+	int asyncMaxQueueDepth() const;
+	double asyncStallSeconds() const;
+
+	// task is run in the background thread, so it should own copies of the data it writes.
+	// returns the error of a background write done before, if any.
+	int writeAsync(const std::function<int()>& task);
+	// waits until all queued writes finish, and returns the first error of them.
+	int waitForAsyncWrites();
+	// waits until all queued writes finish. The error of them is kept, and returned by the next call.
+	void drainAsyncWrites();
+
+	// true when the HDF5 library is built thread-safe, so that it can be called from the background thread
+	static bool asyncWriteSupported();
+
 	int flush();
 	int close();
 
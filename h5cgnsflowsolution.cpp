@@ -11,6 +11,31 @@
 
 using namespace iRICLib;
 
+namespace {
+
+// start, stride and count are in (i, j, k) order, and they are reversed to fit the data array
+template <typename V>
+int readValueRegionT(hid_t groupId, const std::string& name, std::vector<hsize_t> dims, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, V* values)
+{
+	if (start.size() != dims.size() || stride.size() != dims.size() || count.size() != dims.size()) {
+		_iric_logger_error("In H5CgnsFlowSolution::readValueRegion(), the region dimension does not match the grid dimension");
+		return IRIC_WRONG_DATASIZE;
+	}
+	std::reverse(dims.begin(), dims.end());
+	std::vector<hsize_t> start2(start.rbegin(), start.rend());
+	std::vector<hsize_t> stride2(stride.rbegin(), stride.rend());
+	std::vector<hsize_t> count2(count.rbegin(), count.rend());
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValueRegion");
+	int ier = H5Util::readDataArrayValueRegion(groupId, name, dims, start2, stride2, count2, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValueRegion", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+} // namespace
+
 #define LABEL "FlowSolution_t"
 
 int H5CgnsFlowSolution::Impl::loadNames()
@@ -99,6 +124,19 @@ int H5CgnsFlowSolution::readValue(const std::string& name, std::vector<int>* val
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsFlowSolution::readValue(const std::string& name, int* values, size_t count) const
+{
+	int ier = impl->checkNameExists(name);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	ier = H5Util::readDataArrayValue(impl->m_groupId, name, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsFlowSolution::readValue(const std::string& name, std::vector<double>* values) const
 {
 	int ier = impl->checkNameExists(name);
@@ -112,6 +150,69 @@ int H5CgnsFlowSolution::readValue(const std::string& name, std::vector<double>*
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsFlowSolution::readValue(const std::string& name, double* values, size_t count) const
+{
+	int ier = impl->checkNameExists(name);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	ier = H5Util::readDataArrayValue(impl->m_groupId, name, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsFlowSolution::readValuePoints(const std::string& name, const std::vector<hsize_t>& indices, int* values) const
+{
+	int ier = impl->checkNameExists(name);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValuePoints");
+	ier = H5Util::readDataArrayValuePoints(impl->m_groupId, name, indices, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValuePoints", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsFlowSolution::readValuePoints(const std::string& name, const std::vector<hsize_t>& indices, double* values) const
+{
+	int ier = impl->checkNameExists(name);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValuePoints");
+	ier = H5Util::readDataArrayValuePoints(impl->m_groupId, name, indices, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValuePoints", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsFlowSolution::readValueRegion(const std::string& name, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, int* values) const
+{
+	int ier = impl->checkNameExists(name);
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> dims;
+	ier = dataDims(&dims);
+	RETURN_IF_ERR;
+
+	return readValueRegionT(impl->m_groupId, name, dims, start, stride, count, values);
+}
+
+int H5CgnsFlowSolution::readValueRegion(const std::string& name, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const
+{
+	int ier = impl->checkNameExists(name);
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> dims;
+	ier = dataDims(&dims);
+	RETURN_IF_ERR;
+
+	return readValueRegionT(impl->m_groupId, name, dims, start, stride, count, values);
+}
+
 int H5CgnsFlowSolution::readValueAsDouble(const std::string& name, std::vector<double>* values) const
 {
 	int ier = impl->checkNameExists(name);
@@ -137,13 +238,16 @@ int H5CgnsFlowSolution::readValueAsDouble(const std::string& name, std::vector<d
 }
 
 int H5CgnsFlowSolution::writeValue(const std::string& name, const std::vector<int>& values) const
+{
+	return writeValue(name, values.data(), values.size());
+}
+
+int H5CgnsFlowSolution::writeValue(const std::string& name, const int* values, size_t count) const
 {
 	std::vector<hsize_t> dims;
-	int ier = dataDims(&dims);
+	int ier = writeDims(count, &dims);
 	RETURN_IF_ERR;
 
-	std::reverse(dims.begin(), dims.end());
-
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
 	ier = H5Util::createDataArray(impl->m_groupId, name, values, dims);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
@@ -155,13 +259,16 @@ int H5CgnsFlowSolution::writeValue(const std::string& name, const std::vector<in
 }
 
 int H5CgnsFlowSolution::writeValue(const std::string& name, const std::vector<double>& values) const
+{
+	return writeValue(name, values.data(), values.size());
+}
+
+int H5CgnsFlowSolution::writeValue(const std::string& name, const double* values, size_t count) const
 {
 	std::vector<hsize_t> dims;
-	int ier = dataDims(&dims);
+	int ier = writeDims(count, &dims);
 	RETURN_IF_ERR;
 
-	std::reverse(dims.begin(), dims.end());
-
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
 	ier = H5Util::createDataArray(impl->m_groupId, name, values, dims);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
@@ -176,3 +283,22 @@ H5CgnsZone* H5CgnsFlowSolution::zone() const
 {
 	return impl->m_zone;
 }
+
+int H5CgnsFlowSolution::writeDims(size_t count, std::vector<hsize_t>* dims) const
+{
+	int ier = dataDims(dims);
+	RETURN_IF_ERR;
+
+	std::reverse(dims->begin(), dims->end());
+
+	hsize_t size = 1;
+	for (hsize_t d : *dims) {
+		size *= d;
+	}
+	if (count < size) {
+		_iric_logger_error("In H5CgnsFlowSolution::writeDims(), count is smaller than the solution size");
+		return IRIC_WRONG_DATASIZE;
+	}
+
+	return IRIC_NO_ERROR;
+}
@@ -29,14 +29,24 @@ public:
 	int readValueType(const std::string& name, H5Util::DataArrayValueType *type) const override;
 	int readValue(const std::string& name, std::vector<int>* values) const override;
 	int readValue(const std::string& name, std::vector<double>* values) const override;
+	int readValue(const std::string& name, int* values, size_t count) const;
+	int readValue(const std::string& name, double* values, size_t count) const;
+	int readValuePoints(const std::string& name, const std::vector<hsize_t>& indices, int* values) const;
+	int readValuePoints(const std::string& name, const std::vector<hsize_t>& indices, double* values) const;
+	// reads the values in a region of a structured grid. start, stride and count are in (i, j, k) order.
+	int readValueRegion(const std::string& name, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, int* values) const;
+	int readValueRegion(const std::string& name, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const;
 	int readValueAsDouble(const std::string& name, std::vector<double>* values) const override;
 	int writeValue(const std::string& name, const std::vector<int>& values) const;
 	int writeValue(const std::string& name, const std::vector<double>& values) const;
+	int writeValue(const std::string& name, const int* values, size_t count) const;
+	int writeValue(const std::string& name, const double* values, size_t count) const;
 
 	H5CgnsZone* zone() const override;
 
 private:
 	virtual int dataDims(std::vector<hsize_t>* dims) const = 0;
+	int writeDims(size_t count, std::vector<hsize_t>* dims) const;
 
 	class Impl;
 	Impl* impl;
@@ -41,24 +41,33 @@ std::string dimensionValueName(int dimId)
 	return ss.str();
 }
 
-template <typename V>
-int readDataArray(hid_t groupId, const std::string& name, const std::string& valName, std::vector<V>* values)
+int openDataArrayGroup(hid_t groupId, const std::string& name, const std::string& valName, hid_t* gId)
 {
-	hid_t gId;
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::openGroup");
-	int ier = H5Util::openGroup(groupId, name, H5Util::userDefinedDataLabel(), &gId);
+	int ier = H5Util::openGroup(groupId, name, H5Util::userDefinedDataLabel(), gId);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::openGroup", ier);
 	RETURN_IF_ERR;
 
-	H5GroupCloser closer(gId);
-
 	std::unordered_set<std::string> tmp_names;
 
-	H5Util::getGroupNames(gId, &tmp_names);
+	H5Util::getGroupNames(*gId, &tmp_names);
 	if (tmp_names.find(valName) == tmp_names.end()) {
+		H5Gclose(*gId);
 		return  IRIC_DATA_NOT_FOUND;
 	}
 
+	return IRIC_NO_ERROR;
+}
+
+template <typename V>
+int readDataArray(hid_t groupId, const std::string& name, const std::string& valName, std::vector<V>* values)
+{
+	hid_t gId;
+	int ier = openDataArrayGroup(groupId, name, valName, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
 	ier = H5Util::readDataArrayValue(gId, valName, values);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
@@ -68,7 +77,24 @@ int readDataArray(hid_t groupId, const std::string& name, const std::string& val
 }
 
 template <typename V>
-int createDataArray(hid_t groupId, const std::string& name, const std::string& valName, const std::vector<V>& values)
+int readDataArray(hid_t groupId, const std::string& name, const std::string& valName, V* values, size_t count)
+{
+	hid_t gId;
+	int ier = openDataArrayGroup(groupId, name, valName, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	ier = H5Util::readDataArrayValue(gId, valName, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+template <typename V>
+int createDataArray(hid_t groupId, const std::string& name, const std::string& valName, const V* values, size_t count)
 {
 	hid_t gId;
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::openOrCreateUserDefinedDataGroup");
@@ -79,7 +105,7 @@ int createDataArray(hid_t groupId, const std::string& name, const std::string& v
 	H5GroupCloser closer(gId);
 
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
-	ier = H5Util::createDataArray(gId, valName, values);
+	ier = H5Util::createDataArray(gId, valName, values, count);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
 	RETURN_IF_ERR;
 
@@ -87,7 +113,7 @@ int createDataArray(hid_t groupId, const std::string& name, const std::string& v
 }
 
 template <typename V>
-int updateDataArray(hid_t groupId, const std::string& name, const std::string& valName, const std::vector<V>& values)
+int updateDataArray(hid_t groupId, const std::string& name, const std::string& valName, const V* values, size_t count)
 {
 	hid_t gId;
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::openOrCreateUserDefinedDataGroup");
@@ -98,7 +124,7 @@ int updateDataArray(hid_t groupId, const std::string& name, const std::string& v
 	H5GroupCloser closer(gId);
 
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
-	ier = H5Util::createDataArray(gId, valName, values);
+	ier = H5Util::createDataArray(gId, valName, values, count);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
 	RETURN_IF_ERR;
 
@@ -106,19 +132,25 @@ int updateDataArray(hid_t groupId, const std::string& name, const std::string& v
 }
 
 template <typename V>
-int updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::string& valName, const std::vector<V>& values, std::unordered_set<std::string>* names)
+int updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::string& valName, const V* values, size_t count, std::unordered_set<std::string>* names)
 {
 	if (names->find(name) == names->end()) {
-		int ier = createDataArray(groupId, name, valName, values);
+		int ier = createDataArray(groupId, name, valName, values, count);
 		RETURN_IF_ERR;
 		names->insert(name);
 	} else {
-		int ier = updateDataArray(groupId, name, valName, values);
+		int ier = updateDataArray(groupId, name, valName, values, count);
 		RETURN_IF_ERR;
 	}
 	return IRIC_NO_ERROR;
 }
 
+template <typename V>
+int updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::string& valName, const std::vector<V>& values, std::unordered_set<std::string>* names)
+{
+	return updateOrCreateDataArray(groupId, name, valName, values.data(), values.size(), names);
+}
+
 } // namespace
 
 H5CgnsGridAttributes::H5CgnsGridAttributes(hid_t groupId, H5CgnsZone* zone) :
@@ -182,6 +214,13 @@ int H5CgnsGridAttributes::readValue(const std::string& name, std::vector<int>* v
 	return readDataArray(impl->m_groupId, name, "Value", values);
 }
 
+int H5CgnsGridAttributes::readValue(const std::string& name, int* values, size_t count) const
+{
+	CHECK_NAME_EXISTS;
+
+	return readDataArray(impl->m_groupId, name, "Value", values, count);
+}
+
 int H5CgnsGridAttributes::readValue(const std::string& name, std::vector<double>* values) const
 {
 	CHECK_NAME_EXISTS;
@@ -189,6 +228,13 @@ int H5CgnsGridAttributes::readValue(const std::string& name, std::vector<double>
 	return readDataArray(impl->m_groupId, name, "Value", values);
 }
 
+int H5CgnsGridAttributes::readValue(const std::string& name, double* values, size_t count) const
+{
+	CHECK_NAME_EXISTS;
+
+	return readDataArray(impl->m_groupId, name, "Value", values, count);
+}
+
 int H5CgnsGridAttributes::readFunctionalDimensionSize(const std::string& name, const std::string& dimname, int* size) const
 {
 	CHECK_NAME_EXISTS;
@@ -255,6 +301,14 @@ int H5CgnsGridAttributes::writeValue(const std::string& name, const std::vector<
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsGridAttributes::writeValue(const std::string& name, const int* values, size_t count) const
+{
+	int ier = updateOrCreateDataArray(impl->m_groupId, name, "Value", values, count, &(impl->m_names));
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsGridAttributes::writeValue(const std::string& name, const std::vector<double>& values) const
 {
 	int ier = updateOrCreateDataArray(impl->m_groupId, name, "Value", values, &(impl->m_names));
@@ -263,6 +317,14 @@ int H5CgnsGridAttributes::writeValue(const std::string& name, const std::vector<
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsGridAttributes::writeValue(const std::string& name, const double* values, size_t count) const
+{
+	int ier = updateOrCreateDataArray(impl->m_groupId, name, "Value", values, count, &(impl->m_names));
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsGridAttributes::writeFunctionalDimension(const std::string& name, const std::string& dimname, const std::vector<int>& values) const
 {
 	if (values.size() == 0) {return IRIC_NO_ERROR;}
@@ -24,6 +24,8 @@ public:
 	int getValueType(const std::string& name, H5Util::DataArrayValueType *type) const;
 	int readValue(const std::string& name, std::vector<int>* values) const;
 	int readValue(const std::string& name, std::vector<double>* values) const;
+	int readValue(const std::string& name, int* values, size_t count) const;
+	int readValue(const std::string& name, double* values, size_t count) const;
 
 	int readFunctionalDimensionSize(const std::string& name, const std::string& dimname, int* size) const;
 	int readFunctionalDimension(const std::string& name, const std::string& dimname, std::vector<int>* values) const;
@@ -33,6 +35,8 @@ public:
 
 	int writeValue(const std::string& name, const std::vector<int>& values) const;
 	int writeValue(const std::string& name, const std::vector<double>& values) const;
+	int writeValue(const std::string& name, const int* values, size_t count) const;
+	int writeValue(const std::string& name, const double* values, size_t count) const;
 
 	int writeFunctionalDimension(const std::string& name, const std::string& dimname, const std::vector<int>& values) const;
 	int writeFunctionalDimension(const std::string& name, const std::string& dimname, const std::vector<double>& values) const;
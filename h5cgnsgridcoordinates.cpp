@@ -51,6 +51,11 @@ int H5CgnsGridCoordinates::readCoordinatesX(std::vector<double>* values) const
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsGridCoordinates::readCoordinatesX(double* values, size_t count) const
+{
+	return impl->readCoordinates("CoordinateX", values, count);
+}
+
 int H5CgnsGridCoordinates::readCoordinatesY(std::vector<double>* values) const
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
@@ -66,6 +71,11 @@ int H5CgnsGridCoordinates::readCoordinatesY(std::vector<double>* values) const
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsGridCoordinates::readCoordinatesY(double* values, size_t count) const
+{
+	return impl->readCoordinates("CoordinateY", values, count);
+}
+
 int H5CgnsGridCoordinates::readCoordinatesZ(std::vector<double>* values) const
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
@@ -81,34 +91,54 @@ int H5CgnsGridCoordinates::readCoordinatesZ(std::vector<double>* values) const
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsGridCoordinates::readCoordinatesZ(double* values, size_t count) const
+{
+	return impl->readCoordinates("CoordinateZ", values, count);
+}
+
+int H5CgnsGridCoordinates::readCoordinatesXRegion(const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const
+{
+	return impl->readCoordinatesRegion("CoordinateX", start, stride, count, values);
+}
+
+int H5CgnsGridCoordinates::readCoordinatesYRegion(const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const
+{
+	return impl->readCoordinatesRegion("CoordinateY", start, stride, count, values);
+}
+
+int H5CgnsGridCoordinates::readCoordinatesZRegion(const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const
+{
+	return impl->readCoordinatesRegion("CoordinateZ", start, stride, count, values);
+}
+
 int H5CgnsGridCoordinates::writeCoordinatesX(const std::vector<double>& coords) const
 {
-	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
-	int ier = H5Util::createDataArray(impl->m_groupId, "CoordinateX", coords, impl->dimensions());
-	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
-	RETURN_IF_ERR;
+	return impl->writeCoordinates("CoordinateX", coords.data(), coords.size());
+}
 
-	return IRIC_NO_ERROR;
+int H5CgnsGridCoordinates::writeCoordinatesX(const double* coords, size_t count) const
+{
+	return impl->writeCoordinates("CoordinateX", coords, count);
 }
 
 int H5CgnsGridCoordinates::writeCoordinatesY(const std::vector<double>& coords) const
 {
-	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
-	int ier = H5Util::createDataArray(impl->m_groupId, "CoordinateY", coords, impl->dimensions());
-	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
-	RETURN_IF_ERR;
+	return impl->writeCoordinates("CoordinateY", coords.data(), coords.size());
+}
 
-	return IRIC_NO_ERROR;
+int H5CgnsGridCoordinates::writeCoordinatesY(const double* coords, size_t count) const
+{
+	return impl->writeCoordinates("CoordinateY", coords, count);
 }
 
 int H5CgnsGridCoordinates::writeCoordinatesZ(const std::vector<double>& coords) const
 {
-	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
-	int ier = H5Util::createDataArray(impl->m_groupId, "CoordinateZ", coords, impl->dimensions());
-	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
-	RETURN_IF_ERR;
+	return impl->writeCoordinates("CoordinateZ", coords.data(), coords.size());
+}
 
-	return IRIC_NO_ERROR;
+int H5CgnsGridCoordinates::writeCoordinatesZ(const double* coords, size_t count) const
+{
+	return impl->writeCoordinates("CoordinateZ", coords, count);
 }
 
 int H5CgnsGridCoordinates::copyTo(H5CgnsGridCoordinates* coords)
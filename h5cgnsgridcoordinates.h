@@ -25,10 +25,20 @@ public:
 	int readCoordinatesX(std::vector<double>* values) const;
 	int readCoordinatesY(std::vector<double>* values) const;
 	int readCoordinatesZ(std::vector<double>* values) const;
+	int readCoordinatesX(double* values, size_t count) const;
+	int readCoordinatesY(double* values, size_t count) const;
+	int readCoordinatesZ(double* values, size_t count) const;
+	// reads the nodes in a region of a structured grid. start, stride and count are in (i, j, k) order.
+	int readCoordinatesXRegion(const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const;
+	int readCoordinatesYRegion(const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const;
+	int readCoordinatesZRegion(const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const;
 
 	int writeCoordinatesX(const std::vector<double>& coords) const;
 	int writeCoordinatesY(const std::vector<double>& coords) const;
 	int writeCoordinatesZ(const std::vector<double>& coords) const;
+	int writeCoordinatesX(const double* coords, size_t count) const;
+	int writeCoordinatesY(const double* coords, size_t count) const;
+	int writeCoordinatesZ(const double* coords, size_t count) const;
 
 	int copyTo(H5CgnsGridCoordinates* coords);
 
@@ -176,6 +176,14 @@ void H5CgnsParticleGroupImageSolution::writePos2d(double x, double y, double siz
 	impl->m_angle.push_back(angle);
 }
 
+void H5CgnsParticleGroupImageSolution::writePos2d(const double* x, const double* y, const double* size, const double* angle, size_t count)
+{
+	impl->m_coordinateX.insert(impl->m_coordinateX.end(), x, x + count);
+	impl->m_coordinateY.insert(impl->m_coordinateY.end(), y, y + count);
+	impl->m_size.insert(impl->m_size.end(), size, size + count);
+	impl->m_angle.insert(impl->m_angle.end(), angle, angle + count);
+}
+
 H5CgnsZone* H5CgnsParticleGroupImageSolution::zone() const
 {
 	return impl->m_zone;
@@ -31,6 +31,7 @@ public:
 	void writeBegin(const std::string& groupName);
 	int writeEnd();
 	void writePos2d(double x, double y, double size, double angle);
+	void writePos2d(const double* x, const double* y, const double* size, const double* angle, size_t count);
 
 	H5CgnsZone* zone() const;
 
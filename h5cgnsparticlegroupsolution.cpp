@@ -1,5 +1,10 @@
 #include "error_macros.h"
+#include "h5cgnsbase.h"
+#include "h5cgnsfile.h"
 #include "h5cgnsparticlegroupsolution.h"
+#include "h5cgnsparticlegrouptrajectories.h"
+#include "h5cgnszone.h"
+#include "h5particlebins.h"
 #include "iriclib_errorcodes.h"
 
 #include "internal/iric_logger.h"
@@ -7,10 +12,23 @@
 #include "private/h5cgnsparticlegroupsolution_impl.h"
 #include "public/h5cgnsparticlegroupsolution_groupreader.h"
 
+#include <algorithm>
 #include <sstream>
 
 using namespace iRICLib;
 
+namespace {
+
+template <typename V>
+void pickRows(const std::vector<V>& allValues, const std::vector<hsize_t>& rows, V* values)
+{
+	for (size_t i = 0; i < rows.size(); ++i) {
+		values[i] = allValues.at(rows[i]);
+	}
+}
+
+} // namespace
+
 H5CgnsParticleGroupSolution::H5CgnsParticleGroupSolution(const std::string& name, hid_t groupId, H5CgnsZone* zone) :
 	impl {new Impl {}}
 {
@@ -57,11 +75,30 @@ int H5CgnsParticleGroupSolution::readGroupNames(std::vector<std::string>* names)
 		names->push_back(name.substr(0, offset));
 	}
 
+	if (! impl->m_zone->particleGroupTrajectoriesExists()) {return IRIC_NO_ERROR;}
+
+	auto t = impl->m_zone->particleGroupTrajectories();
+	if (t == nullptr) {return IRIC_NO_ERROR;}
+
+	std::vector<std::string> trajectoryNames;
+	ier = t->readGroupNames(&trajectoryNames);
+	RETURN_IF_ERR;
+
+	for (const auto& name : trajectoryNames) {
+		if (! t->stepExists(name, impl->m_zone->solutionId())) {continue;}
+		if (std::find(names->begin(), names->end(), name) != names->end()) {continue;}
+
+		names->push_back(name);
+	}
+
 	return IRIC_NO_ERROR;
 }
 
 int H5CgnsParticleGroupSolution::count(const std::string& groupName, int* count)
 {
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {return t->count(groupName, impl->m_zone->solutionId(), count);}
+
 	std::ostringstream ss;
 	ss << groupName << "_coordinateX";
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayLength");
@@ -74,6 +111,9 @@ int H5CgnsParticleGroupSolution::count(const std::string& groupName, int* count)
 
 int H5CgnsParticleGroupSolution::readValueNames(const std::string& groupName, std::vector<std::string>* names) const
 {
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {return t->readValueNames(groupName, names);}
+
 	std::ostringstream ss;
 	ss << groupName << "__";
 	auto prefix = ss.str();
@@ -110,6 +150,16 @@ int H5CgnsParticleGroupSolution::readValueNames(const std::string& groupName, st
 
 int H5CgnsParticleGroupSolution::readCoordinatesX(const std::string& groupName, std::vector<double>* values) const
 {
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {
+		int count;
+		int ier = t->count(groupName, impl->m_zone->solutionId(), &count);
+		RETURN_IF_ERR;
+
+		values->assign(count, 0);
+		return t->readCoordinatesX(groupName, impl->m_zone->solutionId(), values->data(), count);
+	}
+
 	std::ostringstream ss;
 	ss << groupName << "_coordinateX";
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
@@ -120,8 +170,33 @@ int H5CgnsParticleGroupSolution::readCoordinatesX(const std::string& groupName,
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleGroupSolution::readCoordinatesX(const std::string& groupName, double* values, size_t count) const
+{
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {return t->readCoordinatesX(groupName, impl->m_zone->solutionId(), values, count);}
+
+	std::ostringstream ss;
+	ss << groupName << "_coordinateX";
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleGroupSolution::readCoordinatesY(const std::string& groupName, std::vector<double>* values) const
 {
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {
+		int count;
+		int ier = t->count(groupName, impl->m_zone->solutionId(), &count);
+		RETURN_IF_ERR;
+
+		values->assign(count, 0);
+		return t->readCoordinatesY(groupName, impl->m_zone->solutionId(), values->data(), count);
+	}
+
 	std::ostringstream ss;
 	ss << groupName << "_coordinateY";
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
@@ -132,8 +207,33 @@ int H5CgnsParticleGroupSolution::readCoordinatesY(const std::string& groupName,
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleGroupSolution::readCoordinatesY(const std::string& groupName, double* values, size_t count) const
+{
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {return t->readCoordinatesY(groupName, impl->m_zone->solutionId(), values, count);}
+
+	std::ostringstream ss;
+	ss << groupName << "_coordinateY";
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleGroupSolution::readCoordinatesZ(const std::string& groupName, std::vector<double>* values) const
 {
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {
+		int count;
+		int ier = t->count(groupName, impl->m_zone->solutionId(), &count);
+		RETURN_IF_ERR;
+
+		values->assign(count, 0);
+		return t->readCoordinatesZ(groupName, impl->m_zone->solutionId(), values->data(), count);
+	}
+
 	std::ostringstream ss;
 	ss << groupName << "_coordinateZ";
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
@@ -144,8 +244,26 @@ int H5CgnsParticleGroupSolution::readCoordinatesZ(const std::string& groupName,
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleGroupSolution::readCoordinatesZ(const std::string& groupName, double* values, size_t count) const
+{
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {return t->readCoordinatesZ(groupName, impl->m_zone->solutionId(), values, count);}
+
+	std::ostringstream ss;
+	ss << groupName << "_coordinateZ";
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleGroupSolution::readValueType(const std::string& groupName, const std::string& valueName, H5Util::DataArrayValueType *type) const
 {
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {return t->readValueType(groupName, valueName, type);}
+
 	std::ostringstream ss;
 	ss << groupName << "__" << valueName;
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValueType");
@@ -158,6 +276,16 @@ int H5CgnsParticleGroupSolution::readValueType(const std::string& groupName, con
 
 int H5CgnsParticleGroupSolution::readValue(const std::string& groupName, const std::string& valueName, std::vector<int>* values) const
 {
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {
+		int count;
+		int ier = t->count(groupName, impl->m_zone->solutionId(), &count);
+		RETURN_IF_ERR;
+
+		values->assign(count, 0);
+		return t->readValue(groupName, impl->m_zone->solutionId(), valueName, values->data(), count);
+	}
+
 	std::ostringstream ss;
 	ss << groupName << "__" << valueName;
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
@@ -168,8 +296,33 @@ int H5CgnsParticleGroupSolution::readValue(const std::string& groupName, const s
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleGroupSolution::readValue(const std::string& groupName, const std::string& valueName, int* values, size_t count) const
+{
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {return t->readValue(groupName, impl->m_zone->solutionId(), valueName, values, count);}
+
+	std::ostringstream ss;
+	ss << groupName << "__" << valueName;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleGroupSolution::readValue(const std::string& groupName, const std::string& valueName, std::vector<double>* values) const
 {
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {
+		int count;
+		int ier = t->count(groupName, impl->m_zone->solutionId(), &count);
+		RETURN_IF_ERR;
+
+		values->assign(count, 0);
+		return t->readValue(groupName, impl->m_zone->solutionId(), valueName, values->data(), count);
+	}
+
 	std::ostringstream ss;
 	ss << groupName << "__" << valueName;
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
@@ -180,6 +333,21 @@ int H5CgnsParticleGroupSolution::readValue(const std::string& groupName, const s
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleGroupSolution::readValue(const std::string& groupName, const std::string& valueName, double* values, size_t count) const
+{
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {return t->readValue(groupName, impl->m_zone->solutionId(), valueName, values, count);}
+
+	std::ostringstream ss;
+	ss << groupName << "__" << valueName;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleGroupSolution::readValueAsDouble(const std::string& groupName, const std::string& valueName, std::vector<double>* values) const
 {
 	H5Util::DataArrayValueType type;
@@ -201,6 +369,102 @@ int H5CgnsParticleGroupSolution::readValueAsDouble(const std::string& groupName,
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleGroupSolution::findRowsInRect(const std::string& groupName, double xmin, double xmax, double ymin, double ymax, std::vector<hsize_t>* rows) const
+{
+	auto t = impl->trajectories(groupName);
+	if (t != nullptr) {
+		// groups stored in trajectories are not sorted into bins
+		std::vector<double> x, y;
+		int ier = readCoordinatesX(groupName, &x);
+		RETURN_IF_ERR;
+		ier = readCoordinatesY(groupName, &y);
+		RETURN_IF_ERR;
+
+		rows->clear();
+		for (size_t i = 0; i < x.size() && i < y.size(); ++i) {
+			if (x[i] >= xmin && x[i] <= xmax && y[i] >= ymin && y[i] <= ymax) {rows->push_back(i);}
+		}
+		return IRIC_NO_ERROR;
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5ParticleBins::findRows");
+	int ier = H5ParticleBins::findRows(impl->m_groupId, groupName + "_coordinate", groupName + "_coordinateX", groupName + "_coordinateY", xmin, xmax, ymin, ymax, rows);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5ParticleBins::findRows", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupSolution::readCoordinatesX(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const
+{
+	if (impl->trajectories(groupName) != nullptr) {
+		std::vector<double> allValues;
+		int ier = readCoordinatesX(groupName, &allValues);
+		RETURN_IF_ERR;
+
+		pickRows(allValues, rows, values);
+		return IRIC_NO_ERROR;
+	}
+
+	return readRows(groupName + "_coordinateX", rows, values);
+}
+
+int H5CgnsParticleGroupSolution::readCoordinatesY(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const
+{
+	if (impl->trajectories(groupName) != nullptr) {
+		std::vector<double> allValues;
+		int ier = readCoordinatesY(groupName, &allValues);
+		RETURN_IF_ERR;
+
+		pickRows(allValues, rows, values);
+		return IRIC_NO_ERROR;
+	}
+
+	return readRows(groupName + "_coordinateY", rows, values);
+}
+
+int H5CgnsParticleGroupSolution::readCoordinatesZ(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const
+{
+	if (impl->trajectories(groupName) != nullptr) {
+		std::vector<double> allValues;
+		int ier = readCoordinatesZ(groupName, &allValues);
+		RETURN_IF_ERR;
+
+		pickRows(allValues, rows, values);
+		return IRIC_NO_ERROR;
+	}
+
+	return readRows(groupName + "_coordinateZ", rows, values);
+}
+
+int H5CgnsParticleGroupSolution::readValue(const std::string& groupName, const std::string& valueName, const std::vector<hsize_t>& rows, int* values) const
+{
+	if (impl->trajectories(groupName) != nullptr) {
+		std::vector<int> allValues;
+		int ier = readValue(groupName, valueName, &allValues);
+		RETURN_IF_ERR;
+
+		pickRows(allValues, rows, values);
+		return IRIC_NO_ERROR;
+	}
+
+	return readRows(groupName + "__" + valueName, rows, values);
+}
+
+int H5CgnsParticleGroupSolution::readValue(const std::string& groupName, const std::string& valueName, const std::vector<hsize_t>& rows, double* values) const
+{
+	if (impl->trajectories(groupName) != nullptr) {
+		std::vector<double> allValues;
+		int ier = readValue(groupName, valueName, &allValues);
+		RETURN_IF_ERR;
+
+		pickRows(allValues, rows, values);
+		return IRIC_NO_ERROR;
+	}
+
+	return readRows(groupName + "__" + valueName, rows, values);
+}
+
 void H5CgnsParticleGroupSolution::writeBegin(const std::string& groupName)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleGroupSolution::Impl::clear");
@@ -215,6 +479,30 @@ int H5CgnsParticleGroupSolution::writeEnd()
 	std::ostringstream ss;
 	int ier;
 
+	const auto& idName = impl->m_zone->base()->file()->particleGroupTrajectoryIdName();
+	if (idName.size() > 0) {
+		auto t = impl->m_zone->particleGroupTrajectories();
+		if (t == nullptr) {
+			_iric_logger_error("In H5CgnsParticleGroupSolution::writeEnd(), opening trajectories failed");
+			return IRIC_H5_CALL_ERROR;
+		}
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleGroupTrajectories::writeStep");
+		ier = t->writeStep(impl->m_groupName, impl->m_zone->solutionId(), idName, impl->m_coordinateX, impl->m_coordinateY, impl->m_coordinateZ, impl->m_intValues, impl->m_realValues);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleGroupTrajectories::writeStep", ier);
+		RETURN_IF_ERR;
+
+		return IRIC_NO_ERROR;
+	}
+
+	int level = impl->m_zone->base()->file()->particleBinLevel();
+	if (level > 0) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleGroupSolution::Impl::writeBins");
+		ier = impl->writeBins(level);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleGroupSolution::Impl::writeBins", ier);
+		RETURN_IF_ERR;
+	}
+
 	// coordinateX
 	ss.str("");
 	ss << impl->m_groupName << "_coordinateX";
@@ -284,32 +572,37 @@ void H5CgnsParticleGroupSolution::writePos3d(double x, double y, double z)
 
 void H5CgnsParticleGroupSolution::writeValue(const std::string& name, int value)
 {
-	std::vector<int>* vals = nullptr;
-
-	auto it = impl->m_intValues.find(name);
-	if (it != impl->m_intValues.end()) {
-		vals = &(it->second);
-	} else {
-		std::vector<int> empty;
-		auto it2 = impl->m_intValues.insert({name, empty});
-		vals = &(it2.first->second);
-	}
-	vals->push_back(value);
+	impl->intValues(name)->push_back(value);
 }
 
 void H5CgnsParticleGroupSolution::writeValue(const std::string& name, double value)
 {
-	std::vector<double>* vals = nullptr;
+	impl->realValues(name)->push_back(value);
+}
 
-	auto it = impl->m_realValues.find(name);
-	if (it != impl->m_realValues.end()) {
-		vals = &(it->second);
-	} else {
-		std::vector<double> empty;
-		auto it2 = impl->m_realValues.insert({name, empty});
-		vals = &(it2.first->second);
-	}
-	vals->push_back(value);
+void H5CgnsParticleGroupSolution::writePos2d(const double* x, const double* y, size_t count)
+{
+	impl->m_coordinateX.insert(impl->m_coordinateX.end(), x, x + count);
+	impl->m_coordinateY.insert(impl->m_coordinateY.end(), y, y + count);
+}
+
+void H5CgnsParticleGroupSolution::writePos3d(const double* x, const double* y, const double* z, size_t count)
+{
+	impl->m_coordinateX.insert(impl->m_coordinateX.end(), x, x + count);
+	impl->m_coordinateY.insert(impl->m_coordinateY.end(), y, y + count);
+	impl->m_coordinateZ.insert(impl->m_coordinateZ.end(), z, z + count);
+}
+
+void H5CgnsParticleGroupSolution::writeValue(const std::string& name, const int* values, size_t count)
+{
+	auto vals = impl->intValues(name);
+	vals->insert(vals->end(), values, values + count);
+}
+
+void H5CgnsParticleGroupSolution::writeValue(const std::string& name, const double* values, size_t count)
+{
+	auto vals = impl->realValues(name);
+	vals->insert(vals->end(), values, values + count);
 }
 
 H5CgnsZone* H5CgnsParticleGroupSolution::zone() const
@@ -317,6 +610,26 @@ H5CgnsZone* H5CgnsParticleGroupSolution::zone() const
 	return impl->m_zone;
 }
 
+int H5CgnsParticleGroupSolution::readRows(const std::string& arrayName, const std::vector<hsize_t>& rows, int* values) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5ParticleBins::readRows");
+	int ier = H5ParticleBins::readRows(impl->m_groupId, arrayName, rows, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5ParticleBins::readRows", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupSolution::readRows(const std::string& arrayName, const std::vector<hsize_t>& rows, double* values) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5ParticleBins::readRows");
+	int ier = H5ParticleBins::readRows(impl->m_groupId, arrayName, rows, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5ParticleBins::readRows", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 H5CgnsParticleGroupSolution::GroupReader H5CgnsParticleGroupSolution::groupReader(const std::string& name)
 {
 	return GroupReader(name, this);
@@ -26,19 +26,38 @@ public:
 	int readValueNames(const std::string& groupName, std::vector<std::string>* names) const;
 	int readValueNames(const std::string& groupName, std::unordered_set<std::string>* names) const;
 	int readCoordinatesX(const std::string& groupName, std::vector<double>* values) const;
+	int readCoordinatesX(const std::string& groupName, double* values, size_t count) const;
 	int readCoordinatesY(const std::string& groupName, std::vector<double>* values) const;
+	int readCoordinatesY(const std::string& groupName, double* values, size_t count) const;
 	int readCoordinatesZ(const std::string& groupName, std::vector<double>* values) const;
+	int readCoordinatesZ(const std::string& groupName, double* values, size_t count) const;
 	int readValueType(const std::string& groupName, const std::string& valueName, H5Util::DataArrayValueType *type) const;
 	int readValue(const std::string& groupName, const std::string& valueName, std::vector<int>* values) const;
+	int readValue(const std::string& groupName, const std::string& valueName, int* values, size_t count) const;
 	int readValue(const std::string& groupName, const std::string& valueName, std::vector<double>* values) const;
+	int readValue(const std::string& groupName, const std::string& valueName, double* values, size_t count) const;
 	int readValueAsDouble(const std::string& groupName, const std::string& valueName, std::vector<double>* values) const;
 
+	// finds the rows (in ascending order) of the particles of the group in the rectangle
+	int findRowsInRect(const std::string& groupName, double xmin, double xmax, double ymin, double ymax, std::vector<hsize_t>* rows) const;
+	// reads the values at rows found with findRowsInRect()
+	int readCoordinatesX(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const;
+	int readCoordinatesY(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const;
+	int readCoordinatesZ(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const;
+	int readValue(const std::string& groupName, const std::string& valueName, const std::vector<hsize_t>& rows, int* values) const;
+	int readValue(const std::string& groupName, const std::string& valueName, const std::vector<hsize_t>& rows, double* values) const;
+
 	void writeBegin(const std::string& groupName);
+	// writes the group. When H5CgnsFile::particleBinLevel() is larger than 0, the particles are sorted into spatial bins.
 	int writeEnd();
 	void writePos2d(double x, double y);
 	void writePos3d(double x, double y, double z);
 	void writeValue(const std::string& name, int value);
 	void writeValue(const std::string& name, double value);
+	void writePos2d(const double* x, const double* y, size_t count);
+	void writePos3d(const double* x, const double* y, const double* z, size_t count);
+	void writeValue(const std::string& name, const int* values, size_t count);
+	void writeValue(const std::string& name, const double* values, size_t count);
 
 	H5CgnsZone* zone() const;
 
@@ -46,6 +65,9 @@ public:
 	GroupReader groupReader(const std::string& name);
 
 private:
+	int readRows(const std::string& arrayName, const std::vector<hsize_t>& rows, int* values) const;
+	int readRows(const std::string& arrayName, const std::vector<hsize_t>& rows, double* values) const;
+
 	class Impl;
 	Impl* impl;
 };
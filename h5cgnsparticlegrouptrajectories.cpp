@@ -0,0 +1,333 @@
+#include "error_macros.h"
+#include "h5cgnsparticlegrouptrajectories.h"
+#include "iriclib_errorcodes.h"
+
+#include "internal/iric_logger.h"
+
+#include "private/h5cgnsparticlegrouptrajectories_impl.h"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace iRICLib;
+
+namespace {
+
+std::string valueName(const std::string& name)
+{
+	return std::string("__") + name;
+}
+
+} // namespace
+
+template <typename V>
+int H5CgnsParticleGroupTrajectories::Impl::readStep(const std::string& groupName, int step, const std::string& name, V* values, size_t count) const
+{
+	Group* g;
+	int ier = group(groupName, &g);
+	RETURN_IF_ERR;
+
+	int idx = g->stepIndex(step);
+	if (idx < 0) {
+		std::ostringstream ss;
+		ss << "In H5CgnsParticleGroupTrajectories, step " << step << " of " << groupName << " does not exist";
+		_iric_logger_error(ss.str());
+		return IRIC_DATA_NOT_FOUND;
+	}
+	hsize_t c = g->m_counts[idx];
+	if (c > count) {
+		std::ostringstream ss;
+		ss << "In H5CgnsParticleGroupTrajectories, the buffer size " << count << " is smaller than the particle count " << c;
+		_iric_logger_error(ss.str());
+		return IRIC_WRONG_DATASIZE;
+	}
+	if (c == 0) {return IRIC_NO_ERROR;}
+
+	std::vector<hsize_t> dims(1, g->rowCount()), start(1, g->m_starts[idx]), stride(1, 1), counts(1, c);
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValueRegion");
+	ier = H5Util::readDataArrayValueRegion(g->m_groupId, name, dims, start, stride, counts, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValueRegion", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+template <typename V>
+int H5CgnsParticleGroupTrajectories::Impl::readRows(const std::string& groupName, const std::string& name, const std::vector<hsize_t>& rows, V* values) const
+{
+	Group* g;
+	int ier = group(groupName, &g);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValuePoints");
+	ier = H5Util::readDataArrayValuePoints(g->m_groupId, name, rows, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValuePoints", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+H5CgnsParticleGroupTrajectories::H5CgnsParticleGroupTrajectories(hid_t groupId, H5CgnsZone* zone) :
+	impl {new Impl {}}
+{
+	impl->m_groupId = groupId;
+	impl->m_zone = zone;
+}
+
+H5CgnsParticleGroupTrajectories::~H5CgnsParticleGroupTrajectories()
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Gclose");
+	herr_t status = H5Gclose(impl->m_groupId);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Gclose");
+
+	if (status < 0) {
+		_iric_logger_error("H5CgnsParticleGroupTrajectories::~H5CgnsParticleGroupTrajectories", "H5Gclose", status);
+	}
+
+	delete impl;
+}
+
+int H5CgnsParticleGroupTrajectories::readGroupNames(std::vector<std::string>* names) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getLinkNames");
+	int ier = H5Util::getLinkNames(impl->m_groupId, names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getLinkNames", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+bool H5CgnsParticleGroupTrajectories::stepExists(const std::string& groupName, int step) const
+{
+	Impl::Group* g;
+	int ier = impl->group(groupName, &g);
+	if (ier != IRIC_NO_ERROR) {return false;}
+
+	return g->stepIndex(step) >= 0;
+}
+
+int H5CgnsParticleGroupTrajectories::readIdName(const std::string& groupName, std::string* name) const
+{
+	Impl::Group* g;
+	int ier = impl->group(groupName, &g);
+	RETURN_IF_ERR;
+
+	*name = g->m_idName;
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::count(const std::string& groupName, int step, int* count) const
+{
+	Impl::Group* g;
+	int ier = impl->group(groupName, &g);
+	RETURN_IF_ERR;
+
+	int idx = g->stepIndex(step);
+	if (idx < 0) {return IRIC_DATA_NOT_FOUND;}
+
+	*count = g->m_counts[idx];
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::readValueNames(const std::string& groupName, std::vector<std::string>* names) const
+{
+	Impl::Group* g;
+	int ier = impl->group(groupName, &g);
+	RETURN_IF_ERR;
+
+	std::vector<std::string> tmpNames;
+	ier = H5Util::getLinkNames(g->m_groupId, &tmpNames);
+	RETURN_IF_ERR;
+
+	for (const auto& name : tmpNames) {
+		if (name.substr(0, 2) != "__") {continue;}
+		names->push_back(name.substr(2));
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::readValueType(const std::string& groupName, const std::string& valueName, H5Util::DataArrayValueType* type) const
+{
+	Impl::Group* g;
+	int ier = impl->group(groupName, &g);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValueType");
+	ier = H5Util::readDataArrayValueType(g->m_groupId, ::valueName(valueName), type);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValueType", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::readCoordinatesX(const std::string& groupName, int step, double* values, size_t count) const
+{
+	return impl->readStep(groupName, step, "coordinateX", values, count);
+}
+
+int H5CgnsParticleGroupTrajectories::readCoordinatesY(const std::string& groupName, int step, double* values, size_t count) const
+{
+	return impl->readStep(groupName, step, "coordinateY", values, count);
+}
+
+int H5CgnsParticleGroupTrajectories::readCoordinatesZ(const std::string& groupName, int step, double* values, size_t count) const
+{
+	return impl->readStep(groupName, step, "coordinateZ", values, count);
+}
+
+int H5CgnsParticleGroupTrajectories::readValue(const std::string& groupName, int step, const std::string& valueName, int* values, size_t count) const
+{
+	return impl->readStep(groupName, step, ::valueName(valueName), values, count);
+}
+
+int H5CgnsParticleGroupTrajectories::readValue(const std::string& groupName, int step, const std::string& valueName, double* values, size_t count) const
+{
+	return impl->readStep(groupName, step, ::valueName(valueName), values, count);
+}
+
+int H5CgnsParticleGroupTrajectories::findRows(const std::string& groupName, const std::vector<int>& ids, int stepMin, int stepMax, std::vector<int>* foundIds, std::vector<int>* steps, std::vector<hsize_t>* rows) const
+{
+	Impl::Group* g;
+	int ier = impl->group(groupName, &g);
+	RETURN_IF_ERR;
+
+	// the range of the steps, in the steps written
+	size_t first = std::lower_bound(g->m_steps.begin(), g->m_steps.end(), stepMin) - g->m_steps.begin();
+	size_t last = std::upper_bound(g->m_steps.begin(), g->m_steps.end(), stepMax) - g->m_steps.begin();
+
+	struct Found {
+		size_t idIndex;
+		int step;
+		hsize_t row;
+	};
+	std::vector<Found> found;
+
+	// steps included in the index
+	size_t indexed = static_cast<size_t> (g->m_indexedSteps);
+	if (first < indexed && first < last) {
+		ier = g->loadIndex();
+		RETURN_IF_ERR;
+
+		std::vector<hsize_t> dims(1, g->m_indexStarts.back()), stride(1, 1);
+		std::vector<int> postingSteps, postingRows;
+		for (size_t i = 0; i < ids.size(); ++i) {
+			auto it = std::lower_bound(g->m_indexIds.begin(), g->m_indexIds.end(), ids[i]);
+			if (it == g->m_indexIds.end() || *it != ids[i]) {continue;}
+
+			size_t pos = it - g->m_indexIds.begin();
+			std::vector<hsize_t> start(1, g->m_indexStarts[pos]), count(1, g->m_indexStarts[pos + 1] - g->m_indexStarts[pos]);
+			postingSteps.assign(count[0], 0);
+			postingRows.assign(count[0], 0);
+			ier = H5Util::readDataArrayValueRegion(g->m_groupId, "IndexSteps", dims, start, stride, count, postingSteps.data());
+			RETURN_IF_ERR;
+			ier = H5Util::readDataArrayValueRegion(g->m_groupId, "IndexRows", dims, start, stride, count, postingRows.data());
+			RETURN_IF_ERR;
+
+			for (size_t j = 0; j < postingSteps.size(); ++j) {
+				int step = postingSteps[j];
+				if (step < stepMin || step > stepMax) {continue;}
+
+				int idx = g->stepIndex(step);
+				found.push_back(Found {i, step, g->m_starts[idx] + postingRows[j]});
+			}
+		}
+	}
+
+	// steps written after the index is built are searched one by one
+	std::vector<int> runIds, runRows;
+	for (size_t s = (std::max)(first, indexed); s < last; ++s) {
+		hsize_t c = g->m_counts[s];
+		if (c == 0) {continue;}
+
+		std::vector<hsize_t> dims(1, g->rowCount()), start(1, g->m_starts[s]), stride(1, 1), count(1, c);
+		runIds.assign(c, 0);
+		runRows.assign(c, 0);
+		ier = H5Util::readDataArrayValueRegion(g->m_groupId, "RunIds", dims, start, stride, count, runIds.data());
+		RETURN_IF_ERR;
+		ier = H5Util::readDataArrayValueRegion(g->m_groupId, "RunRows", dims, start, stride, count, runRows.data());
+		RETURN_IF_ERR;
+
+		for (size_t i = 0; i < ids.size(); ++i) {
+			auto range = std::equal_range(runIds.begin(), runIds.end(), ids[i]);
+			for (auto it = range.first; it != range.second; ++it) {
+				found.push_back(Found {i, g->m_steps[s], g->m_starts[s] + runRows[it - runIds.begin()]});
+			}
+		}
+	}
+
+	// the rows from the index come first, so sorting by id keeps them sorted by step
+	std::stable_sort(found.begin(), found.end(), [](const Found& a, const Found& b) {
+		return a.idIndex < b.idIndex;
+	});
+
+	foundIds->clear();
+	steps->clear();
+	rows->clear();
+	foundIds->reserve(found.size());
+	steps->reserve(found.size());
+	rows->reserve(found.size());
+	for (const auto& f : found) {
+		foundIds->push_back(ids[f.idIndex]);
+		steps->push_back(f.step);
+		rows->push_back(f.row);
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::readCoordinatesX(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const
+{
+	return impl->readRows(groupName, "coordinateX", rows, values);
+}
+
+int H5CgnsParticleGroupTrajectories::readCoordinatesY(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const
+{
+	return impl->readRows(groupName, "coordinateY", rows, values);
+}
+
+int H5CgnsParticleGroupTrajectories::readCoordinatesZ(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const
+{
+	return impl->readRows(groupName, "coordinateZ", rows, values);
+}
+
+int H5CgnsParticleGroupTrajectories::readValue(const std::string& groupName, const std::string& valueName, const std::vector<hsize_t>& rows, int* values) const
+{
+	return impl->readRows(groupName, ::valueName(valueName), rows, values);
+}
+
+int H5CgnsParticleGroupTrajectories::readValue(const std::string& groupName, const std::string& valueName, const std::vector<hsize_t>& rows, double* values) const
+{
+	return impl->readRows(groupName, ::valueName(valueName), rows, values);
+}
+
+int H5CgnsParticleGroupTrajectories::writeStep(const std::string& groupName, int step, const std::string& idName, const std::vector<double>& coordinateX, const std::vector<double>& coordinateY, const std::vector<double>& coordinateZ, const std::map<std::string, std::vector<int> >& intValues, const std::map<std::string, std::vector<double> >& realValues)
+{
+	Impl::Group* g;
+	int ier = impl->openOrCreateGroup(groupName, &g);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleGroupTrajectories::Impl::Group::appendStep");
+	ier = g->appendStep(step, idName, coordinateX, coordinateY, coordinateZ, intValues, realValues);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleGroupTrajectories::Impl::Group::appendStep", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::buildIndex()
+{
+	for (const auto& pair : impl->m_groups) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleGroupTrajectories::Impl::Group::buildIndex");
+		int ier = pair.second->buildIndex();
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleGroupTrajectories::Impl::Group::buildIndex", ier);
+		RETURN_IF_ERR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+H5CgnsZone* H5CgnsParticleGroupTrajectories::zone() const
+{
+	return impl->m_zone;
+}
@@ -0,0 +1,75 @@
+#ifndef H5CGNSPARTICLEGROUPTRAJECTORIES_H
+#define H5CGNSPARTICLEGROUPTRAJECTORIES_H
+
+#include "iriclib_global.h"
+#include "h5util.h"
+
+#include <hdf5.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace iRICLib {
+
+class H5CgnsZone;
+
+// Particle group solutions of all steps, stored in one extendible array per value and per group,
+// instead of arrays in the solution group of each step.
+//
+// Each step is appended as a block of rows, and the particles are identified with an integer
+// value (the id value). An index from the ids to the rows is built by buildIndex(), so that the
+// trajectories of particles can be read without reading whole steps. cg_iRIC_Close() builds the
+// index through H5CgnsFile::buildParticleGroupTrajectoryIndex(); steps written after the last
+// build are searched one by one.
+class IRICLIBDLL H5CgnsParticleGroupTrajectories
+{
+public:
+	H5CgnsParticleGroupTrajectories(hid_t groupId, H5CgnsZone* zone);
+	~H5CgnsParticleGroupTrajectories();
+
+	int readGroupNames(std::vector<std::string>* names) const;
+	// returns false when the group does not have the step
+	bool stepExists(const std::string& groupName, int step) const;
+	int readIdName(const std::string& groupName, std::string* name) const;
+
+	// reads the values of a step
+	int count(const std::string& groupName, int step, int* count) const;
+	int readValueNames(const std::string& groupName, std::vector<std::string>* names) const;
+	int readValueType(const std::string& groupName, const std::string& valueName, H5Util::DataArrayValueType* type) const;
+	int readCoordinatesX(const std::string& groupName, int step, double* values, size_t count) const;
+	int readCoordinatesY(const std::string& groupName, int step, double* values, size_t count) const;
+	int readCoordinatesZ(const std::string& groupName, int step, double* values, size_t count) const;
+	int readValue(const std::string& groupName, int step, const std::string& valueName, int* values, size_t count) const;
+	int readValue(const std::string& groupName, int step, const std::string& valueName, double* values, size_t count) const;
+
+	// finds the rows of the particles with ids, in steps stepMin - stepMax. The rows are ordered by
+	// the order in ids, then by step. foundIds and steps are set for each row.
+	int findRows(const std::string& groupName, const std::vector<int>& ids, int stepMin, int stepMax, std::vector<int>* foundIds, std::vector<int>* steps, std::vector<hsize_t>* rows) const;
+	// reads the values at rows found with findRows()
+	int readCoordinatesX(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const;
+	int readCoordinatesY(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const;
+	int readCoordinatesZ(const std::string& groupName, const std::vector<hsize_t>& rows, double* values) const;
+	int readValue(const std::string& groupName, const std::string& valueName, const std::vector<hsize_t>& rows, int* values) const;
+	int readValue(const std::string& groupName, const std::string& valueName, const std::vector<hsize_t>& rows, double* values) const;
+
+	// appends the particles of a step. step should be larger than the steps already written.
+	// intValues should contain the id value, idName.
+	int writeStep(const std::string& groupName, int step, const std::string& idName, const std::vector<double>& coordinateX, const std::vector<double>& coordinateY, const std::vector<double>& coordinateZ, const std::map<std::string, std::vector<int> >& intValues, const std::map<std::string, std::vector<double> >& realValues);
+	// builds the index of the groups with steps written after the last build
+	int buildIndex();
+
+	H5CgnsZone* zone() const;
+
+private:
+	class Impl;
+	Impl* impl;
+};
+
+} // namespace iRICLib
+
+#ifdef _DEBUG
+	#include "private/h5cgnsparticlegrouptrajectories_impl.h"
+#endif // _DEBUG
+
+#endif // H5CGNSPARTICLEGROUPTRAJECTORIES_H
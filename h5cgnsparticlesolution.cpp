@@ -1,5 +1,9 @@
 #include "error_macros.h"
+#include "h5cgnsbase.h"
+#include "h5cgnsfile.h"
 #include "h5cgnsparticlesolution.h"
+#include "h5cgnszone.h"
+#include "h5particlebins.h"
 #include "h5util.h"
 #include "iriclib_errorcodes.h"
 
@@ -12,6 +16,7 @@ using namespace iRICLib;
 #define COORDSX "CoordinateX"
 #define COORDSY "CoordinateY"
 #define COORDSZ "CoordinateZ"
+#define BINS_PREFIX "Coordinate"
 
 H5CgnsParticleSolution::H5CgnsParticleSolution(const std::string& name, hid_t groupId, H5CgnsZone* zone) :
 	impl {new Impl {}}
@@ -91,6 +96,16 @@ int H5CgnsParticleSolution::readCoordinatesX(std::vector<double>* values) const
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::readCoordinatesX(double* values, size_t count) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::readValue");
+	int ier = readValue(COORDSX, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleSolution::readValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleSolution::readCoordinatesY(std::vector<double>* values) const
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::readValue");
@@ -101,6 +116,16 @@ int H5CgnsParticleSolution::readCoordinatesY(std::vector<double>* values) const
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::readCoordinatesY(double* values, size_t count) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::readValue");
+	int ier = readValue(COORDSY, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleSolution::readValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleSolution::readCoordinatesZ(std::vector<double>* values) const
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::readValue");
@@ -111,6 +136,16 @@ int H5CgnsParticleSolution::readCoordinatesZ(std::vector<double>* values) const
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::readCoordinatesZ(double* values, size_t count) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::readValue");
+	int ier = readValue(COORDSZ, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleSolution::readValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleSolution::readValueType(const std::string& name, H5Util::DataArrayValueType *type) const
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValueType");
@@ -131,6 +166,16 @@ int H5CgnsParticleSolution::readValue(const std::string& name, std::vector<doubl
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::readValue(const std::string& name, double* values, size_t count) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, name, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleSolution::readValue(const std::string& name, std::vector<int>* values) const
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
@@ -141,6 +186,16 @@ int H5CgnsParticleSolution::readValue(const std::string& name, std::vector<int>*
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::readValue(const std::string& name, int* values, size_t count) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, name, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleSolution::readValueAsDouble(const std::string& name, std::vector<double>* values) const
 {
 	H5Util::DataArrayValueType type;
@@ -162,6 +217,51 @@ int H5CgnsParticleSolution::readValueAsDouble(const std::string& name, std::vect
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::findRowsInRect(double xmin, double xmax, double ymin, double ymax, std::vector<hsize_t>* rows) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5ParticleBins::findRows");
+	int ier = H5ParticleBins::findRows(impl->m_groupId, BINS_PREFIX, COORDSX, COORDSY, xmin, xmax, ymin, ymax, rows);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5ParticleBins::findRows", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleSolution::readCoordinatesX(const std::vector<hsize_t>& rows, double* values) const
+{
+	return readValue(COORDSX, rows, values);
+}
+
+int H5CgnsParticleSolution::readCoordinatesY(const std::vector<hsize_t>& rows, double* values) const
+{
+	return readValue(COORDSY, rows, values);
+}
+
+int H5CgnsParticleSolution::readCoordinatesZ(const std::vector<hsize_t>& rows, double* values) const
+{
+	return readValue(COORDSZ, rows, values);
+}
+
+int H5CgnsParticleSolution::readValue(const std::string& name, const std::vector<hsize_t>& rows, double* values) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5ParticleBins::readRows");
+	int ier = H5ParticleBins::readRows(impl->m_groupId, name, rows, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5ParticleBins::readRows", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleSolution::readValue(const std::string& name, const std::vector<hsize_t>& rows, int* values) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5ParticleBins::readRows");
+	int ier = H5ParticleBins::readRows(impl->m_groupId, name, rows, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5ParticleBins::readRows", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleSolution::writeCoordinatesX(const std::vector<double>& coords) const
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::writeValue");
@@ -172,6 +272,16 @@ int H5CgnsParticleSolution::writeCoordinatesX(const std::vector<double>& coords)
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::writeCoordinatesX(const double* coords, size_t count) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::writeValue");
+	int ier = writeValue(COORDSX, coords, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleSolution::writeValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleSolution::writeCoordinatesY(const std::vector<double>& coords) const
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::writeValue");
@@ -182,6 +292,16 @@ int H5CgnsParticleSolution::writeCoordinatesY(const std::vector<double>& coords)
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::writeCoordinatesY(const double* coords, size_t count) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::writeValue");
+	int ier = writeValue(COORDSY, coords, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleSolution::writeValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleSolution::writeCoordinatesZ(const std::vector<double>& coords) const
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::writeValue");
@@ -192,10 +312,31 @@ int H5CgnsParticleSolution::writeCoordinatesZ(const std::vector<double>& coords)
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::writeCoordinatesZ(const double* coords, size_t count) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleSolution::writeValue");
+	int ier = writeValue(COORDSZ, coords, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleSolution::writeValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsParticleSolution::writeValue(const std::string& name, const std::vector<double>& values) const
 {
+	return writeValue(name, values.data(), values.size());
+}
+
+int H5CgnsParticleSolution::writeValue(const std::string& name, const double* values, size_t count) const
+{
+	std::vector<double> sortedValues;
+	if (count > 0 && impl->m_binOrder.size() == count) {
+		sortedValues = H5ParticleBins::sorted(impl->m_binOrder, values);
+		values = sortedValues.data();
+	}
+
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
-	int ier = H5Util::createDataArray(impl->m_groupId, name, values);
+	int ier = H5Util::createDataArray(impl->m_groupId, name, values, count);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
 	RETURN_IF_ERR;
 
@@ -204,14 +345,57 @@ int H5CgnsParticleSolution::writeValue(const std::string& name, const std::vecto
 
 int H5CgnsParticleSolution::writeValue(const std::string& name, const std::vector<int>& values) const
 {
+	return writeValue(name, values.data(), values.size());
+}
+
+int H5CgnsParticleSolution::writeValue(const std::string& name, const int* values, size_t count) const
+{
+	std::vector<int> sortedValues;
+	if (count > 0 && impl->m_binOrder.size() == count) {
+		sortedValues = H5ParticleBins::sorted(impl->m_binOrder, values);
+		values = sortedValues.data();
+	}
+
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
-	int ier = H5Util::createDataArray(impl->m_groupId, name, values);
+	int ier = H5Util::createDataArray(impl->m_groupId, name, values, count);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
 	RETURN_IF_ERR;
 
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsParticleSolution::writeCoordinates(const double* x, const double* y, const double* z, size_t count)
+{
+	impl->m_binOrder.clear();
+
+	int level = impl->m_zone->base()->file()->particleBinLevel();
+	if (level > 0) {
+		std::vector<double> box;
+		impl->m_zone->readGridBoundingBox(&box);
+
+		std::vector<int> order, binCodes, binStarts;
+		H5ParticleBins::sort(x, y, count, level, &box, &order, &binCodes, &binStarts);
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5ParticleBins::write");
+		int ier = H5ParticleBins::write(impl->m_groupId, BINS_PREFIX, level, box, binCodes, binStarts);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5ParticleBins::write", ier);
+		RETURN_IF_ERR;
+
+		impl->m_binOrder = order;
+	}
+
+	int ier = writeValue(COORDSX, x, count);
+	RETURN_IF_ERR;
+	ier = writeValue(COORDSY, y, count);
+	RETURN_IF_ERR;
+	if (z == nullptr) {return IRIC_NO_ERROR;}
+
+	ier = writeValue(COORDSZ, z, count);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 H5CgnsZone* H5CgnsParticleSolution::zone() const
 {
 	return impl->m_zone;
@@ -29,16 +29,38 @@ public:
 	int readCoordinatesX(std::vector<double>* values) const;
 	int readCoordinatesY(std::vector<double>* values) const;
 	int readCoordinatesZ(std::vector<double>* values) const;
+	int readCoordinatesX(double* values, size_t count) const;
+	int readCoordinatesY(double* values, size_t count) const;
+	int readCoordinatesZ(double* values, size_t count) const;
 	int readValueType(const std::string& name, H5Util::DataArrayValueType *type) const override;
 	int readValue(const std::string& name, std::vector<double>* values) const override;
 	int readValue(const std::string& name, std::vector<int>* values) const override;
+	int readValue(const std::string& name, double* values, size_t count) const;
+	int readValue(const std::string& name, int* values, size_t count) const;
 	int readValueAsDouble(const std::string& name, std::vector<double>* values) const override;
 
+	// finds the rows (in ascending order) of the particles in the rectangle
+	int findRowsInRect(double xmin, double xmax, double ymin, double ymax, std::vector<hsize_t>* rows) const;
+	// reads the values at rows found with findRowsInRect()
+	int readCoordinatesX(const std::vector<hsize_t>& rows, double* values) const;
+	int readCoordinatesY(const std::vector<hsize_t>& rows, double* values) const;
+	int readCoordinatesZ(const std::vector<hsize_t>& rows, double* values) const;
+	int readValue(const std::string& name, const std::vector<hsize_t>& rows, double* values) const;
+	int readValue(const std::string& name, const std::vector<hsize_t>& rows, int* values) const;
+
 	int writeCoordinatesX(const std::vector<double>& coords) const;
 	int writeCoordinatesY(const std::vector<double>& coords) const;
 	int writeCoordinatesZ(const std::vector<double>& coords) const;
 	int writeValue(const std::string& name, const std::vector<double>& values) const;
 	int writeValue(const std::string& name, const std::vector<int>& values) const;
+	int writeCoordinatesX(const double* coords, size_t count) const;
+	int writeCoordinatesY(const double* coords, size_t count) const;
+	int writeCoordinatesZ(const double* coords, size_t count) const;
+	int writeValue(const std::string& name, const double* values, size_t count) const;
+	int writeValue(const std::string& name, const int* values, size_t count) const;
+	// writes the coordinates (z can be nullptr). When H5CgnsFile::particleBinLevel() is larger than 0, the particles
+	// are sorted into spatial bins, and the values written after this are sorted in the same order.
+	int writeCoordinates(const double* x, const double* y, const double* z, size_t count);
 
 	H5CgnsZone* zone() const override;
 
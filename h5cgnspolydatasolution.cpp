@@ -103,7 +103,7 @@ int H5CgnsPolyDataSolution::writeEnd()
 		RETURN_IF_ERR;
 	}
 
-	return true;
+	return IRIC_NO_ERROR;
 }
 
 void H5CgnsPolyDataSolution::writePolygon(std::vector<double>& x, std::vector<double>& y)
@@ -132,32 +132,57 @@ void H5CgnsPolyDataSolution::writePolyline(std::vector<double>& x, std::vector<d
 
 void H5CgnsPolyDataSolution::writeValue(const std::string& name, int value)
 {
-	std::vector<int>* vals = nullptr;
-
-	auto it = impl->m_intValues.find(name);
-	if (it != impl->m_intValues.end()) {
-		vals = &(it->second);
-	} else {
-		std::vector<int> empty;
-		auto it2 = impl->m_intValues.insert({name, empty});
-		vals = &(it2.first->second);
-	}
-	vals->push_back(value);
+	impl->intValues(name)->push_back(value);
 }
 
 void H5CgnsPolyDataSolution::writeValue(const std::string& name, double value)
 {
-	std::vector<double>* vals = nullptr;
+	impl->realValues(name)->push_back(value);
+}
 
-	auto it = impl->m_realValues.find(name);
-	if (it != impl->m_realValues.end()) {
-		vals = &(it->second);
-	} else {
-		std::vector<double> empty;
-		auto it2 = impl->m_realValues.insert({name, empty});
-		vals = &(it2.first->second);
+int H5CgnsPolyDataSolution::writePolyData(const int* types, const int* offsets, size_t count, const double* x, const double* y)
+{
+	if (offsets[0] != 0) {
+		_iric_logger_error("H5CgnsPolyDataSolution::writePolyData(): offsets[0] is not 0");
+		return IRIC_INVALID_ARGUMENT;
 	}
-	vals->push_back(value);
+	for (size_t i = 0; i < count; ++i) {
+		if (types[i] != POLYGON && types[i] != POLYLINE) {
+			std::ostringstream ss;
+			ss << "H5CgnsPolyDataSolution::writePolyData(): type of geometry " << i << " is invalid (" << types[i] << ")";
+			_iric_logger_error(ss.str());
+			return IRIC_INVALID_ARGUMENT;
+		}
+		if (offsets[i + 1] < offsets[i]) {
+			std::ostringstream ss;
+			ss << "H5CgnsPolyDataSolution::writePolyData(): offsets[" << i + 1 << "] is smaller than offsets[" << i << "]";
+			_iric_logger_error(ss.str());
+			return IRIC_INVALID_ARGUMENT;
+		}
+	}
+
+	impl->m_types.insert(impl->m_types.end(), types, types + count);
+	impl->m_sizes.reserve(impl->m_sizes.size() + count);
+	for (size_t i = 0; i < count; ++i) {
+		impl->m_sizes.push_back(offsets[i + 1] - offsets[i]);
+	}
+	int numPoints = offsets[count];
+	impl->m_coordinateX.insert(impl->m_coordinateX.end(), x, x + numPoints);
+	impl->m_coordinateY.insert(impl->m_coordinateY.end(), y, y + numPoints);
+
+	return IRIC_NO_ERROR;
+}
+
+void H5CgnsPolyDataSolution::writeValue(const std::string& name, const int* values, size_t count)
+{
+	auto vals = impl->intValues(name);
+	vals->insert(vals->end(), values, values + count);
+}
+
+void H5CgnsPolyDataSolution::writeValue(const std::string& name, const double* values, size_t count)
+{
+	auto vals = impl->realValues(name);
+	vals->insert(vals->end(), values, values + count);
 }
 
 int H5CgnsPolyDataSolution::readGroupNames(std::vector<std::string>* names) const
@@ -215,9 +240,9 @@ int H5CgnsPolyDataSolution::readValueNames(const std::string& groupName, std::ve
 
 	std::vector<std::string> tmpNames;
 
-	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getGroupNames");
-	int ier = H5Util::getGroupNames(impl->m_groupId, &tmpNames);
-	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getGroupNames", ier);
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getLinkNames");
+	int ier = H5Util::getLinkNames(impl->m_groupId, &tmpNames);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getLinkNames", ier);
 	RETURN_IF_ERR;
 
 	for (const auto& name : tmpNames) {
@@ -255,6 +280,18 @@ int H5CgnsPolyDataSolution::readCoordinatesX(const std::string& groupName, std::
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsPolyDataSolution::readCoordinatesX(const std::string& groupName, double* values, size_t count) const
+{
+	std::ostringstream ss;
+	ss << groupName << "_coordinateX";
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsPolyDataSolution::readCoordinatesY(const std::string& groupName, std::vector<double>* values) const
 {
 	std::ostringstream ss;
@@ -267,6 +304,18 @@ int H5CgnsPolyDataSolution::readCoordinatesY(const std::string& groupName, std::
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsPolyDataSolution::readCoordinatesY(const std::string& groupName, double* values, size_t count) const
+{
+	std::ostringstream ss;
+	ss << groupName << "_coordinateY";
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsPolyDataSolution::readTypes(const std::string& groupName, std::vector<int>* values) const
 {
 	std::ostringstream ss;
@@ -279,6 +328,18 @@ int H5CgnsPolyDataSolution::readTypes(const std::string& groupName, std::vector<
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsPolyDataSolution::readTypes(const std::string& groupName, int* values, size_t count) const
+{
+	std::ostringstream ss;
+	ss << groupName << "_type";
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsPolyDataSolution::readSizes(const std::string& groupName, std::vector<int>* values) const
 {
 	std::ostringstream ss;
@@ -291,6 +352,18 @@ int H5CgnsPolyDataSolution::readSizes(const std::string& groupName, std::vector<
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsPolyDataSolution::readSizes(const std::string& groupName, int* values, size_t count) const
+{
+	std::ostringstream ss;
+	ss << groupName << "_size";
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsPolyDataSolution::readValueType(const std::string& groupName, const std::string& valueName, H5Util::DataArrayValueType *type) const
 {
 	std::ostringstream ss;
@@ -315,6 +388,18 @@ int H5CgnsPolyDataSolution::readValue(const std::string& groupName, const std::s
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsPolyDataSolution::readValue(const std::string& groupName, const std::string& valueName, int* values, size_t count) const
+{
+	std::ostringstream ss;
+	ss << groupName << "__" << valueName;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsPolyDataSolution::readValue(const std::string& groupName, const std::string& valueName, std::vector<double>* values) const
 {
 	std::ostringstream ss;
@@ -327,6 +412,18 @@ int H5CgnsPolyDataSolution::readValue(const std::string& groupName, const std::s
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsPolyDataSolution::readValue(const std::string& groupName, const std::string& valueName, double* values, size_t count) const
+{
+	std::ostringstream ss;
+	ss << groupName << "__" << valueName;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(impl->m_groupId, ss.str(), values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsPolyDataSolution::readValueAsDouble(const std::string& groupName, const std::string& valueName, std::vector<double>* values) const
 {
 	H5Util::DataArrayValueType type;
@@ -31,6 +31,10 @@ public:
 	void writePolyline(std::vector<double>& x, std::vector<double>& y);
 	void writeValue(const std::string& name, int value);
 	void writeValue(const std::string& name, double value);
+	// writes count geometries at once. coordinates of geometry i are x[offsets[i]] to x[offsets[i + 1] - 1]
+	int writePolyData(const int* types, const int* offsets, size_t count, const double* x, const double* y);
+	void writeValue(const std::string& name, const int* values, size_t count);
+	void writeValue(const std::string& name, const double* values, size_t count);
 
 	int readGroupNames(std::vector<std::string>* names) const;
 	int dataCount(const std::string& groupName, int* count);
@@ -38,12 +42,18 @@ public:
 	int readValueNames(const std::string& groupName, std::vector<std::string>* names) const;
 	int readValueNames(const std::string& groupName, std::unordered_set<std::string>* names) const;
 	int readCoordinatesX(const std::string& groupName, std::vector<double>* values) const;
+	int readCoordinatesX(const std::string& groupName, double* values, size_t count) const;
 	int readCoordinatesY(const std::string& groupName, std::vector<double>* values) const;
+	int readCoordinatesY(const std::string& groupName, double* values, size_t count) const;
 	int readTypes(const std::string& groupName, std::vector<int>* values) const;
+	int readTypes(const std::string& groupName, int* values, size_t count) const;
 	int readSizes(const std::string& groupName, std::vector<int>* values) const;
+	int readSizes(const std::string& groupName, int* values, size_t count) const;
 	int readValueType(const std::string& groupName, const std::string& valueName, H5Util::DataArrayValueType *type) const;
 	int readValue(const std::string& groupName, const std::string& valueName, std::vector<int>* values) const;
+	int readValue(const std::string& groupName, const std::string& valueName, int* values, size_t count) const;
 	int readValue(const std::string& groupName, const std::string& valueName, std::vector<double>* values) const;
+	int readValue(const std::string& groupName, const std::string& valueName, double* values, size_t count) const;
 	int readValueAsDouble(const std::string& groupName, const std::string& valueName, std::vector<double>* values) const;
 
 	H5CgnsZone* zone() const;
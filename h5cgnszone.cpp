@@ -1,11 +1,17 @@
 #include "error_macros.h"
 #include "h5cgnsbase.h"
+#include "h5cgnscellflowsolution.h"
 #include "h5cgnsfile.h"
 #include "h5cgnsflowsolution.h"
 #include "h5cgnsgridattributes.h"
 #include "h5cgnsgridcoordinates.h"
+#include "h5cgnsifaceflowsolution.h"
+#include "h5cgnsjfaceflowsolution.h"
+#include "h5cgnskfaceflowsolution.h"
+#include "h5cgnsnodeflowsolution.h"
 #include "h5cgnsparticlegroupimagesolution.h"
 #include "h5cgnsparticlegroupsolution.h"
+#include "h5cgnsparticlegrouptrajectories.h"
 #include "h5cgnsparticlesolution.h"
 #include "h5cgnspolydatasolution.h"
 #include "h5cgnszone.h"
@@ -18,11 +24,13 @@
 
 #include "private/h5cgnszone_impl.h"
 
+#include <algorithm>
 #include <sstream>
 
 using namespace iRICLib;
 
 #define LABEL "Zone_t"
+#define GRIDCOORDINATES_NAME "GridCoordinates"
 #define ELEMENT "Element"
 #define ELEMENT_LABEL "Elements_t"
 #define ELEMENT_CONNECTIVITY "ElementConnectivity"
@@ -83,6 +91,8 @@ H5CgnsZone::~H5CgnsZone()
 	flush();
 	clearSolutionGroups();
 
+	delete impl->m_particleGroupTrajectories;
+
 	delete impl;
 }
 
@@ -272,6 +282,30 @@ H5CgnsGridCoordinates* H5CgnsZone::gridCoordinates() const
 	return impl->m_gridCoordinates;
 }
 
+int H5CgnsZone::readGridBoundingBox(std::vector<double>* box) const
+{
+	if (impl->m_gridBoundingBox.size() == 0) {
+		if (impl->m_gridCoordinates == nullptr) {return IRIC_DATA_NOT_FOUND;}
+
+		std::vector<double> x, y;
+		int ier = impl->m_gridCoordinates->readCoordinatesX(&x);
+		RETURN_IF_ERR;
+		ier = impl->m_gridCoordinates->readCoordinatesY(&y);
+		RETURN_IF_ERR;
+		if (x.size() == 0 || y.size() == 0) {return IRIC_DATA_NOT_FOUND;}
+
+		auto xRange = std::minmax_element(x.begin(), x.end());
+		auto yRange = std::minmax_element(y.begin(), y.end());
+		impl->m_gridBoundingBox.push_back(*xRange.first);
+		impl->m_gridBoundingBox.push_back(*xRange.second);
+		impl->m_gridBoundingBox.push_back(*yRange.first);
+		impl->m_gridBoundingBox.push_back(*yRange.second);
+	}
+
+	*box = impl->m_gridBoundingBox;
+	return IRIC_NO_ERROR;
+}
+
 H5CgnsGridAttributes* H5CgnsZone::gridAttributes() const
 {
 	return impl->m_gridAttributes;
@@ -718,6 +752,27 @@ H5CgnsParticleGroupSolution* H5CgnsZone::particleGroupSolution()
 	}
 }
 
+bool H5CgnsZone::particleGroupTrajectoriesExists() const
+{
+	if (impl->m_particleGroupTrajectories != nullptr) {return true;}
+
+	return impl->m_names.find("ParticleGroupTrajectories") != impl->m_names.end();
+}
+
+H5CgnsParticleGroupTrajectories* H5CgnsZone::particleGroupTrajectories()
+{
+	if (impl->m_particleGroupTrajectories != nullptr) {
+		return impl->m_particleGroupTrajectories;
+	}
+	if (particleGroupTrajectoriesExists()) {
+		return impl->openParticleGroupTrajectories();
+	}
+	if (impl->m_base->file()->mode() == H5CgnsFile::Mode::OpenReadOnly) {
+		return nullptr;
+	}
+	return impl->createParticleGroupTrajectories();
+}
+
 bool H5CgnsZone::particleGroupImageSolutionExists() const
 {
 	if (impl->m_flowSolutionPointerNames.find("ParticleGroupImageSolutionPointers") != impl->m_flowSolutionPointerNames.end()) {return true;}
@@ -829,6 +884,101 @@ int H5CgnsZone::copyGridTo(H5CgnsZone* target)
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsZone::linkGridTo(const std::string& fileName)
+{
+	delete impl->m_gridCoordinates;
+	impl->m_gridCoordinates = nullptr;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::linkGroup");
+	int ier = impl->linkGroup(fileName, GRIDCOORDINATES_NAME);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::linkGroup", ier);
+	RETURN_IF_ERR;
+
+	impl->m_gridCoordinates = impl->openLinkedGridCoordinates();
+	if (impl->m_gridCoordinates == nullptr) {return IRIC_H5_CALL_ERROR;}
+
+	if (type() == Type::Structured) {return IRIC_NO_ERROR;}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::linkGroup");
+	ier = impl->linkGroup(fileName, ELEMENT);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::linkGroup", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsZone::copySolutionTo(H5CgnsZone* target)
+{
+	// copies the solution of the current solution id to the current solution id of target.
+	target->clearSolutionGroups();
+
+	auto t = target->impl;
+	std::string name;
+	hid_t gId;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	int ier = impl->copySolutionGroupTo("GridCoordinatesPointers", "GridCoordinatesForSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_gridCoordinatesForSolution = new H5CgnsGridCoordinates(name, gId, target);}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	ier = impl->copySolutionGroupTo("FlowSolutionPointers", "FlowSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_nodeSolution = new H5CgnsNodeFlowSolution(name, gId, target);}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	ier = impl->copySolutionGroupTo("FlowCellSolutionPointers", "FlowCellSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_cellSolution = new H5CgnsCellFlowSolution(name, gId, target);}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	ier = impl->copySolutionGroupTo("FlowIFaceSolutionPointers", "FlowIFaceSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_iFaceSolution = new H5CgnsIFaceFlowSolution(name, gId, target);}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	ier = impl->copySolutionGroupTo("FlowJFaceSolutionPointers", "FlowJFaceSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_jFaceSolution = new H5CgnsJFaceFlowSolution(name, gId, target);}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	ier = impl->copySolutionGroupTo("FlowKFaceSolutionPointers", "FlowKFaceSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_kFaceSolution = new H5CgnsKFaceFlowSolution(name, gId, target);}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	ier = impl->copySolutionGroupTo("ParticleSolutionPointers", "ParticleSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_particleSolution = new H5CgnsParticleSolution(name, gId, target);}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	ier = impl->copySolutionGroupTo("ParticleGroupSolutionPointers", "ParticleGroupSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_particleGroupSolution = new H5CgnsParticleGroupSolution(name, gId, target);}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	ier = impl->copySolutionGroupTo("ParticleGroupImageSolutionPointers", "ParticleGroupImageSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_particleGroupImageSolution = new H5CgnsParticleGroupImageSolution(name, gId, target);}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsZone::Impl::copySolutionGroupTo");
+	ier = impl->copySolutionGroupTo("PolydataSolutionPointers", "PolydataSolution", t, &name, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsZone::Impl::copySolutionGroupTo", ier);
+	RETURN_IF_ERR;
+	if (gId >= 0) {t->m_polyDataSolution = new H5CgnsPolyDataSolution(name, gId, target);}
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsZone::flush()
 {
 	if (impl->m_base->file()->mode() == H5CgnsFile::Mode::OpenReadOnly) {
@@ -842,6 +992,18 @@ int H5CgnsZone::flush()
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsZone::buildParticleGroupTrajectoryIndex()
+{
+	if (impl->m_particleGroupTrajectories == nullptr) {return IRIC_NO_ERROR;}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsParticleGroupTrajectories::buildIndex");
+	int ier = impl->m_particleGroupTrajectories->buildIndex();
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsParticleGroupTrajectories::buildIndex", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 void H5CgnsZone::clearSolutionGroups()
 {
 	delete impl->m_gridCoordinatesForSolution;
@@ -887,15 +1049,14 @@ int H5CgnsZone::deleteAllResults()
 	solHeaders.push_back("ParticleGroupImageSolution");
 	solHeaders.push_back("ParticleSolution");
 	solHeaders.push_back("PolydataSolution");
+	solHeaders.push_back("ParticleGroupTrajectories");
 
-	std::vector<std::string> names;
-
-	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getGroupNames");
-	int ier = H5Util::getGroupNames(impl->m_groupId, &names);
-	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getGroupNames", ier);
-	RETURN_IF_ERR;
+	delete impl->m_particleGroupTrajectories;
+	impl->m_particleGroupTrajectories = nullptr;
 
-	for (const auto& name : names) {
+	// solution groups are found from the cached names, instead of opening every child
+	std::vector<std::string> names;
+	for (const auto& name : impl->m_names) {
 		for (const auto& header : solHeaders) {
 			if (name.substr(0, header.size()) == header) {
 				// this is a solution node.
@@ -906,9 +1067,15 @@ int H5CgnsZone::deleteAllResults()
 					_iric_logger_error("H5CgnsZone::deleteAllResults", "H5Ldelete", status);
 					return IRIC_H5_CALL_ERROR;
 				}
+				names.push_back(name);
+				break;
 			}
 		}
 	}
+	for (const auto& name : names) {
+		impl->m_names.erase(name);
+	}
+	impl->m_solutionPointers.clear();
 
 	return IRIC_NO_ERROR;
 }
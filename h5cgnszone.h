@@ -16,6 +16,7 @@ class H5CgnsGridAttributes;
 class H5CgnsGridCoordinates;
 class H5CgnsParticleGroupImageSolution;
 class H5CgnsParticleGroupSolution;
+class H5CgnsParticleGroupTrajectories;
 class H5CgnsParticleSolution;
 class H5CgnsPolyDataSolution;
 class H5CgnsZoneBc;
@@ -73,6 +74,8 @@ public:
 	int getSolutionExists(bool* exists) const;
 
 	H5CgnsGridCoordinates* gridCoordinates() const;
+	// bounding box (xmin, xmax, ymin, ymax) of the grid. It is read once, and cached.
+	int readGridBoundingBox(std::vector<double>* box) const;
 	H5CgnsGridAttributes* gridAttributes() const;
 	H5CgnsZoneBc* zoneBc() const;
 
@@ -106,6 +109,9 @@ public:
 	H5CgnsFlowSolution* kFaceSolution();
 	bool particleGroupSolutionExists() const;
 	H5CgnsParticleGroupSolution* particleGroupSolution();
+	// particle group solutions of all steps, written when H5CgnsFile::particleGroupTrajectoryIdName() is set
+	bool particleGroupTrajectoriesExists() const;
+	H5CgnsParticleGroupTrajectories* particleGroupTrajectories();
 	bool particleGroupImageSolutionExists() const;
 	H5CgnsParticleGroupImageSolution* particleGroupImageSolution();
 	bool particleSolutionExists() const;
@@ -115,7 +121,13 @@ public:
 
 	int copyGridTo(H5CgnsBase* target);
 	int copyGridTo(H5CgnsZone* target);
+	// replaces the grid of this zone with external links to the zone with the same path in fileName.
+	// fileName is relative to the folder of this file.
+	int linkGridTo(const std::string& fileName);
+	int copySolutionTo(H5CgnsZone* target);
 	int flush();
+	// builds the index of the particle group trajectories, if they are opened
+	int buildParticleGroupTrajectoryIndex();
 	void clearSolutionGroups();
 	int deleteAllResults();
 
@@ -0,0 +1,202 @@
+#include "h5datasetstoragepolicy.h"
+#include "iriclib_errorcodes.h"
+
+#include "internal/iric_logger.h"
+
+#include <algorithm>
+
+using namespace iRICLib;
+
+namespace {
+
+const int DEFAULT_COMPRESSION_LEVEL = 4;
+const hsize_t DEFAULT_CONTIGUOUS_LIMIT = 64 * 1024;
+const hsize_t DEFAULT_CHUNK_SIZE = 1024 * 1024;
+const unsigned int SZIP_PIXELS_PER_BLOCK = 16;
+
+bool filterAvailable(H5Z_filter_t filter)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Zfilter_avail");
+	htri_t avail = H5Zfilter_avail(filter);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Zfilter_avail");
+	if (avail <= 0) {return false;}
+
+	unsigned int filterInfo;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Zget_filter_info");
+	herr_t status = H5Zget_filter_info(filter, &filterInfo);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Zget_filter_info");
+	if (status < 0) {return false;}
+
+	return (filterInfo & H5Z_FILTER_CONFIG_ENCODE_ENABLED) != 0;
+}
+
+} // namespace
+
+H5DatasetStoragePolicy::H5DatasetStoragePolicy() :
+	m_compression {Compression::None},
+	m_compressionLevel {DEFAULT_COMPRESSION_LEVEL},
+	m_shuffle {true},
+	m_chunked {false},
+	m_contiguousLimit {DEFAULT_CONTIGUOUS_LIMIT},
+	m_chunkSize {DEFAULT_CHUNK_SIZE}
+{}
+
+H5DatasetStoragePolicy::Compression H5DatasetStoragePolicy::compression() const
+{
+	return m_compression;
+}
+
+void H5DatasetStoragePolicy::setCompression(Compression compression)
+{
+	m_compression = compression;
+}
+
+int H5DatasetStoragePolicy::compressionLevel() const
+{
+	return m_compressionLevel;
+}
+
+void H5DatasetStoragePolicy::setCompressionLevel(int level)
+{
+	m_compressionLevel = (std::max)(0, (std::min)(9, level));
+}
+
+bool H5DatasetStoragePolicy::shuffle() const
+{
+	return m_shuffle;
+}
+
+void H5DatasetStoragePolicy::setShuffle(bool shuffle)
+{
+	m_shuffle = shuffle;
+}
+
+bool H5DatasetStoragePolicy::chunked() const
+{
+	return m_chunked;
+}
+
+void H5DatasetStoragePolicy::setChunked(bool chunked)
+{
+	m_chunked = chunked;
+}
+
+hsize_t H5DatasetStoragePolicy::contiguousLimit() const
+{
+	return m_contiguousLimit;
+}
+
+void H5DatasetStoragePolicy::setContiguousLimit(hsize_t limit)
+{
+	m_contiguousLimit = limit;
+}
+
+hsize_t H5DatasetStoragePolicy::chunkSize() const
+{
+	return m_chunkSize;
+}
+
+void H5DatasetStoragePolicy::setChunkSize(hsize_t size)
+{
+	if (size == 0) {size = DEFAULT_CHUNK_SIZE;}
+	m_chunkSize = size;
+}
+
+bool H5DatasetStoragePolicy::isDefault() const
+{
+	return m_compression == Compression::None && ! m_chunked;
+}
+
+bool H5DatasetStoragePolicy::useChunkedLayout(const std::vector<hsize_t>& dims, size_t elementSize) const
+{
+	if (isDefault()) {return false;}
+	if (dims.size() == 0) {return false;}
+
+	hsize_t bytes = elementSize;
+	for (auto d : dims) {
+		if (d == 0) {return false;}
+		bytes *= d;
+	}
+	return bytes >= m_contiguousLimit;
+}
+
+std::vector<hsize_t> H5DatasetStoragePolicy::chunkDimensions(const std::vector<hsize_t>& dims, size_t elementSize) const
+{
+	// fill the fastest varying dimensions first, so that a chunk holds
+	// complete rows whenever possible.
+	std::vector<hsize_t> ret(dims.size(), 1);
+	hsize_t remaining = (std::max)(static_cast<hsize_t> (1), m_chunkSize / (std::max)(static_cast<size_t> (1), elementSize));
+
+	for (size_t i = dims.size(); i > 0; --i) {
+		hsize_t d = dims.at(i - 1);
+		if (d <= remaining) {
+			ret[i - 1] = d;
+			remaining /= d;
+		} else {
+			ret[i - 1] = remaining;
+			remaining = 1;
+		}
+	}
+	return ret;
+}
+
+int H5DatasetStoragePolicy::setupCreationProperty(hid_t propertyId, const std::vector<hsize_t>& dims, size_t elementSize) const
+{
+	if (! useChunkedLayout(dims, elementSize)) {return IRIC_NO_ERROR;}
+
+	auto chunkDims = chunkDimensions(dims, elementSize);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pset_chunk");
+	herr_t status = H5Pset_chunk(propertyId, static_cast<int> (chunkDims.size()), chunkDims.data());
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pset_chunk");
+	if (status < 0) {
+		_iric_logger_error("H5DatasetStoragePolicy::setupCreationProperty", "H5Pset_chunk", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	if (m_compression == Compression::None) {return IRIC_NO_ERROR;}
+
+	if (m_shuffle && elementSize > 1) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Pset_shuffle");
+		status = H5Pset_shuffle(propertyId);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Pset_shuffle");
+		if (status < 0) {
+			_iric_logger_error("H5DatasetStoragePolicy::setupCreationProperty", "H5Pset_shuffle", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+
+	if (m_compression == Compression::Deflate) {
+		if (! filterAvailable(H5Z_FILTER_DEFLATE)) {
+			_iric_logger_warn("In H5DatasetStoragePolicy::setupCreationProperty(), deflate filter is not available. Data is stored without compression");
+			return IRIC_NO_ERROR;
+		}
+		_IRIC_LOGGER_TRACE_CALL_START("H5Pset_deflate");
+		status = H5Pset_deflate(propertyId, static_cast<unsigned int> (m_compressionLevel));
+		_IRIC_LOGGER_TRACE_CALL_END("H5Pset_deflate");
+		if (status < 0) {
+			_iric_logger_error("H5DatasetStoragePolicy::setupCreationProperty", "H5Pset_deflate", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	} else if (m_compression == Compression::Szip) {
+		hsize_t chunkElems = 1;
+		for (auto d : chunkDims) {
+			chunkElems *= d;
+		}
+		if (chunkElems < SZIP_PIXELS_PER_BLOCK) {return IRIC_NO_ERROR;}
+
+		if (! filterAvailable(H5Z_FILTER_SZIP)) {
+			_iric_logger_warn("In H5DatasetStoragePolicy::setupCreationProperty(), szip filter is not available. Data is stored without compression");
+			return IRIC_NO_ERROR;
+		}
+		_IRIC_LOGGER_TRACE_CALL_START("H5Pset_szip");
+		status = H5Pset_szip(propertyId, H5_SZIP_NN_OPTION_MASK, SZIP_PIXELS_PER_BLOCK);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Pset_szip");
+		if (status < 0) {
+			_iric_logger_error("H5DatasetStoragePolicy::setupCreationProperty", "H5Pset_szip", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+
+	return IRIC_NO_ERROR;
+}
@@ -0,0 +1,61 @@
+#ifndef H5DATASETSTORAGEPOLICY_H
+#define H5DATASETSTORAGEPOLICY_H
+
+#include "iriclib_global.h"
+
+#include <hdf5.h>
+
+#include <vector>
+
+namespace iRICLib {
+
+class IRICLIBDLL H5DatasetStoragePolicy
+{
+public:
+	enum class Compression {
+		None,
+		Deflate,
+		Szip
+	};
+
+	H5DatasetStoragePolicy();
+
+	Compression compression() const;
+	void setCompression(Compression compression);
+
+	int compressionLevel() const;
+	void setCompressionLevel(int level);
+
+	bool shuffle() const;
+	void setShuffle(bool shuffle);
+
+	bool chunked() const;
+	void setChunked(bool chunked);
+
+	// datasets smaller than this (in bytes) are stored contiguous
+	hsize_t contiguousLimit() const;
+	void setContiguousLimit(hsize_t limit);
+
+	// target size of one chunk (in bytes)
+	hsize_t chunkSize() const;
+	void setChunkSize(hsize_t size);
+
+	bool isDefault() const;
+
+	bool useChunkedLayout(const std::vector<hsize_t>& dims, size_t elementSize) const;
+	std::vector<hsize_t> chunkDimensions(const std::vector<hsize_t>& dims, size_t elementSize) const;
+
+	int setupCreationProperty(hid_t propertyId, const std::vector<hsize_t>& dims, size_t elementSize) const;
+
+private:
+	Compression m_compression;
+	int m_compressionLevel;
+	bool m_shuffle;
+	bool m_chunked;
+	hsize_t m_contiguousLimit;
+	hsize_t m_chunkSize;
+};
+
+} // namespace iRICLib
+
+#endif // H5DATASETSTORAGEPOLICY_H
@@ -0,0 +1,337 @@
+#include "error_macros.h"
+#include "h5fileaccessprofile.h"
+#include "iriclib_errorcodes.h"
+
+#include "internal/iric_logger.h"
+
+#include <algorithm>
+
+using namespace iRICLib;
+
+namespace {
+
+const size_t KB = 1024;
+const size_t MB = 1024 * 1024;
+
+const double DEFAULT_CHUNK_CACHE_PREEMPTION = 0.75;
+// limits of the metadata cache size accepted by HDF5
+const size_t MAX_METADATA_CACHE_SIZE = 128 * MB;
+const size_t MIN_METADATA_CACHE_SIZE = 1 * KB;
+
+H5F_libver_t toH5LibVer(H5FileAccessProfile::LibVersion v)
+{
+	if (v == H5FileAccessProfile::LibVersion::V18) {
+		return H5F_LIBVER_V18;
+	} else if (v == H5FileAccessProfile::LibVersion::V110) {
+		return H5F_LIBVER_V110;
+	} else if (v == H5FileAccessProfile::LibVersion::Latest) {
+		return H5F_LIBVER_LATEST;
+	}
+	return H5F_LIBVER_EARLIEST;
+}
+
+int setupMetadataCache(hid_t propertyId, size_t size)
+{
+	H5AC_cache_config_t config;
+	config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pget_mdc_config");
+	herr_t status = H5Pget_mdc_config(propertyId, &config);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pget_mdc_config");
+	if (status < 0) {
+		_iric_logger_error("H5FileAccessProfile::setupAccessProperty", "H5Pget_mdc_config", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	config.set_initial_size = true;
+	config.initial_size = size;
+	config.max_size = (std::max)(config.max_size, size);
+	config.min_size = (std::min)(config.min_size, size);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pset_mdc_config");
+	status = H5Pset_mdc_config(propertyId, &config);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pset_mdc_config");
+	if (status < 0) {
+		_iric_logger_error("H5FileAccessProfile::setupAccessProperty", "H5Pset_mdc_config", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+	return IRIC_NO_ERROR;
+}
+
+int setupChunkCache(hid_t propertyId, size_t size, size_t slots, double w0)
+{
+	int mdcElems;
+	size_t defaultSlots, defaultSize;
+	double defaultW0;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pget_cache");
+	herr_t status = H5Pget_cache(propertyId, &mdcElems, &defaultSlots, &defaultSize, &defaultW0);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pget_cache");
+	if (status < 0) {
+		_iric_logger_error("H5FileAccessProfile::setupAccessProperty", "H5Pget_cache", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	if (size == 0) {size = defaultSize;}
+	if (slots == 0) {slots = defaultSlots;}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pset_cache");
+	status = H5Pset_cache(propertyId, mdcElems, slots, size, w0);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pset_cache");
+	if (status < 0) {
+		_iric_logger_error("H5FileAccessProfile::setupAccessProperty", "H5Pset_cache", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+	return IRIC_NO_ERROR;
+}
+
+} // namespace
+
+H5FileAccessProfile::H5FileAccessProfile() :
+	m_metadataCacheSize {0},
+	m_chunkCacheSize {0},
+	m_chunkCacheSlots {0},
+	m_chunkCachePreemption {DEFAULT_CHUNK_CACHE_PREEMPTION},
+	m_pageSize {0},
+	m_pageBufferSize {0},
+	m_alignmentThreshold {1},
+	m_alignment {1},
+	m_sieveBufferSize {0},
+	m_libVersionLow {LibVersion::Earliest},
+	m_libVersionHigh {LibVersion::Latest}
+{}
+
+H5FileAccessProfile H5FileAccessProfile::preset(Preset preset)
+{
+	H5FileAccessProfile p;
+
+	if (preset == Preset::SolverWrite) {
+		// large arrays are written once per step, and not read again
+		p.setMetadataCacheSize(8 * MB);
+		p.setChunkCacheSize(16 * MB);
+		p.setChunkCacheSlots(12421);
+		p.setChunkCachePreemption(1.0);
+		p.setAlignment(64 * KB, 4 * KB);
+		p.setSieveBufferSize(1 * MB);
+	} else if (preset == Preset::GuiRead) {
+		// the same arrays are read repeatedly, while the user moves between steps
+		p.setMetadataCacheSize(16 * MB);
+		p.setChunkCacheSize(64 * MB);
+		p.setChunkCacheSlots(50021);
+		p.setSieveBufferSize(4 * MB);
+		p.setPageBufferSize(16 * MB);
+	} else if (preset == Preset::Archive) {
+		// files are written once and read over slow file systems. metadata and small
+		// datasets are packed into large pages, so that they are read with a few requests
+		p.setMetadataCacheSize(8 * MB);
+		p.setChunkCacheSize(16 * MB);
+		p.setChunkCacheSlots(12421);
+		p.setPageSize(1 * MB);
+		p.setPageBufferSize(16 * MB);
+		p.setSieveBufferSize(1 * MB);
+		p.setLibVersionBounds(LibVersion::V110, LibVersion::Latest);
+	}
+
+	return p;
+}
+
+size_t H5FileAccessProfile::metadataCacheSize() const
+{
+	return m_metadataCacheSize;
+}
+
+void H5FileAccessProfile::setMetadataCacheSize(size_t size)
+{
+	if (size != 0) {
+		size = (std::max)(MIN_METADATA_CACHE_SIZE, (std::min)(MAX_METADATA_CACHE_SIZE, size));
+	}
+	m_metadataCacheSize = size;
+}
+
+size_t H5FileAccessProfile::chunkCacheSize() const
+{
+	return m_chunkCacheSize;
+}
+
+void H5FileAccessProfile::setChunkCacheSize(size_t size)
+{
+	m_chunkCacheSize = size;
+}
+
+size_t H5FileAccessProfile::chunkCacheSlots() const
+{
+	return m_chunkCacheSlots;
+}
+
+void H5FileAccessProfile::setChunkCacheSlots(size_t slots)
+{
+	m_chunkCacheSlots = slots;
+}
+
+double H5FileAccessProfile::chunkCachePreemption() const
+{
+	return m_chunkCachePreemption;
+}
+
+void H5FileAccessProfile::setChunkCachePreemption(double w0)
+{
+	m_chunkCachePreemption = (std::max)(0.0, (std::min)(1.0, w0));
+}
+
+hsize_t H5FileAccessProfile::pageSize() const
+{
+	return m_pageSize;
+}
+
+void H5FileAccessProfile::setPageSize(hsize_t size)
+{
+	m_pageSize = size;
+}
+
+size_t H5FileAccessProfile::pageBufferSize() const
+{
+	return m_pageBufferSize;
+}
+
+void H5FileAccessProfile::setPageBufferSize(size_t size)
+{
+	m_pageBufferSize = size;
+}
+
+hsize_t H5FileAccessProfile::alignmentThreshold() const
+{
+	return m_alignmentThreshold;
+}
+
+hsize_t H5FileAccessProfile::alignment() const
+{
+	return m_alignment;
+}
+
+void H5FileAccessProfile::setAlignment(hsize_t threshold, hsize_t alignment)
+{
+	m_alignmentThreshold = (std::max)(static_cast<hsize_t> (1), threshold);
+	m_alignment = (std::max)(static_cast<hsize_t> (1), alignment);
+}
+
+size_t H5FileAccessProfile::sieveBufferSize() const
+{
+	return m_sieveBufferSize;
+}
+
+void H5FileAccessProfile::setSieveBufferSize(size_t size)
+{
+	m_sieveBufferSize = size;
+}
+
+H5FileAccessProfile::LibVersion H5FileAccessProfile::libVersionLow() const
+{
+	return m_libVersionLow;
+}
+
+H5FileAccessProfile::LibVersion H5FileAccessProfile::libVersionHigh() const
+{
+	return m_libVersionHigh;
+}
+
+void H5FileAccessProfile::setLibVersionBounds(LibVersion low, LibVersion high)
+{
+	m_libVersionLow = low;
+	m_libVersionHigh = (std::max)(low, high);
+}
+
+bool H5FileAccessProfile::isDefault() const
+{
+	return m_metadataCacheSize == 0 &&
+			m_chunkCacheSize == 0 &&
+			m_chunkCacheSlots == 0 &&
+			m_chunkCachePreemption == DEFAULT_CHUNK_CACHE_PREEMPTION &&
+			m_pageSize == 0 &&
+			m_pageBufferSize == 0 &&
+			m_alignment == 1 &&
+			m_sieveBufferSize == 0 &&
+			m_libVersionLow == LibVersion::Earliest &&
+			m_libVersionHigh == LibVersion::Latest;
+}
+
+int H5FileAccessProfile::setupAccessProperty(hid_t propertyId, bool usePageBuffer) const
+{
+	if (isDefault()) {return IRIC_NO_ERROR;}
+
+	int ier;
+	if (m_metadataCacheSize != 0) {
+		ier = setupMetadataCache(propertyId, m_metadataCacheSize);
+		RETURN_IF_ERR;
+	}
+
+	if (m_chunkCacheSize != 0 || m_chunkCacheSlots != 0 || m_chunkCachePreemption != DEFAULT_CHUNK_CACHE_PREEMPTION) {
+		ier = setupChunkCache(propertyId, m_chunkCacheSize, m_chunkCacheSlots, m_chunkCachePreemption);
+		RETURN_IF_ERR;
+	}
+
+	herr_t status;
+	if (usePageBuffer && m_pageBufferSize != 0) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Pset_page_buffer_size");
+		status = H5Pset_page_buffer_size(propertyId, m_pageBufferSize, 0, 0);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Pset_page_buffer_size");
+		if (status < 0) {
+			_iric_logger_error("H5FileAccessProfile::setupAccessProperty", "H5Pset_page_buffer_size", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+
+	if (m_alignment > 1) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Pset_alignment");
+		status = H5Pset_alignment(propertyId, m_alignmentThreshold, m_alignment);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Pset_alignment");
+		if (status < 0) {
+			_iric_logger_error("H5FileAccessProfile::setupAccessProperty", "H5Pset_alignment", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+
+	if (m_sieveBufferSize != 0) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Pset_sieve_buf_size");
+		status = H5Pset_sieve_buf_size(propertyId, m_sieveBufferSize);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Pset_sieve_buf_size");
+		if (status < 0) {
+			_iric_logger_error("H5FileAccessProfile::setupAccessProperty", "H5Pset_sieve_buf_size", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+
+	if (m_libVersionLow != LibVersion::Earliest || m_libVersionHigh != LibVersion::Latest) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Pset_libver_bounds");
+		status = H5Pset_libver_bounds(propertyId, toH5LibVer(m_libVersionLow), toH5LibVer(m_libVersionHigh));
+		_IRIC_LOGGER_TRACE_CALL_END("H5Pset_libver_bounds");
+		if (status < 0) {
+			_iric_logger_error("H5FileAccessProfile::setupAccessProperty", "H5Pset_libver_bounds", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5FileAccessProfile::setupCreationProperty(hid_t propertyId) const
+{
+	if (m_pageSize == 0) {return IRIC_NO_ERROR;}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pset_file_space_strategy");
+	herr_t status = H5Pset_file_space_strategy(propertyId, H5F_FSPACE_STRATEGY_PAGE, false, 1);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pset_file_space_strategy");
+	if (status < 0) {
+		_iric_logger_error("H5FileAccessProfile::setupCreationProperty", "H5Pset_file_space_strategy", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pset_file_space_page_size");
+	status = H5Pset_file_space_page_size(propertyId, m_pageSize);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pset_file_space_page_size");
+	if (status < 0) {
+		_iric_logger_error("H5FileAccessProfile::setupCreationProperty", "H5Pset_file_space_page_size", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	return IRIC_NO_ERROR;
+}
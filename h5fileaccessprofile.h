@@ -0,0 +1,91 @@
+#ifndef H5FILEACCESSPROFILE_H
+#define H5FILEACCESSPROFILE_H
+
+#include "iriclib_global.h"
+
+#include <hdf5.h>
+
+namespace iRICLib {
+
+// HDF5 file access and file creation settings used when H5CgnsFile creates or opens a file.
+// Values that are 0 keep the HDF5 default.
+class IRICLIBDLL H5FileAccessProfile
+{
+public:
+	enum class Preset {
+		Default,
+		SolverWrite,
+		GuiRead,
+		Archive
+	};
+
+	enum class LibVersion {
+		Earliest,
+		V18,
+		V110,
+		Latest
+	};
+
+	H5FileAccessProfile();
+
+	static H5FileAccessProfile preset(Preset preset);
+
+	// initial size of the metadata cache (in bytes)
+	size_t metadataCacheSize() const;
+	void setMetadataCacheSize(size_t size);
+
+	// raw data chunk cache of each dataset (in bytes)
+	size_t chunkCacheSize() const;
+	void setChunkCacheSize(size_t size);
+
+	// number of hash slots of the chunk cache. a prime number about 100 times the number of chunks in the cache works best
+	size_t chunkCacheSlots() const;
+	void setChunkCacheSlots(size_t slots);
+
+	// preemption policy of the chunk cache, between 0 and 1. use 1 when chunks are written or read only once
+	double chunkCachePreemption() const;
+	void setChunkCachePreemption(double w0);
+
+	// page size of paged file space strategy (in bytes). used for new files only
+	hsize_t pageSize() const;
+	void setPageSize(hsize_t size);
+
+	// size of the page buffer (in bytes). used only for files created with paged file space strategy
+	size_t pageBufferSize() const;
+	void setPageBufferSize(size_t size);
+
+	// objects larger than threshold are aligned to multiples of alignment
+	hsize_t alignmentThreshold() const;
+	hsize_t alignment() const;
+	void setAlignment(hsize_t threshold, hsize_t alignment);
+
+	// buffer used to combine small raw data I/O on contiguous datasets (in bytes)
+	size_t sieveBufferSize() const;
+	void setSieveBufferSize(size_t size);
+
+	LibVersion libVersionLow() const;
+	LibVersion libVersionHigh() const;
+	void setLibVersionBounds(LibVersion low, LibVersion high);
+
+	bool isDefault() const;
+
+	int setupAccessProperty(hid_t propertyId, bool usePageBuffer) const;
+	int setupCreationProperty(hid_t propertyId) const;
+
+private:
+	size_t m_metadataCacheSize;
+	size_t m_chunkCacheSize;
+	size_t m_chunkCacheSlots;
+	double m_chunkCachePreemption;
+	hsize_t m_pageSize;
+	size_t m_pageBufferSize;
+	hsize_t m_alignmentThreshold;
+	hsize_t m_alignment;
+	size_t m_sieveBufferSize;
+	LibVersion m_libVersionLow;
+	LibVersion m_libVersionHigh;
+};
+
+} // namespace iRICLib
+
+#endif // H5FILEACCESSPROFILE_H
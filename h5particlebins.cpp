@@ -0,0 +1,269 @@
+#include "error_macros.h"
+#include "h5particlebins.h"
+#include "h5util.h"
+#include "iriclib_errorcodes.h"
+
+#include "internal/iric_logger.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace iRICLib;
+
+namespace {
+
+const std::string BINLEVEL = "BinLevel";
+const std::string BINBOX = "BinBox";
+const std::string BINCODES = "BinCodes";
+const std::string BINSTARTS = "BinStarts";
+
+// index of the bin that contains v. values outside are put into the bins on the edge.
+int binIndex(double v, double min, double max, int n)
+{
+	if (! (max > min)) {return 0;}
+
+	double t = (v - min) / (max - min) * n;
+	if (! (t >= 0)) {return 0;}
+	if (t >= n) {return n - 1;}
+	return static_cast<int> (t);
+}
+
+unsigned int spreadBits(unsigned int v)
+{
+	v &= 0x0000ffff;
+	v = (v | (v << 8)) & 0x00ff00ff;
+	v = (v | (v << 4)) & 0x0f0f0f0f;
+	v = (v | (v << 2)) & 0x33333333;
+	v = (v | (v << 1)) & 0x55555555;
+	return v;
+}
+
+unsigned int compactBits(unsigned int v)
+{
+	v &= 0x55555555;
+	v = (v | (v >> 1)) & 0x33333333;
+	v = (v | (v >> 2)) & 0x0f0f0f0f;
+	v = (v | (v >> 4)) & 0x00ff00ff;
+	v = (v | (v >> 8)) & 0x0000ffff;
+	return v;
+}
+
+unsigned int mortonCode(int i, int j)
+{
+	return spreadBits(static_cast<unsigned int> (i)) | (spreadBits(static_cast<unsigned int> (j)) << 1);
+}
+
+// sorts the indices by the codes with a radix sort (16 bits per pass). The sort is stable.
+void sortByCode(std::vector<unsigned int>* codes, std::vector<int>* indices)
+{
+	const size_t count = codes->size();
+	const unsigned int BUCKETS = 1 << 16;
+
+	std::vector<unsigned int> codes2(count);
+	std::vector<int> indices2(count);
+	std::vector<size_t> offsets(BUCKETS);
+	for (int shift = 0; shift < 32; shift += 16) {
+		std::fill(offsets.begin(), offsets.end(), 0);
+		for (size_t i = 0; i < count; ++i) {
+			++offsets[((*codes)[i] >> shift) & (BUCKETS - 1)];
+		}
+		if (offsets[0] == count) {continue;} // all codes have zero in these bits
+
+		size_t sum = 0;
+		for (unsigned int b = 0; b < BUCKETS; ++b) {
+			size_t c = offsets[b];
+			offsets[b] = sum;
+			sum += c;
+		}
+		for (size_t i = 0; i < count; ++i) {
+			size_t& pos = offsets[((*codes)[i] >> shift) & (BUCKETS - 1)];
+			codes2[pos] = (*codes)[i];
+			indices2[pos] = (*indices)[i];
+			++pos;
+		}
+		codes->swap(codes2);
+		indices->swap(indices2);
+	}
+}
+
+// finds the ranges of rows in the bins that intersect the rectangle. Adjacent bins are merged into one range.
+int findBinRanges(hid_t groupId, const std::string& prefix, double xmin, double xmax, double ymin, double ymax, std::vector<hsize_t>* starts, std::vector<hsize_t>* counts)
+{
+	std::vector<int> level, binCodes, binStarts;
+	std::vector<double> box;
+
+	int ier = H5Util::readDataArrayValue(groupId, prefix + BINLEVEL, &level);
+	RETURN_IF_ERR;
+	ier = H5Util::readDataArrayValue(groupId, prefix + BINBOX, &box);
+	RETURN_IF_ERR;
+	ier = H5Util::readDataArrayValue(groupId, prefix + BINCODES, &binCodes);
+	RETURN_IF_ERR;
+	ier = H5Util::readDataArrayValue(groupId, prefix + BINSTARTS, &binStarts);
+	RETURN_IF_ERR;
+
+	if (level.size() != 1 || box.size() != 4 || binStarts.size() != binCodes.size() + 1) {
+		_iric_logger_error("In H5ParticleBins::findRows(), the bin directory is broken");
+		return IRIC_WRONG_DATASIZE;
+	}
+
+	int n = 1 << level.at(0);
+	int imin = binIndex(xmin, box[0], box[1], n);
+	int imax = binIndex(xmax, box[0], box[1], n);
+	int jmin = binIndex(ymin, box[2], box[3], n);
+	int jmax = binIndex(ymax, box[2], box[3], n);
+
+	for (size_t b = 0; b < binCodes.size(); ++b) {
+		auto code = static_cast<unsigned int> (binCodes[b]);
+		auto i = static_cast<int> (compactBits(code));
+		auto j = static_cast<int> (compactBits(code >> 1));
+		if (i < imin || i > imax || j < jmin || j > jmax) {continue;}
+
+		hsize_t start = binStarts[b];
+		hsize_t count = binStarts[b + 1] - binStarts[b];
+		if (starts->size() > 0 && starts->back() + counts->back() == start) {
+			counts->back() += count;
+		} else {
+			starts->push_back(start);
+			counts->push_back(count);
+		}
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+void rowsToRanges(const std::vector<hsize_t>& rows, std::vector<hsize_t>* starts, std::vector<hsize_t>* counts)
+{
+	for (auto row : rows) {
+		if (starts->size() > 0 && starts->back() + counts->back() == row) {
+			++counts->back();
+		} else {
+			starts->push_back(row);
+			counts->push_back(1);
+		}
+	}
+}
+
+bool inRect(double x, double y, double xmin, double xmax, double ymin, double ymax)
+{
+	return x >= xmin && x <= xmax && y >= ymin && y <= ymax;
+}
+
+} // namespace
+
+void H5ParticleBins::sort(const double* x, const double* y, size_t count, int level, std::vector<double>* box, std::vector<int>* order, std::vector<int>* binCodes, std::vector<int>* binStarts)
+{
+	if (box->size() != 4) {
+		box->assign(4, 0);
+		if (count > 0) {
+			(*box)[0] = *std::min_element(x, x + count);
+			(*box)[1] = *std::max_element(x, x + count);
+			(*box)[2] = *std::min_element(y, y + count);
+			(*box)[3] = *std::max_element(y, y + count);
+		}
+	}
+
+	int n = 1 << level;
+	std::vector<unsigned int> codes(count);
+	order->resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		codes[i] = mortonCode(binIndex(x[i], (*box)[0], (*box)[1], n), binIndex(y[i], (*box)[2], (*box)[3], n));
+		(*order)[i] = static_cast<int> (i);
+	}
+	sortByCode(&codes, order);
+
+	binCodes->clear();
+	binStarts->clear();
+	for (size_t i = 0; i < count; ++i) {
+		if (i > 0 && codes[i] == codes[i - 1]) {continue;}
+
+		binCodes->push_back(static_cast<int> (codes[i]));
+		binStarts->push_back(static_cast<int> (i));
+	}
+	binStarts->push_back(static_cast<int> (count));
+}
+
+bool H5ParticleBins::exists(hid_t groupId, const std::string& prefix)
+{
+	auto name = prefix + BINCODES;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Lexists");
+	htri_t exists = H5Lexists(groupId, name.c_str(), H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Lexists");
+
+	return exists > 0;
+}
+
+int H5ParticleBins::write(hid_t groupId, const std::string& prefix, int level, const std::vector<double>& box, const std::vector<int>& binCodes, const std::vector<int>& binStarts)
+{
+	std::vector<int> levelValue(1, level);
+
+	int ier = H5Util::createDataArray(groupId, prefix + BINLEVEL, levelValue);
+	RETURN_IF_ERR;
+	ier = H5Util::createDataArray(groupId, prefix + BINBOX, box);
+	RETURN_IF_ERR;
+	ier = H5Util::createDataArray(groupId, prefix + BINCODES, binCodes);
+	RETURN_IF_ERR;
+	ier = H5Util::createDataArray(groupId, prefix + BINSTARTS, binStarts);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5ParticleBins::findRows(hid_t groupId, const std::string& prefix, const std::string& xName, const std::string& yName, double xmin, double xmax, double ymin, double ymax, std::vector<hsize_t>* rows)
+{
+	rows->clear();
+
+	if (! exists(groupId, prefix)) {
+		std::vector<double> x, y;
+		int ier = H5Util::readDataArrayValue(groupId, xName, &x);
+		RETURN_IF_ERR;
+		ier = H5Util::readDataArrayValue(groupId, yName, &y);
+		RETURN_IF_ERR;
+
+		size_t count = (std::min)(x.size(), y.size());
+		for (size_t i = 0; i < count; ++i) {
+			if (inRect(x[i], y[i], xmin, xmax, ymin, ymax)) {rows->push_back(i);}
+		}
+		return IRIC_NO_ERROR;
+	}
+
+	std::vector<hsize_t> starts, counts;
+	int ier = findBinRanges(groupId, prefix, xmin, xmax, ymin, ymax, &starts, &counts);
+	RETURN_IF_ERR;
+
+	hsize_t total = 0;
+	for (auto c : counts) {
+		total += c;
+	}
+	std::vector<double> x(total), y(total);
+	ier = H5Util::readDataArrayValueRanges(groupId, xName, starts, counts, x.data());
+	RETURN_IF_ERR;
+	ier = H5Util::readDataArrayValueRanges(groupId, yName, starts, counts, y.data());
+	RETURN_IF_ERR;
+
+	hsize_t pos = 0;
+	for (size_t r = 0; r < starts.size(); ++r) {
+		for (hsize_t i = 0; i < counts[r]; ++i) {
+			if (inRect(x[pos], y[pos], xmin, xmax, ymin, ymax)) {rows->push_back(starts[r] + i);}
+			++pos;
+		}
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5ParticleBins::readRows(hid_t groupId, const std::string& name, const std::vector<hsize_t>& rows, int* values)
+{
+	std::vector<hsize_t> starts, counts;
+	rowsToRanges(rows, &starts, &counts);
+
+	return H5Util::readDataArrayValueRanges(groupId, name, starts, counts, values);
+}
+
+int H5ParticleBins::readRows(hid_t groupId, const std::string& name, const std::vector<hsize_t>& rows, double* values)
+{
+	std::vector<hsize_t> starts, counts;
+	rowsToRanges(rows, &starts, &counts);
+
+	return H5Util::readDataArrayValueRanges(groupId, name, starts, counts, values);
+}
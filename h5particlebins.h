@@ -0,0 +1,56 @@
+#ifndef H5PARTICLEBINS_H
+#define H5PARTICLEBINS_H
+
+#include "iriclib_global.h"
+
+#include <hdf5.h>
+
+#include <string>
+#include <vector>
+
+namespace iRICLib {
+
+// Spatial bins of particles in a step.
+//
+// The particles are sorted into 2^level x 2^level bins over a bounding box, in Morton order, and a
+// directory of non-empty bins (bin code and first row) is stored with the arrays prefix + "BinLevel",
+// prefix + "BinBox", prefix + "BinCodes" and prefix + "BinStarts". Particles outside the box are put
+// into the bins on the edge. The particles in a rectangle can be read with hyperslabs of the bins
+// that intersect it, instead of reading all the particles.
+class IRICLIBDLL H5ParticleBins
+{
+public:
+	static const int MAX_LEVEL = 15;
+
+	// sorts the particles. box is (xmin, xmax, ymin, ymax); the bounding box of the particles is used when box is empty.
+	// order is the original index of each particle after sorting. binCodes and binStarts are for the non-empty bins,
+	// and binStarts has the number of particles at the end.
+	static void sort(const double* x, const double* y, size_t count, int level, std::vector<double>* box, std::vector<int>* order, std::vector<int>* binCodes, std::vector<int>* binStarts);
+	static bool exists(hid_t groupId, const std::string& prefix);
+	static int write(hid_t groupId, const std::string& prefix, int level, const std::vector<double>& box, const std::vector<int>& binCodes, const std::vector<int>& binStarts);
+
+	// finds the rows (in ascending order) of the particles in the rectangle, reading the coordinates
+	// xName and yName. The bins are used when they exist.
+	static int findRows(hid_t groupId, const std::string& prefix, const std::string& xName, const std::string& yName, double xmin, double xmax, double ymin, double ymax, std::vector<hsize_t>* rows);
+	// reads the values of the array at rows
+	static int readRows(hid_t groupId, const std::string& name, const std::vector<hsize_t>& rows, int* values);
+	static int readRows(hid_t groupId, const std::string& name, const std::vector<hsize_t>& rows, double* values);
+
+	// values sorted with order
+	template <typename V>
+	static std::vector<V> sorted(const std::vector<int>& order, const V* values);
+};
+
+template <typename V>
+std::vector<V> H5ParticleBins::sorted(const std::vector<int>& order, const V* values)
+{
+	std::vector<V> ret(order.size());
+	for (size_t i = 0; i < order.size(); ++i) {
+		ret[i] = values[order[i]];
+	}
+	return ret;
+}
+
+} // namespace iRICLib
+
+#endif // H5PARTICLEBINS_H
@@ -1,17 +1,20 @@
 #include "error_macros.h"
 #include "h5attributecloser.h"
 #include "h5datasetcloser.h"
+#include "h5datasetstoragepolicy.h"
 #include "h5dataspacecloser.h"
 #include "h5datatypecloser.h"
 #include "h5groupcloser.h"
-#include "h5objectcloser.h"
 #include "h5propertylistcloser.h"
 #include "h5util.h"
 #include "iriclib_errorcodes.h"
 
 #include "internal/iric_logger.h"
 
+#include <algorithm>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -25,8 +28,38 @@ using namespace iRICLib;
 
 namespace {
 
-template <typename V>
-int readValueT(hid_t groupId, const std::string& name, std::vector<V>* value, hid_t dataTypeNative)
+// size of one chunk of extendible datasets, in bytes
+const hsize_t EXTENDIBLE_CHUNK_SIZE = 4096;
+// readValueRangesT() selects up to this number of ranges as hyperslabs. More ranges are read with one span or with points
+const size_t MAX_SELECTED_RANGES = 32;
+
+std::map<hid_t, H5DatasetStoragePolicy> storagePolicies;
+std::mutex storagePoliciesMutex;
+
+void setupStringBuffer(const std::vector<std::string>& values, std::vector<char>* buffer, std::vector<hsize_t>* dims)
+{
+	size_t maxLen = 0;
+	for (const auto& v : values) {
+		auto len = v.length();
+		if (len > maxLen) {maxLen = len;}
+	}
+	maxLen += 1; // for \0
+
+	dims->clear();
+	dims->push_back(values.size());
+	dims->push_back(maxLen);
+
+	buffer->assign(maxLen * values.size(), 0);
+
+	for (size_t i = 0; i < values.size(); ++i) {
+		const auto& v = values.at(i);
+		memcpy(buffer->data() + i * maxLen, v.data(), v.length());
+	}
+}
+
+// getBuffer(size) returns the memory to read the whole dataset in, or nullptr when it is not available
+template <typename V, typename F>
+int readValueT(hid_t groupId, const std::string& name, hid_t dataTypeNative, F getBuffer)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5Dopen2");
 	hid_t dataSetId = H5Dopen2(groupId,name.c_str(), H5P_DEFAULT);
@@ -53,10 +86,17 @@ int readValueT(hid_t groupId, const std::string& name, std::vector<V>* value, hi
 	for (int i = 0; i < ndims; ++i) {
 		size *= dims[i];
 	}
-	value->assign(size, 0);
+
+	V* buffer = getBuffer(size);
+	if (buffer == nullptr && size > 0) {
+		std::ostringstream ss;
+		ss << "In readValueT(), " << name << " has " << size << " values, that does not fit in the buffer";
+		_iric_logger_error(ss.str());
+		return IRIC_WRONG_DATASIZE;
+	}
 
 	_IRIC_LOGGER_TRACE_CALL_START("H5Dread");
-	herr_t status = H5Dread(dataSetId, dataTypeNative, H5S_ALL, H5S_ALL, H5P_DEFAULT, value->data());
+	herr_t status = H5Dread(dataSetId, dataTypeNative, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer);
 	_IRIC_LOGGER_TRACE_CALL_END("H5Dread");
 
 	if (status < 0) {
@@ -68,10 +108,298 @@ int readValueT(hid_t groupId, const std::string& name, std::vector<V>* value, hi
 }
 
 template <typename V>
-int writeValueT(hid_t groupId, const std::string& name, const std::vector<V>& value, const std::vector<hsize_t>& dims, hid_t dataTypeInFile, hid_t dataTypeNative)
+int readValueT(hid_t groupId, const std::string& name, std::vector<V>* value, hid_t dataTypeNative)
+{
+	return readValueT<V>(groupId, name, dataTypeNative, [value](hsize_t size) -> V* {
+		value->assign(size, 0);
+		return value->data();
+	});
+}
+
+// reads directly into the caller's memory, that can hold count values
+template <typename V>
+int readValueT(hid_t groupId, const std::string& name, V* value, size_t count, hid_t dataTypeNative)
+{
+	return readValueT<V>(groupId, name, dataTypeNative, [value, count](hsize_t size) -> V* {
+		if (size > count) {return nullptr;}
+		return value;
+	});
+}
+
+// reads the values at indices (zero-based, in the flattened array) into value, that can hold indices.size() values
+template <typename V>
+int readValuePointsT(hid_t groupId, const std::string& name, const std::vector<hsize_t>& indices, V* value, hid_t dataTypeNative)
 {
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dopen2");
+	hid_t dataSetId = H5Dopen2(groupId, name.c_str(), H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dopen2");
+	if (dataSetId < 0) {
+		_iric_logger_error("readValuePointsT", "H5Dopen2", dataSetId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DatasetCloser dataSetCloser(dataSetId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dget_space");
+	hid_t dataSpaceId = H5Dget_space(dataSetId);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dget_space");
+	if (dataSpaceId < 0) {
+		_iric_logger_error("readValuePointsT", "H5Dget_space", dataSpaceId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DataSpaceCloser dataSpaceCloser(dataSpaceId);
+
+	if (indices.size() == 0) {return IRIC_NO_ERROR;}
+
+	int ndims = H5Sget_simple_extent_ndims(dataSpaceId);
+	std::vector<hsize_t> dims(ndims);
+	H5Sget_simple_extent_dims(dataSpaceId, dims.data(), nullptr);
+	hsize_t size = 1;
+	for (int i = 0; i < ndims; ++i) {
+		size *= dims[i];
+	}
+
+	// coordinates of the points, in row-major order
+	std::vector<hsize_t> coords(indices.size() * ndims);
+	for (size_t i = 0; i < indices.size(); ++i) {
+		hsize_t idx = indices[i];
+		if (idx >= size) {
+			std::ostringstream ss;
+			ss << "In readValuePointsT(), index " << idx << " is out of range for " << name << " that has " << size << " values";
+			_iric_logger_error(ss.str());
+			return IRIC_WRONG_DATASIZE;
+		}
+		for (int d = ndims - 1; d >= 0; --d) {
+			coords[i * ndims + d] = idx % dims[d];
+			idx /= dims[d];
+		}
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Sselect_elements");
+	herr_t status = H5Sselect_elements(dataSpaceId, H5S_SELECT_SET, indices.size(), coords.data());
+	_IRIC_LOGGER_TRACE_CALL_END("H5Sselect_elements");
+	if (status < 0) {
+		_iric_logger_error("readValuePointsT", "H5Sselect_elements", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	hsize_t memDims = indices.size();
+	hid_t memSpaceId = H5Screate_simple(1, &memDims, nullptr);
+	H5DataSpaceCloser memSpaceCloser(memSpaceId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dread");
+	status = H5Dread(dataSetId, dataTypeNative, memSpaceId, dataSpaceId, H5P_DEFAULT, value);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dread");
+	if (status < 0) {
+		_iric_logger_error("readValuePointsT", "H5Dread", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+// reads the ranges (starts[i], counts[i]) of a one-dimensional array into value, one after another.
+// the ranges should be sorted and should not overlap.
+template <typename V>
+int readValueRangesT(hid_t groupId, const std::string& name, const std::vector<hsize_t>& starts, const std::vector<hsize_t>& counts, V* value, hid_t dataTypeNative)
+{
+	hsize_t total = 0;
+	for (auto c : counts) {
+		total += c;
+	}
+	if (total == 0) {return IRIC_NO_ERROR;}
+
+	// building a selection of many hyperslabs takes time that grows faster than the number of them. When there are
+	// more than MAX_SELECTED_RANGES ranges, the span from the first to the last range is read and the ranges are copied
+	// from it, unless the span is more than 4 times as large as the values needed; then a point selection is read.
+	if (starts.size() > MAX_SELECTED_RANGES) {
+		hsize_t spanStart = starts.front();
+		hsize_t spanSize = starts.back() + counts.back() - spanStart;
+		if (spanSize > total * 4) {
+			std::vector<hsize_t> indices;
+			indices.reserve(total);
+			for (size_t i = 0; i < starts.size(); ++i) {
+				for (hsize_t j = 0; j < counts[i]; ++j) {
+					indices.push_back(starts[i] + j);
+				}
+			}
+			return readValuePointsT(groupId, name, indices, value, dataTypeNative);
+		}
+
+		std::vector<V> span(spanSize);
+		int ier = readValueRangesT(groupId, name, std::vector<hsize_t>(1, spanStart), std::vector<hsize_t>(1, spanSize), span.data(), dataTypeNative);
+		RETURN_IF_ERR;
+
+		V* v = value;
+		for (size_t i = 0; i < starts.size(); ++i) {
+			v = std::copy(span.begin() + (starts[i] - spanStart), span.begin() + (starts[i] - spanStart + counts[i]), v);
+		}
+		return IRIC_NO_ERROR;
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dopen2");
+	hid_t dataSetId = H5Dopen2(groupId, name.c_str(), H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dopen2");
+	if (dataSetId < 0) {
+		_iric_logger_error("readValueRangesT", "H5Dopen2", dataSetId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DatasetCloser dataSetCloser(dataSetId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dget_space");
+	hid_t dataSpaceId = H5Dget_space(dataSetId);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dget_space");
+	if (dataSpaceId < 0) {
+		_iric_logger_error("readValueRangesT", "H5Dget_space", dataSpaceId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DataSpaceCloser dataSpaceCloser(dataSpaceId);
+
+	hsize_t size = H5Sget_simple_extent_npoints(dataSpaceId);
+	if (H5Sget_simple_extent_ndims(dataSpaceId) != 1) {
+		std::ostringstream ss;
+		ss << "In readValueRangesT(), " << name << " is not a one-dimensional array";
+		_iric_logger_error(ss.str());
+		return IRIC_WRONG_DATASIZE;
+	}
+
+	H5S_seloper_t op = H5S_SELECT_SET;
+	for (size_t i = 0; i < starts.size(); ++i) {
+		if (counts[i] == 0) {continue;}
+		if (starts[i] + counts[i] > size) {
+			std::ostringstream ss;
+			ss << "In readValueRangesT(), range (" << starts[i] << ", " << counts[i] << ") is out of range for " << name << " that has " << size << " values";
+			_iric_logger_error(ss.str());
+			return IRIC_WRONG_DATASIZE;
+		}
+
+		herr_t status = H5Sselect_hyperslab(dataSpaceId, op, &(starts[i]), nullptr, &(counts[i]), nullptr);
+		if (status < 0) {
+			_iric_logger_error("readValueRangesT", "H5Sselect_hyperslab", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+		op = H5S_SELECT_OR;
+	}
+
 	_IRIC_LOGGER_TRACE_CALL_START("H5Screate_simple");
-	hid_t dataSpaceId = H5Screate_simple(static_cast<int> (dims.size()), dims.data(), nullptr);
+	hid_t memSpaceId = H5Screate_simple(1, &total, nullptr);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Screate_simple");
+	if (memSpaceId < 0) {
+		_iric_logger_error("readValueRangesT", "H5Screate_simple", memSpaceId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DataSpaceCloser memSpaceCloser(memSpaceId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dread");
+	herr_t status = H5Dread(dataSetId, dataTypeNative, memSpaceId, dataSpaceId, H5P_DEFAULT, value);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dread");
+	if (status < 0) {
+		_iric_logger_error("readValueRangesT", "H5Dread", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+// reads a (strided) hyperslab of an array with dims. dims, start, stride and count are in row-major order.
+// arrays stored in one dimension are also supported.
+template <typename V>
+int readValueRegionT(hid_t groupId, const std::string& name, const std::vector<hsize_t>& dims, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, V* value, hid_t dataTypeNative)
+{
+	hsize_t size = 1;
+	hsize_t regionSize = 1;
+	for (size_t i = 0; i < dims.size(); ++i) {
+		if (count[i] == 0 || stride[i] == 0 || start[i] + (count[i] - 1) * stride[i] >= dims[i]) {
+			std::ostringstream ss;
+			ss << "In readValueRegionT(), the region is out of range for " << name;
+			_iric_logger_error(ss.str());
+			return IRIC_WRONG_DATASIZE;
+		}
+		size *= dims[i];
+		regionSize *= count[i];
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dopen2");
+	hid_t dataSetId = H5Dopen2(groupId, name.c_str(), H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dopen2");
+	if (dataSetId < 0) {
+		_iric_logger_error("readValueRegionT", "H5Dopen2", dataSetId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DatasetCloser dataSetCloser(dataSetId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dget_space");
+	hid_t dataSpaceId = H5Dget_space(dataSetId);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dget_space");
+	if (dataSpaceId < 0) {
+		_iric_logger_error("readValueRegionT", "H5Dget_space", dataSpaceId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DataSpaceCloser dataSpaceCloser(dataSpaceId);
+
+	int ndims = H5Sget_simple_extent_ndims(dataSpaceId);
+	std::vector<hsize_t> fileDims(ndims);
+	H5Sget_simple_extent_dims(dataSpaceId, fileDims.data(), nullptr);
+
+	herr_t status;
+	if (fileDims == dims) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Sselect_hyperslab");
+		status = H5Sselect_hyperslab(dataSpaceId, H5S_SELECT_SET, start.data(), stride.data(), count.data(), nullptr);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Sselect_hyperslab");
+	} else if (ndims == 1 && fileDims[0] == size && dims.size() > 0) {
+		// select the rows of the region one by one
+		size_t last = dims.size() - 1;
+		std::vector<hsize_t> pitch(dims.size(), 1);
+		for (size_t d = last; d > 0; --d) {
+			pitch[d - 1] = pitch[d] * dims[d];
+		}
+		hsize_t rows = regionSize / count[last];
+		status = H5Sselect_none(dataSpaceId);
+		for (hsize_t r = 0; r < rows && status >= 0; ++r) {
+			hsize_t rowStart = start[last];
+			hsize_t rest = r;
+			for (size_t d = last; d > 0; --d) {
+				hsize_t idx = rest % count[d - 1];
+				rest /= count[d - 1];
+				rowStart += (start[d - 1] + idx * stride[d - 1]) * pitch[d - 1];
+			}
+			status = H5Sselect_hyperslab(dataSpaceId, H5S_SELECT_OR, &rowStart, &stride[last], &count[last], nullptr);
+		}
+	} else {
+		std::ostringstream ss;
+		ss << "In readValueRegionT(), the size of " << name << " does not match the grid size";
+		_iric_logger_error(ss.str());
+		return IRIC_WRONG_DATASIZE;
+	}
+	if (status < 0) {
+		_iric_logger_error("readValueRegionT", "H5Sselect_hyperslab", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	hid_t memSpaceId = H5Screate_simple(1, &regionSize, nullptr);
+	H5DataSpaceCloser memSpaceCloser(memSpaceId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dread");
+	status = H5Dread(dataSetId, dataTypeNative, memSpaceId, dataSpaceId, H5P_DEFAULT, value);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dread");
+	if (status < 0) {
+		_iric_logger_error("readValueRegionT", "H5Dread", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+template <typename V>
+int writeValueT(hid_t groupId, const std::string& name, const V* value, const std::vector<hsize_t>& dims, hid_t dataTypeInFile, hid_t dataTypeNative, bool extendible = false, hsize_t chunkBytes = EXTENDIBLE_CHUNK_SIZE)
+{
+	// extendible datasets can grow in the first dimension with H5Dset_extent()
+	std::vector<hsize_t> maxDims = dims;
+	if (extendible) {
+		maxDims[0] = H5S_UNLIMITED;
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Screate_simple");
+	hid_t dataSpaceId = H5Screate_simple(static_cast<int> (dims.size()), dims.data(), maxDims.data());
 	_IRIC_LOGGER_TRACE_CALL_END("H5Screate_simple");
 	if (dataSpaceId < 0) {
 		_iric_logger_error("writeValueT", "H5Screate_simple", dataSpaceId);
@@ -80,8 +408,33 @@ int writeValueT(hid_t groupId, const std::string& name, const std::vector<V>& va
 
 	H5DataSpaceCloser dataSpaceCloser(dataSpaceId);
 
+	hid_t dataSetCreationProperty;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDatasetCreationProperty");
+	int ier = H5Util::createDatasetCreationProperty(groupId, dims, dataTypeInFile, &dataSetCreationProperty);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDatasetCreationProperty", ier);
+	RETURN_IF_ERR;
+
+	H5PropertyListCloser dataSetCreationPropertyCloser(dataSetCreationProperty);
+
+	if (extendible) {
+		std::vector<hsize_t> chunkDims = dims;
+		hsize_t rowSize = H5Tget_size(dataTypeInFile);
+		for (size_t i = 1; i < dims.size(); ++i) {
+			rowSize *= dims.at(i);
+		}
+		chunkDims[0] = (std::max)(static_cast<hsize_t> (1), chunkBytes / (std::max)(static_cast<hsize_t> (1), rowSize));
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5Pset_chunk");
+		herr_t status = H5Pset_chunk(dataSetCreationProperty, static_cast<int> (chunkDims.size()), chunkDims.data());
+		_IRIC_LOGGER_TRACE_CALL_END("H5Pset_chunk");
+		if (status < 0) {
+			_iric_logger_error("writeValueT", "H5Pset_chunk", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+
 	_IRIC_LOGGER_TRACE_CALL_START("H5Dcreate2");
-	hid_t dataSetId = H5Dcreate2(groupId, name.c_str(), dataTypeInFile, dataSpaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+	hid_t dataSetId = H5Dcreate2(groupId, name.c_str(), dataTypeInFile, dataSpaceId, H5P_DEFAULT, dataSetCreationProperty, H5P_DEFAULT);
 	_IRIC_LOGGER_TRACE_CALL_END("H5Dcreate2");
 	if (dataSetId < 0) {
 		_iric_logger_error("writeValueT", "H5Dcreate2", dataSetId);
@@ -91,7 +444,7 @@ int writeValueT(hid_t groupId, const std::string& name, const std::vector<V>& va
 	H5DatasetCloser dataSetCloser(dataSetId);
 
 	_IRIC_LOGGER_TRACE_CALL_START("H5Dwrite");
-	herr_t status = H5Dwrite(dataSetId, dataTypeNative, H5S_ALL, H5S_ALL, H5P_DEFAULT, value.data());
+	herr_t status = H5Dwrite(dataSetId, dataTypeNative, H5S_ALL, H5S_ALL, H5P_DEFAULT, value);
 	_IRIC_LOGGER_TRACE_CALL_END("H5Dwrite");
 
 	if (status < 0) {
@@ -102,6 +455,12 @@ int writeValueT(hid_t groupId, const std::string& name, const std::vector<V>& va
 	return IRIC_NO_ERROR;
 }
 
+template <typename V>
+int writeValueT(hid_t groupId, const std::string& name, const std::vector<V>& value, const std::vector<hsize_t>& dims, hid_t dataTypeInFile, hid_t dataTypeNative, bool extendible = false)
+{
+	return writeValueT(groupId, name, value.data(), dims, dataTypeInFile, dataTypeNative, extendible);
+}
+
 template <typename V>
 int writeValueT(hid_t groupId, const std::string& name, const std::vector<V>& value, hid_t dataTypeInFile, hid_t dataTypeNative)
 {
@@ -131,7 +490,7 @@ int writeValueT(hid_t groupId, const std::string& name, const V& value, hid_t da
 }
 
 template <typename V>
-int createGroupWithValuesT(hid_t groupId, const std::string& name, const std::string& label, const std::vector<V>& values, const std::vector<hsize_t>& dims, const std::string& typeAtt, hid_t dataTypeInFile, hid_t dataTypeNative, hid_t* newGroup)
+int createGroupWithValuesT(hid_t groupId, const std::string& name, const std::string& label, const V* values, const std::vector<hsize_t>& dims, const std::string& typeAtt, hid_t dataTypeInFile, hid_t dataTypeNative, hid_t* newGroup, bool extendible = false, hsize_t chunkBytes = EXTENDIBLE_CHUNK_SIZE)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5Pcreate");
 	hid_t groupCreationProperty = H5Pcreate(H5P_GROUP_CREATE);
@@ -158,7 +517,7 @@ int createGroupWithValuesT(hid_t groupId, const std::string& name, const std::st
 	}
 
 	_IRIC_LOGGER_TRACE_CALL_START("writeValueT");
-	int ier = writeValueT(newGroupId, " data", values, dims, dataTypeInFile, dataTypeNative);
+	int ier = writeValueT(newGroupId, " data", values, dims, dataTypeInFile, dataTypeNative, extendible, chunkBytes);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("writeValueT", ier);
 
 	_IRIC_LOGGER_TRACE_CALL_START("H5Util::writeAttribute");
@@ -193,6 +552,12 @@ int createGroupWithValuesT(hid_t groupId, const std::string& name, const std::st
 	return IRIC_NO_ERROR;
 }
 
+template <typename V>
+int createGroupWithValuesT(hid_t groupId, const std::string& name, const std::string& label, const std::vector<V>& values, const std::vector<hsize_t>& dims, const std::string& typeAtt, hid_t dataTypeInFile, hid_t dataTypeNative, hid_t* newGroup, bool extendible = false)
+{
+	return createGroupWithValuesT(groupId, name, label, values.data(), dims, typeAtt, dataTypeInFile, dataTypeNative, newGroup, extendible);
+}
+
 template <typename V>
 int createGroupWithValuesT(hid_t groupId, const std::string& name, const std::string& label, const std::vector<V>& values, const std::string& typeAtt, hid_t dataTypeInFile, hid_t dataTypeNative, hid_t* newGroup)
 {
@@ -232,6 +597,17 @@ int readGroupValueT(hid_t groupId, std::vector<V>* value, hid_t dataTypeNative)
 	return IRIC_NO_ERROR;
 }
 
+template <typename V>
+int readGroupValueT(hid_t groupId, V* value, size_t count, hid_t dataTypeNative)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("readValueT");
+	int ier = readValueT(groupId, " data", value, count, dataTypeNative);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("readValueT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 template <typename V>
 int updateGroupValueT(hid_t groupId, const std::vector<V>& value, const std::vector<hsize_t>& dims, hid_t dataTypeInFile, hid_t dataTypeNative)
 {
@@ -347,6 +723,283 @@ int updateOrCreateDataArrayT(hid_t groupId, const std::string& name, const std::
 	return IRIC_NO_ERROR;
 }
 
+template <typename V>
+int appendGroupValueT(hid_t groupId, const std::vector<V>& values, const std::vector<hsize_t>& dims, hsize_t writtenCount, hid_t dataTypeInFile, hid_t dataTypeNative)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dopen2");
+	hid_t dataSetId = H5Dopen2(groupId, " data", H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dopen2");
+
+	if (dataSetId < 0) {
+		_iric_logger_error("appendGroupValueT", "H5Dopen2", dataSetId);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	bool appendable = false;
+	{
+		H5DatasetCloser dataSetCloser(dataSetId);
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5Dget_space");
+		hid_t fileSpaceId = H5Dget_space(dataSetId);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Dget_space");
+		if (fileSpaceId < 0) {
+			_iric_logger_error("appendGroupValueT", "H5Dget_space", fileSpaceId);
+			return IRIC_H5_CALL_ERROR;
+		}
+		H5DataSpaceCloser fileSpaceCloser(fileSpaceId);
+
+		int ndims = H5Sget_simple_extent_ndims(fileSpaceId);
+		if (ndims == static_cast<int> (dims.size())) {
+			std::vector<hsize_t> curDims(ndims), maxDims(ndims);
+			H5Sget_simple_extent_dims(fileSpaceId, curDims.data(), maxDims.data());
+
+			appendable = (maxDims[0] == H5S_UNLIMITED) && (curDims[0] == writtenCount) && (writtenCount <= dims[0]);
+			for (int i = 1; i < ndims; ++i) {
+				appendable = appendable && (curDims[i] == dims[i]);
+			}
+		}
+
+		if (appendable) {
+			if (writtenCount == dims[0]) {return IRIC_NO_ERROR;}
+
+			_IRIC_LOGGER_TRACE_CALL_START("H5Dset_extent");
+			herr_t status = H5Dset_extent(dataSetId, dims.data());
+			_IRIC_LOGGER_TRACE_CALL_END("H5Dset_extent");
+			if (status < 0) {
+				_iric_logger_error("appendGroupValueT", "H5Dset_extent", status);
+				return IRIC_H5_CALL_ERROR;
+			}
+
+			_IRIC_LOGGER_TRACE_CALL_START("H5Dget_space");
+			hid_t newSpaceId = H5Dget_space(dataSetId);
+			_IRIC_LOGGER_TRACE_CALL_END("H5Dget_space");
+			if (newSpaceId < 0) {
+				_iric_logger_error("appendGroupValueT", "H5Dget_space", newSpaceId);
+				return IRIC_H5_CALL_ERROR;
+			}
+			H5DataSpaceCloser newSpaceCloser(newSpaceId);
+
+			std::vector<hsize_t> start(dims.size(), 0);
+			std::vector<hsize_t> count = dims;
+			start[0] = writtenCount;
+			count[0] = dims[0] - writtenCount;
+
+			_IRIC_LOGGER_TRACE_CALL_START("H5Sselect_hyperslab");
+			status = H5Sselect_hyperslab(newSpaceId, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr);
+			_IRIC_LOGGER_TRACE_CALL_END("H5Sselect_hyperslab");
+			if (status < 0) {
+				_iric_logger_error("appendGroupValueT", "H5Sselect_hyperslab", status);
+				return IRIC_H5_CALL_ERROR;
+			}
+
+			_IRIC_LOGGER_TRACE_CALL_START("H5Screate_simple");
+			hid_t memSpaceId = H5Screate_simple(static_cast<int> (count.size()), count.data(), nullptr);
+			_IRIC_LOGGER_TRACE_CALL_END("H5Screate_simple");
+			if (memSpaceId < 0) {
+				_iric_logger_error("appendGroupValueT", "H5Screate_simple", memSpaceId);
+				return IRIC_H5_CALL_ERROR;
+			}
+			H5DataSpaceCloser memSpaceCloser(memSpaceId);
+
+			hsize_t rowSize = 1;
+			for (size_t i = 1; i < dims.size(); ++i) {
+				rowSize *= dims.at(i);
+			}
+
+			_IRIC_LOGGER_TRACE_CALL_START("H5Dwrite");
+			status = H5Dwrite(dataSetId, dataTypeNative, memSpaceId, newSpaceId, H5P_DEFAULT, values.data() + writtenCount * rowSize);
+			_IRIC_LOGGER_TRACE_CALL_END("H5Dwrite");
+			if (status < 0) {
+				_iric_logger_error("appendGroupValueT", "H5Dwrite", status);
+				return IRIC_H5_CALL_ERROR;
+			}
+
+			return IRIC_NO_ERROR;
+		}
+	}
+
+	// the data on disk can not be extended (written by older versions, or shape changed). rewrite it.
+	_IRIC_LOGGER_TRACE_CALL_START("H5Ldelete");
+	herr_t status = H5Ldelete(groupId, " data", H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Ldelete");
+
+	if (status < 0) {
+		_iric_logger_error("appendGroupValueT", "H5Ldelete", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("writeValueT");
+	int ier = writeValueT(groupId, " data", values, dims, dataTypeInFile, dataTypeNative, true);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("writeValueT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+template <typename V>
+int appendOrCreateDataArrayT(hid_t groupId, const std::string& name, const std::vector<V>& values, const std::vector<hsize_t>& dims, hsize_t writtenCount, const std::string& typeAtt, hid_t dataTypeInFile, hid_t dataTypeNative, std::unordered_set<std::string>* names)
+{
+	std::unordered_set<std::string> tmpNames;
+	if (names == nullptr) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Util::getGroupNames");
+		int ier = H5Util::getGroupNames(groupId, &tmpNames);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getGroupNames", ier);
+		RETURN_IF_ERR;
+
+		names = &tmpNames;
+	}
+
+	if (names->find(name) != names->end()) {
+		hid_t gId;
+		_IRIC_LOGGER_TRACE_CALL_START("H5Util::openGroup");
+		int ier = H5Util::openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::openGroup", ier);
+		RETURN_IF_ERR;
+
+		H5GroupCloser closer(gId);
+
+		_IRIC_LOGGER_TRACE_CALL_START("appendGroupValueT");
+		ier = appendGroupValueT(gId, values, dims, writtenCount, dataTypeInFile, dataTypeNative);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("appendGroupValueT", ier);
+		RETURN_IF_ERR;
+	} else {
+		_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValuesT");
+		int ier = createGroupWithValuesT(groupId, name, DATAARRAY_LABEL, values, dims, typeAtt, dataTypeInFile, dataTypeNative, nullptr, true);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValuesT", ier);
+		RETURN_IF_ERR;
+
+		names->insert(name);
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+template <typename V>
+int appendGroupValueT(hid_t groupId, const V* values, size_t count, hid_t dataTypeNative)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dopen2");
+	hid_t dataSetId = H5Dopen2(groupId, " data", H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dopen2");
+
+	if (dataSetId < 0) {
+		_iric_logger_error("appendGroupValueT", "H5Dopen2", dataSetId);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	H5DatasetCloser dataSetCloser(dataSetId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dget_space");
+	hid_t fileSpaceId = H5Dget_space(dataSetId);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dget_space");
+	if (fileSpaceId < 0) {
+		_iric_logger_error("appendGroupValueT", "H5Dget_space", fileSpaceId);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	hsize_t curDim, maxDim;
+	{
+		H5DataSpaceCloser fileSpaceCloser(fileSpaceId);
+
+		if (H5Sget_simple_extent_ndims(fileSpaceId) != 1) {
+			_iric_logger_error("In appendGroupValueT(), the data is not an one-dimensional array");
+			return IRIC_WRONG_DATASIZE;
+		}
+		H5Sget_simple_extent_dims(fileSpaceId, &curDim, &maxDim);
+	}
+	if (maxDim != H5S_UNLIMITED) {
+		_iric_logger_error("In appendGroupValueT(), the data is not extendible");
+		return IRIC_WRONG_DATASIZE;
+	}
+	if (count == 0) {return IRIC_NO_ERROR;}
+
+	hsize_t newDim = curDim + count;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dset_extent");
+	herr_t status = H5Dset_extent(dataSetId, &newDim);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dset_extent");
+	if (status < 0) {
+		_iric_logger_error("appendGroupValueT", "H5Dset_extent", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dget_space");
+	hid_t newSpaceId = H5Dget_space(dataSetId);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dget_space");
+	if (newSpaceId < 0) {
+		_iric_logger_error("appendGroupValueT", "H5Dget_space", newSpaceId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DataSpaceCloser newSpaceCloser(newSpaceId);
+
+	hsize_t c = count;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Sselect_hyperslab");
+	status = H5Sselect_hyperslab(newSpaceId, H5S_SELECT_SET, &curDim, nullptr, &c, nullptr);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Sselect_hyperslab");
+	if (status < 0) {
+		_iric_logger_error("appendGroupValueT", "H5Sselect_hyperslab", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Screate_simple");
+	hid_t memSpaceId = H5Screate_simple(1, &c, nullptr);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Screate_simple");
+	if (memSpaceId < 0) {
+		_iric_logger_error("appendGroupValueT", "H5Screate_simple", memSpaceId);
+		return IRIC_H5_CALL_ERROR;
+	}
+	H5DataSpaceCloser memSpaceCloser(memSpaceId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dwrite");
+	status = H5Dwrite(dataSetId, dataTypeNative, memSpaceId, newSpaceId, H5P_DEFAULT, values);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dwrite");
+	if (status < 0) {
+		_iric_logger_error("appendGroupValueT", "H5Dwrite", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+template <typename V>
+int appendDataArrayT(hid_t groupId, const std::string& name, const V* values, size_t count, hsize_t chunkSize, const std::string& typeAtt, hid_t dataTypeInFile, hid_t dataTypeNative, std::unordered_set<std::string>* names)
+{
+	std::unordered_set<std::string> tmpNames;
+	if (names == nullptr) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Util::getGroupNames");
+		int ier = H5Util::getGroupNames(groupId, &tmpNames);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getGroupNames", ier);
+		RETURN_IF_ERR;
+
+		names = &tmpNames;
+	}
+
+	if (names->find(name) != names->end()) {
+		hid_t gId;
+		_IRIC_LOGGER_TRACE_CALL_START("H5Util::openGroup");
+		int ier = H5Util::openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::openGroup", ier);
+		RETURN_IF_ERR;
+
+		H5GroupCloser closer(gId);
+
+		_IRIC_LOGGER_TRACE_CALL_START("appendGroupValueT");
+		ier = appendGroupValueT(gId, values, count, dataTypeNative);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("appendGroupValueT", ier);
+		RETURN_IF_ERR;
+	} else {
+		std::vector<hsize_t> dims;
+		dims.push_back(count);
+
+		_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValuesT");
+		int ier = createGroupWithValuesT(groupId, name, DATAARRAY_LABEL, values, dims, typeAtt, dataTypeInFile, dataTypeNative, nullptr, true, chunkSize);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValuesT", ier);
+		RETURN_IF_ERR;
+
+		names->insert(name);
+	}
+
+	return IRIC_NO_ERROR;
+}
+
 template <typename V>
 int writeAttributeT(hid_t groupId, const std::string& name, const V& value, hid_t dataTypeInFile, hid_t dataTypeNative)
 {
@@ -614,8 +1267,19 @@ int copyDataset(hid_t srcId, hid_t tgtId, const std::string& name)
 		return IRIC_H5_CALL_ERROR;
 	}
 
+	std::vector<hsize_t> dims(H5Sget_simple_extent_ndims(srcDataSpaceId));
+	H5Sget_simple_extent_dims(srcDataSpaceId, dims.data(), nullptr);
+
+	hid_t tgtDatasetCreationProperty;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDatasetCreationProperty");
+	ier = H5Util::createDatasetCreationProperty(tgtId, dims, tgtDataTypeId, &tgtDatasetCreationProperty);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDatasetCreationProperty", ier);
+	RETURN_IF_ERR;
+
+	H5PropertyListCloser tgtDatasetCreationPropertyCloser(tgtDatasetCreationProperty);
+
 	_IRIC_LOGGER_TRACE_CALL_START("H5Dcreate2");
-	hid_t tgtDatasetId = H5Dcreate2(tgtId, name.c_str(), tgtDataTypeId, tgtDataSpaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+	hid_t tgtDatasetId = H5Dcreate2(tgtId, name.c_str(), tgtDataTypeId, tgtDataSpaceId, H5P_DEFAULT, tgtDatasetCreationProperty, H5P_DEFAULT);
 	_IRIC_LOGGER_TRACE_CALL_END("H5Dcreate2");
 
 	H5DatasetCloser tgtDatasetCloser(tgtDatasetId);
@@ -718,50 +1382,44 @@ int copyChildren(hid_t srcGroupId, hid_t tgtGroupId)
 	return IRIC_NO_ERROR;
 }
 
-int getObjectNames(hid_t groupId, H5O_type_t objectType, std::vector<std::string>* names)
+herr_t collectLinkName(hid_t /*groupId*/, const char* name, const H5L_info_t* /*info*/, void* data)
 {
-	H5G_info_t info;
-	_IRIC_LOGGER_TRACE_CALL_START("H5Gget_info");
-	herr_t status = H5Gget_info(groupId, &info);
-	_IRIC_LOGGER_TRACE_CALL_END("H5Gget_info");
+	auto names = reinterpret_cast<std::vector<std::string>*> (data);
+	names->push_back(name);
+	return 0;
+}
+
+int getLinkNames(hid_t groupId, std::vector<std::string>* names)
+{
+	// one pass over the creation order index. looking up each link by its index costs
+	// a search in the index, that grows with the number of links in the group
+	hsize_t idx = 0;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Literate");
+	herr_t status = H5Literate(groupId, H5_INDEX_CRT_ORDER, H5_ITER_INC, &idx, collectLinkName, names);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Literate");
 
 	if (status < 0) {
-		_iric_logger_error("H5Util::getGroupNames", "H5Gget_info", status);
+		_iric_logger_error("H5Util::getLinkNames", "H5Literate", status);
 		return IRIC_H5_CALL_ERROR;
 	}
 
-	for (hsize_t i = 0; i < info.nlinks; ++i) {
-		_IRIC_LOGGER_TRACE_CALL_START("H5Lget_name_by_idx");
-		ssize_t nameLen = H5Lget_name_by_idx(groupId, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, i, nullptr, 0, H5P_DEFAULT);
-		_IRIC_LOGGER_TRACE_CALL_END("H5Lget_name_by_idx");
-
-		if (nameLen < 0) {continue;}
-
-		std::vector<char> buffer(nameLen + 1);
-		_IRIC_LOGGER_TRACE_CALL_START("H5Lget_name_by_idx");
-		H5Lget_name_by_idx(groupId, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, i, buffer.data(), buffer.size(), H5P_DEFAULT);
-		_IRIC_LOGGER_TRACE_CALL_END("H5Lget_name_by_idx");
-
-		std::string name = buffer.data();
-
-		_IRIC_LOGGER_TRACE_CALL_START("H5Oopen");
-		hid_t oid = H5Oopen(groupId, name.c_str(), H5P_DEFAULT);
-		_IRIC_LOGGER_TRACE_CALL_END("H5Oopen");
-
-		if (oid < 0) {
-			_iric_logger_error("H5Util::getGroupNames", "H5Open", oid);
-			return IRIC_H5_CALL_ERROR;
-		}
+	return IRIC_NO_ERROR;
+}
 
-		H5ObjectCloser objectCloser(oid);
+int getObjectNames(hid_t groupId, H5O_type_t objectType, std::vector<std::string>* names)
+{
+	std::vector<std::string> linkNames;
+	int ier = getLinkNames(groupId, &linkNames);
+	RETURN_IF_ERR;
 
+	for (const auto& name : linkNames) {
 		H5O_info2_t info;
-		_IRIC_LOGGER_TRACE_CALL_START("H5Oget_info");
-		status = H5Oget_info(oid, &info, H5O_INFO_BASIC);
-		_IRIC_LOGGER_TRACE_CALL_END("H5Oget_info");
+		_IRIC_LOGGER_TRACE_CALL_START("H5Oget_info_by_name");
+		herr_t status = H5Oget_info_by_name(groupId, name.c_str(), &info, H5O_INFO_BASIC, H5P_DEFAULT);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Oget_info_by_name");
 
 		if (status < 0) {
-			_iric_logger_error("H5Util::getGroupNames", "H5Oget_info", status);
+			_iric_logger_error("H5Util::getGroupNames", "H5Oget_info_by_name", status);
 			return IRIC_H5_CALL_ERROR;
 		}
 
@@ -868,6 +1526,24 @@ int H5Util::getDatasetNames(hid_t groupId, std::unordered_set<std::string>* name
 	return IRIC_NO_ERROR;
 }
 
+int H5Util::getLinkNames(hid_t groupId, std::vector<std::string>* names)
+{
+	return ::getLinkNames(groupId, names);
+}
+
+int H5Util::getLinkNames(hid_t groupId, std::unordered_set<std::string>* names)
+{
+	std::vector<std::string> namesVec;
+
+	int ier = getLinkNames(groupId, &namesVec);
+	RETURN_IF_ERR;
+
+	for (const auto& name : namesVec) {
+		names->insert(name);
+	}
+	return IRIC_NO_ERROR;
+}
+
 int H5Util::createGroup(hid_t groupId, const std::string& name, hid_t* newGroup)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5Pcreate");
@@ -1206,6 +1882,36 @@ int H5Util::createGroupWithValue(hid_t groupId, const std::string& name, const s
 	return IRIC_NO_ERROR;
 }
 
+int H5Util::createGroupWithValue(hid_t groupId, const std::string& name, const std::string& label, const int* value, const std::vector<hsize_t>& dims, hid_t* newGroup)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValuesT");
+	int ier = createGroupWithValuesT(groupId, name, label, value, dims, "I4", H5T_STD_I32LE, H5T_NATIVE_INT32, newGroup);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValuesT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::createGroupWithValue(hid_t groupId, const std::string& name, const std::string& label, const float* value, const std::vector<hsize_t>& dims, hid_t* newGroup)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValuesT");
+	int ier = createGroupWithValuesT(groupId, name, label, value, dims, "R4", H5T_IEEE_F32LE, H5T_NATIVE_FLOAT, newGroup);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValuesT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::createGroupWithValue(hid_t groupId, const std::string& name, const std::string& label, const double* value, const std::vector<hsize_t>& dims, hid_t* newGroup)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValuesT");
+	int ier = createGroupWithValuesT(groupId, name, label, value, dims, "R8", H5T_IEEE_F64LE, H5T_NATIVE_DOUBLE, newGroup);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValuesT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::string& value)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
@@ -1239,25 +1945,94 @@ int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::v
 int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<float>& value)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
-	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value);
+	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<double>& value)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
+	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<char>& value, const std::vector<hsize_t>& dims)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
+	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<int>& value, const std::vector<hsize_t>& dims)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
+	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<float>& value, const std::vector<hsize_t>& dims)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
+	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<double>& value, const std::vector<hsize_t>& dims)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
+	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const int* value, size_t count)
+{
+	std::vector<hsize_t> dims;
+	dims.push_back(count);
+
+	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
+	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValue", ier);
 	RETURN_IF_ERR;
 
 	return IRIC_NO_ERROR;
 }
 
-int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<double>& value)
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const float* value, size_t count)
 {
+	std::vector<hsize_t> dims;
+	dims.push_back(count);
+
 	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
-	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value);
+	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValue", ier);
 	RETURN_IF_ERR;
 
 	return IRIC_NO_ERROR;
 }
 
-int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<char>& value, const std::vector<hsize_t>& dims)
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const double* value, size_t count)
 {
+	std::vector<hsize_t> dims;
+	dims.push_back(count);
+
 	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
 	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("createGroupWithValue", ier);
@@ -1266,7 +2041,7 @@ int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::v
 	return IRIC_NO_ERROR;
 }
 
-int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<int>& value, const std::vector<hsize_t>& dims)
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const int* value, const std::vector<hsize_t>& dims)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
 	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
@@ -1276,7 +2051,7 @@ int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::v
 	return IRIC_NO_ERROR;
 }
 
-int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<float>& value, const std::vector<hsize_t>& dims)
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const float* value, const std::vector<hsize_t>& dims)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
 	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
@@ -1286,7 +2061,7 @@ int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::v
 	return IRIC_NO_ERROR;
 }
 
-int H5Util::createDataArray(hid_t groupId, const std::string& name, const std::vector<double>& value, const std::vector<hsize_t>& dims)
+int H5Util::createDataArray(hid_t groupId, const std::string& name, const double* value, const std::vector<hsize_t>& dims)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("createGroupWithValue");
 	int ier = createGroupWithValue(groupId, name, DATAARRAY_LABEL, value, dims);
@@ -1347,24 +2122,10 @@ int H5Util::updateOrCreateDataArray(hid_t groupId, const std::string& name, cons
 
 int H5Util::updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<std::string>& value, std::unordered_set<std::string>* names)
 {
-	size_t maxLen = 0;
-	for (const auto& v : value) {
-		auto len = v.length();
-		if (len > maxLen) {maxLen = len;}
-	}
-	maxLen += 1; // for \0
-
 	std::vector<hsize_t> dims;
-	dims.push_back(value.size());
-	dims.push_back(maxLen);
-
 	std::vector<char> buffer;
-	buffer.assign(maxLen * value.size(), 0);
+	setupStringBuffer(value, &buffer, &dims);
 
-	for (size_t i = 0; i < value.size(); ++i) {
-		const auto& v = value.at(i);
-		memcpy(buffer.data() + i * maxLen, v.data(), v.length());
-	}
 	_IRIC_LOGGER_TRACE_CALL_START("updateOrCreateDataArrayT");
 	int ier = updateOrCreateDataArrayT(groupId, name, buffer, dims, "C1", H5T_STD_I8LE, H5T_NATIVE_INT8, names);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("updateOrCreateDataArrayT", ier);
@@ -1413,6 +2174,117 @@ int H5Util::updateOrCreateDataArray(hid_t groupId, const std::string& name, cons
 	return IRIC_NO_ERROR;
 }
 
+int H5Util::appendOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<int>& value, hsize_t writtenCount, std::unordered_set<std::string>* names)
+{
+	std::vector<hsize_t> dims;
+	dims.push_back(value.size());
+
+	_IRIC_LOGGER_TRACE_CALL_START("appendOrCreateDataArrayT");
+	int ier = appendOrCreateDataArrayT(groupId, name, value, dims, writtenCount, "I4", H5T_STD_I32LE, H5T_NATIVE_INT, names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("appendOrCreateDataArrayT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::appendOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<double>& value, hsize_t writtenCount, std::unordered_set<std::string>* names)
+{
+	std::vector<hsize_t> dims;
+	dims.push_back(value.size());
+
+	_IRIC_LOGGER_TRACE_CALL_START("appendOrCreateDataArrayT");
+	int ier = appendOrCreateDataArrayT(groupId, name, value, dims, writtenCount, "R8", H5T_IEEE_F64LE, H5T_NATIVE_DOUBLE, names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("appendOrCreateDataArrayT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::appendOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<std::string>& value, hsize_t writtenCount, std::unordered_set<std::string>* names)
+{
+	std::vector<hsize_t> dims;
+	std::vector<char> buffer;
+	setupStringBuffer(value, &buffer, &dims);
+
+	_IRIC_LOGGER_TRACE_CALL_START("appendOrCreateDataArrayT");
+	int ier = appendOrCreateDataArrayT(groupId, name, buffer, dims, writtenCount, "C1", H5T_STD_I8LE, H5T_NATIVE_INT8, names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("appendOrCreateDataArrayT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::appendDataArray(hid_t groupId, const std::string& name, const int* values, size_t count, hsize_t chunkSize, std::unordered_set<std::string>* names)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("appendDataArrayT");
+	int ier = appendDataArrayT(groupId, name, values, count, chunkSize, "I4", H5T_STD_I32LE, H5T_NATIVE_INT, names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("appendDataArrayT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::appendDataArray(hid_t groupId, const std::string& name, const double* values, size_t count, hsize_t chunkSize, std::unordered_set<std::string>* names)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("appendDataArrayT");
+	int ier = appendDataArrayT(groupId, name, values, count, chunkSize, "R8", H5T_IEEE_F64LE, H5T_NATIVE_DOUBLE, names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("appendDataArrayT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::truncateDataArray(hid_t groupId, const std::string& name, hsize_t size)
+{
+	hid_t gId;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::openGroup");
+	int ier = H5Util::openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::openGroup", ier);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dopen2");
+	hid_t dataSetId = H5Dopen2(gId, " data", H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dopen2");
+	if (dataSetId < 0) {
+		_iric_logger_error("H5Util::truncateDataArray", "H5Dopen2", dataSetId);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	H5DatasetCloser dataSetCloser(dataSetId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dget_space");
+	hid_t fileSpaceId = H5Dget_space(dataSetId);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dget_space");
+	if (fileSpaceId < 0) {
+		_iric_logger_error("H5Util::truncateDataArray", "H5Dget_space", fileSpaceId);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	hsize_t curDim, maxDim;
+	{
+		H5DataSpaceCloser fileSpaceCloser(fileSpaceId);
+
+		if (H5Sget_simple_extent_ndims(fileSpaceId) != 1) {
+			_iric_logger_error("In H5Util::truncateDataArray(), the data is not an one-dimensional array");
+			return IRIC_WRONG_DATASIZE;
+		}
+		H5Sget_simple_extent_dims(fileSpaceId, &curDim, &maxDim);
+	}
+	if (curDim <= size) {return IRIC_NO_ERROR;}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Dset_extent");
+	herr_t status = H5Dset_extent(dataSetId, &size);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Dset_extent");
+	if (status < 0) {
+		_iric_logger_error("H5Util::truncateDataArray", "H5Dset_extent", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
 int H5Util::readGroupValueDimensions(hid_t groupId, std::vector<hsize_t>* dims)
 {
 	_IRIC_LOGGER_TRACE_CALL_START("H5Dopen2");
@@ -1549,6 +2421,36 @@ int H5Util::readGroupValue(hid_t groupId, std::vector<std::string>* values)
 	return IRIC_NO_ERROR;
 }
 
+int H5Util::readGroupValue(hid_t groupId, int* values, size_t count)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readGroupValueT");
+	int ier = readGroupValueT(groupId, values, count, H5T_NATIVE_INT32);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readGroupValueT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::readGroupValue(hid_t groupId, float* values, size_t count)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readGroupValueT");
+	int ier = readGroupValueT(groupId, values, count, H5T_NATIVE_FLOAT);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readGroupValueT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::readGroupValue(hid_t groupId, double* values, size_t count)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readGroupValueT");
+	int ier = readGroupValueT(groupId, values, count, H5T_NATIVE_DOUBLE);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readGroupValueT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5Util::readDataArrayValueType(hid_t groupId, const std::string& name, DataArrayValueType* type)
 {
 	hid_t gId;
@@ -1723,6 +2625,135 @@ int H5Util::readDataArrayValue(hid_t groupId, const std::string& name, std::vect
 	return readGroupValue(gId, values);
 }
 
+int H5Util::readDataArrayValue(hid_t groupId, const std::string& name, int* values, size_t count)
+{
+	hid_t gId;
+	int ier = openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	return readGroupValue(gId, values, count);
+}
+
+int H5Util::readDataArrayValue(hid_t groupId, const std::string& name, float* values, size_t count)
+{
+	hid_t gId;
+	int ier = openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	return readGroupValue(gId, values, count);
+}
+
+int H5Util::readDataArrayValue(hid_t groupId, const std::string& name, double* values, size_t count)
+{
+	hid_t gId;
+	int ier = openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	return readGroupValue(gId, values, count);
+}
+
+int H5Util::readDataArrayValuePoints(hid_t groupId, const std::string& name, const std::vector<hsize_t>& indices, int* values)
+{
+	hid_t gId;
+	int ier = openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("readValuePointsT");
+	ier = readValuePointsT(gId, " data", indices, values, H5T_NATIVE_INT32);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("readValuePointsT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::readDataArrayValuePoints(hid_t groupId, const std::string& name, const std::vector<hsize_t>& indices, double* values)
+{
+	hid_t gId;
+	int ier = openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("readValuePointsT");
+	ier = readValuePointsT(gId, " data", indices, values, H5T_NATIVE_DOUBLE);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("readValuePointsT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::readDataArrayValueRanges(hid_t groupId, const std::string& name, const std::vector<hsize_t>& starts, const std::vector<hsize_t>& counts, int* values)
+{
+	hid_t gId;
+	int ier = openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("readValueRangesT");
+	ier = readValueRangesT(gId, " data", starts, counts, values, H5T_NATIVE_INT32);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("readValueRangesT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::readDataArrayValueRanges(hid_t groupId, const std::string& name, const std::vector<hsize_t>& starts, const std::vector<hsize_t>& counts, double* values)
+{
+	hid_t gId;
+	int ier = openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("readValueRangesT");
+	ier = readValueRangesT(gId, " data", starts, counts, values, H5T_NATIVE_DOUBLE);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("readValueRangesT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::readDataArrayValueRegion(hid_t groupId, const std::string& name, const std::vector<hsize_t>& dims, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, int* values)
+{
+	hid_t gId;
+	int ier = openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("readValueRegionT");
+	ier = readValueRegionT(gId, " data", dims, start, stride, count, values, H5T_NATIVE_INT32);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("readValueRegionT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5Util::readDataArrayValueRegion(hid_t groupId, const std::string& name, const std::vector<hsize_t>& dims, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values)
+{
+	hid_t gId;
+	int ier = openGroup(groupId, name, DATAARRAY_LABEL, &gId);
+	RETURN_IF_ERR;
+
+	H5GroupCloser closer(gId);
+
+	_IRIC_LOGGER_TRACE_CALL_START("readValueRegionT");
+	ier = readValueRegionT(gId, " data", dims, start, stride, count, values, H5T_NATIVE_DOUBLE);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("readValueRegionT", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5Util::updateGroupValue(hid_t groupId, const int& value)
 {
 	return updateGroupValueT(groupId, value, H5T_NATIVE_INT32);
@@ -1772,11 +2803,15 @@ int H5Util::readAttribute(hid_t groupId, const std::string& name, std::string* v
 
 	H5Tset_size(memDataTypeId, labelSize);
 
-	H5Aread(attId, memDataTypeId, buf.data());
+	herr_t status = H5Aread(attId, memDataTypeId, buf.data());
+	if (status < 0) {
+		_iric_logger_error("H5Util::readAttribute", "H5Aread", status);
+		return IRIC_H5_CALL_ERROR;
+	}
 
-	*value = buf.data();
+	*value = std::string(buf.data(), strnlen(buf.data(), labelSize));
 
-	return true;
+	return IRIC_NO_ERROR;
 }
 
 int H5Util::writeAttribute(hid_t groupId, const std::string& name, const std::string& value)
@@ -1871,7 +2906,13 @@ int H5Util::writeData(hid_t groupId, const std::string& name, const std::string&
 
 	H5DataSpaceCloser dataSpaceCloser(dataSpaceId);
 
-	hid_t dataSetId = H5Dcreate2(groupId, name.c_str(), H5T_NATIVE_INT8, dataSpaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+	hid_t dataSetCreationProperty;
+	int ier = createDatasetCreationProperty(groupId, std::vector<hsize_t> {datalen}, H5T_NATIVE_INT8, &dataSetCreationProperty);
+	RETURN_IF_ERR;
+
+	H5PropertyListCloser dataSetCreationPropertyCloser(dataSetCreationProperty);
+
+	hid_t dataSetId = H5Dcreate2(groupId, name.c_str(), H5T_NATIVE_INT8, dataSpaceId, H5P_DEFAULT, dataSetCreationProperty, H5P_DEFAULT);
 	if (dataSetId < 0) {
 		_iric_logger_error("H5Util::writeData", "H5Dcreate2", dataSetId);
 		return IRIC_H5_CALL_ERROR;
@@ -2040,6 +3081,67 @@ int H5Util::copyGroupRecursively(hid_t srcGroupId, hid_t tgtGroupId)
 	return IRIC_NO_ERROR;
 }
 
+void H5Util::setStoragePolicy(hid_t fileId, const H5DatasetStoragePolicy& policy)
+{
+	std::lock_guard<std::mutex> lock(storagePoliciesMutex);
+
+	if (policy.isDefault()) {
+		storagePolicies.erase(fileId);
+	} else {
+		storagePolicies[fileId] = policy;
+	}
+}
+
+void H5Util::clearStoragePolicy(hid_t fileId)
+{
+	std::lock_guard<std::mutex> lock(storagePoliciesMutex);
+
+	storagePolicies.erase(fileId);
+}
+
+int H5Util::createDatasetCreationProperty(hid_t groupId, const std::vector<hsize_t>& dims, hid_t dataTypeInFile, hid_t* propertyId)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pcreate");
+	*propertyId = H5Pcreate(H5P_DATASET_CREATE);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pcreate");
+
+	if (*propertyId < 0) {
+		_iric_logger_error("H5Util::createDatasetCreationProperty", "H5Pcreate", *propertyId);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	H5DatasetStoragePolicy policy;
+	{
+		std::lock_guard<std::mutex> lock(storagePoliciesMutex);
+		if (storagePolicies.empty()) {return IRIC_NO_ERROR;}
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5Iget_file_id");
+		hid_t fileId = H5Iget_file_id(groupId);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Iget_file_id");
+		if (fileId < 0) {return IRIC_NO_ERROR;}
+
+		auto it = storagePolicies.find(fileId);
+		if (it != storagePolicies.end()) {
+			policy = it->second;
+		}
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5Fclose");
+		H5Fclose(fileId);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Fclose");
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Tget_size");
+	size_t elementSize = H5Tget_size(dataTypeInFile);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Tget_size");
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5DatasetStoragePolicy::setupCreationProperty");
+	int ier = policy.setupCreationProperty(*propertyId, dims, elementSize);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5DatasetStoragePolicy::setupCreationProperty", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 H5Util::H5Util()
 {}
 
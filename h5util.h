@@ -11,6 +11,8 @@
 
 namespace iRICLib {
 
+class H5DatasetStoragePolicy;
+
 class IRICLIBDLL H5Util
 {
 public:
@@ -32,6 +34,9 @@ public:
 	static int getGroupNamesWithLabel(hid_t groupId, const std::string& label, std::unordered_set<std::string>* names);
 	static int getDatasetNames(hid_t groupId, std::vector<std::string>* names);
 	static int getDatasetNames(hid_t groupId, std::unordered_set<std::string>* names);
+	// names of all links in the group, without opening the objects they point to
+	static int getLinkNames(hid_t groupId, std::vector<std::string>* names);
+	static int getLinkNames(hid_t groupId, std::unordered_set<std::string>* names);
 
 	static int createGroup(hid_t groupId, const std::string& name, hid_t* newGroup);
 	static int createGroup(hid_t groupId, const std::string& name, const std::string& label, const std::string& type, hid_t* newGroup);
@@ -53,6 +58,9 @@ public:
 	static int createGroupWithValue(hid_t groupId, const std::string& name, const std::string& label, const std::vector<int>& value, const std::vector<hsize_t>& dims, hid_t* newGroup = nullptr);
 	static int createGroupWithValue(hid_t groupId, const std::string& name, const std::string& label, const std::vector<float>& value, const std::vector<hsize_t>& dims, hid_t* newGroup = nullptr);
 	static int createGroupWithValue(hid_t groupId, const std::string& name, const std::string& label, const std::vector<double>& value, const std::vector<hsize_t>& dims, hid_t* newGroup = nullptr);
+	static int createGroupWithValue(hid_t groupId, const std::string& name, const std::string& label, const int* value, const std::vector<hsize_t>& dims, hid_t* newGroup = nullptr);
+	static int createGroupWithValue(hid_t groupId, const std::string& name, const std::string& label, const float* value, const std::vector<hsize_t>& dims, hid_t* newGroup = nullptr);
+	static int createGroupWithValue(hid_t groupId, const std::string& name, const std::string& label, const double* value, const std::vector<hsize_t>& dims, hid_t* newGroup = nullptr);
 
 	static int createDataArray(hid_t groupId, const std::string& name, const std::string& value);
 	static int createDataArray(hid_t groupId, const std::string& name, const std::vector<char>& value);
@@ -63,6 +71,13 @@ public:
 	static int createDataArray(hid_t groupId, const std::string& name, const std::vector<int>& value, const std::vector<hsize_t>& dims);
 	static int createDataArray(hid_t groupId, const std::string& name, const std::vector<float>& value, const std::vector<hsize_t>& dims);
 	static int createDataArray(hid_t groupId, const std::string& name, const std::vector<double>& value, const std::vector<hsize_t>& dims);
+	// writes count values from the caller's memory, without copying them
+	static int createDataArray(hid_t groupId, const std::string& name, const int* value, size_t count);
+	static int createDataArray(hid_t groupId, const std::string& name, const float* value, size_t count);
+	static int createDataArray(hid_t groupId, const std::string& name, const double* value, size_t count);
+	static int createDataArray(hid_t groupId, const std::string& name, const int* value, const std::vector<hsize_t>& dims);
+	static int createDataArray(hid_t groupId, const std::string& name, const float* value, const std::vector<hsize_t>& dims);
+	static int createDataArray(hid_t groupId, const std::string& name, const double* value, const std::vector<hsize_t>& dims);
 	static int updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::string& value, std::unordered_set<std::string>* names = nullptr);
 	static int updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<char>& value, std::unordered_set<std::string>* names = nullptr);
 	static int updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<int>& value, std::unordered_set<std::string>* names = nullptr);
@@ -73,6 +88,16 @@ public:
 	static int updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<int>& value, const std::vector<hsize_t>& dims, std::unordered_set<std::string>* names = nullptr);
 	static int updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<float>& value, const std::vector<hsize_t>& dims, std::unordered_set<std::string>* names = nullptr);
 	static int updateOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<double>& value, const std::vector<hsize_t>& dims, std::unordered_set<std::string>* names = nullptr);
+	// writes value[writtenCount...] to the end of the array. The first writtenCount values should be already written.
+	static int appendOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<int>& value, hsize_t writtenCount, std::unordered_set<std::string>* names = nullptr);
+	static int appendOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<double>& value, hsize_t writtenCount, std::unordered_set<std::string>* names = nullptr);
+	static int appendOrCreateDataArray(hid_t groupId, const std::string& name, const std::vector<std::string>& value, hsize_t writtenCount, std::unordered_set<std::string>* names = nullptr);
+	// writes count values to the end of the extendible array, that is created when it does not exist yet.
+	// chunkSize is the chunk size (in bytes) used when the array is created.
+	static int appendDataArray(hid_t groupId, const std::string& name, const int* values, size_t count, hsize_t chunkSize, std::unordered_set<std::string>* names = nullptr);
+	static int appendDataArray(hid_t groupId, const std::string& name, const double* values, size_t count, hsize_t chunkSize, std::unordered_set<std::string>* names = nullptr);
+	// shrinks the extendible array to size values. Nothing is done when the array is not larger than size.
+	static int truncateDataArray(hid_t groupId, const std::string& name, hsize_t size);
 
 	static int readGroupValueDimensions(hid_t groupId, std::vector<hsize_t>* dims);
 	static int readGroupValueLength(hid_t groupId, int* length);
@@ -82,6 +107,10 @@ public:
 	static int readGroupValue(hid_t groupId, std::vector<float>* values);
 	static int readGroupValue(hid_t groupId, std::vector<double>* values);
 	static int readGroupValue(hid_t groupId, std::vector<std::string>* values);
+	// reads into the caller's memory that can hold count values. IRIC_WRONG_DATASIZE is returned when the data is larger.
+	static int readGroupValue(hid_t groupId, int* values, size_t count);
+	static int readGroupValue(hid_t groupId, float* values, size_t count);
+	static int readGroupValue(hid_t groupId, double* values, size_t count);
 
 	static int readDataArrayValueType(hid_t groupId, const std::string& name, DataArrayValueType* type);
 	static int readDataArrayLength(hid_t groupId, const std::string& name, int* length);
@@ -91,6 +120,18 @@ public:
 	static int readDataArrayValue(hid_t groupId, const std::string& name, std::vector<float>* values);
 	static int readDataArrayValue(hid_t groupId, const std::string& name, std::vector<double>* values);
 	static int readDataArrayValue(hid_t groupId, const std::string& name, std::vector<std::string>* values);
+	static int readDataArrayValue(hid_t groupId, const std::string& name, int* values, size_t count);
+	static int readDataArrayValue(hid_t groupId, const std::string& name, float* values, size_t count);
+	static int readDataArrayValue(hid_t groupId, const std::string& name, double* values, size_t count);
+	// reads the values at indices (zero-based) only, with a point selection
+	static int readDataArrayValuePoints(hid_t groupId, const std::string& name, const std::vector<hsize_t>& indices, int* values);
+	static int readDataArrayValuePoints(hid_t groupId, const std::string& name, const std::vector<hsize_t>& indices, double* values);
+	// reads the ranges (starts[i], counts[i]) of the array, one after another. The ranges should be sorted and should not overlap.
+	static int readDataArrayValueRanges(hid_t groupId, const std::string& name, const std::vector<hsize_t>& starts, const std::vector<hsize_t>& counts, int* values);
+	static int readDataArrayValueRanges(hid_t groupId, const std::string& name, const std::vector<hsize_t>& starts, const std::vector<hsize_t>& counts, double* values);
+	// reads a hyperslab (start, stride, count) of the array with dims. All are in row-major (HDF5) order.
+	static int readDataArrayValueRegion(hid_t groupId, const std::string& name, const std::vector<hsize_t>& dims, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, int* values);
+	static int readDataArrayValueRegion(hid_t groupId, const std::string& name, const std::vector<hsize_t>& dims, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values);
 
 	static int updateGroupValue(hid_t groupId, const int& value);
 	static int updateGroupValue(hid_t groupId, const float& value);
@@ -126,6 +167,10 @@ public:
 	static int copyAttributes(hid_t srcGroupId, hid_t tgtGroupId);
 	static int copyGroupRecursively(hid_t srcGroupId, hid_t tgtGroupId);
 
+	static void setStoragePolicy(hid_t fileId, const H5DatasetStoragePolicy& policy);
+	static void clearStoragePolicy(hid_t fileId);
+	static int createDatasetCreationProperty(hid_t groupId, const std::vector<hsize_t>& dims, hid_t dataTypeInFile, hid_t* propertyId);
+
 private:
 	H5Util();
 };
@@ -1,10 +1,16 @@
 #include "intarraycontainer.h"
 
 IntArrayContainer::IntArrayContainer(int size) :
-	m_value {new std::vector<int> {}}
-{
-	m_value->assign(size, 0);
-}
+	m_value {new std::vector<int> (size, 0)},
+	m_data {m_value->data()},
+	m_size {size}
+{}
+
+IntArrayContainer::IntArrayContainer(int* data, int size) :
+	m_value {nullptr},
+	m_data {data},
+	m_size {size}
+{}
 
 IntArrayContainer::~IntArrayContainer()
 {
@@ -13,7 +19,7 @@ IntArrayContainer::~IntArrayContainer()
 
 int IntArrayContainer::size() const
 {
-	return static_cast<int> (m_value->size());
+	return m_size;
 }
 
 int IntArrayContainer::value(int index) const
@@ -21,10 +27,10 @@ int IntArrayContainer::value(int index) const
 	if (index < 0) {
 		return 0;
 	}
-	if (index >= static_cast<int>(m_value->size())) {
+	if (index >= m_size) {
 		return 0;
 	}
-	return m_value->at(index);
+	return *(m_data + index);
 }
 
 void IntArrayContainer::setValue(int index, int v)
@@ -32,13 +38,13 @@ void IntArrayContainer::setValue(int index, int v)
 	if (index < 0) {
 		return;
 	}
-	if (index >= static_cast<int>(m_value->size())) {
+	if (index >= m_size) {
 		return;
 	}
-	(*m_value)[index] = v;
+	*(m_data + index) = v;
 }
 
 int* IntArrayContainer::pointer()
 {
-	return m_value->data();
+	return m_data;
 }
@@ -9,6 +9,8 @@ class IRICLIBDLL IntArrayContainer
 {
 public:
 	IntArrayContainer(int size);
+	// wraps memory owned by the caller, without copying. used to pass NumPy arrays from Python.
+	IntArrayContainer(int* data, int size);
 	~IntArrayContainer();
 
 	int size() const;
@@ -17,7 +19,10 @@ public:
 	int* pointer();
 
 private:
+	// nullptr when wrapping memory owned by the caller
 	std::vector<int>* m_value;
+	int* m_data;
+	int m_size;
 };
 
 #endif // INTARRAYCONTAINER_H
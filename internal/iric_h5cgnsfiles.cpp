@@ -1,4 +1,5 @@
 #include "iric_h5cgnsfiles.h"
+#include "../h5cgnsfile.h"
 #include "../h5cgnsfiles.h"
 #include "../iriclib_errorcodes.h"
 
@@ -36,6 +37,16 @@ int _iric_h5cgnsfiles_unregister(int fid)
 }
 
 int _iric_h5cgnsfiles_get(int fid, H5CgnsFile** file)
+{
+	int ier = _iric_h5cgnsfiles_get_nowait(fid, file);
+	if (ier != IRIC_NO_ERROR) {return ier;}
+	if (*file == nullptr) {return IRIC_NO_ERROR;}
+
+	// solution writes queued for the background thread are finished before the caller accesses the file.
+	return (*file)->waitForAsyncWrites();
+}
+
+int _iric_h5cgnsfiles_get_nowait(int fid, H5CgnsFile** file)
 {
 	if (fid < 1 || fid > files.size()) {
 		std::ostringstream ss;
@@ -45,8 +56,23 @@ int _iric_h5cgnsfiles_get(int fid, H5CgnsFile** file)
 		return IRIC_INVALID_FILEID;
 	}
 
+	// the caller may call HDF5, so the background threads of the other files should be idle
+	_iric_h5cgnsfiles_drain_async_writes(fid);
+
 	*file = files.at(fid);
 	return IRIC_NO_ERROR;
 }
 
+void _iric_h5cgnsfiles_drain_async_writes(int exceptFid)
+{
+	for (int i = 1; i <= files.size(); ++i) {
+		if (i == exceptFid) {continue;}
+
+		auto f = files.at(i);
+		if (f == nullptr) {continue;}
+
+		f->drainAsyncWrites();
+	}
+}
+
 } // namespace iRICLib
@@ -9,6 +9,8 @@ int _iric_lastFileId(int* fid);
 int _iric_h5cgnsfiles_register(H5CgnsFile* file, int* fid);
 int _iric_h5cgnsfiles_unregister(int fid);
 int _iric_h5cgnsfiles_get(int fid, H5CgnsFile** file);
+int _iric_h5cgnsfiles_get_nowait(int fid, H5CgnsFile** file);
+void _iric_h5cgnsfiles_drain_async_writes(int exceptFid);
 
 } // namespace iRICLib
 
@@ -13,6 +13,7 @@
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <vector>
 
 namespace {
 
@@ -20,10 +21,16 @@ bool _initialized = false;
 
 const std::string LOGGER_NAME = "iric_logger";
 
+static_assert(iRICLib::_IRIC_LOGGER_PRIO_ERROR == Poco::Message::PRIO_ERROR, "priority mismatch");
+static_assert(iRICLib::_IRIC_LOGGER_PRIO_TRACE == Poco::Message::PRIO_TRACE, "priority mismatch");
+
 } // namespace
 
 namespace iRICLib {
 
+// Poco::Logger::root() starts with PRIO_INFORMATION
+int _iric_logger_level = _IRIC_LOGGER_PRIO_INFORMATION;
+
 void _iric_logger_init()
 {
 	if (_initialized) {return;}
@@ -52,6 +59,7 @@ void _iric_logger_init()
 
 	auto& logger = Poco::Logger::root();
 	logger.setLevel(logLevel);
+	_iric_logger_level = logger.getLevel();
 	auto channels = new Poco::SplitterChannel();
 	logger.setChannel(channels);
 
@@ -76,6 +84,7 @@ void _iric_logger_init()
 		channels->addChannel(new Poco::FormattingChannel(fmt, fileChannel));
 	}
 
+	_iric_logger_level = logger.getLevel();
 	_initialized = true;
 }
 
@@ -86,71 +95,94 @@ Poco::Logger& _iric_logger_get()
 
 void _iric_logger_trace(const std::string& message)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_TRACE)) {return;}
+
 	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_TRACE);
 	s << message << std::endl;
 }
 
 void _iric_logger_debug(const std::string& message)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_DEBUG)) {return;}
+
 	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_DEBUG);
 	s << message << std::endl;
 }
 
 void _iric_logger_info(const std::string& message)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_INFORMATION)) {return;}
+
 	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_INFORMATION);
 	s << message << std::endl;
 }
 
 void _iric_logger_warn(const std::string& message)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_WARNING)) {return;}
+
 	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_WARNING);
 	s << message << std::endl;
 }
 
 void _iric_logger_error(const std::string& message)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_ERROR)) {return;}
+
 	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_ERROR);
 	s << message << std::endl;
 }
 
 void _iric_logger_error(const std::string& current, const std::string& func, int val)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_ERROR)) {return;}
+
 	std::ostringstream ss;
 	ss << "In " << current << "(), " << func << "() returned " << val;
 	_iric_logger_error(ss.str());
 }
 
-void _iric_logger_trace_enter(const std::string& f_name)
+void _iric_logger_trace_enter(const char* f_name)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_TRACE)) {return;}
+
 	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_TRACE);
 	s << "Entered " << f_name << "()" << std::endl;
 }
 
-void _iric_logger_trace_leave(const std::string& f_name)
+void _iric_logger_trace_leave(const char* f_name)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_TRACE)) {return;}
+
 	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_TRACE);
 	s << "Leaving " << f_name << "()" << std::endl;
 }
 
-void _iric_logger_trace_call_start(const std::string& f_name, const std::string& c_name)
+void _iric_logger_trace_call_start(const char* f_name, const char* c_name)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_TRACE)) {return;}
+
 	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_TRACE);
 	s << "Entering " << f_name << "() in " << c_name << std::endl;
 }
 
-void _iric_logger_trace_call_end(const std::string& f_name, const std::string& c_name)
+void _iric_logger_trace_call_end(const char* f_name, const char* c_name)
 {
+	if (! _iric_logger_enabled(_IRIC_LOGGER_PRIO_TRACE)) {return;}
+
 	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_TRACE);
 	s << "Returned from " << f_name << "() in " << c_name << std::endl;
 }
 
-void _iric_logger_trace_call_end(const std::string& f_name, const std::string& c_name, int ier)
+void _iric_logger_trace_call_end(const char* f_name, const char* c_name, int ier)
 {
-	Poco::LogStream s(_iric_logger_get(), Poco::Message::PRIO_TRACE);
+	int priority = Poco::Message::PRIO_TRACE;
 	if (ier != 0) {
-		s.priority(Poco::Message::PRIO_ERROR);
+		priority = Poco::Message::PRIO_ERROR;
 	}
+	if (! _iric_logger_enabled(priority)) {return;}
+
+	Poco::LogStream s(_iric_logger_get(), static_cast<Poco::Message::Priority> (priority));
 	s << "Returned from " << f_name << "() in " << c_name << " with value " << ier << std::endl;
 }
 
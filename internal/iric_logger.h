@@ -9,6 +9,23 @@ namespace Poco {
 
 namespace iRICLib {
 
+// priorities, same values as Poco::Message::Priority
+const int _IRIC_LOGGER_PRIO_FATAL = 1;
+const int _IRIC_LOGGER_PRIO_ERROR = 3;
+const int _IRIC_LOGGER_PRIO_WARNING = 4;
+const int _IRIC_LOGGER_PRIO_INFORMATION = 6;
+const int _IRIC_LOGGER_PRIO_DEBUG = 7;
+const int _IRIC_LOGGER_PRIO_TRACE = 8;
+
+// copy of the logger level, updated in _iric_logger_init().
+// messages are built only when this check passes.
+extern int _iric_logger_level;
+
+inline bool _iric_logger_enabled(int priority)
+{
+	return _iric_logger_level >= priority;
+}
+
 void _iric_logger_init();
 
 Poco::Logger& _iric_logger_get();
@@ -20,22 +37,42 @@ void _iric_logger_warn(const std::string& message);
 void _iric_logger_error(const std::string& message);
 void _iric_logger_error(const std::string& current, const std::string& func, int val);
 
-void _iric_logger_trace_enter(const std::string& f_name);
-void _iric_logger_trace_leave(const std::string& f_name);
+void _iric_logger_trace_enter(const char* f_name);
+void _iric_logger_trace_leave(const char* f_name);
 
-void _iric_logger_trace_call_start(const std::string& f_name, const std::string& c_name);
-void _iric_logger_trace_call_end(const std::string& f_name, const std::string& c_name);
-void _iric_logger_trace_call_end(const std::string& f_name, const std::string& c_name, int ier);
+void _iric_logger_trace_call_start(const char* f_name, const char* c_name);
+void _iric_logger_trace_call_end(const char* f_name, const char* c_name);
+void _iric_logger_trace_call_end(const char* f_name, const char* c_name, int ier);
 
 #if _MSC_VER <= 1800
 	#define __func__ __FUNCTION__
 #endif // _MSC_VER
 
-#define _IRIC_LOGGER_TRACE_ENTER() _iric_logger_trace_enter(__func__)
-#define _IRIC_LOGGER_TRACE_LEAVE() _iric_logger_trace_leave(__func__)
-#define _IRIC_LOGGER_TRACE_CALL_START(f_name) _iric_logger_trace_call_start(f_name, __func__)
-#define _IRIC_LOGGER_TRACE_CALL_END(f_name) _iric_logger_trace_call_end(f_name, __func__)
-#define _IRIC_LOGGER_TRACE_CALL_END_WITHVAL(f_name, ier) _iric_logger_trace_call_end(f_name, __func__, ier)
+// define IRIC_LOGGER_DISABLE_TRACE to remove trace logging at compile time.
+// errors reported through _IRIC_LOGGER_TRACE_CALL_END_WITHVAL are still logged.
+#ifdef IRIC_LOGGER_DISABLE_TRACE
+
+#define _IRIC_LOGGER_TRACE_ENTER() ((void) 0)
+#define _IRIC_LOGGER_TRACE_LEAVE() ((void) 0)
+#define _IRIC_LOGGER_TRACE_CALL_START(f_name) ((void) 0)
+#define _IRIC_LOGGER_TRACE_CALL_END(f_name) ((void) 0)
+#define _IRIC_LOGGER_TRACE_CALL_END_WITHVAL(f_name, ier) \
+	do {if ((ier) != 0 && iRICLib::_iric_logger_enabled(iRICLib::_IRIC_LOGGER_PRIO_ERROR)) {iRICLib::_iric_logger_trace_call_end(f_name, __func__, ier);}} while (0)
+
+#else
+
+#define _IRIC_LOGGER_TRACE_ENTER() \
+	do {if (iRICLib::_iric_logger_enabled(iRICLib::_IRIC_LOGGER_PRIO_TRACE)) {iRICLib::_iric_logger_trace_enter(__func__);}} while (0)
+#define _IRIC_LOGGER_TRACE_LEAVE() \
+	do {if (iRICLib::_iric_logger_enabled(iRICLib::_IRIC_LOGGER_PRIO_TRACE)) {iRICLib::_iric_logger_trace_leave(__func__);}} while (0)
+#define _IRIC_LOGGER_TRACE_CALL_START(f_name) \
+	do {if (iRICLib::_iric_logger_enabled(iRICLib::_IRIC_LOGGER_PRIO_TRACE)) {iRICLib::_iric_logger_trace_call_start(f_name, __func__);}} while (0)
+#define _IRIC_LOGGER_TRACE_CALL_END(f_name) \
+	do {if (iRICLib::_iric_logger_enabled(iRICLib::_IRIC_LOGGER_PRIO_TRACE)) {iRICLib::_iric_logger_trace_call_end(f_name, __func__);}} while (0)
+#define _IRIC_LOGGER_TRACE_CALL_END_WITHVAL(f_name, ier) \
+	do {if (iRICLib::_iric_logger_enabled((ier) == 0 ? iRICLib::_IRIC_LOGGER_PRIO_TRACE : iRICLib::_IRIC_LOGGER_PRIO_ERROR)) {iRICLib::_iric_logger_trace_call_end(f_name, __func__, ier);}} while (0)
+
+#endif // IRIC_LOGGER_DISABLE_TRACE
 
 } // namespace iRICLib
 
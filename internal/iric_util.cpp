@@ -1,15 +1,113 @@
 #include "../error_macros.h"
+#include "../h5cgnsbase.h"
+#include "../h5cgnsbaseiterativedata.h"
 #include "../h5cgnsfile.h"
 #include "../h5cgnsfilesolutionreader.h"
 #include "../h5cgnsfilesolutionwriter.h"
+#include "../h5cgnszone.h"
 #include "../iriclib_errorcodes.h"
 
 #include "iric_h5cgnsfiles.h"
+#include "iric_logger.h"
 #include "iric_util.h"
 #include "iric_outputerror.h"
 
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <vector>
+
 namespace iRICLib {
 
+namespace {
+
+template <typename V>
+int writeSolValuesT(int fid, int gid, const V* v_arr, _iric_zone_count_func count, const std::function<int(H5CgnsZone*, const V*, size_t)>& func, const std::string& f_name)
+{
+	H5CgnsFile* file = nullptr;
+	int ier = _iric_h5cgnsfiles_get_nowait(fid, &file);
+	RETURN_IF_ERR;
+
+	auto writer = file->solutionWriter();
+	if (writer->asyncQueueSize() == 0) {
+		H5CgnsZone* zone = nullptr;
+		ier = _iric_get_zone_for_solwrite(fid, gid, &zone, f_name);
+		RETURN_IF_ERR;
+
+		return func(zone, v_arr, static_cast<size_t> ((zone->*count)()));
+	}
+
+	// zones in solution files have the same size as the ones in the main file, and reading
+	// the size of a zone does not call HDF5, so it is safe while the writer thread runs.
+	auto mainZone = file->zoneById(gid);
+	if (mainZone == nullptr) {
+		_iric_output_zonenotexists_error(fid, gid, f_name);
+		return IRIC_GRID_NOT_FOUND;
+	}
+	auto values = std::make_shared<std::vector<V> >(v_arr, v_arr + (mainZone->*count)());
+
+	return writer->writeAsync([=] {
+		auto f2 = writer->targetFile();
+		auto zone = (f2 == nullptr) ? nullptr : f2->zoneById(gid);
+		if (zone == nullptr) {
+			_iric_output_zonenotexists_error(fid, gid, f_name);
+			return IRIC_GRID_NOT_FOUND;
+		}
+		return func(zone, values->data(), values->size());
+	});
+}
+
+template <typename V>
+int readSolSeriesT(int fid, int gid, int count, const int* idx_arr, V* v_arr, _iric_zone_count_func zoneCount, const std::function<int(H5CgnsZone*, const std::vector<hsize_t>&, V*)>& func, const std::string& f_name)
+{
+	H5CgnsFile* file = nullptr;
+	int ier = _iric_h5cgnsfiles_get(fid, &file);
+	RETURN_IF_ERR;
+
+	auto mainZone = file->zoneById(gid);
+	if (mainZone == nullptr) {
+		_iric_output_zonenotexists_error(fid, gid, f_name);
+		return IRIC_GRID_NOT_FOUND;
+	}
+
+	// indices are one-based, like the ones of boundary conditions
+	int valueCount = (mainZone->*zoneCount)();
+	std::vector<hsize_t> indices(count < 0 ? 0 : count);
+	for (int i = 0; i < count; ++i) {
+		int idx = *(idx_arr + i);
+		if (idx < 1 || idx > valueCount) {
+			std::ostringstream ss;
+			ss << "In " << f_name << "(), index " << idx << " is out of range (1 - " << valueCount << ")";
+			_iric_logger_error(ss.str());
+			return IRIC_INVALID_ARGUMENT;
+		}
+		indices[i] = idx - 1;
+	}
+
+	std::vector<double> times;
+	std::vector<int> iterations;
+	ier = file->ccBase()->biterData()->readTime(&times);
+	RETURN_IF_ERR;
+	ier = file->ccBase()->biterData()->readIteration(&iterations);
+	RETURN_IF_ERR;
+
+	int steps = static_cast<int> ((std::max)(times.size(), iterations.size()));
+
+	// only the values at the indices are read from each solution, not the whole arrays
+	for (int step = 1; step <= steps; ++step) {
+		H5CgnsZone* zone = nullptr;
+		ier = _iric_get_zone_for_solread(fid, gid, step, &zone, f_name);
+		RETURN_IF_ERR;
+
+		ier = func(zone, indices, v_arr + static_cast<size_t> (step - 1) * indices.size());
+		RETURN_IF_ERR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+} // namespace
+
 int _iric_get_zone(int fid, int gid, H5CgnsZone** zone, const std::string& f_name)
 {
 	H5CgnsFile* file = nullptr;
@@ -67,4 +165,73 @@ int _iric_get_zone_for_solwrite(int fid, int gid, H5CgnsZone** zone, const std::
 	return IRIC_NO_ERROR;
 }
 
+int _iric_get_region(H5CgnsZone* zone, const std::vector<hsize_t>& dims, const std::vector<int>& mins, const std::vector<int>& maxs, int stride, std::vector<hsize_t>* start, std::vector<hsize_t>* strides, std::vector<hsize_t>* count, const std::string& f_name)
+{
+	if (zone->type() != H5CgnsZone::Type::Structured) {
+		std::ostringstream ss;
+		ss << "In " << f_name << "(), the grid is not a structured grid";
+		_iric_logger_error(ss.str());
+		return IRIC_INVALID_GRIDTYPE;
+	}
+	if (dims.size() != mins.size()) {
+		std::ostringstream ss;
+		ss << "In " << f_name << "(), the grid has dimension " << dims.size();
+		_iric_logger_error(ss.str());
+		return IRIC_INVALID_DIMENSION;
+	}
+	if (stride < 1) {
+		std::ostringstream ss;
+		ss << "In " << f_name << "(), stride " << stride << " is invalid";
+		_iric_logger_error(ss.str());
+		return IRIC_INVALID_ARGUMENT;
+	}
+
+	for (size_t i = 0; i < dims.size(); ++i) {
+		int dim = static_cast<int> (dims.at(i));
+		if (mins.at(i) < 1 || mins.at(i) > maxs.at(i) || maxs.at(i) > dim) {
+			std::ostringstream ss;
+			ss << "In " << f_name << "(), range " << mins.at(i) << " - " << maxs.at(i) << " is out of range (1 - " << dim << ")";
+			_iric_logger_error(ss.str());
+			return IRIC_INVALID_ARGUMENT;
+		}
+		start->push_back(mins.at(i) - 1);
+		strides->push_back(stride);
+		count->push_back((maxs.at(i) - mins.at(i)) / stride + 1);
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int _iric_check_count(int count, const std::string& f_name)
+{
+	if (count < 0) {
+		std::ostringstream ss;
+		ss << "In " << f_name << "(), count " << count << " is invalid";
+		_iric_logger_error(ss.str());
+		return IRIC_INVALID_ARGUMENT;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int _iric_write_sol_values(int fid, int gid, const int* v_arr, _iric_zone_count_func count, const std::function<int(H5CgnsZone*, const int*, size_t)>& func, const std::string& f_name)
+{
+	return writeSolValuesT(fid, gid, v_arr, count, func, f_name);
+}
+
+int _iric_write_sol_values(int fid, int gid, const double* v_arr, _iric_zone_count_func count, const std::function<int(H5CgnsZone*, const double*, size_t)>& func, const std::string& f_name)
+{
+	return writeSolValuesT(fid, gid, v_arr, count, func, f_name);
+}
+
+int _iric_read_sol_series(int fid, int gid, int count, const int* idx_arr, int* v_arr, _iric_zone_count_func zoneCount, const std::function<int(H5CgnsZone*, const std::vector<hsize_t>&, int*)>& func, const std::string& f_name)
+{
+	return readSolSeriesT(fid, gid, count, idx_arr, v_arr, zoneCount, func, f_name);
+}
+
+int _iric_read_sol_series(int fid, int gid, int count, const int* idx_arr, double* v_arr, _iric_zone_count_func zoneCount, const std::function<int(H5CgnsZone*, const std::vector<hsize_t>&, double*)>& func, const std::string& f_name)
+{
+	return readSolSeriesT(fid, gid, count, idx_arr, v_arr, zoneCount, func, f_name);
+}
+
 } // namespace iRICLib
@@ -1,16 +1,38 @@
 #ifndef IRIC_UTIL_H
 #define IRIC_UTIL_H
 
+#include <hdf5.h>
+
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace iRICLib {
 
 class H5CgnsZone;
 
+typedef int (H5CgnsZone::*_iric_zone_count_func)() const;
+
 int _iric_get_zone(int fid, int gid, H5CgnsZone** zone, const std::string& f_name);
 int _iric_get_zone_for_solread(int fid, int gid, int solid, H5CgnsZone** zone, const std::string& f_name);
 int _iric_get_zone_for_solwrite(int fid, int gid, H5CgnsZone** zone, const std::string& f_name);
 
+// writes (zone->*count)() values of v_arr with func. When the background solution writer is enabled,
+// the values are copied and func is called later from the writer thread.
+int _iric_write_sol_values(int fid, int gid, const int* v_arr, _iric_zone_count_func count, const std::function<int(H5CgnsZone*, const int*, size_t)>& func, const std::string& f_name);
+int _iric_write_sol_values(int fid, int gid, const double* v_arr, _iric_zone_count_func count, const std::function<int(H5CgnsZone*, const double*, size_t)>& func, const std::string& f_name);
+
+// converts one-based ranges (mins[i] - maxs[i], in (i, j, k) order) with stride to a hyperslab of a structured zone
+int _iric_get_region(H5CgnsZone* zone, const std::vector<hsize_t>& dims, const std::vector<int>& mins, const std::vector<int>& maxs, int stride, std::vector<hsize_t>* start, std::vector<hsize_t>* strides, std::vector<hsize_t>* count, const std::string& f_name);
+
+// returns IRIC_INVALID_ARGUMENT with an error message when the element count passed to f_name is negative
+int _iric_check_count(int count, const std::string& f_name);
+
+// reads the values at count one-based indices in idx_arr, for all solutions, into v_arr (solution count x count).
+// func reads the values at zero-based indices of a solution.
+int _iric_read_sol_series(int fid, int gid, int count, const int* idx_arr, int* v_arr, _iric_zone_count_func zoneCount, const std::function<int(H5CgnsZone*, const std::vector<hsize_t>&, int*)>& func, const std::string& f_name);
+int _iric_read_sol_series(int fid, int gid, int count, const int* idx_arr, double* v_arr, _iric_zone_count_func zoneCount, const std::function<int(H5CgnsZone*, const std::vector<hsize_t>&, double*)>& func, const std::string& f_name);
+
 } // namespace iRICLib
 
 #endif // IRIC_UTIL_H
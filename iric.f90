@@ -4,6 +4,7 @@ module iric
   integer, parameter:: IRIC_MODE_READ = 0
   integer, parameter:: IRIC_MODE_WRITE = 1
   integer, parameter:: IRIC_MODE_MODIFY = 2
+  integer, parameter:: IRIC_MODE_READ_SWMR = 3
 
   integer, parameter:: IRIC_GEO_UNKNOWN = 0
   integer, parameter:: IRIC_GEO_POLYGON = 1
@@ -15,6 +16,19 @@ module iric
   integer, parameter:: IRIC_OPTION_CANCEL = 1
   integer, parameter:: IRIC_OPTION_DIVIDESOLUTIONS = 2
   integer, parameter:: IRIC_OPTION_STDSOLUTION = 3
+  integer, parameter:: IRIC_OPTION_SWMRSOLUTIONS = 4
+  integer, parameter:: IRIC_OPTION_SHAREDGRIDSOLUTIONS = 5
+  integer, parameter:: IRIC_OPTION_FILEACCESS_DEFAULT = 6
+  integer, parameter:: IRIC_OPTION_FILEACCESS_SOLVERWRITE = 7
+  integer, parameter:: IRIC_OPTION_FILEACCESS_GUIREAD = 8
+  integer, parameter:: IRIC_OPTION_FILEACCESS_ARCHIVE = 9
+
+  integer, parameter:: IRIC_COMPRESSION_NONE = 0
+  integer, parameter:: IRIC_COMPRESSION_DEFLATE = 1
+  integer, parameter:: IRIC_COMPRESSION_SZIP = 2
+
+  integer, parameter:: IRIC_SPATIALINDEX_BACKGRID = 0
+  integer, parameter:: IRIC_SPATIALINDEX_BVH = 1
 
   integer, parameter:: IRIC_CANCELED = 1
 
@@ -166,6 +180,16 @@ module iric
     module procedure cg_iric_read_grid3d_coords_withgridid_3d
   end interface
 
+  interface cg_iric_read_grid2d_coords_region_withgridid
+    module procedure cg_iric_read_grid2d_coords_region_withgridid_1d
+    module procedure cg_iric_read_grid2d_coords_region_withgridid_2d
+  end interface
+
+  interface cg_iric_read_grid3d_coords_region_withgridid
+    module procedure cg_iric_read_grid3d_coords_region_withgridid_1d
+    module procedure cg_iric_read_grid3d_coords_region_withgridid_3d
+  end interface
+
   interface cg_iric_read_grid_real_node_withgridid
     module procedure cg_iric_read_grid_real_node_withgridid_1d
     module procedure cg_iric_read_grid_real_node_withgridid_2d
@@ -478,6 +502,16 @@ module iric
     module procedure cg_iric_read_grid3d_coords_3d
   end interface
 
+  interface cg_iric_read_grid2d_coords_region
+    module procedure cg_iric_read_grid2d_coords_region_1d
+    module procedure cg_iric_read_grid2d_coords_region_2d
+  end interface
+
+  interface cg_iric_read_grid3d_coords_region
+    module procedure cg_iric_read_grid3d_coords_region_1d
+    module procedure cg_iric_read_grid3d_coords_region_3d
+  end interface
+
   interface cg_iric_read_grid_real_node
     module procedure cg_iric_read_grid_real_node_1d
     module procedure cg_iric_read_grid_real_node_2d
@@ -654,6 +688,40 @@ module iric
     module procedure cg_iric_read_sol_cell_real_3d
   end interface
 
+  interface cg_iric_read_sol_cell_integer_series
+    module procedure cg_iric_read_sol_cell_integer_series_1d
+    module procedure cg_iric_read_sol_cell_integer_series_2d
+  end interface
+
+  interface cg_iric_read_sol_cell_real_series
+    module procedure cg_iric_read_sol_cell_real_series_1d
+    module procedure cg_iric_read_sol_cell_real_series_2d
+  end interface
+
+  interface cg_iric_read_sol_cell_integer_region2d
+    module procedure cg_iric_read_sol_cell_integer_region2d_1d
+    module procedure cg_iric_read_sol_cell_integer_region2d_2d
+    module procedure cg_iric_read_sol_cell_integer_region2d_3d
+  end interface
+
+  interface cg_iric_read_sol_cell_real_region2d
+    module procedure cg_iric_read_sol_cell_real_region2d_1d
+    module procedure cg_iric_read_sol_cell_real_region2d_2d
+    module procedure cg_iric_read_sol_cell_real_region2d_3d
+  end interface
+
+  interface cg_iric_read_sol_cell_integer_region3d
+    module procedure cg_iric_read_sol_cell_integer_region3d_1d
+    module procedure cg_iric_read_sol_cell_integer_region3d_2d
+    module procedure cg_iric_read_sol_cell_integer_region3d_3d
+  end interface
+
+  interface cg_iric_read_sol_cell_real_region3d
+    module procedure cg_iric_read_sol_cell_real_region3d_1d
+    module procedure cg_iric_read_sol_cell_real_region3d_2d
+    module procedure cg_iric_read_sol_cell_real_region3d_3d
+  end interface
+
   interface cg_iric_write_sol_cell_integer
     module procedure cg_iric_write_sol_cell_integer_1d
     module procedure cg_iric_write_sol_cell_integer_2d
@@ -770,6 +838,40 @@ module iric
     module procedure cg_iric_read_sol_node_real_3d
   end interface
 
+  interface cg_iric_read_sol_node_integer_series
+    module procedure cg_iric_read_sol_node_integer_series_1d
+    module procedure cg_iric_read_sol_node_integer_series_2d
+  end interface
+
+  interface cg_iric_read_sol_node_real_series
+    module procedure cg_iric_read_sol_node_real_series_1d
+    module procedure cg_iric_read_sol_node_real_series_2d
+  end interface
+
+  interface cg_iric_read_sol_node_integer_region2d
+    module procedure cg_iric_read_sol_node_integer_region2d_1d
+    module procedure cg_iric_read_sol_node_integer_region2d_2d
+    module procedure cg_iric_read_sol_node_integer_region2d_3d
+  end interface
+
+  interface cg_iric_read_sol_node_real_region2d
+    module procedure cg_iric_read_sol_node_real_region2d_1d
+    module procedure cg_iric_read_sol_node_real_region2d_2d
+    module procedure cg_iric_read_sol_node_real_region2d_3d
+  end interface
+
+  interface cg_iric_read_sol_node_integer_region3d
+    module procedure cg_iric_read_sol_node_integer_region3d_1d
+    module procedure cg_iric_read_sol_node_integer_region3d_2d
+    module procedure cg_iric_read_sol_node_integer_region3d_3d
+  end interface
+
+  interface cg_iric_read_sol_node_real_region3d
+    module procedure cg_iric_read_sol_node_real_region3d_1d
+    module procedure cg_iric_read_sol_node_real_region3d_2d
+    module procedure cg_iric_read_sol_node_real_region3d_3d
+  end interface
+
   interface cg_iric_write_sol_node_integer
     module procedure cg_iric_write_sol_node_integer_1d
     module procedure cg_iric_write_sol_node_integer_2d
@@ -794,6 +896,40 @@ module iric
     module procedure cg_iric_read_sol_cell_real_withgridid_3d
   end interface
 
+  interface cg_iric_read_sol_cell_integer_series_withgridid
+    module procedure cg_iric_read_sol_cell_integer_series_withgridid_1d
+    module procedure cg_iric_read_sol_cell_integer_series_withgridid_2d
+  end interface
+
+  interface cg_iric_read_sol_cell_real_series_withgridid
+    module procedure cg_iric_read_sol_cell_real_series_withgridid_1d
+    module procedure cg_iric_read_sol_cell_real_series_withgridid_2d
+  end interface
+
+  interface cg_iric_read_sol_cell_integer_region2d_withgridid
+    module procedure cg_iric_read_sol_cell_integer_region2d_withgridid_1d
+    module procedure cg_iric_read_sol_cell_integer_region2d_withgridid_2d
+    module procedure cg_iric_read_sol_cell_integer_region2d_withgridid_3d
+  end interface
+
+  interface cg_iric_read_sol_cell_real_region2d_withgridid
+    module procedure cg_iric_read_sol_cell_real_region2d_withgridid_1d
+    module procedure cg_iric_read_sol_cell_real_region2d_withgridid_2d
+    module procedure cg_iric_read_sol_cell_real_region2d_withgridid_3d
+  end interface
+
+  interface cg_iric_read_sol_cell_integer_region3d_withgridid
+    module procedure cg_iric_read_sol_cell_integer_region3d_withgridid_1d
+    module procedure cg_iric_read_sol_cell_integer_region3d_withgridid_2d
+    module procedure cg_iric_read_sol_cell_integer_region3d_withgridid_3d
+  end interface
+
+  interface cg_iric_read_sol_cell_real_region3d_withgridid
+    module procedure cg_iric_read_sol_cell_real_region3d_withgridid_1d
+    module procedure cg_iric_read_sol_cell_real_region3d_withgridid_2d
+    module procedure cg_iric_read_sol_cell_real_region3d_withgridid_3d
+  end interface
+
   interface cg_iric_write_sol_cell_integer_withgridid
     module procedure cg_iric_write_sol_cell_integer_withgridid_1d
     module procedure cg_iric_write_sol_cell_integer_withgridid_2d
@@ -910,6 +1046,40 @@ module iric
     module procedure cg_iric_read_sol_node_real_withgridid_3d
   end interface
 
+  interface cg_iric_read_sol_node_integer_series_withgridid
+    module procedure cg_iric_read_sol_node_integer_series_withgridid_1d
+    module procedure cg_iric_read_sol_node_integer_series_withgridid_2d
+  end interface
+
+  interface cg_iric_read_sol_node_real_series_withgridid
+    module procedure cg_iric_read_sol_node_real_series_withgridid_1d
+    module procedure cg_iric_read_sol_node_real_series_withgridid_2d
+  end interface
+
+  interface cg_iric_read_sol_node_integer_region2d_withgridid
+    module procedure cg_iric_read_sol_node_integer_region2d_withgridid_1d
+    module procedure cg_iric_read_sol_node_integer_region2d_withgridid_2d
+    module procedure cg_iric_read_sol_node_integer_region2d_withgridid_3d
+  end interface
+
+  interface cg_iric_read_sol_node_real_region2d_withgridid
+    module procedure cg_iric_read_sol_node_real_region2d_withgridid_1d
+    module procedure cg_iric_read_sol_node_real_region2d_withgridid_2d
+    module procedure cg_iric_read_sol_node_real_region2d_withgridid_3d
+  end interface
+
+  interface cg_iric_read_sol_node_integer_region3d_withgridid
+    module procedure cg_iric_read_sol_node_integer_region3d_withgridid_1d
+    module procedure cg_iric_read_sol_node_integer_region3d_withgridid_2d
+    module procedure cg_iric_read_sol_node_integer_region3d_withgridid_3d
+  end interface
+
+  interface cg_iric_read_sol_node_real_region3d_withgridid
+    module procedure cg_iric_read_sol_node_real_region3d_withgridid_1d
+    module procedure cg_iric_read_sol_node_real_region3d_withgridid_2d
+    module procedure cg_iric_read_sol_node_real_region3d_withgridid_3d
+  end interface
+
   interface cg_iric_write_sol_node_integer_withgridid
     module procedure cg_iric_write_sol_node_integer_withgridid_1d
     module procedure cg_iric_write_sol_node_integer_withgridid_2d
@@ -2705,6 +2875,82 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_read_grid2d_coords_region_withgridid_1d(fid, gid, imin, imax, jmin, jmax, stride, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid2d_coords_region_withgridid_f2c &
+      (fid, gid, imin, imax, jmin, jmax, stride, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_grid2d_coords_region_withgridid_2d(fid, gid, imin, imax, jmin, jmax, stride, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:), intent(out):: x_arr
+    double precision, dimension(:,:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid2d_coords_region_withgridid_f2c &
+      (fid, gid, imin, imax, jmin, jmax, stride, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_grid3d_coords_region_withgridid_1d(fid, gid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr, y_arr, &
+      z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    double precision, dimension(:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid3d_coords_region_withgridid_f2c &
+      (fid, gid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_grid3d_coords_region_withgridid_3d(fid, gid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr, y_arr, &
+      z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:,:), intent(out):: x_arr
+    double precision, dimension(:,:,:), intent(out):: y_arr
+    double precision, dimension(:,:,:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid3d_coords_region_withgridid_f2c &
+      (fid, gid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
   subroutine cg_iric_read_grid_celltype_withgridid(fid, gid, type, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
@@ -4057,6 +4303,16 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_set_grid2d_spatialindex(grid_handle, type, ier)
+    integer, intent(in):: grid_handle
+    integer, intent(in):: type
+    integer, intent(out):: ier
+
+    call cg_iric_set_grid2d_spatialindex_f2c &
+      (grid_handle, type, ier)
+
+  end subroutine
+
   subroutine cg_iric_read_grid2d_cellarea(grid_handle, cellId, area, ier)
     integer, intent(in):: grid_handle
     integer, intent(in):: cellId
@@ -4120,6 +4376,67 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_read_grid2d_findcellwithhint(grid_handle, x, y, hintCellId, cellId, ier)
+    integer, intent(in):: grid_handle
+    double precision, intent(in):: x
+    double precision, intent(in):: y
+    integer, intent(in):: hintCellId
+    integer, intent(out):: cellId
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid2d_findcellwithhint_f2c &
+      (grid_handle, x, y, hintCellId, cellId, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_grid2d_interpolatewithhint(grid_handle, x, y, hintCellId, ok, cellId, count, nodeids_arr, weights_arr, &
+      ier)
+    integer, intent(in):: grid_handle
+    double precision, intent(in):: x
+    double precision, intent(in):: y
+    integer, intent(in):: hintCellId
+    integer, intent(out):: ok
+    integer, intent(out):: cellId
+    integer, intent(out):: count
+    integer, dimension(:), intent(out):: nodeids_arr
+    double precision, dimension(:), intent(out):: weights_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid2d_interpolatewithhint_f2c &
+      (grid_handle, x, y, hintCellId, ok, cellId, count, nodeids_arr, weights_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_grid2d_findcellmulti(grid_handle, count, x_arr, y_arr, cellids_arr, ier)
+    integer, intent(in):: grid_handle
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    integer, dimension(:), intent(out):: cellids_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid2d_findcellmulti_f2c &
+      (grid_handle, count, x_arr, y_arr, cellids_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_grid2d_interpolatemulti(grid_handle, count, x_arr, y_arr, ok_arr, nodecount_arr, nodeids_arr, &
+      weights_arr, ier)
+    integer, intent(in):: grid_handle
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    integer, dimension(:), intent(out):: ok_arr
+    integer, dimension(:), intent(out):: nodecount_arr
+    integer, dimension(:), intent(out):: nodeids_arr
+    double precision, dimension(:), intent(out):: weights_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid2d_interpolatemulti_f2c &
+      (grid_handle, count, x_arr, y_arr, ok_arr, nodecount_arr, nodeids_arr, weights_arr, ier)
+
+  end subroutine
+
 
 
   ! from iriclib_gui_coorp.h
@@ -4174,6 +4491,49 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_set_storagepolicy(fid, compression, level, shuffle, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: compression
+    integer, intent(in):: level
+    integer, intent(in):: shuffle
+    integer, intent(out):: ier
+
+    call cg_iric_set_storagepolicy_f2c &
+      (fid, compression, level, shuffle, ier)
+
+  end subroutine
+
+  subroutine cg_iric_set_storagechunking(fid, contiguous_limit, chunk_size, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: contiguous_limit
+    integer, intent(in):: chunk_size
+    integer, intent(out):: ier
+
+    call cg_iric_set_storagechunking_f2c &
+      (fid, contiguous_limit, chunk_size, ier)
+
+  end subroutine
+
+  subroutine cg_iric_set_particlegrouptrajectory(fid, idname, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: idname
+    integer, intent(out):: ier
+
+    call cg_iric_set_particlegrouptrajectory_f2c &
+      (fid, idname, ier)
+
+  end subroutine
+
+  subroutine cg_iric_set_particlebins(fid, level, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: level
+    integer, intent(out):: ier
+
+    call cg_iric_set_particlebins_f2c &
+      (fid, level, ier)
+
+  end subroutine
+
 
 
   ! from iriclib_not_withbaseid.h
@@ -5686,6 +6046,76 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_read_grid2d_coords_region_1d(fid, imin, imax, jmin, jmax, stride, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid2d_coords_region_f2c &
+      (fid, imin, imax, jmin, jmax, stride, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_grid2d_coords_region_2d(fid, imin, imax, jmin, jmax, stride, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:), intent(out):: x_arr
+    double precision, dimension(:,:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid2d_coords_region_f2c &
+      (fid, imin, imax, jmin, jmax, stride, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_grid3d_coords_region_1d(fid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    double precision, dimension(:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid3d_coords_region_f2c &
+      (fid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_grid3d_coords_region_3d(fid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:,:), intent(out):: x_arr
+    double precision, dimension(:,:,:), intent(out):: y_arr
+    double precision, dimension(:,:,:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_grid3d_coords_region_f2c &
+      (fid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
   subroutine cg_iric_read_grid_celltype(fid, type, ier)
     integer, intent(in):: fid
     integer, intent(out):: type
@@ -6991,93 +7421,361 @@ contains
 
   end subroutine
 
-  subroutine cg_iric_write_sol_cell_integer_1d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_integer_series_1d(fid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
     character(*), intent(in):: name
-    integer, dimension(:), intent(in):: v_arr
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    integer, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_cell_integer_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_cell_integer_series_f2c &
+      (fid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_cell_integer_2d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_integer_series_2d(fid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
     character(*), intent(in):: name
-    integer, dimension(:,:), intent(in):: v_arr
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    integer, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_cell_integer_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_cell_integer_series_f2c &
+      (fid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_cell_integer_3d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_real_series_1d(fid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
     character(*), intent(in):: name
-    integer, dimension(:,:,:), intent(in):: v_arr
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    double precision, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_cell_integer_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_cell_real_series_f2c &
+      (fid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_cell_real_1d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_real_series_2d(fid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
     character(*), intent(in):: name
-    double precision, dimension(:), intent(in):: v_arr
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    double precision, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_cell_real_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_cell_real_series_f2c &
+      (fid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_cell_real_2d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_integer_region2d_1d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: step
     character(*), intent(in):: name
-    double precision, dimension(:,:), intent(in):: v_arr
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_cell_real_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_cell_integer_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_cell_real_3d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_integer_region2d_2d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: step
     character(*), intent(in):: name
-    double precision, dimension(:,:,:), intent(in):: v_arr
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_cell_real_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_cell_integer_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_grid2d_coords_1d(fid, step, x_arr, y_arr, ier)
+  subroutine cg_iric_read_sol_cell_integer_region2d_3d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: step
-    double precision, dimension(:), intent(out):: x_arr
-    double precision, dimension(:), intent(out):: y_arr
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:,:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_grid2d_coords_f2c &
-      (fid, step, x_arr, y_arr, ier)
+    call cg_iric_read_sol_cell_integer_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_grid2d_coords_2d(fid, step, x_arr, y_arr, ier)
+  subroutine cg_iric_read_sol_cell_real_region2d_1d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: step
-    double precision, dimension(:,:), intent(out):: x_arr
-    double precision, dimension(:,:), intent(out):: y_arr
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_grid2d_coords_f2c &
-      (fid, step, x_arr, y_arr, ier)
+    call cg_iric_read_sol_cell_real_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_real_region2d_2d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_real_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_real_region2d_3d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_real_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_integer_region3d_1d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_integer_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_integer_region3d_2d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    integer, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_integer_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_integer_region3d_3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    integer, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_integer_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_real_region3d_1d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_real_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_real_region3d_2d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_real_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_real_region3d_3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_real_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_cell_integer_1d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_cell_integer_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_cell_integer_2d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, dimension(:,:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_cell_integer_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_cell_integer_3d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, dimension(:,:,:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_cell_integer_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_cell_real_1d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_cell_real_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_cell_real_2d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    double precision, dimension(:,:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_cell_real_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_cell_real_3d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    double precision, dimension(:,:,:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_cell_real_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_grid2d_coords_1d(fid, step, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_grid2d_coords_f2c &
+      (fid, step, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_grid2d_coords_2d(fid, step, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    double precision, dimension(:,:), intent(out):: x_arr
+    double precision, dimension(:,:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_grid2d_coords_f2c &
+      (fid, step, x_arr, y_arr, ier)
 
   end subroutine
 
@@ -7639,165 +8337,513 @@ contains
 
   end subroutine
 
-  subroutine cg_iric_write_sol_node_integer_1d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_integer_series_1d(fid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
     character(*), intent(in):: name
-    integer, dimension(:), intent(in):: v_arr
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    integer, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_node_integer_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_node_integer_series_f2c &
+      (fid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_node_integer_2d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_integer_series_2d(fid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
     character(*), intent(in):: name
-    integer, dimension(:,:), intent(in):: v_arr
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    integer, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_node_integer_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_node_integer_series_f2c &
+      (fid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_node_integer_3d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_real_series_1d(fid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
     character(*), intent(in):: name
-    integer, dimension(:,:,:), intent(in):: v_arr
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    double precision, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_node_integer_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_node_real_series_f2c &
+      (fid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_node_real_1d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_real_series_2d(fid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
     character(*), intent(in):: name
-    double precision, dimension(:), intent(in):: v_arr
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    double precision, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_node_real_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_node_real_series_f2c &
+      (fid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_node_real_2d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_integer_region2d_1d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: step
     character(*), intent(in):: name
-    double precision, dimension(:,:), intent(in):: v_arr
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_node_real_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_node_integer_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_node_real_3d(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_integer_region2d_2d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: step
     character(*), intent(in):: name
-    double precision, dimension(:,:,:), intent(in):: v_arr
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_node_real_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_node_integer_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_particle_count(fid, step, count, ier)
+  subroutine cg_iric_read_sol_node_integer_region2d_3d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: step
-    integer, intent(out):: count
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:,:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_particle_count_f2c &
-      (fid, step, count, ier)
+    call cg_iric_read_sol_node_integer_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_particle_pos2d(fid, step, x_arr, y_arr, ier)
+  subroutine cg_iric_read_sol_node_real_region2d_1d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: step
-    double precision, dimension(:), intent(out):: x_arr
-    double precision, dimension(:), intent(out):: y_arr
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_particle_pos2d_f2c &
-      (fid, step, x_arr, y_arr, ier)
+    call cg_iric_read_sol_node_real_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_particle_pos3d(fid, step, x_arr, y_arr, z_arr, ier)
+  subroutine cg_iric_read_sol_node_real_region2d_2d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: step
-    double precision, dimension(:), intent(out):: x_arr
-    double precision, dimension(:), intent(out):: y_arr
-    double precision, dimension(:), intent(out):: z_arr
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_particle_pos3d_f2c &
-      (fid, step, x_arr, y_arr, z_arr, ier)
+    call cg_iric_read_sol_node_real_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_particle_real(fid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_real_region2d_3d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: step
     character(*), intent(in):: name
-    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_particle_real_f2c &
-      (fid, step, name, v_arr, ier)
+    call cg_iric_read_sol_node_real_region2d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_particle_integer(fid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_integer_region3d_1d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: step
     character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
     integer, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_particle_integer_f2c &
-      (fid, step, name, v_arr, ier)
+    call cg_iric_read_sol_node_integer_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_particle_pos2d(fid, count, x_arr, y_arr, ier)
+  subroutine cg_iric_read_sol_node_integer_region3d_2d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
     integer, intent(in):: fid
-    integer, intent(in):: count
-    double precision, dimension(:), intent(in):: x_arr
-    double precision, dimension(:), intent(in):: y_arr
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    integer, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_particle_pos2d_f2c &
-      (fid, count, x_arr, y_arr, ier)
+    call cg_iric_read_sol_node_integer_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_particle_pos3d(fid, count, x_arr, y_arr, z_arr, ier)
+  subroutine cg_iric_read_sol_node_integer_region3d_3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
     integer, intent(in):: fid
-    integer, intent(in):: count
-    double precision, dimension(:), intent(in):: x_arr
-    double precision, dimension(:), intent(in):: y_arr
-    double precision, dimension(:), intent(in):: z_arr
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    integer, dimension(:,:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_particle_pos3d_f2c &
-      (fid, count, x_arr, y_arr, z_arr, ier)
+    call cg_iric_read_sol_node_integer_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_particle_real(fid, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_real_region3d_1d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: step
     character(*), intent(in):: name
-    double precision, dimension(:), intent(in):: v_arr
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_particle_real_f2c &
-      (fid, name, v_arr, ier)
+    call cg_iric_read_sol_node_real_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_region3d_2d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_region3d_3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_region3d_f2c &
+      (fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_node_integer_1d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_node_integer_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_node_integer_2d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, dimension(:,:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_node_integer_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_node_integer_3d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, dimension(:,:,:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_node_integer_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_node_real_1d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_node_real_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_node_real_2d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    double precision, dimension(:,:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_node_real_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_node_real_3d(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    double precision, dimension(:,:,:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_node_real_f2c &
+      (fid, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_count(fid, step, count, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    integer, intent(out):: count
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_count_f2c &
+      (fid, step, count, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_pos2d(fid, step, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_pos2d_f2c &
+      (fid, step, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_pos3d(fid, step, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    double precision, dimension(:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_pos3d_f2c &
+      (fid, step, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_real(fid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_real_f2c &
+      (fid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_integer(fid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_integer_f2c &
+      (fid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_rectcount(fid, step, xmin, xmax, ymin, ymax, count, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    integer, intent(out):: count
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectcount_f2c &
+      (fid, step, xmin, xmax, ymin, ymax, count, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_rectpos2d(fid, step, xmin, xmax, ymin, ymax, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectpos2d_f2c &
+      (fid, step, xmin, xmax, ymin, ymax, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_rectpos3d(fid, step, xmin, xmax, ymin, ymax, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    double precision, dimension(:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectpos3d_f2c &
+      (fid, step, xmin, xmax, ymin, ymax, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_rectreal(fid, step, xmin, xmax, ymin, ymax, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectreal_f2c &
+      (fid, step, xmin, xmax, ymin, ymax, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_rectinteger(fid, step, xmin, xmax, ymin, ymax, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    character(*), intent(in):: name
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectinteger_f2c &
+      (fid, step, xmin, xmax, ymin, ymax, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particle_pos2d(fid, count, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particle_pos2d_f2c &
+      (fid, count, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particle_pos3d(fid, count, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    double precision, dimension(:), intent(in):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particle_pos3d_f2c &
+      (fid, count, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particle_real(fid, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particle_real_f2c &
+      (fid, name, v_arr, ier)
 
   end subroutine
 
@@ -7877,6 +8923,177 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_read_sol_particlegroup_trajectorysize(fid, groupname, count, id_arr, step_min, step_max, size, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    integer, intent(out):: size
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectorysize_f2c &
+      (fid, groupname, count, id_arr, step_min, step_max, size, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_trajectory2d(fid, groupname, count, id_arr, step_min, step_max, pid_arr, step_arr, &
+      x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    integer, dimension(:), intent(out):: pid_arr
+    integer, dimension(:), intent(out):: step_arr
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectory2d_f2c &
+      (fid, groupname, count, id_arr, step_min, step_max, pid_arr, step_arr, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_trajectory3d(fid, groupname, count, id_arr, step_min, step_max, pid_arr, step_arr, &
+      x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    integer, dimension(:), intent(out):: pid_arr
+    integer, dimension(:), intent(out):: step_arr
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    double precision, dimension(:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectory3d_f2c &
+      (fid, groupname, count, id_arr, step_min, step_max, pid_arr, step_arr, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_trajectoryreal(fid, groupname, count, id_arr, step_min, step_max, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectoryreal_f2c &
+      (fid, groupname, count, id_arr, step_min, step_max, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_trajectoryinteger(fid, groupname, count, id_arr, step_min, step_max, name, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    character(*), intent(in):: name
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectoryinteger_f2c &
+      (fid, groupname, count, id_arr, step_min, step_max, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectcount(fid, step, groupname, xmin, xmax, ymin, ymax, count, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    integer, intent(out):: count
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectcount_f2c &
+      (fid, step, groupname, xmin, xmax, ymin, ymax, count, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectpos2d(fid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectpos2d_f2c &
+      (fid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectpos3d(fid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    double precision, dimension(:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectpos3d_f2c &
+      (fid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectreal(fid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectreal_f2c &
+      (fid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectinteger(fid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    character(*), intent(in):: name
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectinteger_f2c &
+      (fid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr, ier)
+
+  end subroutine
+
   subroutine cg_iric_write_sol_particlegroup_groupbegin(fid, groupname, ier)
     integer, intent(in):: fid
     character(*), intent(in):: groupname
@@ -7933,11 +9150,60 @@ contains
   subroutine cg_iric_write_sol_particlegroup_real(fid, name, value, ier)
     integer, intent(in):: fid
     character(*), intent(in):: name
-    double precision, intent(in):: value
+    double precision, intent(in):: value
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroup_real_f2c &
+      (fid, name, value, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particlegroup_pos2dmulti(fid, count, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroup_pos2dmulti_f2c &
+      (fid, count, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particlegroup_pos3dmulti(fid, count, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    double precision, dimension(:), intent(in):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroup_pos3dmulti_f2c &
+      (fid, count, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particlegroup_integermulti(fid, name, count, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroup_integermulti_f2c &
+      (fid, name, count, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particlegroup_realmulti(fid, name, count, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_particlegroup_real_f2c &
-      (fid, name, value, ier)
+    call cg_iric_write_sol_particlegroup_realmulti_f2c &
+      (fid, name, count, v_arr, ier)
 
   end subroutine
 
@@ -8000,6 +9266,20 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_write_sol_particlegroupimage_pos2dmulti(fid, count, x_arr, y_arr, size_arr, angle_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    double precision, dimension(:), intent(in):: size_arr
+    double precision, dimension(:), intent(in):: angle_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroupimage_pos2dmulti_f2c &
+      (fid, count, x_arr, y_arr, size_arr, angle_arr, ier)
+
+  end subroutine
+
   subroutine cg_iric_read_sol_polydata_datacount(fid, step, groupname, count, ier)
     integer, intent(in):: fid
     integer, intent(in):: step
@@ -8140,6 +9420,44 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_write_sol_polydata_geometrymulti(fid, count, types_arr, offsets_arr, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: types_arr
+    integer, dimension(:), intent(in):: offsets_arr
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_polydata_geometrymulti_f2c &
+      (fid, count, types_arr, offsets_arr, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_polydata_integermulti(fid, name, count, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_polydata_integermulti_f2c &
+      (fid, name, count, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_polydata_realmulti(fid, name, count, v_arr, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_polydata_realmulti_f2c &
+      (fid, name, count, v_arr, ier)
+
+  end subroutine
+
 
 
   ! from iriclib_solution.h
@@ -8233,166 +9551,508 @@ contains
 
   end subroutine
 
-  subroutine cg_iric_write_sol_end(fid, ier)
+  subroutine cg_iric_write_sol_end(fid, ier)
+    integer, intent(in):: fid
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_end_f2c &
+      (fid, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_time(fid, time, ier)
+    integer, intent(in):: fid
+    double precision, intent(in):: time
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_time_f2c &
+      (fid, time, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_iteration(fid, iteration, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: iteration
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_iteration_f2c &
+      (fid, iteration, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_baseiterative_integer(fid, name, value, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    integer, intent(in):: value
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_baseiterative_integer_f2c &
+      (fid, name, value, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_baseiterative_real(fid, name, value, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    double precision, intent(in):: value
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_baseiterative_real_f2c &
+      (fid, name, value, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_baseiterative_string(fid, name, value, ier)
+    integer, intent(in):: fid
+    character(*), intent(in):: name
+    character(*), intent(in):: value
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_baseiterative_string_f2c &
+      (fid, name, value, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_errorcode(fid, errorcode, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: errorcode
+    integer, intent(out):: ier
+
+    call cg_iric_write_errorcode_f2c &
+      (fid, errorcode, ier)
+
+  end subroutine
+
+  subroutine cg_iric_clear_sol(fid, ier)
+    integer, intent(in):: fid
+    integer, intent(out):: ier
+
+    call cg_iric_clear_sol_f2c &
+      (fid, ier)
+
+  end subroutine
+
+  subroutine cg_iric_set_sol_cache(fid, capacity, prefetch, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: capacity
+    integer, intent(in):: prefetch
+    integer, intent(out):: ier
+
+    call cg_iric_set_sol_cache_f2c &
+      (fid, capacity, prefetch, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cachestats(fid, hits, misses, ier)
+    integer, intent(in):: fid
+    integer, intent(out):: hits
+    integer, intent(out):: misses
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cachestats_f2c &
+      (fid, hits, misses, ier)
+
+  end subroutine
+
+  subroutine cg_iric_set_sol_asyncwrite(fid, queueSize, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: queueSize
+    integer, intent(out):: ier
+
+    call cg_iric_set_sol_asyncwrite_f2c &
+      (fid, queueSize, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_asyncwritestats(fid, maxQueueDepth, stallSeconds, ier)
+    integer, intent(in):: fid
+    integer, intent(out):: maxQueueDepth
+    double precision, intent(out):: stallSeconds
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_asyncwritestats_f2c &
+      (fid, maxQueueDepth, stallSeconds, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_refresh(fid, ier)
+    integer, intent(in):: fid
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_refresh_f2c &
+      (fid, ier)
+
+  end subroutine
+
+
+
+  ! from iriclib_sol_cell.h
+
+  subroutine cg_iric_read_sol_cell_integer_withgridid_1d(fid, gid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_integer_withgridid_f2c &
+      (fid, gid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_integer_withgridid_2d(fid, gid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_integer_withgridid_f2c &
+      (fid, gid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_integer_withgridid_3d(fid, gid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_integer_withgridid_f2c &
+      (fid, gid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_real_withgridid_1d(fid, gid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_real_withgridid_f2c &
+      (fid, gid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_real_withgridid_2d(fid, gid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    double precision, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_real_withgridid_f2c &
+      (fid, gid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_real_withgridid_3d(fid, gid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    double precision, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_real_withgridid_f2c &
+      (fid, gid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_integer_series_withgridid_1d(fid, gid, name, count, idx_arr, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_integer_series_withgridid_f2c &
+      (fid, gid, name, count, idx_arr, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_integer_series_withgridid_2d(fid, gid, name, count, idx_arr, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    integer, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_cell_integer_series_withgridid_f2c &
+      (fid, gid, name, count, idx_arr, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_cell_real_series_withgridid_1d(fid, gid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    double precision, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_end_f2c &
-      (fid, ier)
+    call cg_iric_read_sol_cell_real_series_withgridid_f2c &
+      (fid, gid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_time(fid, time, ier)
+  subroutine cg_iric_read_sol_cell_real_series_withgridid_2d(fid, gid, name, count, idx_arr, v_arr, ier)
     integer, intent(in):: fid
-    double precision, intent(in):: time
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    double precision, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_time_f2c &
-      (fid, time, ier)
+    call cg_iric_read_sol_cell_real_series_withgridid_f2c &
+      (fid, gid, name, count, idx_arr, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_iteration(fid, iteration, ier)
+  subroutine cg_iric_read_sol_cell_integer_region2d_withgridid_1d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
-    integer, intent(in):: iteration
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_iteration_f2c &
-      (fid, iteration, ier)
+    call cg_iric_read_sol_cell_integer_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_baseiterative_integer(fid, name, value, ier)
+  subroutine cg_iric_read_sol_cell_integer_region2d_withgridid_2d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
     character(*), intent(in):: name
-    integer, intent(in):: value
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_baseiterative_integer_f2c &
-      (fid, name, value, ier)
+    call cg_iric_read_sol_cell_integer_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_baseiterative_real(fid, name, value, ier)
+  subroutine cg_iric_read_sol_cell_integer_region2d_withgridid_3d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
     character(*), intent(in):: name
-    double precision, intent(in):: value
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:,:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_baseiterative_real_f2c &
-      (fid, name, value, ier)
+    call cg_iric_read_sol_cell_integer_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_sol_baseiterative_string(fid, name, value, ier)
+  subroutine cg_iric_read_sol_cell_real_region2d_withgridid_1d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
     character(*), intent(in):: name
-    character(*), intent(in):: value
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_sol_baseiterative_string_f2c &
-      (fid, name, value, ier)
+    call cg_iric_read_sol_cell_real_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_write_errorcode(fid, errorcode, ier)
+  subroutine cg_iric_read_sol_cell_real_region2d_withgridid_2d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
-    integer, intent(in):: errorcode
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_write_errorcode_f2c &
-      (fid, errorcode, ier)
+    call cg_iric_read_sol_cell_real_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_clear_sol(fid, ier)
+  subroutine cg_iric_read_sol_cell_real_region2d_withgridid_3d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
     integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_clear_sol_f2c &
-      (fid, ier)
+    call cg_iric_read_sol_cell_real_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
 
   end subroutine
 
-
-
-  ! from iriclib_sol_cell.h
-
-  subroutine cg_iric_read_sol_cell_integer_withgridid_1d(fid, gid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_integer_region3d_withgridid_1d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, &
+      stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
     integer, intent(in):: step
     character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
     integer, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_cell_integer_withgridid_f2c &
-      (fid, gid, step, name, v_arr, ier)
+    call cg_iric_read_sol_cell_integer_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_cell_integer_withgridid_2d(fid, gid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_integer_region3d_withgridid_2d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, &
+      stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
     integer, intent(in):: step
     character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
     integer, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_cell_integer_withgridid_f2c &
-      (fid, gid, step, name, v_arr, ier)
+    call cg_iric_read_sol_cell_integer_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_cell_integer_withgridid_3d(fid, gid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_integer_region3d_withgridid_3d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, &
+      stride, v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
     integer, intent(in):: step
     character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
     integer, dimension(:,:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_cell_integer_withgridid_f2c &
-      (fid, gid, step, name, v_arr, ier)
+    call cg_iric_read_sol_cell_integer_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_cell_real_withgridid_1d(fid, gid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_real_region3d_withgridid_1d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, &
+      v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
     integer, intent(in):: step
     character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
     double precision, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_cell_real_withgridid_f2c &
-      (fid, gid, step, name, v_arr, ier)
+    call cg_iric_read_sol_cell_real_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_cell_real_withgridid_2d(fid, gid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_real_region3d_withgridid_2d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, &
+      v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
     integer, intent(in):: step
     character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
     double precision, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_cell_real_withgridid_f2c &
-      (fid, gid, step, name, v_arr, ier)
+    call cg_iric_read_sol_cell_real_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_cell_real_withgridid_3d(fid, gid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_cell_real_region3d_withgridid_3d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, &
+      v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
     integer, intent(in):: step
     character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
     double precision, dimension(:,:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_cell_real_withgridid_f2c &
-      (fid, gid, step, name, v_arr, ier)
+    call cg_iric_read_sol_cell_real_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
@@ -9089,34 +10749,324 @@ contains
     double precision, dimension(:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_node_real_withgridid_f2c &
-      (fid, gid, step, name, v_arr, ier)
+    call cg_iric_read_sol_node_real_withgridid_f2c &
+      (fid, gid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_withgridid_2d(fid, gid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    double precision, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_withgridid_f2c &
+      (fid, gid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_withgridid_3d(fid, gid, step, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    double precision, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_withgridid_f2c &
+      (fid, gid, step, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_integer_series_withgridid_1d(fid, gid, name, count, idx_arr, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_integer_series_withgridid_f2c &
+      (fid, gid, name, count, idx_arr, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_integer_series_withgridid_2d(fid, gid, name, count, idx_arr, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    integer, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_integer_series_withgridid_f2c &
+      (fid, gid, name, count, idx_arr, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_series_withgridid_1d(fid, gid, name, count, idx_arr, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_series_withgridid_f2c &
+      (fid, gid, name, count, idx_arr, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_series_withgridid_2d(fid, gid, name, count, idx_arr, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: idx_arr
+    double precision, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_series_withgridid_f2c &
+      (fid, gid, name, count, idx_arr, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_integer_region2d_withgridid_1d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_integer_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_integer_region2d_withgridid_2d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_integer_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_integer_region2d_withgridid_3d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    integer, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_integer_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_region2d_withgridid_1d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_region2d_withgridid_2d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_region2d_withgridid_3d(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: stride
+    double precision, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_region2d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_integer_region3d_withgridid_1d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, &
+      stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_integer_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_integer_region3d_withgridid_2d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, &
+      stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    integer, dimension(:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_integer_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_integer_region3d_withgridid_3d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, &
+      stride, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    integer, dimension(:,:,:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_integer_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_node_real_region3d_withgridid_1d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, &
+      v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_node_real_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_node_real_withgridid_2d(fid, gid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_real_region3d_withgridid_2d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, &
+      v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
     integer, intent(in):: step
     character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
     double precision, dimension(:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_node_real_withgridid_f2c &
-      (fid, gid, step, name, v_arr, ier)
+    call cg_iric_read_sol_node_real_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
-  subroutine cg_iric_read_sol_node_real_withgridid_3d(fid, gid, step, name, v_arr, ier)
+  subroutine cg_iric_read_sol_node_real_region3d_withgridid_3d(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, &
+      v_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
     integer, intent(in):: step
     character(*), intent(in):: name
+    integer, intent(in):: imin
+    integer, intent(in):: imax
+    integer, intent(in):: jmin
+    integer, intent(in):: jmax
+    integer, intent(in):: kmin
+    integer, intent(in):: kmax
+    integer, intent(in):: stride
     double precision, dimension(:,:,:), intent(out):: v_arr
     integer, intent(out):: ier
 
-    call cg_iric_read_sol_node_real_withgridid_f2c &
-      (fid, gid, step, name, v_arr, ier)
+    call cg_iric_read_sol_node_real_region3d_withgridid_f2c &
+      (fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr, ier)
 
   end subroutine
 
@@ -9261,6 +11211,91 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_read_sol_particle_rectcount_withgridid(fid, gid, step, xmin, xmax, ymin, ymax, count, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    integer, intent(out):: count
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectcount_withgridid_f2c &
+      (fid, gid, step, xmin, xmax, ymin, ymax, count, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_rectpos2d_withgridid(fid, gid, step, xmin, xmax, ymin, ymax, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectpos2d_withgridid_f2c &
+      (fid, gid, step, xmin, xmax, ymin, ymax, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_rectpos3d_withgridid(fid, gid, step, xmin, xmax, ymin, ymax, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    double precision, dimension(:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectpos3d_withgridid_f2c &
+      (fid, gid, step, xmin, xmax, ymin, ymax, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_rectreal_withgridid(fid, gid, step, xmin, xmax, ymin, ymax, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectreal_withgridid_f2c &
+      (fid, gid, step, xmin, xmax, ymin, ymax, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particle_rectinteger_withgridid(fid, gid, step, xmin, xmax, ymin, ymax, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    character(*), intent(in):: name
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particle_rectinteger_withgridid_f2c &
+      (fid, gid, step, xmin, xmax, ymin, ymax, name, v_arr, ier)
+
+  end subroutine
+
   subroutine cg_iric_write_sol_particle_pos2d_withgridid(fid, gid, count, x_arr, y_arr, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
@@ -9386,6 +11421,193 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_read_sol_particlegroup_trajectorysize_withgridid(fid, gid, groupname, count, id_arr, step_min, step_max, &
+      size, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    integer, intent(out):: size
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectorysize_withgridid_f2c &
+      (fid, gid, groupname, count, id_arr, step_min, step_max, size, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_trajectory2d_withgridid(fid, gid, groupname, count, id_arr, step_min, step_max, &
+      pid_arr, step_arr, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    integer, dimension(:), intent(out):: pid_arr
+    integer, dimension(:), intent(out):: step_arr
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectory2d_withgridid_f2c &
+      (fid, gid, groupname, count, id_arr, step_min, step_max, pid_arr, step_arr, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_trajectory3d_withgridid(fid, gid, groupname, count, id_arr, step_min, step_max, &
+      pid_arr, step_arr, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    integer, dimension(:), intent(out):: pid_arr
+    integer, dimension(:), intent(out):: step_arr
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    double precision, dimension(:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectory3d_withgridid_f2c &
+      (fid, gid, groupname, count, id_arr, step_min, step_max, pid_arr, step_arr, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_trajectoryreal_withgridid(fid, gid, groupname, count, id_arr, step_min, step_max, &
+      name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectoryreal_withgridid_f2c &
+      (fid, gid, groupname, count, id_arr, step_min, step_max, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_trajectoryinteger_withgridid(fid, gid, groupname, count, id_arr, step_min, step_max, &
+      name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: groupname
+    integer, intent(in):: count
+    integer, dimension(:), intent(out):: id_arr
+    integer, intent(in):: step_min
+    integer, intent(in):: step_max
+    character(*), intent(in):: name
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_trajectoryinteger_withgridid_f2c &
+      (fid, gid, groupname, count, id_arr, step_min, step_max, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectcount_withgridid(fid, gid, step, groupname, xmin, xmax, ymin, ymax, count, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    integer, intent(out):: count
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectcount_withgridid_f2c &
+      (fid, gid, step, groupname, xmin, xmax, ymin, ymax, count, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectpos2d_withgridid(fid, gid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr, &
+      ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectpos2d_withgridid_f2c &
+      (fid, gid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectpos3d_withgridid(fid, gid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr, &
+      z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    double precision, dimension(:), intent(out):: x_arr
+    double precision, dimension(:), intent(out):: y_arr
+    double precision, dimension(:), intent(out):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectpos3d_withgridid_f2c &
+      (fid, gid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectreal_withgridid(fid, gid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    character(*), intent(in):: name
+    double precision, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectreal_withgridid_f2c &
+      (fid, gid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_read_sol_particlegroup_rectinteger_withgridid(fid, gid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr, &
+      ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: step
+    character(*), intent(in):: groupname
+    double precision, intent(in):: xmin
+    double precision, intent(in):: xmax
+    double precision, intent(in):: ymin
+    double precision, intent(in):: ymax
+    character(*), intent(in):: name
+    integer, dimension(:), intent(out):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_read_sol_particlegroup_rectinteger_withgridid_f2c &
+      (fid, gid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr, ier)
+
+  end subroutine
+
   subroutine cg_iric_write_sol_particlegroup_groupbegin_withgridid(fid, gid, groupname, ier)
     integer, intent(in):: fid
     integer, intent(in):: gid
@@ -9456,6 +11678,59 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_write_sol_particlegroup_pos2dmulti_withgridid(fid, gid, count, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroup_pos2dmulti_withgridid_f2c &
+      (fid, gid, count, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particlegroup_pos3dmulti_withgridid(fid, gid, count, x_arr, y_arr, z_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    double precision, dimension(:), intent(in):: z_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroup_pos3dmulti_withgridid_f2c &
+      (fid, gid, count, x_arr, y_arr, z_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particlegroup_integermulti_withgridid(fid, gid, name, count, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroup_integermulti_withgridid_f2c &
+      (fid, gid, name, count, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_particlegroup_realmulti_withgridid(fid, gid, name, count, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroup_realmulti_withgridid_f2c &
+      (fid, gid, name, count, v_arr, ier)
+
+  end subroutine
+
 
 
   ! from iriclib_sol_particlegroupimage.h
@@ -9524,6 +11799,21 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_write_sol_particlegroupimage_pos2dmulti_withgridid(fid, gid, count, x_arr, y_arr, size_arr, angle_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    double precision, dimension(:), intent(in):: size_arr
+    double precision, dimension(:), intent(in):: angle_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_particlegroupimage_pos2dmulti_withgridid_f2c &
+      (fid, gid, count, x_arr, y_arr, size_arr, angle_arr, ier)
+
+  end subroutine
+
 
 
   ! from iriclib_sol_polydata.h
@@ -9680,5 +11970,46 @@ contains
 
   end subroutine
 
+  subroutine cg_iric_write_sol_polydata_geometrymulti_withgridid(fid, gid, count, types_arr, offsets_arr, x_arr, y_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: types_arr
+    integer, dimension(:), intent(in):: offsets_arr
+    double precision, dimension(:), intent(in):: x_arr
+    double precision, dimension(:), intent(in):: y_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_polydata_geometrymulti_withgridid_f2c &
+      (fid, gid, count, types_arr, offsets_arr, x_arr, y_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_polydata_integermulti_withgridid(fid, gid, name, count, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    integer, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_polydata_integermulti_withgridid_f2c &
+      (fid, gid, name, count, v_arr, ier)
+
+  end subroutine
+
+  subroutine cg_iric_write_sol_polydata_realmulti_withgridid(fid, gid, name, count, v_arr, ier)
+    integer, intent(in):: fid
+    integer, intent(in):: gid
+    character(*), intent(in):: name
+    integer, intent(in):: count
+    double precision, dimension(:), intent(in):: v_arr
+    integer, intent(out):: ier
+
+    call cg_iric_write_sol_polydata_realmulti_withgridid_f2c &
+      (fid, gid, name, count, v_arr, ier)
+
+  end subroutine
+
 
 end module
@@ -3,6 +3,7 @@
 #define IRIC_MODE_READ          0
 #define IRIC_MODE_WRITE         1
 #define IRIC_MODE_MODIFY        2
+#define IRIC_MODE_READ_SWMR     3
 
 #define IRIC_GEO_UNKNOWN        0
 #define IRIC_GEO_POLYGON        1
@@ -10,10 +11,23 @@
 #define IRIC_GEO_POINTMAP       3
 #define IRIC_GEO_POLYLINE       4
 
-#define IRIC_OPTION_UNKNOWN         0
-#define IRIC_OPTION_CANCEL          1
-#define IRIC_OPTION_DIVIDESOLUTIONS 2
-#define IRIC_OPTION_STDSOLUTION     3
+#define IRIC_OPTION_UNKNOWN                0
+#define IRIC_OPTION_CANCEL                 1
+#define IRIC_OPTION_DIVIDESOLUTIONS        2
+#define IRIC_OPTION_STDSOLUTION            3
+#define IRIC_OPTION_SWMRSOLUTIONS          4
+#define IRIC_OPTION_SHAREDGRIDSOLUTIONS    5
+#define IRIC_OPTION_FILEACCESS_DEFAULT     6
+#define IRIC_OPTION_FILEACCESS_SOLVERWRITE 7
+#define IRIC_OPTION_FILEACCESS_GUIREAD     8
+#define IRIC_OPTION_FILEACCESS_ARCHIVE     9
+
+#define IRIC_COMPRESSION_NONE    0
+#define IRIC_COMPRESSION_DEFLATE 1
+#define IRIC_COMPRESSION_SZIP    2
+
+#define IRIC_SPATIALINDEX_BACKGRID 0
+#define IRIC_SPATIALINDEX_BVH      1
 
 #define IRIC_LOCKED 1
 
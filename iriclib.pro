@@ -2,6 +2,7 @@ TEMPLATE = lib
 TARGET = iriclib
 CONFIG += dll
 CONFIG += c++11
+CONFIG += thread
 
 DEPENDPATH += .
 unix {
@@ -69,6 +70,7 @@ HEADERS += error_macros.h \
            h5cgnsnodeflowsolution.h \
            h5cgnsparticlegroupimagesolution.h \
            h5cgnsparticlegroupsolution.h \
+           h5cgnsparticlegrouptrajectories.h \
            h5cgnsparticlesolution.h \
            h5cgnspolydatasolution.h \
            h5cgnssolutioni.h \
@@ -76,10 +78,13 @@ HEADERS += error_macros.h \
            h5cgnszone.h \
            h5cgnszonebc.h \
            h5datasetcloser.h \
+           h5datasetstoragepolicy.h \
            h5dataspacecloser.h \
            h5datatypecloser.h \
+           h5fileaccessprofile.h \
            h5groupcloser.h \
            h5objectcloser.h \
+           h5particlebins.h \
            h5propertylistcloser.h \
            h5util.h \
            intarraycontainer.h \
@@ -144,12 +149,14 @@ HEADERS += error_macros.h \
            private/h5cgnsgridcoordinates_impl.h \
            private/h5cgnsparticlegroupimagesolution_impl.h \
            private/h5cgnsparticlegroupsolution_impl.h \
+           private/h5cgnsparticlegrouptrajectories_impl.h \
            private/h5cgnsparticlesolution_impl.h \
            private/h5cgnspolydatasolution_impl.h \
            private/h5cgnssolverinformation_impl.h \
            private/h5cgnszone_impl.h \
            private/h5cgnszonebc_impl.h \
            private/iricsolverlib_cell2d_impl.h \
+           private/iricsolverlib_cellinterpolation.h \
            private/iricsolverlib_grid2d_impl.h \
            private/iricsolverlib_point2d_detail.h \
            private/vectorutil_detail.h \
@@ -179,16 +186,20 @@ SOURCES += h5attributecloser.cpp \
            h5cgnsnodeflowsolution.cpp \
            h5cgnsparticlegroupimagesolution.cpp \
            h5cgnsparticlegroupsolution.cpp \
+           h5cgnsparticlegrouptrajectories.cpp \
            h5cgnsparticlesolution.cpp \
            h5cgnspolydatasolution.cpp \
            h5cgnssolverinformation.cpp \
            h5cgnszone.cpp \
            h5cgnszonebc.cpp \
            h5datasetcloser.cpp \
+           h5datasetstoragepolicy.cpp \
            h5dataspacecloser.cpp \
            h5datatypecloser.cpp \
+           h5fileaccessprofile.cpp \
            h5groupcloser.cpp \
            h5objectcloser.cpp \
+           h5particlebins.cpp \
            h5propertylistcloser.cpp \
            h5util.cpp \
            intarraycontainer.cpp \
@@ -247,6 +258,7 @@ SOURCES += h5attributecloser.cpp \
            private/h5cgnsgridcoordinates_impl.cpp \
            private/h5cgnsparticlegroupimagesolution_impl.cpp \
            private/h5cgnsparticlegroupsolution_impl.cpp \
+           private/h5cgnsparticlegrouptrajectories_impl.cpp \
            private/h5cgnspolydatasolution_impl.cpp \
            private/h5cgnssolverinformation_impl.cpp \
            private/h5cgnszone_impl.cpp \
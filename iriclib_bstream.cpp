@@ -27,18 +27,47 @@ InputBStream& InputBStream::operator >> (double& value)
 
 InputBStream& InputBStream::operator >> (std::string& str)
 {
-	char* buffer;
-	int size;
+	int size = 0;
 	m_stream->read(reinterpret_cast<char*>(&size), sizeof(int));
-	buffer = new char[size];
-	m_stream->read(buffer, sizeof(char) * size);
+	if (size <= 0) {
+		str.clear();
+		return *this;
+	}
+	m_stringBuffer.resize(size);
+	m_stream->read(m_stringBuffer.data(), sizeof(char) * size);
 
-	str = buffer;
+	// the string is stored with the terminating null character
+	str.assign(m_stringBuffer.data(), strnlen(m_stringBuffer.data(), size));
 
-	delete buffer;
 	return *this;
 }
 
+InputBStream& InputBStream::read(int* values, size_t count)
+{
+	if (count == 0) {return *this;}
+
+	m_stream->read(reinterpret_cast<char*>(values), sizeof(int) * count);
+	return *this;
+}
+
+InputBStream& InputBStream::read(double* values, size_t count)
+{
+	if (count == 0) {return *this;}
+
+	m_stream->read(reinterpret_cast<char*>(values), sizeof(double) * count);
+	return *this;
+}
+
+bool InputBStream::fail() const
+{
+	return m_stream->fail();
+}
+
+void InputBStream::setFail()
+{
+	m_stream->setstate(std::ios::failbit);
+}
+
 OutputBStream::OutputBStream(std::ostream &stream)
 {
 	m_stream = &stream;
@@ -65,3 +94,19 @@ OutputBStream& OutputBStream::operator << (const std::string& str)
 
 	return *this;
 }
+
+OutputBStream& OutputBStream::write(const int* values, size_t count)
+{
+	if (count == 0) {return *this;}
+
+	m_stream->write(reinterpret_cast<const char*>(values), sizeof(int) * count);
+	return *this;
+}
+
+OutputBStream& OutputBStream::write(const double* values, size_t count)
+{
+	if (count == 0) {return *this;}
+
+	m_stream->write(reinterpret_cast<const char*>(values), sizeof(double) * count);
+	return *this;
+}
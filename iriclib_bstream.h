@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace iRICLib
 {
@@ -14,8 +15,17 @@ public:
 		InputBStream& operator >> (double& value);
 		InputBStream& operator >> (std::string& value);
 
+		// reads count values with one read
+		InputBStream& read(int* values, size_t count);
+		InputBStream& read(double* values, size_t count);
+
+		// true when a read failed (e.g. the file is truncated), or setFail() is called for invalid data
+		bool fail() const;
+		void setFail();
+
 private:
 		std::istream* m_stream;
+		std::vector<char> m_stringBuffer;
 };
 
 class OutputBStream {
@@ -25,6 +35,10 @@ public:
 		OutputBStream& operator << (double value);
 		OutputBStream& operator << (const std::string& value);
 
+		// writes count values with one write
+		OutputBStream& write(const int* values, size_t count);
+		OutputBStream& write(const double* values, size_t count);
+
 private:
 		std::ostream* m_stream;
 };
@@ -1,12 +1,44 @@
+#include "error_macros.h"
+#include "h5cgnsfile.h"
+#include "h5cgnsfileseparatesolutionutil.h"
 #include "iriclib.h"
 #include "iriclib_errorcodes.h"
 
-#include <stdexcept>
+#include "internal/iric_h5cgnsfiles.h"
+#include "internal/iric_logger.h"
+
+using namespace iRICLib;
 
 int cg_iRIC_Combine_Solutions(int fid, int* progress)
 {
-	// @todo implement this
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsFile* file;
+	int ier = _iric_h5cgnsfiles_get(fid, &file);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFileSeparateSolutionUtil::combineSolutions");
+	ier = H5CgnsFileSeparateSolutionUtil::combineSolutions(file, progress);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFileSeparateSolutionUtil::combineSolutions", ier);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Update_Sol_Index(int fid, int* stepCount)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsFile* file;
+	int ier = _iric_h5cgnsfiles_get(fid, &file);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFileSeparateSolutionUtil::updateSolutionIndex");
+	ier = H5CgnsFileSeparateSolutionUtil::updateSolutionIndex(file, stepCount);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFileSeparateSolutionUtil::updateSolutionIndex", ier);
+	RETURN_IF_ERR;
 
-	throw std::runtime_error("not implemented");
+	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
@@ -8,6 +8,7 @@ extern "C" {
 #endif
 
 int IRICLIBDLL cg_iRIC_Combine_Solutions(int fid, int* progress);
+int IRICLIBDLL cg_iRIC_Update_Sol_Index(int fid, int* stepCount);
 
 #ifdef __cplusplus
 }
@@ -25,5 +25,6 @@ const int IRIC_SOLUTION_ID_INVALID = 20;
 const int IRIC_FOLDER_CREATE_ERROR = 21;
 const int IRIC_WRONG_POINTER = 22;
 const int IRIC_WRONG_CELLID = 23;
+const int IRIC_INVALID_ARGUMENT = 24;
 
 #endif // IRICLIB_ERRORCODES_H
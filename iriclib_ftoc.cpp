@@ -960,6 +960,14 @@ void IRICLIBDLL FMNAME(cg_iric_read_grid3d_coords_withgridid_f2c, CG_IRIC_READ_G
 	*ier = cg_iRIC_Read_Grid3d_Coords_WithGridId(*fid, *gid, x_arr, y_arr, z_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_grid2d_coords_region_withgridid_f2c, CG_IRIC_READ_GRID2D_COORDS_REGION_WITHGRIDID_F2C) (int* fid, int* gid, int* imin, int* imax, int* jmin, int* jmax, int* stride, double* x_arr, double* y_arr, int *ier) {
+	*ier = cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(*fid, *gid, *imin, *imax, *jmin, *jmax, *stride, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_grid3d_coords_region_withgridid_f2c, CG_IRIC_READ_GRID3D_COORDS_REGION_WITHGRIDID_F2C) (int* fid, int* gid, int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, double* x_arr, double* y_arr, double* z_arr, int *ier) {
+	*ier = cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(*fid, *gid, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, x_arr, y_arr, z_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_read_grid_celltype_withgridid_f2c, CG_IRIC_READ_GRID_CELLTYPE_WITHGRIDID_F2C) (int* fid, int* gid, int* type, int *ier) {
 	*ier = cg_iRIC_Read_Grid_CellType_WithGridId(*fid, *gid, type);
 }
@@ -1331,6 +1339,10 @@ void IRICLIBDLL FMNAME(cg_iric_read_grid2d_close_f2c, CG_IRIC_READ_GRID2D_CLOSE_
 	*ier = cg_iRIC_Read_Grid2d_Close(*grid_handle);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_set_grid2d_spatialindex_f2c, CG_IRIC_SET_GRID2D_SPATIALINDEX_F2C) (int* grid_handle, int* type, int *ier) {
+	*ier = cg_iRIC_Set_Grid2d_SpatialIndex(*grid_handle, *type);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_read_grid2d_cellarea_f2c, CG_IRIC_READ_GRID2D_CELLAREA_F2C) (int* grid_handle, int* cellId, double* area, int *ier) {
 	*ier = cg_iRIC_Read_Grid2d_CellArea(*grid_handle, *cellId, area);
 }
@@ -1351,6 +1363,22 @@ void IRICLIBDLL FMNAME(cg_iric_read_grid2d_interpolatewithcell_f2c, CG_IRIC_READ
 	*ier = cg_iRIC_Read_Grid2d_InterpolateWithCell(*grid_handle, *x, *y, *cellId, nodeids_arr, weights_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_grid2d_findcellwithhint_f2c, CG_IRIC_READ_GRID2D_FINDCELLWITHHINT_F2C) (int* grid_handle, double* x, double* y, int* hintCellId, int* cellId, int *ier) {
+	*ier = cg_iRIC_Read_Grid2d_FindCellWithHint(*grid_handle, *x, *y, *hintCellId, cellId);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_grid2d_interpolatewithhint_f2c, CG_IRIC_READ_GRID2D_INTERPOLATEWITHHINT_F2C) (int* grid_handle, double* x, double* y, int* hintCellId, int* ok, int* cellId, int* count, int* nodeids_arr, double* weights_arr, int *ier) {
+	*ier = cg_iRIC_Read_Grid2d_InterpolateWithHint(*grid_handle, *x, *y, *hintCellId, ok, cellId, count, nodeids_arr, weights_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_grid2d_findcellmulti_f2c, CG_IRIC_READ_GRID2D_FINDCELLMULTI_F2C) (int* grid_handle, int* count, double* x_arr, double* y_arr, int* cellids_arr, int *ier) {
+	*ier = cg_iRIC_Read_Grid2d_FindCellMulti(*grid_handle, *count, x_arr, y_arr, cellids_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_grid2d_interpolatemulti_f2c, CG_IRIC_READ_GRID2D_INTERPOLATEMULTI_F2C) (int* grid_handle, int* count, double* x_arr, double* y_arr, int* ok_arr, int* nodecount_arr, int* nodeids_arr, double* weights_arr, int *ier) {
+	*ier = cg_iRIC_Read_Grid2d_InterpolateMulti(*grid_handle, *count, x_arr, y_arr, ok_arr, nodecount_arr, nodeids_arr, weights_arr);
+}
+
 
 // from iriclib_gui_coorp.h
 void IRICLIBDLL FMNAME(iric_check_cancel_f2c, IRIC_CHECK_CANCEL_F2C) (int *ier) {
@@ -1379,6 +1407,26 @@ void IRICLIBDLL FMNAME(iric_initoption_f2c, IRIC_INITOPTION_F2C) (int* option, i
 	*ier = iRIC_InitOption(*option);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_set_storagepolicy_f2c, CG_IRIC_SET_STORAGEPOLICY_F2C) (int* fid, int* compression, int* level, int* shuffle, int *ier) {
+	*ier = cg_iRIC_Set_StoragePolicy(*fid, *compression, *level, *shuffle);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_set_storagechunking_f2c, CG_IRIC_SET_STORAGECHUNKING_F2C) (int* fid, int* contiguous_limit, int* chunk_size, int *ier) {
+	*ier = cg_iRIC_Set_StorageChunking(*fid, *contiguous_limit, *chunk_size);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_set_particlegrouptrajectory_f2c, CG_IRIC_SET_PARTICLEGROUPTRAJECTORY_F2C) (int* fid, STR_PSTR(idname), int *ier STR_PLEN(idname)) {
+	char c_idname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(idname), STR_LEN(idname), c_idname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Set_ParticleGroupTrajectory(*fid, c_idname);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_set_particlebins_f2c, CG_IRIC_SET_PARTICLEBINS_F2C) (int* fid, int* level, int *ier) {
+	*ier = cg_iRIC_Set_ParticleBins(*fid, *level);
+}
+
 
 // from iriclib_not_withbaseid.h
 void IRICLIBDLL FMNAME(cg_iric_read_complex_count_f2c, CG_IRIC_READ_COMPLEX_COUNT_F2C) (int* fid, STR_PSTR(groupname), int* num, int *ier STR_PLEN(groupname)) {
@@ -1981,6 +2029,14 @@ void IRICLIBDLL FMNAME(cg_iric_read_grid3d_coords_f2c, CG_IRIC_READ_GRID3D_COORD
 	*ier = cg_iRIC_Read_Grid3d_Coords(*fid, x_arr, y_arr, z_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_grid2d_coords_region_f2c, CG_IRIC_READ_GRID2D_COORDS_REGION_F2C) (int* fid, int* imin, int* imax, int* jmin, int* jmax, int* stride, double* x_arr, double* y_arr, int *ier) {
+	*ier = cg_iRIC_Read_Grid2d_Coords_Region(*fid, *imin, *imax, *jmin, *jmax, *stride, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_grid3d_coords_region_f2c, CG_IRIC_READ_GRID3D_COORDS_REGION_F2C) (int* fid, int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, double* x_arr, double* y_arr, double* z_arr, int *ier) {
+	*ier = cg_iRIC_Read_Grid3d_Coords_Region(*fid, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, x_arr, y_arr, z_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_read_grid_celltype_f2c, CG_IRIC_READ_GRID_CELLTYPE_F2C) (int* fid, int* type, int *ier) {
 	*ier = cg_iRIC_Read_Grid_CellType(*fid, type);
 }
@@ -2362,6 +2418,54 @@ void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_real_f2c, CG_IRIC_READ_SOL_CELL_REA
 	*ier = cg_iRIC_Read_Sol_Cell_Real(*fid, *step, c_name, v_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_integer_series_f2c, CG_IRIC_READ_SOL_CELL_INTEGER_SERIES_F2C) (int* fid, STR_PSTR(name), int* count, int* idx_arr, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Integer_Series(*fid, c_name, *count, idx_arr, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_real_series_f2c, CG_IRIC_READ_SOL_CELL_REAL_SERIES_F2C) (int* fid, STR_PSTR(name), int* count, int* idx_arr, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Real_Series(*fid, c_name, *count, idx_arr, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_integer_region2d_f2c, CG_IRIC_READ_SOL_CELL_INTEGER_REGION2D_F2C) (int* fid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* stride, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Integer_Region2d(*fid, *step, c_name, *imin, *imax, *jmin, *jmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_real_region2d_f2c, CG_IRIC_READ_SOL_CELL_REAL_REGION2D_F2C) (int* fid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* stride, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Real_Region2d(*fid, *step, c_name, *imin, *imax, *jmin, *jmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_integer_region3d_f2c, CG_IRIC_READ_SOL_CELL_INTEGER_REGION3D_F2C) (int* fid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Integer_Region3d(*fid, *step, c_name, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_real_region3d_f2c, CG_IRIC_READ_SOL_CELL_REAL_REGION3D_F2C) (int* fid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Real_Region3d(*fid, *step, c_name, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, v_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_write_sol_cell_integer_f2c, CG_IRIC_WRITE_SOL_CELL_INTEGER_F2C) (int* fid, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(name)) {
 	char c_name[STRINGMAXLEN + 1];
 	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
@@ -2506,6 +2610,54 @@ void IRICLIBDLL FMNAME(cg_iric_read_sol_node_real_f2c, CG_IRIC_READ_SOL_NODE_REA
 	*ier = cg_iRIC_Read_Sol_Node_Real(*fid, *step, c_name, v_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_integer_series_f2c, CG_IRIC_READ_SOL_NODE_INTEGER_SERIES_F2C) (int* fid, STR_PSTR(name), int* count, int* idx_arr, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Integer_Series(*fid, c_name, *count, idx_arr, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_real_series_f2c, CG_IRIC_READ_SOL_NODE_REAL_SERIES_F2C) (int* fid, STR_PSTR(name), int* count, int* idx_arr, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Real_Series(*fid, c_name, *count, idx_arr, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_integer_region2d_f2c, CG_IRIC_READ_SOL_NODE_INTEGER_REGION2D_F2C) (int* fid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* stride, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Integer_Region2d(*fid, *step, c_name, *imin, *imax, *jmin, *jmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_real_region2d_f2c, CG_IRIC_READ_SOL_NODE_REAL_REGION2D_F2C) (int* fid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* stride, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Real_Region2d(*fid, *step, c_name, *imin, *imax, *jmin, *jmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_integer_region3d_f2c, CG_IRIC_READ_SOL_NODE_INTEGER_REGION3D_F2C) (int* fid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Integer_Region3d(*fid, *step, c_name, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_real_region3d_f2c, CG_IRIC_READ_SOL_NODE_REAL_REGION3D_F2C) (int* fid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Real_Region3d(*fid, *step, c_name, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, v_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_write_sol_node_integer_f2c, CG_IRIC_WRITE_SOL_NODE_INTEGER_F2C) (int* fid, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(name)) {
 	char c_name[STRINGMAXLEN + 1];
 	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
@@ -2550,6 +2702,34 @@ void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_integer_f2c, CG_IRIC_READ_SOL_P
 	*ier = cg_iRIC_Read_Sol_Particle_Integer(*fid, *step, c_name, v_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectcount_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTCOUNT_F2C) (int* fid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, int* count, int *ier) {
+	*ier = cg_iRIC_Read_Sol_Particle_RectCount(*fid, *step, *xmin, *xmax, *ymin, *ymax, count);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectpos2d_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTPOS2D_F2C) (int* fid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, double* x_arr, double* y_arr, int *ier) {
+	*ier = cg_iRIC_Read_Sol_Particle_RectPos2d(*fid, *step, *xmin, *xmax, *ymin, *ymax, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectpos3d_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTPOS3D_F2C) (int* fid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, double* x_arr, double* y_arr, double* z_arr, int *ier) {
+	*ier = cg_iRIC_Read_Sol_Particle_RectPos3d(*fid, *step, *xmin, *xmax, *ymin, *ymax, x_arr, y_arr, z_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectreal_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTREAL_F2C) (int* fid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, STR_PSTR(name), double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Particle_RectReal(*fid, *step, *xmin, *xmax, *ymin, *ymax, c_name, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectinteger_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTINTEGER_F2C) (int* fid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Particle_RectInteger(*fid, *step, *xmin, *xmax, *ymin, *ymax, c_name, v_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_write_sol_particle_pos2d_f2c, CG_IRIC_WRITE_SOL_PARTICLE_POS2D_F2C) (int* fid, int* count, double* x_arr, double* y_arr, int *ier) {
 	*ier = cg_iRIC_Write_Sol_Particle_Pos2d(*fid, *count, x_arr, y_arr);
 }
@@ -2620,6 +2800,98 @@ void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_integer_f2c, CG_IRIC_READ_
 	*ier = cg_iRIC_Read_Sol_ParticleGroup_Integer(*fid, *step, c_groupname, c_name, v_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectorysize_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORYSIZE_F2C) (int* fid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, int* size, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(*fid, c_groupname, *count, id_arr, *step_min, *step_max, size);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectory2d_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORY2D_F2C) (int* fid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(*fid, c_groupname, *count, id_arr, *step_min, *step_max, pid_arr, step_arr, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectory3d_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORY3D_F2C) (int* fid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr, double* z_arr, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d(*fid, c_groupname, *count, id_arr, *step_min, *step_max, pid_arr, step_arr, x_arr, y_arr, z_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectoryreal_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORYREAL_F2C) (int* fid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, STR_PSTR(name), double* v_arr, int *ier STR_PLEN(groupname) STR_PLEN(name)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(*fid, c_groupname, *count, id_arr, *step_min, *step_max, c_name, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectoryinteger_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORYINTEGER_F2C) (int* fid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(groupname) STR_PLEN(name)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger(*fid, c_groupname, *count, id_arr, *step_min, *step_max, c_name, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectcount_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTCOUNT_F2C) (int* fid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, int* count, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectCount(*fid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, count);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectpos2d_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTPOS2D_F2C) (int* fid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, double* x_arr, double* y_arr, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectPos2d(*fid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectpos3d_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTPOS3D_F2C) (int* fid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, double* x_arr, double* y_arr, double* z_arr, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectPos3d(*fid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, x_arr, y_arr, z_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectreal_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTREAL_F2C) (int* fid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, STR_PSTR(name), double* v_arr, int *ier STR_PLEN(groupname) STR_PLEN(name)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectReal(*fid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, c_name, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectinteger_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTINTEGER_F2C) (int* fid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(groupname) STR_PLEN(name)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectInteger(*fid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, c_name, v_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_groupbegin_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_GROUPBEGIN_F2C) (int* fid, STR_PSTR(groupname), int *ier STR_PLEN(groupname)) {
 	char c_groupname[STRINGMAXLEN + 1];
 	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
@@ -2656,6 +2928,30 @@ void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_real_f2c, CG_IRIC_WRITE_S
 	*ier = cg_iRIC_Write_Sol_ParticleGroup_Real(*fid, c_name, *value);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_pos2dmulti_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_POS2DMULTI_F2C) (int* fid, int* count, double* x_arr, double* y_arr, int *ier) {
+	*ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(*fid, *count, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_pos3dmulti_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_POS3DMULTI_F2C) (int* fid, int* count, double* x_arr, double* y_arr, double* z_arr, int *ier) {
+	*ier = cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti(*fid, *count, x_arr, y_arr, z_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_integermulti_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_INTEGERMULTI_F2C) (int* fid, STR_PSTR(name), int* count, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(*fid, c_name, *count, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_realmulti_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_REALMULTI_F2C) (int* fid, STR_PSTR(name), int* count, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Write_Sol_ParticleGroup_RealMulti(*fid, c_name, *count, v_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroupimage_count_f2c, CG_IRIC_READ_SOL_PARTICLEGROUPIMAGE_COUNT_F2C) (int* fid, int* step, STR_PSTR(groupname), int* count, int *ier STR_PLEN(groupname)) {
 	char c_groupname[STRINGMAXLEN + 1];
 	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
@@ -2688,6 +2984,10 @@ void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroupimage_pos2d_f2c, CG_IRIC_W
 	*ier = cg_iRIC_Write_Sol_ParticleGroupImage_Pos2d(*fid, *x, *y, *size, *angle);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroupimage_pos2dmulti_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUPIMAGE_POS2DMULTI_F2C) (int* fid, int* count, double* x_arr, double* y_arr, double* size_arr, double* angle_arr, int *ier) {
+	*ier = cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(*fid, *count, x_arr, y_arr, size_arr, angle_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_read_sol_polydata_datacount_f2c, CG_IRIC_READ_SOL_POLYDATA_DATACOUNT_F2C) (int* fid, int* step, STR_PSTR(groupname), int* count, int *ier STR_PLEN(groupname)) {
 	char c_groupname[STRINGMAXLEN + 1];
 	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
@@ -2778,6 +3078,26 @@ void IRICLIBDLL FMNAME(cg_iric_write_sol_polydata_real_f2c, CG_IRIC_WRITE_SOL_PO
 	*ier = cg_iRIC_Write_Sol_PolyData_Real(*fid, c_name, *value);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_write_sol_polydata_geometrymulti_f2c, CG_IRIC_WRITE_SOL_POLYDATA_GEOMETRYMULTI_F2C) (int* fid, int* count, int* types_arr, int* offsets_arr, double* x_arr, double* y_arr, int *ier) {
+	*ier = cg_iRIC_Write_Sol_PolyData_GeometryMulti(*fid, *count, types_arr, offsets_arr, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_polydata_integermulti_f2c, CG_IRIC_WRITE_SOL_POLYDATA_INTEGERMULTI_F2C) (int* fid, STR_PSTR(name), int* count, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Write_Sol_PolyData_IntegerMulti(*fid, c_name, *count, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_polydata_realmulti_f2c, CG_IRIC_WRITE_SOL_POLYDATA_REALMULTI_F2C) (int* fid, STR_PSTR(name), int* count, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Write_Sol_PolyData_RealMulti(*fid, c_name, *count, v_arr);
+}
+
 
 // from iriclib_solution.h
 void IRICLIBDLL FMNAME(cg_iric_read_sol_count_f2c, CG_IRIC_READ_SOL_COUNT_F2C) (int* fid, int* count, int *ier) {
@@ -2879,6 +3199,26 @@ void IRICLIBDLL FMNAME(cg_iric_clear_sol_f2c, CG_IRIC_CLEAR_SOL_F2C) (int* fid,
 	*ier = cg_iRIC_Clear_Sol(*fid);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_set_sol_cache_f2c, CG_IRIC_SET_SOL_CACHE_F2C) (int* fid, int* capacity, int* prefetch, int *ier) {
+	*ier = cg_iRIC_Set_Sol_Cache(*fid, *capacity, *prefetch);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cachestats_f2c, CG_IRIC_READ_SOL_CACHESTATS_F2C) (int* fid, int* hits, int* misses, int *ier) {
+	*ier = cg_iRIC_Read_Sol_CacheStats(*fid, hits, misses);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_set_sol_asyncwrite_f2c, CG_IRIC_SET_SOL_ASYNCWRITE_F2C) (int* fid, int* queueSize, int *ier) {
+	*ier = cg_iRIC_Set_Sol_AsyncWrite(*fid, *queueSize);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_asyncwritestats_f2c, CG_IRIC_READ_SOL_ASYNCWRITESTATS_F2C) (int* fid, int* maxQueueDepth, double* stallSeconds, int *ier) {
+	*ier = cg_iRIC_Read_Sol_AsyncWriteStats(*fid, maxQueueDepth, stallSeconds);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_refresh_f2c, CG_IRIC_READ_SOL_REFRESH_F2C) (int* fid, int *ier) {
+	*ier = cg_iRIC_Read_Sol_Refresh(*fid);
+}
+
 
 // from iriclib_sol_cell.h
 void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_integer_withgridid_f2c, CG_IRIC_READ_SOL_CELL_INTEGER_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(name)) {
@@ -2897,6 +3237,54 @@ void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_real_withgridid_f2c, CG_IRIC_READ_S
 	*ier = cg_iRIC_Read_Sol_Cell_Real_WithGridId(*fid, *gid, *step, c_name, v_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_integer_series_withgridid_f2c, CG_IRIC_READ_SOL_CELL_INTEGER_SERIES_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* count, int* idx_arr, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Integer_Series_WithGridId(*fid, *gid, c_name, *count, idx_arr, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_real_series_withgridid_f2c, CG_IRIC_READ_SOL_CELL_REAL_SERIES_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* count, int* idx_arr, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Real_Series_WithGridId(*fid, *gid, c_name, *count, idx_arr, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_integer_region2d_withgridid_f2c, CG_IRIC_READ_SOL_CELL_INTEGER_REGION2D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* stride, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Integer_Region2d_WithGridId(*fid, *gid, *step, c_name, *imin, *imax, *jmin, *jmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_real_region2d_withgridid_f2c, CG_IRIC_READ_SOL_CELL_REAL_REGION2D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* stride, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Real_Region2d_WithGridId(*fid, *gid, *step, c_name, *imin, *imax, *jmin, *jmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_integer_region3d_withgridid_f2c, CG_IRIC_READ_SOL_CELL_INTEGER_REGION3D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Integer_Region3d_WithGridId(*fid, *gid, *step, c_name, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_cell_real_region3d_withgridid_f2c, CG_IRIC_READ_SOL_CELL_REAL_REGION3D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Cell_Real_Region3d_WithGridId(*fid, *gid, *step, c_name, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, v_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_write_sol_cell_integer_withgridid_f2c, CG_IRIC_WRITE_SOL_CELL_INTEGER_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(name)) {
 	char c_name[STRINGMAXLEN + 1];
 	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
@@ -3051,6 +3439,54 @@ void IRICLIBDLL FMNAME(cg_iric_read_sol_node_real_withgridid_f2c, CG_IRIC_READ_S
 	*ier = cg_iRIC_Read_Sol_Node_Real_WithGridId(*fid, *gid, *step, c_name, v_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_integer_series_withgridid_f2c, CG_IRIC_READ_SOL_NODE_INTEGER_SERIES_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* count, int* idx_arr, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId(*fid, *gid, c_name, *count, idx_arr, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_real_series_withgridid_f2c, CG_IRIC_READ_SOL_NODE_REAL_SERIES_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* count, int* idx_arr, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Real_Series_WithGridId(*fid, *gid, c_name, *count, idx_arr, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_integer_region2d_withgridid_f2c, CG_IRIC_READ_SOL_NODE_INTEGER_REGION2D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* stride, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId(*fid, *gid, *step, c_name, *imin, *imax, *jmin, *jmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_real_region2d_withgridid_f2c, CG_IRIC_READ_SOL_NODE_REAL_REGION2D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* stride, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId(*fid, *gid, *step, c_name, *imin, *imax, *jmin, *jmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_integer_region3d_withgridid_f2c, CG_IRIC_READ_SOL_NODE_INTEGER_REGION3D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId(*fid, *gid, *step, c_name, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_node_real_region3d_withgridid_f2c, CG_IRIC_READ_SOL_NODE_REAL_REGION3D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(name), int* imin, int* imax, int* jmin, int* jmax, int* kmin, int* kmax, int* stride, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId(*fid, *gid, *step, c_name, *imin, *imax, *jmin, *jmax, *kmin, *kmax, *stride, v_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_write_sol_node_integer_withgridid_f2c, CG_IRIC_WRITE_SOL_NODE_INTEGER_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(name)) {
 	char c_name[STRINGMAXLEN + 1];
 	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
@@ -3097,6 +3533,34 @@ void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_integer_withgridid_f2c, CG_IRIC
 	*ier = cg_iRIC_Read_Sol_Particle_Integer_WithGridId(*fid, *gid, *step, c_name, v_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectcount_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTCOUNT_WITHGRIDID_F2C) (int* fid, int* gid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, int* count, int *ier) {
+	*ier = cg_iRIC_Read_Sol_Particle_RectCount_WithGridId(*fid, *gid, *step, *xmin, *xmax, *ymin, *ymax, count);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectpos2d_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTPOS2D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, double* x_arr, double* y_arr, int *ier) {
+	*ier = cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId(*fid, *gid, *step, *xmin, *xmax, *ymin, *ymax, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectpos3d_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTPOS3D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, double* x_arr, double* y_arr, double* z_arr, int *ier) {
+	*ier = cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId(*fid, *gid, *step, *xmin, *xmax, *ymin, *ymax, x_arr, y_arr, z_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectreal_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTREAL_WITHGRIDID_F2C) (int* fid, int* gid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, STR_PSTR(name), double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Particle_RectReal_WithGridId(*fid, *gid, *step, *xmin, *xmax, *ymin, *ymax, c_name, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particle_rectinteger_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLE_RECTINTEGER_WITHGRIDID_F2C) (int* fid, int* gid, int* step, double* xmin, double* xmax, double* ymin, double* ymax, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId(*fid, *gid, *step, *xmin, *xmax, *ymin, *ymax, c_name, v_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_write_sol_particle_pos2d_withgridid_f2c, CG_IRIC_WRITE_SOL_PARTICLE_POS2D_WITHGRIDID_F2C) (int* fid, int* gid, int* count, double* x_arr, double* y_arr, int *ier) {
 	*ier = cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(*fid, *gid, *count, x_arr, y_arr);
 }
@@ -3169,6 +3633,98 @@ void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_integer_withgridid_f2c, CG
 	*ier = cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(*fid, *gid, *step, c_groupname, c_name, v_arr);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectorysize_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORYSIZE_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, int* size, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId(*fid, *gid, c_groupname, *count, id_arr, *step_min, *step_max, size);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectory2d_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORY2D_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId(*fid, *gid, c_groupname, *count, id_arr, *step_min, *step_max, pid_arr, step_arr, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectory3d_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORY3D_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr, double* z_arr, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId(*fid, *gid, c_groupname, *count, id_arr, *step_min, *step_max, pid_arr, step_arr, x_arr, y_arr, z_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectoryreal_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORYREAL_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, STR_PSTR(name), double* v_arr, int *ier STR_PLEN(groupname) STR_PLEN(name)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId(*fid, *gid, c_groupname, *count, id_arr, *step_min, *step_max, c_name, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_trajectoryinteger_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_TRAJECTORYINTEGER_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(groupname), int* count, int* id_arr, int* step_min, int* step_max, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(groupname) STR_PLEN(name)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId(*fid, *gid, c_groupname, *count, id_arr, *step_min, *step_max, c_name, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectcount_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTCOUNT_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, int* count, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectCount_WithGridId(*fid, *gid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, count);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectpos2d_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTPOS2D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, double* x_arr, double* y_arr, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId(*fid, *gid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectpos3d_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTPOS3D_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, double* x_arr, double* y_arr, double* z_arr, int *ier STR_PLEN(groupname)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId(*fid, *gid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, x_arr, y_arr, z_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectreal_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTREAL_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, STR_PSTR(name), double* v_arr, int *ier STR_PLEN(groupname) STR_PLEN(name)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId(*fid, *gid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, c_name, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroup_rectinteger_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUP_RECTINTEGER_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(groupname), double* xmin, double* xmax, double* ymin, double* ymax, STR_PSTR(name), int* v_arr, int *ier STR_PLEN(groupname) STR_PLEN(name)) {
+	char c_groupname[STRINGMAXLEN + 1];
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId(*fid, *gid, *step, c_groupname, *xmin, *xmax, *ymin, *ymax, c_name, v_arr);
+}
+
 void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_groupbegin_withgridid_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_GROUPBEGIN_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(groupname), int *ier STR_PLEN(groupname)) {
 	char c_groupname[STRINGMAXLEN + 1];
 	string_2_C_string(STR_PTR(groupname), STR_LEN(groupname), c_groupname, STRINGMAXLEN, ier);
@@ -3205,6 +3761,30 @@ void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_real_withgridid_f2c, CG_I
 	*ier = cg_iRIC_Write_Sol_ParticleGroup_Real_WithGridId(*fid, *gid, c_name, *value);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_pos2dmulti_withgridid_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_POS2DMULTI_WITHGRIDID_F2C) (int* fid, int* gid, int* count, double* x_arr, double* y_arr, int *ier) {
+	*ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(*fid, *gid, *count, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_pos3dmulti_withgridid_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_POS3DMULTI_WITHGRIDID_F2C) (int* fid, int* gid, int* count, double* x_arr, double* y_arr, double* z_arr, int *ier) {
+	*ier = cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(*fid, *gid, *count, x_arr, y_arr, z_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_integermulti_withgridid_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_INTEGERMULTI_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* count, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(*fid, *gid, c_name, *count, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroup_realmulti_withgridid_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUP_REALMULTI_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* count, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(*fid, *gid, c_name, *count, v_arr);
+}
+
 
 // from iriclib_sol_particlegroupimage.h
 void IRICLIBDLL FMNAME(cg_iric_read_sol_particlegroupimage_count_withgridid_f2c, CG_IRIC_READ_SOL_PARTICLEGROUPIMAGE_COUNT_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(groupname), int* count, int *ier STR_PLEN(groupname)) {
@@ -3239,6 +3819,10 @@ void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroupimage_pos2d_withgridid_f2c
 	*ier = cg_iRIC_Write_Sol_ParticleGroupImage_Pos2d_WithGridId(*fid, *gid, *x, *y, *size, *angle);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_write_sol_particlegroupimage_pos2dmulti_withgridid_f2c, CG_IRIC_WRITE_SOL_PARTICLEGROUPIMAGE_POS2DMULTI_WITHGRIDID_F2C) (int* fid, int* gid, int* count, double* x_arr, double* y_arr, double* size_arr, double* angle_arr, int *ier) {
+	*ier = cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(*fid, *gid, *count, x_arr, y_arr, size_arr, angle_arr);
+}
+
 
 // from iriclib_sol_polydata.h
 void IRICLIBDLL FMNAME(cg_iric_read_sol_polydata_datacount_withgridid_f2c, CG_IRIC_READ_SOL_POLYDATA_DATACOUNT_WITHGRIDID_F2C) (int* fid, int* gid, int* step, STR_PSTR(groupname), int* count, int *ier STR_PLEN(groupname)) {
@@ -3331,5 +3915,25 @@ void IRICLIBDLL FMNAME(cg_iric_write_sol_polydata_real_withgridid_f2c, CG_IRIC_W
 	*ier = cg_iRIC_Write_Sol_PolyData_Real_WithGridId(*fid, *gid, c_name, *value);
 }
 
+void IRICLIBDLL FMNAME(cg_iric_write_sol_polydata_geometrymulti_withgridid_f2c, CG_IRIC_WRITE_SOL_POLYDATA_GEOMETRYMULTI_WITHGRIDID_F2C) (int* fid, int* gid, int* count, int* types_arr, int* offsets_arr, double* x_arr, double* y_arr, int *ier) {
+	*ier = cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(*fid, *gid, *count, types_arr, offsets_arr, x_arr, y_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_polydata_integermulti_withgridid_f2c, CG_IRIC_WRITE_SOL_POLYDATA_INTEGERMULTI_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* count, int* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(*fid, *gid, c_name, *count, v_arr);
+}
+
+void IRICLIBDLL FMNAME(cg_iric_write_sol_polydata_realmulti_withgridid_f2c, CG_IRIC_WRITE_SOL_POLYDATA_REALMULTI_WITHGRIDID_F2C) (int* fid, int* gid, STR_PSTR(name), int* count, double* v_arr, int *ier STR_PLEN(name)) {
+	char c_name[STRINGMAXLEN + 1];
+	string_2_C_string(STR_PTR(name), STR_LEN(name), c_name, STRINGMAXLEN, ier);
+	if (*ier != 0) return;
+
+	*ier = cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(*fid, *gid, c_name, *count, v_arr);
+}
+
 
 } // extern "C"
@@ -59,13 +59,8 @@ int cg_iRIC_Read_Grid2d_Coords_WithGridId(int fid, int gid, double* x_arr, doubl
 		_iric_logger_error(ss.str());
 		return IRIC_INVALID_DIMENSION;
 	}
-	std::vector<double> xbuffer, ybuffer;
-
-	ier = z->gridCoordinates()->readCoordinatesX(&xbuffer);
-	ier = z->gridCoordinates()->readCoordinatesY(&ybuffer);
-
-	_vectorToPointerT(xbuffer, x_arr);
-	_vectorToPointerT(ybuffer, y_arr);
+	ier = z->gridCoordinates()->readCoordinatesX(x_arr, z->nodeCount());
+	ier = z->gridCoordinates()->readCoordinatesY(y_arr, z->nodeCount());
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -114,18 +109,66 @@ int cg_iRIC_Read_Grid3d_Coords_WithGridId(int fid, int gid, double* x_arr, doubl
 		_iric_logger_error(ss.str());
 		return IRIC_INVALID_DIMENSION;
 	}
-	std::vector<double> xbuffer, ybuffer, zbuffer;
+	ier = zone->gridCoordinates()->readCoordinatesX(x_arr, zone->nodeCount());
+	RETURN_IF_ERR;
+	ier = zone->gridCoordinates()->readCoordinatesY(y_arr, zone->nodeCount());
+	RETURN_IF_ERR;
+	ier = zone->gridCoordinates()->readCoordinatesZ(z_arr, zone->nodeCount());
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int stride, double* x_arr, double* y_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
 
-	ier = zone->gridCoordinates()->readCoordinatesX(&xbuffer);
+	H5CgnsZone* zone;
+	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
-	ier = zone->gridCoordinates()->readCoordinatesY(&ybuffer);
+
+	std::vector<hsize_t> dims, start, strides, count;
+	ier = zone->nodeDims(&dims);
 	RETURN_IF_ERR;
-	ier = zone->gridCoordinates()->readCoordinatesZ(&zbuffer);
+
+	std::vector<int> mins = {imin, jmin};
+	std::vector<int> maxs = {imax, jmax};
+	ier = _iric_get_region(zone, dims, mins, maxs, stride, &start, &strides, &count, __func__);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(xbuffer, x_arr);
-	_vectorToPointerT(ybuffer, y_arr);
-	_vectorToPointerT(zbuffer, z_arr);
+	ier = zone->gridCoordinates()->readCoordinatesXRegion(start, strides, count, x_arr);
+	RETURN_IF_ERR;
+	ier = zone->gridCoordinates()->readCoordinatesYRegion(start, strides, count, y_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* x_arr, double* y_arr, double* z_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsZone* zone;
+	int ier = _iric_get_zone(fid, gid, &zone, __func__);
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> dims, start, strides, count;
+	ier = zone->nodeDims(&dims);
+	RETURN_IF_ERR;
+
+	std::vector<int> mins = {imin, jmin, kmin};
+	std::vector<int> maxs = {imax, jmax, kmax};
+	ier = _iric_get_region(zone, dims, mins, maxs, stride, &start, &strides, &count, __func__);
+	RETURN_IF_ERR;
+
+	ier = zone->gridCoordinates()->readCoordinatesXRegion(start, strides, count, x_arr);
+	RETURN_IF_ERR;
+	ier = zone->gridCoordinates()->readCoordinatesYRegion(start, strides, count, y_arr);
+	RETURN_IF_ERR;
+	ier = zone->gridCoordinates()->readCoordinatesZRegion(start, strides, count, z_arr);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -323,10 +366,7 @@ int cg_iRIC_Read_Grid_Real_Node_WithGridId(int fid, int gid, const char* name, d
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer;
-	zone->gridAttributes()->readValue(name, &buffer);
-
-	_vectorToPointerT(buffer, v_arr);
+	zone->gridAttributes()->readValue(name, v_arr, zone->nodeCount());
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -340,10 +380,7 @@ int cg_iRIC_Read_Grid_Integer_Node_WithGridId(int fid, int gid, const char* name
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer;
-	zone->gridAttributes()->readValue(name, &buffer);
-
-	_vectorToPointerT(buffer, v_arr);
+	zone->gridAttributes()->readValue(name, v_arr, zone->nodeCount());
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -357,12 +394,9 @@ int cg_iRIC_Read_Grid_Real_Cell_WithGridId(int fid, int gid, const char* name, d
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer;
-	ier = zone->gridAttributes()->readValue(name, &buffer);
+	ier = zone->gridAttributes()->readValue(name, v_arr, zone->cellCount());
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
-
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
@@ -375,12 +409,9 @@ int cg_iRIC_Read_Grid_Integer_Cell_WithGridId(int fid, int gid, const char* name
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer;
-	ier = zone->gridAttributes()->readValue(name, &buffer);
+	ier = zone->gridAttributes()->readValue(name, v_arr, zone->cellCount());
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
-
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
@@ -393,12 +424,9 @@ int cg_iRIC_Read_Grid_Real_IFace_WithGridId(int fid, int gid, const char* name,
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer;
-	ier = zone->gridAttributes()->readValue(name, &buffer);
+	ier = zone->gridAttributes()->readValue(name, v_arr, zone->iFaceCount());
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
-
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
@@ -411,12 +439,9 @@ int cg_iRIC_Read_Grid_Integer_IFace_WithGridId(int fid, int gid, const char* nam
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer;
-	ier = zone->gridAttributes()->readValue(name, &buffer);
+	ier = zone->gridAttributes()->readValue(name, v_arr, zone->iFaceCount());
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
-
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
@@ -429,12 +454,9 @@ int cg_iRIC_Read_Grid_Real_JFace_WithGridId(int fid, int gid, const char* name,
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer;
-	ier = zone->gridAttributes()->readValue(name, &buffer);
+	ier = zone->gridAttributes()->readValue(name, v_arr, zone->jFaceCount());
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
-
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
@@ -447,12 +469,9 @@ int cg_iRIC_Read_Grid_Integer_JFace_WithGridId(int fid, int gid, const char* nam
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer;
-	ier = zone->gridAttributes()->readValue(name, &buffer);
+	ier = zone->gridAttributes()->readValue(name, v_arr, zone->jFaceCount());
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
-
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
@@ -676,11 +695,7 @@ int cg_iRIC_Write_Grid1d_Coords_WithGridId(int fid, int isize, double* x_arr, in
 	size.push_back(isize - 1);
 	auto zone = base->createDefaultZone(H5CgnsZone::Type::Structured, size);
 
-	std::vector<double> coords(isize);
-
-	_pointerToVectorT(x_arr, &coords);
-
-	ier = zone->gridCoordinates()->writeCoordinatesX(coords);
+	ier = zone->gridCoordinates()->writeCoordinatesX(x_arr, isize);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -706,15 +721,10 @@ int cg_iRIC_Write_Grid2d_Coords_WithGridId(int fid, int isize, int jsize, double
 
 	auto totalSize = isize * jsize;
 
-	std::vector<double> xVec(totalSize), yVec(totalSize);
-
-	_pointerToVectorT(x_arr, &xVec);
-	_pointerToVectorT(y_arr, &yVec);
-
-	ier = zone->gridCoordinates()->writeCoordinatesX(xVec);
+	ier = zone->gridCoordinates()->writeCoordinatesX(x_arr, totalSize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesY(yVec);
+	ier = zone->gridCoordinates()->writeCoordinatesY(y_arr, totalSize);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -742,18 +752,13 @@ int cg_iRIC_Write_Grid3d_Coords_WithGridId(int fid, int isize, int jsize, int ks
 
 	auto totalSize = isize * jsize * ksize;
 
-	std::vector<double> xVec(totalSize), yVec(totalSize), zVec(totalSize);
-	_pointerToVectorT(x_arr, &xVec);
-	_pointerToVectorT(y_arr, &yVec);
-	_pointerToVectorT(z_arr, &zVec);
-
-	ier = zone->gridCoordinates()->writeCoordinatesX(xVec);
+	ier = zone->gridCoordinates()->writeCoordinatesX(x_arr, totalSize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesY(yVec);
+	ier = zone->gridCoordinates()->writeCoordinatesY(y_arr, totalSize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesZ(zVec);
+	ier = zone->gridCoordinates()->writeCoordinatesZ(z_arr, totalSize);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -774,11 +779,7 @@ int cg_iRIC_Write_NamedGrid1d_Coords_WithGridId(int fid, const char* name, int i
 	size.push_back(isize - 1);
 	auto zone = base->createZone(name, H5CgnsZone::Type::Structured, size);
 
-	std::vector<double> coords(isize);
-
-	_pointerToVectorT(x_arr, &coords);
-
-	ier = zone->gridCoordinates()->writeCoordinatesX(coords);
+	ier = zone->gridCoordinates()->writeCoordinatesX(x_arr, isize);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -804,15 +805,10 @@ int cg_iRIC_Write_NamedGrid2d_Coords_WithGridId(int fid, const char* name, int i
 
 	auto totalSize = isize * jsize;
 
-	std::vector<double> xVec(totalSize), yVec(totalSize);
-
-	_pointerToVectorT(x_arr, &xVec);
-	_pointerToVectorT(y_arr, &yVec);
-
-	ier = zone->gridCoordinates()->writeCoordinatesX(xVec);
+	ier = zone->gridCoordinates()->writeCoordinatesX(x_arr, totalSize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesY(yVec);
+	ier = zone->gridCoordinates()->writeCoordinatesY(y_arr, totalSize);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -840,18 +836,13 @@ int cg_iRIC_Write_NamedGrid3d_Coords_WithGridId(int fid, const char* name, int i
 
 	auto totalSize = isize * jsize * ksize;
 
-	std::vector<double> xVec(totalSize), yVec(totalSize), zVec(totalSize);
-	_pointerToVectorT(x_arr, &xVec);
-	_pointerToVectorT(y_arr, &yVec);
-	_pointerToVectorT(z_arr, &zVec);
-
-	ier = zone->gridCoordinates()->writeCoordinatesX(xVec);
+	ier = zone->gridCoordinates()->writeCoordinatesX(x_arr, totalSize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesY(yVec);
+	ier = zone->gridCoordinates()->writeCoordinatesY(y_arr, totalSize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesZ(zVec);
+	ier = zone->gridCoordinates()->writeCoordinatesZ(z_arr, totalSize);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -924,15 +915,10 @@ int cg_iRIC_Write_NamedGrid2d_Unst_Triangles_WithGridId(int fid, const char* nam
 	size.push_back(csize);
 	auto zone = base->createZone(name, H5CgnsZone::Type::Unstructured, size);
 
-	std::vector<double> xVec(psize), yVec(psize);
-
-	_pointerToVectorT(x_arr, &xVec);
-	_pointerToVectorT(y_arr, &yVec);
-
-	ier = zone->gridCoordinates()->writeCoordinatesX(xVec);
+	ier = zone->gridCoordinates()->writeCoordinatesX(x_arr, psize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesY(yVec);
+	ier = zone->gridCoordinates()->writeCoordinatesY(y_arr, psize);
 	RETURN_IF_ERR;
 
 	std::vector<int> indices(csize * 3);
@@ -960,15 +946,10 @@ int cg_iRIC_Write_NamedGrid2d_Unst_Lines_WithGridId(int fid, const char* name, i
 	size.push_back(csize);
 	auto zone = base->createZone(name, H5CgnsZone::Type::Unstructured, size);
 
-	std::vector<double> xVec(psize), yVec(psize);
-
-	_pointerToVectorT(x_arr, &xVec);
-	_pointerToVectorT(y_arr, &yVec);
-
-	ier = zone->gridCoordinates()->writeCoordinatesX(xVec);
+	ier = zone->gridCoordinates()->writeCoordinatesX(x_arr, psize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesY(yVec);
+	ier = zone->gridCoordinates()->writeCoordinatesY(y_arr, psize);
 	RETURN_IF_ERR;
 
 	std::vector<int> indices(csize * 2);
@@ -996,19 +977,13 @@ int cg_iRIC_Write_NamedGrid3d_Unst_Lines_WithGridId(int fid, const char* name, i
 	size.push_back(csize);
 	auto zone = base->createZone(name, H5CgnsZone::Type::Unstructured, size);
 
-	std::vector<double> xVec(psize), yVec(psize), zVec(psize);
-
-	_pointerToVectorT(x_arr, &xVec);
-	_pointerToVectorT(y_arr, &yVec);
-	_pointerToVectorT(z_arr, &zVec);
-
-	ier = zone->gridCoordinates()->writeCoordinatesX(xVec);
+	ier = zone->gridCoordinates()->writeCoordinatesX(x_arr, psize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesY(yVec);
+	ier = zone->gridCoordinates()->writeCoordinatesY(y_arr, psize);
 	RETURN_IF_ERR;
 
-	ier = zone->gridCoordinates()->writeCoordinatesZ(zVec);
+	ier = zone->gridCoordinates()->writeCoordinatesZ(z_arr, psize);
 	RETURN_IF_ERR;
 
 	std::vector<int> indices(csize * 2);
@@ -1030,10 +1005,7 @@ int cg_iRIC_Write_Grid_Real_Node_WithGridId(int fid, int gid, const char* name,
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer(zone->nodeCount());
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = zone->gridAttributes()->writeValue(name, buffer);
+	ier = zone->gridAttributes()->writeValue(name, v_arr, zone->nodeCount());
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -1048,10 +1020,7 @@ int cg_iRIC_Write_Grid_Integer_Node_WithGridId(int fid, int gid, const char* nam
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer(zone->nodeCount());
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = zone->gridAttributes()->writeValue(name, buffer);
+	ier = zone->gridAttributes()->writeValue(name, v_arr, zone->nodeCount());
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -1066,10 +1035,7 @@ int cg_iRIC_Write_Grid_Real_Cell_WithGridId(int fid, int gid, const char* name,
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer(zone->cellCount());
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = zone->gridAttributes()->writeValue(name, buffer);
+	ier = zone->gridAttributes()->writeValue(name, v_arr, zone->cellCount());
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -1084,10 +1050,7 @@ int cg_iRIC_Write_Grid_Integer_Cell_WithGridId(int fid, int gid, const char* nam
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer(zone->cellCount());
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = zone->gridAttributes()->writeValue(name, buffer);
+	ier = zone->gridAttributes()->writeValue(name, v_arr, zone->cellCount());
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -1102,10 +1065,7 @@ int IRICLIBDLL cg_iRIC_Write_Grid_Real_IFace_WithGridId(int fid, int gid, const
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer(zone->iFaceCount());
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = zone->gridAttributes()->writeValue(name, buffer);
+	ier = zone->gridAttributes()->writeValue(name, v_arr, zone->iFaceCount());
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -1120,10 +1080,7 @@ int IRICLIBDLL cg_iRIC_Write_Grid_Integer_IFace_WithGridId(int fid, int gid, con
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer(zone->iFaceCount());
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = zone->gridAttributes()->writeValue(name, buffer);
+	ier = zone->gridAttributes()->writeValue(name, v_arr, zone->iFaceCount());
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -1138,10 +1095,7 @@ int IRICLIBDLL cg_iRIC_Write_Grid_Real_JFace_WithGridId(int fid, int gid, const
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer(zone->jFaceCount());
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = zone->gridAttributes()->writeValue(name, buffer);
+	ier = zone->gridAttributes()->writeValue(name, v_arr, zone->jFaceCount());
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -1156,10 +1110,7 @@ int IRICLIBDLL cg_iRIC_Write_Grid_Integer_JFace_WithGridId(int fid, int gid, con
 	int ier = _iric_get_zone(fid, gid, &zone, __func__);
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer(zone->jFaceCount());
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = zone->gridAttributes()->writeValue(name, buffer);
+	ier = zone->gridAttributes()->writeValue(name, v_arr, zone->jFaceCount());
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
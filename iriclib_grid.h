@@ -11,6 +11,8 @@ int IRICLIBDLL cg_iRIC_Read_Grid2d_Str_Size_WithGridId(int fid, int gid, int* is
 int IRICLIBDLL cg_iRIC_Read_Grid2d_Coords_WithGridId(int fid, int gid, double* x_arr, double* y_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid3d_Str_Size_WithGridId(int fid, int gid, int* isize, int* jsize, int* ksize);
 int IRICLIBDLL cg_iRIC_Read_Grid3d_Coords_WithGridId(int fid, int gid, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int stride, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* x_arr, double* y_arr, double* z_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid_CellType_WithGridId(int fid, int gid, int* type);
 int IRICLIBDLL cg_iRIC_Read_Grid_TriangleElementsSize_WithGridId(int fid, int gid, int* tsize);
 int IRICLIBDLL cg_iRIC_Read_Grid_TriangleElementsSize2_WithGridId(int fid, int gid, int* tsize);
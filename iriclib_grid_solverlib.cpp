@@ -1,4 +1,5 @@
 #include "error_macros.h"
+#include "iriclib.h"
 #include "iriclib_errorcodes.h"
 #include "iriclib_grid_solverlib.h"
 
@@ -73,7 +74,11 @@ int cg_iRIC_Read_Grid2d_Open_WithGridId(int fid, int gid, int* grid_handle)
 	_IRIC_LOGGER_TRACE_ENTER();
 
 	auto grid = new Grid2D();
-	grid->load(fid, gid);
+	int ier = grid->load(fid, gid);
+	if (ier != IRIC_NO_ERROR) {
+		delete grid;
+		return ier;
+	}
 	grid2ds.push_back(grid);
 
 	*grid_handle = static_cast<int> (grid2ds.size());
@@ -87,7 +92,11 @@ int cg_iRIC_Read_Sol_Grid2d_Open_WithGridId(int fid, int gid, int solid, int* gr
 	_IRIC_LOGGER_TRACE_ENTER();
 
 	auto grid = new Grid2D();
-	grid->load(fid, gid, solid);
+	int ier = grid->load(fid, gid, solid);
+	if (ier != IRIC_NO_ERROR) {
+		delete grid;
+		return ier;
+	}
 	grid2ds.push_back(grid);
 
 	*grid_handle = static_cast<int> (grid2ds.size());
@@ -112,6 +121,31 @@ int cg_iRIC_Read_Grid2d_Close(int grid_handle)
 	return IRIC_NO_ERROR;
 }
 
+int cg_iRIC_Set_Grid2d_SpatialIndex(int grid_handle, int type)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	Grid2D* grid;
+	int ier = _getGrid(grid_handle, &grid, "cg_iRIC_Set_Grid2d_SpatialIndex");
+	RETURN_IF_ERR;
+
+	if (type == IRIC_SPATIALINDEX_BACKGRID) {
+		grid->setSpatialIndex(Grid2D::SpatialIndex::BackGrid);
+	} else if (type == IRIC_SPATIALINDEX_BVH) {
+		grid->setSpatialIndex(Grid2D::SpatialIndex::BVH);
+	} else {
+		std::ostringstream ss;
+		ss << "In cg_iRIC_Set_Grid2d_SpatialIndex(), invalid type " << type << " passed";
+		_iric_logger_error(ss.str());
+
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_INVALID_ARGUMENT;
+	}
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
 int cg_iRIC_Read_Grid2d_CellArea(int grid_handle, int cellId, double* area)
 {
 	_IRIC_LOGGER_TRACE_ENTER();
@@ -205,3 +239,66 @@ int cg_iRIC_Read_Grid2d_InterpolateWithCell(int grid_handle, double x, double y,
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
+
+int cg_iRIC_Read_Grid2d_FindCellWithHint(int grid_handle, double x, double y, int hintCellId, int* cellId)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	Grid2D* grid;
+	int ier = _getGrid(grid_handle, &grid, "cg_iRIC_Read_Grid2d_FindCellWithHint");
+	RETURN_IF_ERR;
+
+	bool success = grid->findCell(Point2D(x, y), hintCellId, cellId);
+	if (! success) {
+		return IRIC_DATA_NOT_FOUND;
+	}
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Grid2d_InterpolateWithHint(int grid_handle, double x, double y, int hintCellId, int* ok, int* cellId, int* count, int* nodeids_arr, double* weights_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	Grid2D* grid;
+	int ier = _getGrid(grid_handle, &grid, "cg_iRIC_Read_Grid2d_InterpolateWithHint");
+	RETURN_IF_ERR;
+
+	*ok = 0;
+	bool success = grid->interpolate(Point2D(x, y), hintCellId, cellId, count, nodeids_arr, weights_arr);
+	if (success) {
+		*ok = 1;
+	}
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Grid2d_FindCellMulti(int grid_handle, int count, const double* x_arr, const double* y_arr, int* cellids_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	Grid2D* grid;
+	int ier = _getGrid(grid_handle, &grid, "cg_iRIC_Read_Grid2d_FindCellMulti");
+	RETURN_IF_ERR;
+
+	grid->findCells(count, x_arr, y_arr, cellids_arr);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Grid2d_InterpolateMulti(int grid_handle, int count, const double* x_arr, const double* y_arr, int* ok_arr, int* nodecount_arr, int* nodeids_arr, double* weights_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	Grid2D* grid;
+	int ier = _getGrid(grid_handle, &grid, "cg_iRIC_Read_Grid2d_InterpolateMulti");
+	RETURN_IF_ERR;
+
+	grid->interpolate(count, x_arr, y_arr, ok_arr, nodecount_arr, nodeids_arr, weights_arr);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
@@ -10,11 +10,16 @@ extern "C" {
 int IRICLIBDLL cg_iRIC_Read_Grid2d_Open_WithGridId(int fid, int gid, int* grid_handle);
 int IRICLIBDLL cg_iRIC_Read_Sol_Grid2d_Open_WithGridId(int fid, int gid, int step, int* grid_handle);
 int IRICLIBDLL cg_iRIC_Read_Grid2d_Close(int grid_handle);
+int IRICLIBDLL cg_iRIC_Set_Grid2d_SpatialIndex(int grid_handle, int type);
 int IRICLIBDLL cg_iRIC_Read_Grid2d_CellArea(int grid_handle, int cellId, double* area);
 int IRICLIBDLL cg_iRIC_Read_Grid2d_FindCell(int grid_handle, double x, double y, int* cellId);
 int IRICLIBDLL cg_iRIC_Read_Grid2d_CellNodeCount(int grid_handle, int cellId, int* count);
 int IRICLIBDLL cg_iRIC_Read_Grid2d_Interpolate(int grid_handle, double x, double y, int* ok, int* count, int* nodeids_arr, double* weights_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid2d_InterpolateWithCell(int grid_handle, double x, double y, int cellId, int* nodeids_arr, double* weights_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_FindCellWithHint(int grid_handle, double x, double y, int hintCellId, int* cellId);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_InterpolateWithHint(int grid_handle, double x, double y, int hintCellId, int* ok, int* cellId, int* count, int* nodeids_arr, double* weights_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_FindCellMulti(int grid_handle, int count, const double* x_arr, const double* y_arr, int* cellids_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_InterpolateMulti(int grid_handle, int count, const double* x_arr, const double* y_arr, int* ok_arr, int* nodecount_arr, int* nodeids_arr, double* weights_arr);
 
 #ifdef __cplusplus
 }
@@ -1,6 +1,9 @@
 #include "error_macros.h"
 #include "h5cgnsfile.h"
 #include "h5cgnsfilesolutionwriter.h"
+#include "h5datasetstoragepolicy.h"
+#include "h5fileaccessprofile.h"
+#include "h5particlebins.h"
 #include "iriclib.h"
 #include "iriclib_errorcodes.h"
 
@@ -9,31 +12,181 @@
 
 #include <Poco/Environment.h>
 #include <Poco/File.h>
+#include <Poco/UTF8String.h>
 
 #include <sstream>
+#include <string>
 
 using namespace iRICLib;
 
 namespace {
 
 const std::string IRIC_SEPARATE_OUTPUT = "IRIC_SEPARATE_OUTPUT";
+const std::string IRIC_SWMR_OUTPUT = "IRIC_SWMR_OUTPUT";
+const std::string IRIC_STORAGE_COMPRESSION = "IRIC_STORAGE_COMPRESSION";
+const std::string IRIC_STORAGE_COMPRESSION_LEVEL = "IRIC_STORAGE_COMPRESSION_LEVEL";
+const std::string IRIC_STORAGE_SHUFFLE = "IRIC_STORAGE_SHUFFLE";
+const std::string IRIC_STORAGE_CONTIGUOUS_LIMIT = "IRIC_STORAGE_CONTIGUOUS_LIMIT";
+const std::string IRIC_STORAGE_CHUNK_SIZE = "IRIC_STORAGE_CHUNK_SIZE";
+const std::string IRIC_ASYNC_OUTPUT_QUEUE = "IRIC_ASYNC_OUTPUT_QUEUE";
+const std::string IRIC_FILE_ACCESS_PROFILE = "IRIC_FILE_ACCESS_PROFILE";
+const std::string IRIC_FILE_ACCESS_METADATA_CACHE = "IRIC_FILE_ACCESS_METADATA_CACHE";
+const std::string IRIC_FILE_ACCESS_CHUNK_CACHE = "IRIC_FILE_ACCESS_CHUNK_CACHE";
+const std::string IRIC_FILE_ACCESS_CHUNK_CACHE_SLOTS = "IRIC_FILE_ACCESS_CHUNK_CACHE_SLOTS";
+const std::string IRIC_FILE_ACCESS_PAGE_SIZE = "IRIC_FILE_ACCESS_PAGE_SIZE";
+const std::string IRIC_FILE_ACCESS_PAGE_BUFFER = "IRIC_FILE_ACCESS_PAGE_BUFFER";
+const std::string IRIC_FILE_ACCESS_ALIGNMENT = "IRIC_FILE_ACCESS_ALIGNMENT";
+const std::string IRIC_FILE_ACCESS_ALIGNMENT_THRESHOLD = "IRIC_FILE_ACCESS_ALIGNMENT_THRESHOLD";
+const std::string IRIC_FILE_ACCESS_SIEVE_BUFFER = "IRIC_FILE_ACCESS_SIEVE_BUFFER";
+const std::string IRIC_FILE_ACCESS_LIBVER = "IRIC_FILE_ACCESS_LIBVER";
 
 H5CgnsFileSolutionWriter::Mode writerMode = H5CgnsFileSolutionWriter::Mode::Standard;
+H5FileAccessProfile::Preset accessPreset = H5FileAccessProfile::Preset::Default;
 
 H5CgnsFileSolutionWriter::Mode setupWriterMode()
 {
 	auto wm = writerMode;
 
-	if (wm == H5CgnsFileSolutionWriter::Mode::Separate) {return wm;}
+	if (wm != H5CgnsFileSolutionWriter::Mode::Standard) {return wm;}
+
+	if (Poco::Environment::has(IRIC_SWMR_OUTPUT) && Poco::Environment::get(IRIC_SWMR_OUTPUT) == "1") {
+		return H5CgnsFileSolutionWriter::Mode::SeparateSwmr;
+	}
 
 	if (! Poco::Environment::has(IRIC_SEPARATE_OUTPUT)) {return wm;}
 
-	if (Poco::Environment::get(IRIC_SEPARATE_OUTPUT) == "1") {
+	auto separate = Poco::Environment::get(IRIC_SEPARATE_OUTPUT);
+	if (separate == "1") {
 		return H5CgnsFileSolutionWriter::Mode::Separate;
+	} else if (separate == "2") {
+		return H5CgnsFileSolutionWriter::Mode::SeparateSharedGrid;
 	}
 	return wm;
 }
 
+bool readEnvironmentInt(const std::string& name, int* value)
+{
+	if (! Poco::Environment::has(name)) {return false;}
+
+	try {
+		*value = std::stoi(Poco::Environment::get(name));
+		return true;
+	} catch (...) {
+		std::ostringstream ss;
+		ss << "Value of environment variable " << name << " is invalid. Ignored";
+		_iric_logger_warn(ss.str());
+		return false;
+	}
+}
+
+H5DatasetStoragePolicy setupStoragePolicy()
+{
+	H5DatasetStoragePolicy policy;
+
+	if (Poco::Environment::has(IRIC_STORAGE_COMPRESSION)) {
+		auto c = Poco::UTF8::toLower(Poco::Environment::get(IRIC_STORAGE_COMPRESSION));
+		if (c == "deflate" || c == "gzip" || c == "zlib") {
+			policy.setCompression(H5DatasetStoragePolicy::Compression::Deflate);
+		} else if (c == "szip") {
+			policy.setCompression(H5DatasetStoragePolicy::Compression::Szip);
+		} else if (c != "none" && c != "") {
+			std::ostringstream ss;
+			ss << "Value of environment variable " << IRIC_STORAGE_COMPRESSION << " (" << c << ") is invalid. Ignored";
+			_iric_logger_warn(ss.str());
+		}
+	}
+
+	int val;
+	if (readEnvironmentInt(IRIC_STORAGE_COMPRESSION_LEVEL, &val)) {
+		policy.setCompressionLevel(val);
+	}
+	if (readEnvironmentInt(IRIC_STORAGE_SHUFFLE, &val)) {
+		policy.setShuffle(val != 0);
+	}
+	if (readEnvironmentInt(IRIC_STORAGE_CONTIGUOUS_LIMIT, &val) && val >= 0) {
+		policy.setChunked(true);
+		policy.setContiguousLimit(static_cast<hsize_t> (val));
+	}
+	if (readEnvironmentInt(IRIC_STORAGE_CHUNK_SIZE, &val) && val > 0) {
+		policy.setChunked(true);
+		policy.setChunkSize(static_cast<hsize_t> (val));
+	}
+
+	return policy;
+}
+
+void warnInvalidEnvironment(const std::string& name, const std::string& value)
+{
+	std::ostringstream ss;
+	ss << "Value of environment variable " << name << " (" << value << ") is invalid. Ignored";
+	_iric_logger_warn(ss.str());
+}
+
+H5FileAccessProfile setupAccessProfile()
+{
+	auto preset = accessPreset;
+
+	if (preset == H5FileAccessProfile::Preset::Default && Poco::Environment::has(IRIC_FILE_ACCESS_PROFILE)) {
+		auto p = Poco::UTF8::toLower(Poco::Environment::get(IRIC_FILE_ACCESS_PROFILE));
+		if (p == "solver_write") {
+			preset = H5FileAccessProfile::Preset::SolverWrite;
+		} else if (p == "gui_read") {
+			preset = H5FileAccessProfile::Preset::GuiRead;
+		} else if (p == "archive") {
+			preset = H5FileAccessProfile::Preset::Archive;
+		} else if (p != "default" && p != "") {
+			warnInvalidEnvironment(IRIC_FILE_ACCESS_PROFILE, p);
+		}
+	}
+
+	// the values of the preset can be overridden one by one. sizes are in bytes
+	auto profile = H5FileAccessProfile::preset(preset);
+
+	int val;
+	if (readEnvironmentInt(IRIC_FILE_ACCESS_METADATA_CACHE, &val) && val >= 0) {
+		profile.setMetadataCacheSize(static_cast<size_t> (val));
+	}
+	if (readEnvironmentInt(IRIC_FILE_ACCESS_CHUNK_CACHE, &val) && val >= 0) {
+		profile.setChunkCacheSize(static_cast<size_t> (val));
+	}
+	if (readEnvironmentInt(IRIC_FILE_ACCESS_CHUNK_CACHE_SLOTS, &val) && val >= 0) {
+		profile.setChunkCacheSlots(static_cast<size_t> (val));
+	}
+	if (readEnvironmentInt(IRIC_FILE_ACCESS_PAGE_SIZE, &val) && val >= 0) {
+		profile.setPageSize(static_cast<hsize_t> (val));
+	}
+	if (readEnvironmentInt(IRIC_FILE_ACCESS_PAGE_BUFFER, &val) && val >= 0) {
+		profile.setPageBufferSize(static_cast<size_t> (val));
+	}
+	if (readEnvironmentInt(IRIC_FILE_ACCESS_ALIGNMENT, &val) && val > 0) {
+		int threshold;
+		if (! readEnvironmentInt(IRIC_FILE_ACCESS_ALIGNMENT_THRESHOLD, &threshold) || threshold < 0) {
+			threshold = val;
+		}
+		profile.setAlignment(static_cast<hsize_t> (threshold), static_cast<hsize_t> (val));
+	}
+	if (readEnvironmentInt(IRIC_FILE_ACCESS_SIEVE_BUFFER, &val) && val >= 0) {
+		profile.setSieveBufferSize(static_cast<size_t> (val));
+	}
+
+	if (Poco::Environment::has(IRIC_FILE_ACCESS_LIBVER)) {
+		auto v = Poco::UTF8::toLower(Poco::Environment::get(IRIC_FILE_ACCESS_LIBVER));
+		if (v == "earliest") {
+			profile.setLibVersionBounds(H5FileAccessProfile::LibVersion::Earliest, H5FileAccessProfile::LibVersion::Latest);
+		} else if (v == "v18") {
+			profile.setLibVersionBounds(H5FileAccessProfile::LibVersion::V18, H5FileAccessProfile::LibVersion::Latest);
+		} else if (v == "v110") {
+			profile.setLibVersionBounds(H5FileAccessProfile::LibVersion::V110, H5FileAccessProfile::LibVersion::Latest);
+		} else if (v == "latest") {
+			profile.setLibVersionBounds(H5FileAccessProfile::LibVersion::Latest, H5FileAccessProfile::LibVersion::Latest);
+		} else if (v != "") {
+			warnInvalidEnvironment(IRIC_FILE_ACCESS_LIBVER, v);
+		}
+	}
+
+	return profile;
+}
+
 int _checkFileIsOpen(int fid)
 {
 	H5CgnsFile* file;
@@ -67,10 +220,23 @@ int cg_iRIC_Open(const char* filename, int mode, int* fid)
 	}
 
 	auto myWriterMode = setupWriterMode();
+	bool swmr = (mode == IRIC_MODE_READ_SWMR) || (m == H5CgnsFile::Mode::Create && myWriterMode == H5CgnsFileSolutionWriter::Mode::SeparateSwmr);
+
+	// the background solution writers of the files already open should not call HDF5 while opening
+	_iric_h5cgnsfiles_drain_async_writes(0);
 
 	try {
-		auto f = new H5CgnsFile(filename, m);
+		auto f = new H5CgnsFile(filename, m, "result", swmr, setupAccessProfile());
 		f->setWriterMode(myWriterMode);
+		if (m != H5CgnsFile::Mode::OpenReadOnly) {
+			f->setStoragePolicy(setupStoragePolicy());
+
+			// when HDF5 is not thread-safe, the error is logged and solutions are written synchronously
+			int queueSize;
+			if (readEnvironmentInt(IRIC_ASYNC_OUTPUT_QUEUE, &queueSize) && queueSize > 0) {
+				f->solutionWriter()->setAsyncQueueSize(queueSize);
+			}
+		}
 
 		int ier = _iric_h5cgnsfiles_register(f, fid);
 		RETURN_IF_ERR;
@@ -92,14 +258,23 @@ int cg_iRIC_Close(int fid)
 	_IRIC_LOGGER_TRACE_ENTER();
 
 	H5CgnsFile* file;
-	int ier = _iric_h5cgnsfiles_get(fid, &file);
+	int ier = _iric_h5cgnsfiles_get_nowait(fid, &file);
 	RETURN_IF_ERR;
 
+	// the file is closed even when a background solution write or building the index of the
+	// particle group trajectories failed, and the error is returned
+	int writeErr = IRIC_NO_ERROR;
+	if (file != nullptr) {
+		writeErr = file->waitForAsyncWrites();
+		int indexErr = file->buildParticleGroupTrajectoryIndex();
+		if (writeErr == IRIC_NO_ERROR) {writeErr = indexErr;}
+	}
+
 	ier = _iric_h5cgnsfiles_unregister(fid);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
-	return IRIC_NO_ERROR;
+	return writeErr;
 }
 
 int iRIC_InitOption(int option)
@@ -121,11 +296,137 @@ int iRIC_InitOption(int option)
 		writerMode = H5CgnsFileSolutionWriter::Mode::Separate;
 		_IRIC_LOGGER_TRACE_LEAVE();
 		return IRIC_NO_ERROR;
+	} else if (option == IRIC_OPTION_SWMRSOLUTIONS) {
+		writerMode = H5CgnsFileSolutionWriter::Mode::SeparateSwmr;
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_NO_ERROR;
+	} else if (option == IRIC_OPTION_SHAREDGRIDSOLUTIONS) {
+		writerMode = H5CgnsFileSolutionWriter::Mode::SeparateSharedGrid;
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_NO_ERROR;
 	} else if (option == IRIC_OPTION_STDSOLUTION) {
 		writerMode = H5CgnsFileSolutionWriter::Mode::Standard;
 		_IRIC_LOGGER_TRACE_LEAVE();
 		return IRIC_NO_ERROR;
+	} else if (option == IRIC_OPTION_FILEACCESS_DEFAULT) {
+		accessPreset = H5FileAccessProfile::Preset::Default;
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_NO_ERROR;
+	} else if (option == IRIC_OPTION_FILEACCESS_SOLVERWRITE) {
+		accessPreset = H5FileAccessProfile::Preset::SolverWrite;
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_NO_ERROR;
+	} else if (option == IRIC_OPTION_FILEACCESS_GUIREAD) {
+		accessPreset = H5FileAccessProfile::Preset::GuiRead;
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_NO_ERROR;
+	} else if (option == IRIC_OPTION_FILEACCESS_ARCHIVE) {
+		accessPreset = H5FileAccessProfile::Preset::Archive;
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_NO_ERROR;
+	}
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Set_StoragePolicy(int fid, int compression, int level, int shuffle)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsFile* file;
+	int ier = _iric_h5cgnsfiles_get(fid, &file);
+	RETURN_IF_ERR;
+
+	auto policy = file->storagePolicy();
+	if (compression == IRIC_COMPRESSION_NONE) {
+		policy.setCompression(H5DatasetStoragePolicy::Compression::None);
+	} else if (compression == IRIC_COMPRESSION_DEFLATE) {
+		policy.setCompression(H5DatasetStoragePolicy::Compression::Deflate);
+	} else if (compression == IRIC_COMPRESSION_SZIP) {
+		policy.setCompression(H5DatasetStoragePolicy::Compression::Szip);
+	} else {
+		std::ostringstream ss;
+		ss << "In cg_iRIC_Set_StoragePolicy(), invalid compression value " << compression;
+		_iric_logger_error(ss.str());
+
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_INVALID_ARGUMENT;
 	}
+	policy.setCompressionLevel(level);
+	policy.setShuffle(shuffle != 0);
+
+	file->setStoragePolicy(policy);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Set_StorageChunking(int fid, int contiguous_limit, int chunk_size)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsFile* file;
+	int ier = _iric_h5cgnsfiles_get(fid, &file);
+	RETURN_IF_ERR;
+
+	if (contiguous_limit < 0 || chunk_size < 0) {
+		_iric_logger_error("In cg_iRIC_Set_StorageChunking(), contiguous_limit and chunk_size should not be negative");
+
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_INVALID_ARGUMENT;
+	}
+
+	auto policy = file->storagePolicy();
+	policy.setChunked(true);
+	policy.setContiguousLimit(static_cast<hsize_t> (contiguous_limit));
+	policy.setChunkSize(static_cast<hsize_t> (chunk_size));
+
+	file->setStoragePolicy(policy);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Set_ParticleGroupTrajectory(int fid, const char* idname)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsFile* file;
+	int ier = _iric_h5cgnsfiles_get(fid, &file);
+	RETURN_IF_ERR;
+
+	if (file->mode() == H5CgnsFile::Mode::OpenReadOnly) {
+		_iric_logger_error("In cg_iRIC_Set_ParticleGroupTrajectory(), the file is opened in read only mode");
+
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_WRONG_FILEMODE;
+	}
+
+	file->setParticleGroupTrajectoryIdName(idname);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Set_ParticleBins(int fid, int level)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsFile* file;
+	int ier = _iric_h5cgnsfiles_get(fid, &file);
+	RETURN_IF_ERR;
+
+	if (level < 0 || level > H5ParticleBins::MAX_LEVEL) {
+		std::ostringstream ss;
+		ss << "In cg_iRIC_Set_ParticleBins(), invalid level " << level;
+		_iric_logger_error(ss.str());
+
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_INVALID_ARGUMENT;
+	}
+
+	file->setParticleBinLevel(level);
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -11,6 +11,15 @@ int IRICLIBDLL cg_iRIC_Open(const char* filename, int mode, int* fid);
 int IRICLIBDLL cg_iRIC_Close(int fid);
 int IRICLIBDLL iRIC_InitOption(int option);
 
+int IRICLIBDLL cg_iRIC_Set_StoragePolicy(int fid, int compression, int level, int shuffle);
+int IRICLIBDLL cg_iRIC_Set_StorageChunking(int fid, int contiguous_limit, int chunk_size);
+// stores particle groups of all steps in one extendible array per value, indexed by the integer value idname.
+// it applies to the solutions written to the file itself (not to separate solution files). empty idname disables it.
+int IRICLIBDLL cg_iRIC_Set_ParticleGroupTrajectory(int fid, const char* idname);
+// sorts particles (and particle groups) into 2^level x 2^level spatial bins over the grid when written, so that
+// the particles in a rectangle are read fast. level is 0 (disabled) to 15.
+int IRICLIBDLL cg_iRIC_Set_ParticleBins(int fid, int level);
+
 #ifdef __cplusplus
 }
 #endif
@@ -382,6 +382,24 @@ int cg_iRIC_Read_Grid3d_Coords(int fid, double* x_arr, double* y_arr, double* z_
   return cg_iRIC_Read_Grid3d_Coords_WithGridId(fid, gid, x_arr, y_arr, z_arr);
 }
 
+int cg_iRIC_Read_Grid2d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int stride, double* x_arr, double* y_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(fid, gid, imin, imax, jmin, jmax, stride, x_arr, y_arr);
+}
+
+int cg_iRIC_Read_Grid3d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* x_arr, double* y_arr, double* z_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(fid, gid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr, y_arr, z_arr);
+}
+
 int cg_iRIC_Read_Grid_CellType(int fid, int* type)
 {
   int gid;
@@ -884,6 +902,60 @@ int cg_iRIC_Read_Sol_Cell_Real(int fid, int step, const char* name, double* v_ar
   return cg_iRIC_Read_Sol_Cell_Real_WithGridId(fid, gid, step, name, v_arr);
 }
 
+int cg_iRIC_Read_Sol_Cell_Integer_Series(int fid, const char* name, int count, const int* idx_arr, int* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Cell_Integer_Series_WithGridId(fid, gid, name, count, idx_arr, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Cell_Real_Series(int fid, const char* name, int count, const int* idx_arr, double* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Cell_Real_Series_WithGridId(fid, gid, name, count, idx_arr, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Cell_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, int* v_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Cell_Integer_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Cell_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, double* v_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Cell_Real_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Cell_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, int* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Cell_Integer_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Cell_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Cell_Real_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr);
+}
+
 int cg_iRIC_Write_Sol_Cell_Integer(int fid, const char* name, int* v_arr)
 {
   int gid;
@@ -1074,6 +1146,60 @@ int cg_iRIC_Read_Sol_Node_Real(int fid, int step, const char* name, double* v_ar
   return cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, gid, step, name, v_arr);
 }
 
+int cg_iRIC_Read_Sol_Node_Integer_Series(int fid, const char* name, int count, const int* idx_arr, int* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId(fid, gid, name, count, idx_arr, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Series(int fid, const char* name, int count, const int* idx_arr, double* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Node_Real_Series_WithGridId(fid, gid, name, count, idx_arr, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Node_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, int* v_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, double* v_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Node_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, int* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr);
+}
+
 int cg_iRIC_Write_Sol_Node_Integer(int fid, const char* name, int* v_arr)
 {
   int gid;
@@ -1139,6 +1265,51 @@ int cg_iRIC_Read_Sol_Particle_Integer(int fid, int step, const char* name, int*
   return cg_iRIC_Read_Sol_Particle_Integer_WithGridId(fid, gid, step, name, v_arr);
 }
 
+int cg_iRIC_Read_Sol_Particle_RectCount(int fid, int step, double xmin, double xmax, double ymin, double ymax, int* count)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Particle_RectCount_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, count);
+}
+
+int cg_iRIC_Read_Sol_Particle_RectPos2d(int fid, int step, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, x_arr, y_arr);
+}
+
+int cg_iRIC_Read_Sol_Particle_RectPos3d(int fid, int step, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr, double* z_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, x_arr, y_arr, z_arr);
+}
+
+int cg_iRIC_Read_Sol_Particle_RectReal(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, double* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Particle_RectReal_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, name, v_arr);
+}
+
+int cg_iRIC_Read_Sol_Particle_RectInteger(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, int* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, name, v_arr);
+}
+
 int cg_iRIC_Write_Sol_Particle_Pos2d(int fid, int count, double* x_arr, double* y_arr)
 {
   int gid;
@@ -1222,6 +1393,96 @@ int cg_iRIC_Read_Sol_ParticleGroup_Integer(int fid, int step, const char* groupn
   return cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(fid, gid, step, groupname, name, v_arr);
 }
 
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* size)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId(fid, gid, groupname, count, id_arr, step_min, step_max, size);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId(fid, gid, groupname, count, id_arr, step_min, step_max, pid_arr, step_arr, x_arr, y_arr);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr, double* z_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId(fid, gid, groupname, count, id_arr, step_min, step_max, pid_arr, step_arr, x_arr, y_arr, z_arr);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, const char* name, double* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId(fid, gid, groupname, count, id_arr, step_min, step_max, name, v_arr);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, const char* name, int* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId(fid, gid, groupname, count, id_arr, step_min, step_max, name, v_arr);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectCount(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, int* count)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_RectCount_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, count);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos2d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos3d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr, double* z_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, x_arr, y_arr, z_arr);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectReal(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, double* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectInteger(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, int* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr);
+}
+
 int cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(int fid, const char* groupname)
 {
   int gid;
@@ -1276,6 +1537,42 @@ int cg_iRIC_Write_Sol_ParticleGroup_Real(int fid, const char* name, double value
   return cg_iRIC_Write_Sol_ParticleGroup_Real_WithGridId(fid, gid, name, value);
 }
 
+int cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(int fid, int count, double* x_arr, double* y_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(fid, gid, count, x_arr, y_arr);
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti(int fid, int count, double* x_arr, double* y_arr, double* z_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(fid, gid, count, x_arr, y_arr, z_arr);
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(int fid, const char* name, int count, int* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(fid, gid, name, count, v_arr);
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_RealMulti(int fid, const char* name, int count, double* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(fid, gid, name, count, v_arr);
+}
+
 
 // from iriclib_sol_particlegroupimage.h
 int cg_iRIC_Read_Sol_ParticleGroupImage_Count(int fid, int step, const char* groupname, int* count)
@@ -1323,6 +1620,15 @@ int cg_iRIC_Write_Sol_ParticleGroupImage_Pos2d(int fid, double x, double y, doub
   return cg_iRIC_Write_Sol_ParticleGroupImage_Pos2d_WithGridId(fid, gid, x, y, size, angle);
 }
 
+int cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(int fid, int count, double* x_arr, double* y_arr, double* size_arr, double* angle_arr)
+{
+  int gid;
+  int ier = getDefault2dGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(fid, gid, count, x_arr, y_arr, size_arr, angle_arr);
+}
+
 
 // from iriclib_sol_polydata.h
 int cg_iRIC_Read_Sol_PolyData_DataCount(int fid, int step, const char* groupname, int* count)
@@ -1433,4 +1739,31 @@ int cg_iRIC_Write_Sol_PolyData_Real(int fid, const char* name, double value)
   return cg_iRIC_Write_Sol_PolyData_Real_WithGridId(fid, gid, name, value);
 }
 
+int cg_iRIC_Write_Sol_PolyData_GeometryMulti(int fid, int count, int* types_arr, int* offsets_arr, double* x_arr, double* y_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(fid, gid, count, types_arr, offsets_arr, x_arr, y_arr);
+}
+
+int cg_iRIC_Write_Sol_PolyData_IntegerMulti(int fid, const char* name, int count, int* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(fid, gid, name, count, v_arr);
+}
+
+int cg_iRIC_Write_Sol_PolyData_RealMulti(int fid, const char* name, int count, double* v_arr)
+{
+  int gid;
+  int ier = getlastGridId(fid, &gid);
+  RETURN_IF_ERR;
+
+  return cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(fid, gid, name, count, v_arr);
+}
+
 
@@ -49,6 +49,8 @@ int IRICLIBDLL cg_iRIC_Read_Grid2d_Str_Size(int fid, int* isize, int* jsize);
 int IRICLIBDLL cg_iRIC_Read_Grid2d_Coords(int fid, double* x_arr, double* y_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid3d_Str_Size(int fid, int* isize, int* jsize, int* ksize);
 int IRICLIBDLL cg_iRIC_Read_Grid3d_Coords(int fid, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int stride, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid3d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* x_arr, double* y_arr, double* z_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid_CellType(int fid, int* type);
 int IRICLIBDLL cg_iRIC_Read_Grid_TriangleElementsSize(int fid, int* tsize);
 int IRICLIBDLL cg_iRIC_Read_Grid_TriangleElementsSize2(int fid, int* tsize);
@@ -111,6 +113,12 @@ int IRICLIBDLL cg_iRIC_Read_Sol_Grid2d_Open(int fid, int step, int* grid_handle)
 // from iriclib_sol_cell.h
 int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer(int fid, int step, const char* name, int* v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real(int fid, int step, const char* name, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_Series(int fid, const char* name, int count, const int* idx_arr, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_Series(int fid, const char* name, int count, const int* idx_arr, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Cell_Integer(int fid, const char* name, int* v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Cell_Real(int fid, const char* name, double* v_arr);
 
@@ -141,6 +149,12 @@ int IRICLIBDLL cg_iRIC_Write_Sol_KFace_Real(int fid, const char* name, double* v
 // from iriclib_sol_node.h
 int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer(int fid, int step, const char* name, int* v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real(int fid, int step, const char* name, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Series(int fid, const char* name, int count, const int* idx_arr, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Series(int fid, const char* name, int count, const int* idx_arr, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Node_Integer(int fid, const char* name, int* v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Node_Real(int fid, const char* name, double* v_arr);
 
@@ -150,6 +164,11 @@ int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Pos2d(int fid, int step, double* x_arr,
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Pos3d(int fid, int step, double* x_arr, double* y_arr, double* z_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Real(int fid, int step, const char* name, double* v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Integer(int fid, int step, const char* name, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectCount(int fid, int step, double xmin, double xmax, double ymin, double ymax, int* count);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectPos2d(int fid, int step, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectPos3d(int fid, int step, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectReal(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectInteger(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, int* v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Pos2d(int fid, int count, double* x_arr, double* y_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Pos3d(int fid, int count, double* x_arr, double* y_arr, double* z_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Real(int fid, const char* name, double* v_arr);
@@ -161,12 +180,26 @@ int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Pos2d(int fid, int step, const cha
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Pos3d(int fid, int step, const char* groupname, double* x_arr, double* y_arr, double* z_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Real(int fid, int step, const char* groupname, const char* name, double* v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Integer(int fid, int step, const char* groupname, const char* name, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* size);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, const char* name, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger(int fid, const char* groupname, int count, int* id_arr, int step_min, int step_max, const char* name, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectCount(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, int* count);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectPos2d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectPos3d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectReal(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectInteger(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, int* v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(int fid, const char* groupname);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_GroupEnd(int fid);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos2d(int fid, double x, double y);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos3d(int fid, double x, double y, double z);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Integer(int fid, const char* name, int value);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Real(int fid, const char* name, double value);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(int fid, int count, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti(int fid, int count, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(int fid, const char* name, int count, int* v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_RealMulti(int fid, const char* name, int count, double* v_arr);
 
 // from iriclib_sol_particlegroupimage.h
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroupImage_Count(int fid, int step, const char* groupname, int* count);
@@ -174,6 +207,7 @@ int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d(int fid, int step, cons
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_GroupBegin(int fid, const char* groupname);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_GroupEnd(int fid);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_Pos2d(int fid, double x, double y, double size, double angle);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(int fid, int count, double* x_arr, double* y_arr, double* size_arr, double* angle_arr);
 
 // from iriclib_sol_polydata.h
 int IRICLIBDLL cg_iRIC_Read_Sol_PolyData_DataCount(int fid, int step, const char* groupname, int* count);
@@ -188,6 +222,9 @@ int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Polygon(int fid, int numPoints, double
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Polyline(int fid, int numPoints, double* x_arr, double* y_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Integer(int fid, const char* name, int value);
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Real(int fid, const char* name, double value);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_GeometryMulti(int fid, int count, int* types_arr, int* offsets_arr, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_IntegerMulti(int fid, const char* name, int count, int* v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_RealMulti(int fid, const char* name, int count, double* v_arr);
 
 #ifdef __cplusplus
 }
@@ -12,36 +12,17 @@ PointMapTriangle::PointMapTriangle()
 	index3 = 0;
 }
 
-InputBStream& operator >> (InputBStream& stream, PointMapTriangle& tri)
-{
-	stream >> tri.index1;
-	stream >> tri.index2;
-	stream >> tri.index3;
-
-	return stream;
-}
-
-OutputBStream& operator << (OutputBStream& stream, const PointMapTriangle& tri)
-{
-	stream << tri.index1;
-	stream << tri.index2;
-	stream << tri.index3;
-
-	return stream;
-}
-
 InputBStream& operator >> (InputBStream& stream, PointMapBreakline& bl)
 {
-	bl.indices.clear();
 	int length;
 	stream >> length;
-	bl.indices.reserve(length);
-
-	for (int i = 0; i < length; ++i){
-		int index;
-		stream >> index;
-		bl.indices.push_back(index);
+	if (stream.fail() || length < 0) {
+		bl.indices.clear();
+		stream.setFail();
+		return stream;
 	}
+	bl.indices.assign(length, 0);
+	stream.read(bl.indices.data(), bl.indices.size());
 
 	return stream;
 }
@@ -49,9 +30,7 @@ InputBStream& operator >> (InputBStream& stream, PointMapBreakline& bl)
 OutputBStream& operator << (OutputBStream& stream, const PointMapBreakline& bl)
 {
 	stream << static_cast<int>(bl.indices.size());
-	for (unsigned int i = 0; i < bl.indices.size(); ++i){
-		stream << bl.indices.at(i);
-	}
+	stream.write(bl.indices.data(), bl.indices.size());
 
 	return stream;
 }
@@ -80,52 +59,42 @@ int PointMap::load(const char* filename)
 	str >> vt;
 	valueType = static_cast<ValueType>(vt);
 
+	// the coordinates and the values are stored in blocks, so each block is read at once
 	str >> pointCount;
-	x.reserve(pointCount);
-	y.reserve(pointCount);
-	if (valueType == vtReal){
-		realValue.reserve(pointCount);
-	} else if (valueType == vtInt){
-		intValue.reserve(pointCount);
-	}
-
-	for (int i = 0; i < pointCount; ++i){
-		double tmpx;
-		str >> tmpx;
-		x.push_back(tmpx);
-	}
-	for (int i = 0; i < pointCount; ++i){
-		double tmpy;
-		str >> tmpy;
-		y.push_back(tmpy);
-	}
+	if (str.fail() || pointCount < 0) {return -1;}
+	x.assign(pointCount, 0);
+	y.assign(pointCount, 0);
+	str.read(x.data(), x.size());
+	str.read(y.data(), y.size());
 	if (valueType == vtReal){
-		for (int i = 0; i < pointCount; ++i){
-			double tmpv;
-			str >> tmpv;
-			realValue.push_back(tmpv);
-		}
+		realValue.assign(pointCount, 0);
+		str.read(realValue.data(), realValue.size());
 	} else if (valueType == vtInt){
-		for (int i = 0; i < pointCount; ++i){
-			int tmpv;
-			str >> tmpv;
-			intValue.push_back(tmpv);
-		}
+		intValue.assign(pointCount, 0);
+		str.read(intValue.data(), intValue.size());
 	}
+	if (str.fail()) {return -1;}
 	int triCount;
 	str >> triCount;
-	triangles.reserve(triCount);
+	if (str.fail() || triCount < 0) {return -1;}
+	std::vector<int> triIndices(static_cast<size_t>(triCount) * 3);
+	str.read(triIndices.data(), triIndices.size());
+	if (str.fail()) {return -1;}
+	triangles.resize(triCount);
 	for (int i = 0; i < triCount; ++i){
-		PointMapTriangle tri;
-		str >> tri;
-		triangles.push_back(tri);
+		PointMapTriangle& tri = triangles[i];
+		tri.index1 = triIndices[i * 3];
+		tri.index2 = triIndices[i * 3 + 1];
+		tri.index3 = triIndices[i * 3 + 2];
 	}
 	int blCount;
 	str >> blCount;
+	if (str.fail() || blCount < 0) {return -1;}
 	breaklines.reserve(blCount);
 	for (int i = 0; i < blCount; ++i){
 		PointMapBreakline bl;
 		str >> bl;
+		if (str.fail()) {return -1;}
 		breaklines.push_back(bl);
 	}
 	istream.close();
@@ -134,6 +103,11 @@ int PointMap::load(const char* filename)
 
 int PointMap::save(const char *filename)
 {
+	// each point should have y and value, because they are written in blocks of x.size() values
+	if (y.size() < x.size()){return -1;}
+	if (valueType == vtReal && realValue.size() < x.size()){return -1;}
+	if (valueType == vtInt && intValue.size() < x.size()){return -1;}
+
 	ofstream ostream(filename, ios::out | ios::binary);
 	if (! ostream){
 		// open error
@@ -145,26 +119,24 @@ int PointMap::save(const char *filename)
 	pointCount = static_cast<int>(x.size());
 	str << pointCount;
 
-	for (int i = 0; i < pointCount; ++i){
-		str << x.at(i);
-	}
-	for (int i = 0; i < pointCount; ++i){
-		str << y.at(i);
-	}
+	str.write(x.data(), pointCount);
+	str.write(y.data(), pointCount);
 	if (valueType == vtReal){
-		for (int i = 0; i < pointCount; ++i){
-			str << realValue.at(i);
-		}
+		str.write(realValue.data(), pointCount);
 	} else if (valueType == vtInt){
-		for (int i = 0; i < pointCount; ++i){
-			str << intValue.at(i);
-		}
+		str.write(intValue.data(), pointCount);
 	}
 	int triCount = static_cast<int>(triangles.size());
 	str << triCount;
+	std::vector<int> triIndices;
+	triIndices.reserve(static_cast<size_t>(triCount) * 3);
 	for (int i = 0; i < triCount; ++i){
-		str << triangles.at(i);
+		const PointMapTriangle& tri = triangles.at(i);
+		triIndices.push_back(tri.index1);
+		triIndices.push_back(tri.index2);
+		triIndices.push_back(tri.index3);
 	}
+	str.write(triIndices.data(), triIndices.size());
 	int blCount = static_cast<int>(breaklines.size());
 	str << blCount;
 	for (int i = 0; i < blCount; ++i){
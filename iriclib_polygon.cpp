@@ -21,27 +21,24 @@ InternalPolygon::~InternalPolygon()
 InputBStream& operator >> (InputBStream& stream, InternalPolygon& pol)
 {
 	stream >> pol.pointCount;
+	if (stream.fail() || pol.pointCount < 0) {
+		pol.pointCount = 0;
+		stream.setFail();
+		return stream;
+	}
 	pol.x = new double[pol.pointCount];
 	pol.y = new double[pol.pointCount];
 
-	for (int i = 0; i < pol.pointCount; ++i){
-		stream >> *(pol.x + i);
-	}
-	for (int i = 0; i < pol.pointCount; ++i){
-		stream >> *(pol.y + i);
-	}
+	stream.read(pol.x, pol.pointCount);
+	stream.read(pol.y, pol.pointCount);
 	return stream;
 }
 
 OutputBStream& operator << (OutputBStream& stream, const InternalPolygon& pol)
 {
 	stream << pol.pointCount;
-	for (int i = 0; i < pol.pointCount; ++i){
-		stream << *(pol.x + i);
-	}
-	for (int i = 0; i < pol.pointCount; ++i){
-		stream << *(pol.y + i);
-	}
+	stream.write(pol.x, pol.pointCount);
+	stream.write(pol.y, pol.pointCount);
 	return stream;
 }
 
@@ -75,20 +72,23 @@ int Polygon::load(const char* filename, bool noDimensions)
 	} else {
 		int count;
 		str >> count;
-		for (int i = 0; i < count; ++i){
-			str >> val;
-			values.push_back(val);
-		}
+		if (str.fail() || count < 0) {return -1;}
+		values.assign(count, 0);
+		str.read(values.data(), values.size());
 	}
+	if (str.fail()) {return -1;}
 	polygon = new iRICLib::InternalPolygon();
 	str >> *polygon;
+	if (str.fail()) {return -1;}
 	str >> size;
+	if (str.fail() || size < 0) {return -1;}
 
 	holes.clear();
 	for (int i = 0; i < size; ++i){
 		InternalPolygon* hole = new InternalPolygon();
 		str >> *hole;
 		holes.push_back(hole);
+		if (str.fail()) {return -1;}
 	}
 	istream.close();
 	return 0;
@@ -107,9 +107,7 @@ int Polygon::save(const char *filename, bool noDimensions)
 	} else {
 		int count = static_cast<int>(values.size());
 		str << count;
-		for (int i = 0; i < count; ++i){
-			str << values[i];
-		}
+		str.write(values.data(), values.size());
 	}
 	str << *polygon;
 	str << static_cast<int>(holes.size());
@@ -124,6 +122,7 @@ int Polygon::save(const char *filename, bool noDimensions)
 void Polygon::clear()
 {
 	if (polygon != 0){delete polygon;}
+	polygon = 0;
 	for (unsigned int i = 0; i < holes.size(); ++i){
 		delete holes[i];
 	}
@@ -21,27 +21,24 @@ InternalPolyline::~InternalPolyline()
 InputBStream& operator >> (InputBStream& stream, InternalPolyline& pol)
 {
 	stream >> pol.pointCount;
+	if (stream.fail() || pol.pointCount < 0) {
+		pol.pointCount = 0;
+		stream.setFail();
+		return stream;
+	}
 	pol.x = new double[pol.pointCount];
 	pol.y = new double[pol.pointCount];
 
-	for (int i = 0; i < pol.pointCount; ++i){
-		stream >> *(pol.x + i);
-	}
-	for (int i = 0; i < pol.pointCount; ++i){
-		stream >> *(pol.y + i);
-	}
+	stream.read(pol.x, pol.pointCount);
+	stream.read(pol.y, pol.pointCount);
 	return stream;
 }
 
 OutputBStream& operator << (OutputBStream& stream, const InternalPolyline& pol)
 {
 	stream << pol.pointCount;
-	for (int i = 0; i < pol.pointCount; ++i){
-		stream << *(pol.x + i);
-	}
-	for (int i = 0; i < pol.pointCount; ++i){
-		stream << *(pol.y + i);
-	}
+	stream.write(pol.x, pol.pointCount);
+	stream.write(pol.y, pol.pointCount);
 	return stream;
 }
 
@@ -74,13 +71,14 @@ int Polyline::load(const char* filename, bool noDimensions)
 	} else {
 		int count;
 		str >> count;
-		for (int i = 0; i < count; ++i){
-			str >> val;
-			values.push_back(val);
-		}
+		if (str.fail() || count < 0) {return -1;}
+		values.assign(count, 0);
+		str.read(values.data(), values.size());
 	}
+	if (str.fail()) {return -1;}
 	polyline = new iRICLib::InternalPolyline();
 	str >> *polyline;
+	if (str.fail()) {return -1;}
 
 	istream.close();
 	return 0;
@@ -99,9 +97,7 @@ int Polyline::save(const char *filename, bool noDimensions)
 	} else {
 		int count = static_cast<int>(values.size());
 		str << count;
-		for (int i = 0; i < count; ++i){
-			str << values[i];
-		}
+		str.write(values.data(), values.size());
 	}
 	str << *polyline;
 	ostream.close();
@@ -1,5 +1,5 @@
-#ifndef IRICLIB_POLYGON_H
-#define IRICLIB_POLYGON_H
+#ifndef IRICLIB_POLYLINE_H
+#define IRICLIB_POLYLINE_H
 
 #include "iriclib_global.h"
 #include <vector>
@@ -27,4 +27,4 @@ public:
 };
 }
 
-#endif // IRICLIB_POLYGON_H
+#endif // IRICLIB_POLYLINE_H
@@ -22,13 +22,14 @@ RiverPathPoint::~RiverPathPoint()
 InputBStream& operator >> (InputBStream& stream, std::vector<double>& vec)
 {
 	int size;
-	double val;
 	stream >> size;
-	vec.clear();
-	for (int i = 0; i < size; ++i){
-		stream >> val;
-		vec.push_back(val);
+	if (stream.fail() || size < 0) {
+		vec.clear();
+		stream.setFail();
+		return stream;
 	}
+	vec.assign(size, 0);
+	stream.read(vec.data(), vec.size());
 	return stream;
 }
 
@@ -41,6 +42,7 @@ InputBStream& operator >> (InputBStream& stream, RiverPathPoint& p)
 	stream >> p.directionX >> p.directionY;
 	stream >> p.leftShift;
 	stream >> size;
+	if (size < 0) {stream.setFail();}
 	p.altitudes.clear();
 	for (int i = 0; i < size; ++i){
 		Altitude alt;
@@ -72,9 +74,7 @@ InputBStream& operator >> (InputBStream& stream, RiverPathPoint& p)
 OutputBStream& operator << (OutputBStream& stream, const std::vector<double>& vec)
 {
 	stream << static_cast<int>(vec.size());
-	for (unsigned int i = 0; i < vec.size(); ++i){
-		stream << vec.at(i);
-	}
+	stream.write(vec.data(), vec.size());
 	return stream;
 }
 
@@ -134,6 +134,7 @@ int RiverSurvey::load(const char* filename)
 	points.clear();
 
 	str >> size;
+	if (str.fail() || size < 0) {return -1;}
 	RiverPathPoint* p;
 	RiverPathPoint* prevP;
 	for (int i = 0; i < size; ++i){
@@ -146,6 +147,7 @@ int RiverSurvey::load(const char* filename)
 		}
 		points.push_back(p);
 		prevP = p;
+		if (str.fail()) {return -1;}
 	}
 	istream.close();
 	return 0;
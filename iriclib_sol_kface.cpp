@@ -3,7 +3,6 @@
 #include "h5cgnszone.h"
 #include "iriclib_errorcodes.h"
 #include "iriclib_sol_kface.h"
-#include "vectorutil.h"
 
 #include "internal/iric_logger.h"
 #include "internal/iric_util.h"
@@ -19,31 +18,18 @@ int readSolutionT(int fid, int gid, int step, const std::string& name, V* v_arr,
 	int ier = _iric_get_zone_for_solread(fid, gid, step, &zone, f_name);
 	RETURN_IF_ERR;
 
-	std::vector<V> buffer;
-
-	ier = zone->kFaceSolution()->readValue(name, &buffer);
+	ier = zone->kFaceSolution()->readValue(name, v_arr, zone->kFaceCount());
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
-
 	return IRIC_NO_ERROR;
 }
 
 template <typename V>
 int writeSolutionT(int fid, int gid, const std::string& name, V* v_arr, const std::string& f_name)
 {
-	H5CgnsZone* zone = nullptr;
-	int ier = _iric_get_zone_for_solwrite(fid, gid, &zone, f_name);
-	RETURN_IF_ERR;
-
-	std::vector<V> buffer(zone->kFaceCount());
-
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = zone->kFaceSolution()->writeValue(name, buffer);
-	RETURN_IF_ERR;
-
-	return IRIC_NO_ERROR;
+	return _iric_write_sol_values(fid, gid, v_arr, &H5CgnsZone::kFaceCount, [name](H5CgnsZone* zone, const V* values, size_t count) {
+		return zone->kFaceSolution()->writeValue(name, values, count);
+	}, f_name);
 }
 
 } // namespace
@@ -3,7 +3,6 @@
 #include "h5cgnszone.h"
 #include "iriclib_errorcodes.h"
 #include "iriclib_sol_node.h"
-#include "vectorutil.h"
 
 #include "internal/iric_logger.h"
 #include "internal/iric_util.h"
@@ -19,33 +18,48 @@ int readSolutionT(int fid, int gid, int step, const std::string& name, V* v_arr,
 	int ier = _iric_get_zone_for_solread(fid, gid, step, &zone, f_name);
 	RETURN_IF_ERR;
 
-	std::vector<V> buffer;
-
-	ier = zone->nodeSolution()->readValue(name, &buffer);
+	ier = zone->nodeSolution()->readValue(name, v_arr, zone->nodeCount());
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
-
 	return IRIC_NO_ERROR;
 }
 
 template <typename V>
-int writeSolutionT(int fid, int gid, const std::string& name, V* v_arr, const std::string& f_name)
+int readSolutionSeriesT(int fid, int gid, const std::string& name, int count, const int* idx_arr, V* v_arr, const std::string& f_name)
+{
+	return _iric_read_sol_series(fid, gid, count, idx_arr, v_arr, &H5CgnsZone::nodeCount, [name](H5CgnsZone* zone, const std::vector<hsize_t>& indices, V* values) {
+		return zone->nodeSolution()->readValuePoints(name, indices, values);
+	}, f_name);
+}
+
+template <typename V>
+int readSolutionRegionT(int fid, int gid, int step, const std::string& name, const std::vector<int>& mins, const std::vector<int>& maxs, int stride, V* v_arr, const std::string& f_name)
 {
 	H5CgnsZone* zone = nullptr;
-	int ier = _iric_get_zone_for_solwrite(fid, gid, &zone, f_name);
+	int ier = _iric_get_zone_for_solread(fid, gid, step, &zone, f_name);
 	RETURN_IF_ERR;
 
-	std::vector<V> buffer(zone->nodeCount());
+	std::vector<hsize_t> dims, start, strides, count;
+	ier = zone->nodeDims(&dims);
+	RETURN_IF_ERR;
 
-	_pointerToVectorT(v_arr, &buffer);
+	ier = _iric_get_region(zone, dims, mins, maxs, stride, &start, &strides, &count, f_name);
+	RETURN_IF_ERR;
 
-	ier = zone->nodeSolution()->writeValue(name, buffer);
+	ier = zone->nodeSolution()->readValueRegion(name, start, strides, count, v_arr);
 	RETURN_IF_ERR;
 
 	return IRIC_NO_ERROR;
 }
 
+template <typename V>
+int writeSolutionT(int fid, int gid, const std::string& name, V* v_arr, const std::string& f_name)
+{
+	return _iric_write_sol_values(fid, gid, v_arr, &H5CgnsZone::nodeCount, [name](H5CgnsZone* zone, const V* values, size_t count) {
+		return zone->nodeSolution()->writeValue(name, values, count);
+	}, f_name);
+}
+
 } // namespace
 
 int cg_iRIC_Read_Sol_Node_Integer_WithGridId(int fid, int gid, int step, const char* name, int* v_arr)
@@ -68,6 +82,74 @@ int cg_iRIC_Read_Sol_Node_Real_WithGridId(int fid, int gid, int step, const char
 	return IRIC_NO_ERROR;
 }
 
+int cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId(int fid, int gid, const char* name, int count, const int* idx_arr, int* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+	int ier = readSolutionSeriesT(fid, gid, name, count, idx_arr, v_arr, "cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId");
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Series_WithGridId(int fid, int gid, const char* name, int count, const int* idx_arr, double* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+	int ier = readSolutionSeriesT(fid, gid, name, count, idx_arr, v_arr, "cg_iRIC_Read_Sol_Node_Real_Series_WithGridId");
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, int* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+	std::vector<int> mins = {imin, jmin};
+	std::vector<int> maxs = {imax, jmax};
+	int ier = readSolutionRegionT(fid, gid, step, name, mins, maxs, stride, v_arr, "cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId");
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, double* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+	std::vector<int> mins = {imin, jmin};
+	std::vector<int> maxs = {imax, jmax};
+	int ier = readSolutionRegionT(fid, gid, step, name, mins, maxs, stride, v_arr, "cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId");
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, int* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+	std::vector<int> mins = {imin, jmin, kmin};
+	std::vector<int> maxs = {imax, jmax, kmax};
+	int ier = readSolutionRegionT(fid, gid, step, name, mins, maxs, stride, v_arr, "cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId");
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+	std::vector<int> mins = {imin, jmin, kmin};
+	std::vector<int> maxs = {imax, jmax, kmax};
+	int ier = readSolutionRegionT(fid, gid, step, name, mins, maxs, stride, v_arr, "cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId");
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
 int cg_iRIC_Write_Sol_Node_Integer_WithGridId(int fid, int gid, const char* name, int* v_arr)
 {
 	_IRIC_LOGGER_TRACE_ENTER();
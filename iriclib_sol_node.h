@@ -9,6 +9,12 @@ extern "C" {
 
 int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_WithGridId(int fid, int gid, int step, const char* name, int* v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_WithGridId(int fid, int gid, int step, const char* name, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId(int fid, int gid, const char* name, int count, const int* idx_arr, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Series_WithGridId(int fid, int gid, const char* name, int count, const int* idx_arr, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, int* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, double* v_arr);
 
 int IRICLIBDLL cg_iRIC_Write_Sol_Node_Integer_WithGridId(int fid, int gid, const char* name, int* v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Node_Real_WithGridId(int fid, int gid, const char* name, double* v_arr);
@@ -3,7 +3,6 @@
 #include "h5cgnszone.h"
 #include "iriclib_errorcodes.h"
 #include "iriclib_sol_particle.h"
-#include "vectorutil.h"
 
 #include "internal/iric_logger.h"
 #include "internal/iric_util.h"
@@ -57,14 +56,14 @@ int cg_iRIC_Read_Sol_Particle_Pos2d_WithGridId(int fid, int gid, int step, doubl
 	int ier = getParticleSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_Particle_WithGridId_Pos2d");
 	RETURN_IF_ERR;
 
-	std::vector<double> xvec, yvec;
-	ier = solution->readCoordinatesX(&xvec);
-	RETURN_IF_ERR;
-	ier = solution->readCoordinatesY(&yvec);
+	int count;
+	ier = solution->count(&count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(xvec, x_arr);
-	_vectorToPointerT(yvec, y_arr);
+	ier = solution->readCoordinatesX(x_arr, count);
+	RETURN_IF_ERR;
+	ier = solution->readCoordinatesY(y_arr, count);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -78,18 +77,17 @@ int cg_iRIC_Read_Sol_Particle_Pos3d_WithGridId(int fid, int gid, int step, doubl
 	int ier = getParticleSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_Particle_WithGridId_Pos3d");
 	RETURN_IF_ERR;
 
-	std::vector<double> xvec, yvec, zvec;
-	ier = solution->readCoordinatesX(&xvec);
+	int count;
+	ier = solution->count(&count);
+	RETURN_IF_ERR;
+
+	ier = solution->readCoordinatesX(x_arr, count);
 	RETURN_IF_ERR;
-	ier = solution->readCoordinatesY(&yvec);
+	ier = solution->readCoordinatesY(y_arr, count);
 	RETURN_IF_ERR;
-	ier = solution->readCoordinatesZ(&zvec);
+	ier = solution->readCoordinatesZ(z_arr, count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(xvec, x_arr);
-	_vectorToPointerT(yvec, y_arr);
-	_vectorToPointerT(zvec, z_arr);
-
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
@@ -102,11 +100,12 @@ int cg_iRIC_Read_Sol_Particle_Real_WithGridId(int fid, int gid, int step, const
 	int ier = getParticleSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_Particle_WithGridId_Real");
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer;
-	ier = solution->readValue(name, &buffer);
+	int count;
+	ier = solution->count(&count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
+	ier = solution->readValue(name, v_arr, count);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -120,57 +119,141 @@ int cg_iRIC_Read_Sol_Particle_Integer_WithGridId(int fid, int gid, int step, con
 	int ier = getParticleSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_Particle_WithGridId_Integer");
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer;
-	ier = solution->readValue(name, &buffer);
+	int count;
+	ier = solution->count(&count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
+	ier = solution->readValue(name, v_arr, count);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
 
-int cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr)
+int cg_iRIC_Read_Sol_Particle_RectCount_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, int* count)
 {
 	_IRIC_LOGGER_TRACE_ENTER();
 
 	H5CgnsParticleSolution* solution = nullptr;
-	int ier = getParticleSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_Particle_WithGridId_Pos2d");
+	int ier = getParticleSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_Particle_RectCount_WithGridId");
 	RETURN_IF_ERR;
 
-	std::vector<double> xvec(count), yvec(count);
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(xmin, xmax, ymin, ymax, &rows);
+	RETURN_IF_ERR;
+
+	*count = static_cast<int> (rows.size());
 
-	_pointerToVectorT(x_arr, &xvec);
-	_pointerToVectorT(y_arr, &yvec);
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
 
-	ier = solution->writeCoordinatesX(xvec);
+int cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleSolution* solution = nullptr;
+	int ier = getParticleSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId");
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(xmin, xmax, ymin, ymax, &rows);
+	RETURN_IF_ERR;
+
+	ier = solution->readCoordinatesX(rows, x_arr);
 	RETURN_IF_ERR;
-	ier = solution->writeCoordinatesY(yvec);
+	ier = solution->readCoordinatesY(rows, y_arr);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
 
-int cg_iRIC_Write_Sol_Particle_Pos3d_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr, double* z_arr)
+int cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr, double* z_arr)
 {
 	_IRIC_LOGGER_TRACE_ENTER();
 
 	H5CgnsParticleSolution* solution = nullptr;
-	int ier = getParticleSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_Particle_WithGridId_Pos3d");
+	int ier = getParticleSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId");
 	RETURN_IF_ERR;
 
-	std::vector<double> xvec(count), yvec(count), zvec(count);
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(xmin, xmax, ymin, ymax, &rows);
+	RETURN_IF_ERR;
 
-	_pointerToVectorT(x_arr, &xvec);
-	_pointerToVectorT(y_arr, &yvec);
-	_pointerToVectorT(z_arr, &zvec);
+	ier = solution->readCoordinatesX(rows, x_arr);
+	RETURN_IF_ERR;
+	ier = solution->readCoordinatesY(rows, y_arr);
+	RETURN_IF_ERR;
+	ier = solution->readCoordinatesZ(rows, z_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
 
-	ier = solution->writeCoordinatesX(xvec);
+int cg_iRIC_Read_Sol_Particle_RectReal_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, double* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleSolution* solution = nullptr;
+	int ier = getParticleSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_Particle_RectReal_WithGridId");
 	RETURN_IF_ERR;
-	ier = solution->writeCoordinatesY(yvec);
+
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(xmin, xmax, ymin, ymax, &rows);
 	RETURN_IF_ERR;
-	ier = solution->writeCoordinatesZ(zvec);
+
+	ier = solution->readValue(name, rows, v_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, int* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleSolution* solution = nullptr;
+	int ier = getParticleSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId");
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(xmin, xmax, ymin, ymax, &rows);
+	RETURN_IF_ERR;
+
+	ier = solution->readValue(name, rows, v_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleSolution* solution = nullptr;
+	int ier = getParticleSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_Particle_WithGridId_Pos2d");
+	RETURN_IF_ERR;
+
+	ier = solution->writeCoordinates(x_arr, y_arr, nullptr, count);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Write_Sol_Particle_Pos3d_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr, double* z_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleSolution* solution = nullptr;
+	int ier = getParticleSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_Particle_WithGridId_Pos3d");
+	RETURN_IF_ERR;
+
+	ier = solution->writeCoordinates(x_arr, y_arr, z_arr, count);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -189,11 +272,7 @@ int cg_iRIC_Write_Sol_Particle_Real_WithGridId(int fid, int gid, const char* nam
 	ier = solution->count(&count);
 	RETURN_IF_ERR;;
 
-	std::vector<double> buffer(count);
-
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = solution->writeValue(name, buffer);
+	ier = solution->writeValue(name, v_arr, count);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -212,11 +291,7 @@ int cg_iRIC_Write_Sol_Particle_Integer_WithGridId(int fid, int gid, const char*
 	ier = solution->count(&count);
 	RETURN_IF_ERR;;
 
-	std::vector<int> buffer(count);
-
-	_pointerToVectorT(v_arr, &buffer);
-
-	ier = solution->writeValue(name, buffer);
+	ier = solution->writeValue(name, v_arr, count);
 	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
@@ -13,6 +13,14 @@ int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Pos3d_WithGridId(int fid, int gid, int
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Real_WithGridId(int fid, int gid, int step, const char* name, double* v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Integer_WithGridId(int fid, int gid, int step, const char* name, int* v_arr);
 
+// reads the particles in the rectangle. Only the spatial bins that intersect the rectangle are read, when
+// the particles were written with cg_iRIC_Set_ParticleBins().
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectCount_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, int* count);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectReal_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, int* v_arr);
+
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Pos3d_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr, double* z_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Real_WithGridId(int fid, int gid, const char* name, double* v_arr);
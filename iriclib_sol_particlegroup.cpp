@@ -1,13 +1,17 @@
 #include "error_macros.h"
 #include "h5cgnsparticlegroupsolution.h"
+#include "h5cgnsparticlegrouptrajectories.h"
 #include "h5cgnszone.h"
 #include "iriclib_errorcodes.h"
 #include "iriclib_sol_particlegroup.h"
-#include "vectorutil.h"
 
 #include "internal/iric_logger.h"
 #include "internal/iric_util.h"
 
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
 using namespace iRICLib;
 
 namespace {
@@ -32,6 +36,27 @@ int getParticleGroupSolutionForWrite(int fid, int gid, H5CgnsParticleGroupSoluti
 	return IRIC_NO_ERROR;
 }
 
+int findParticleGroupTrajectoryRows(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, H5CgnsParticleGroupTrajectories** trajectories, std::vector<int>* ids, std::vector<int>* steps, std::vector<hsize_t>* rows, const std::string& f_name)
+{
+	H5CgnsZone* zone = nullptr;
+	int ier = _iric_get_zone(fid, gid, &zone, f_name);
+	RETURN_IF_ERR;
+
+	if (! zone->particleGroupTrajectoriesExists()) {
+		std::ostringstream ss;
+		ss << "In " << f_name << "(), particle group trajectories are not written";
+		_iric_logger_error(ss.str());
+		return IRIC_DATA_NOT_FOUND;
+	}
+	*trajectories = zone->particleGroupTrajectories();
+
+	std::vector<int> queryIds(id_arr, id_arr + count);
+	ier = (*trajectories)->findRows(groupname, queryIds, step_min, step_max, ids, steps, rows);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
 } // namespace
 
 int cg_iRIC_Read_Sol_ParticleGroup_Count_WithGridId(int fid, int gid, int step, const char* groupname, int* count)
@@ -57,14 +82,14 @@ int cg_iRIC_Read_Sol_ParticleGroup_Pos2d_WithGridId(int fid, int gid, int step,
 	int ier = getParticleGroupSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_ParticleGroup_WithGridId_Pos2d");
 	RETURN_IF_ERR;
 
-	std::vector<double> xvec, yvec;
-	ier = solution->readCoordinatesX(groupname, &xvec);
-	RETURN_IF_ERR;
-	ier = solution->readCoordinatesY(groupname, &yvec);
+	int count;
+	ier = solution->count(groupname, &count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(xvec, x_arr);
-	_vectorToPointerT(yvec, y_arr);
+	ier = solution->readCoordinatesX(groupname, x_arr, count);
+	RETURN_IF_ERR;
+	ier = solution->readCoordinatesY(groupname, y_arr, count);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -78,17 +103,16 @@ int cg_iRIC_Read_Sol_ParticleGroup_Pos3d_WithGridId(int fid, int gid, int step,
 	int ier = getParticleGroupSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_ParticleGroup_WithGridId_Pos3d");
 	RETURN_IF_ERR;
 
-	std::vector<double> xvec, yvec, zvec;
-	ier = solution->readCoordinatesX(groupname, &xvec);
+	int count;
+	ier = solution->count(groupname, &count);
 	RETURN_IF_ERR;
-	ier = solution->readCoordinatesY(groupname, &yvec);
+
+	ier = solution->readCoordinatesX(groupname, x_arr, count);
 	RETURN_IF_ERR;
-	ier = solution->readCoordinatesZ(groupname, &zvec);
+	ier = solution->readCoordinatesY(groupname, y_arr, count);
+	RETURN_IF_ERR;
+	ier = solution->readCoordinatesZ(groupname, z_arr, count);
 	RETURN_IF_ERR;
-
-	_vectorToPointerT(xvec, x_arr);
-	_vectorToPointerT(yvec, y_arr);
-	_vectorToPointerT(zvec, z_arr);
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -102,11 +126,12 @@ int cg_iRIC_Read_Sol_ParticleGroup_Real_WithGridId(int fid, int gid, int step, c
 	int ier = getParticleGroupSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_ParticleGroup_WithGridId_Real");
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer;
-	ier = solution->readValue(groupname, name, &buffer);
+	int count;
+	ier = solution->count(groupname, &count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
+	ier = solution->readValue(groupname, name, v_arr, count);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -120,11 +145,206 @@ int cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(int fid, int gid, int step
 	int ier = getParticleGroupSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_ParticleGroup_WithGridId_Integer");
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer;
-	ier = solution->readValue(groupname, name, &buffer);
+	int count;
+	ier = solution->count(groupname, &count);
+	RETURN_IF_ERR;
+
+	ier = solution->readValue(groupname, name, v_arr, count);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* size)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupTrajectories* trajectories = nullptr;
+	std::vector<int> ids, steps;
+	std::vector<hsize_t> rows;
+	int ier = findParticleGroupTrajectoryRows(fid, gid, groupname, count, id_arr, step_min, step_max, &trajectories, &ids, &steps, &rows, "cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId");
+	RETURN_IF_ERR;
+
+	*size = static_cast<int> (rows.size());
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupTrajectories* trajectories = nullptr;
+	std::vector<int> ids, steps;
+	std::vector<hsize_t> rows;
+	int ier = findParticleGroupTrajectoryRows(fid, gid, groupname, count, id_arr, step_min, step_max, &trajectories, &ids, &steps, &rows, "cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId");
+	RETURN_IF_ERR;
+
+	std::copy(ids.begin(), ids.end(), pid_arr);
+	std::copy(steps.begin(), steps.end(), step_arr);
+	ier = trajectories->readCoordinatesX(groupname, rows, x_arr);
+	RETURN_IF_ERR;
+	ier = trajectories->readCoordinatesY(groupname, rows, y_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr, double* z_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupTrajectories* trajectories = nullptr;
+	std::vector<int> ids, steps;
+	std::vector<hsize_t> rows;
+	int ier = findParticleGroupTrajectoryRows(fid, gid, groupname, count, id_arr, step_min, step_max, &trajectories, &ids, &steps, &rows, "cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId");
+	RETURN_IF_ERR;
+
+	std::copy(ids.begin(), ids.end(), pid_arr);
+	std::copy(steps.begin(), steps.end(), step_arr);
+	ier = trajectories->readCoordinatesX(groupname, rows, x_arr);
+	RETURN_IF_ERR;
+	ier = trajectories->readCoordinatesY(groupname, rows, y_arr);
+	RETURN_IF_ERR;
+	ier = trajectories->readCoordinatesZ(groupname, rows, z_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, const char* name, double* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupTrajectories* trajectories = nullptr;
+	std::vector<int> ids, steps;
+	std::vector<hsize_t> rows;
+	int ier = findParticleGroupTrajectoryRows(fid, gid, groupname, count, id_arr, step_min, step_max, &trajectories, &ids, &steps, &rows, "cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId");
+	RETURN_IF_ERR;
+
+	ier = trajectories->readValue(groupname, name, rows, v_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, const char* name, int* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupTrajectories* trajectories = nullptr;
+	std::vector<int> ids, steps;
+	std::vector<hsize_t> rows;
+	int ier = findParticleGroupTrajectoryRows(fid, gid, groupname, count, id_arr, step_min, step_max, &trajectories, &ids, &steps, &rows, "cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId");
+	RETURN_IF_ERR;
+
+	ier = trajectories->readValue(groupname, name, rows, v_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectCount_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, int* count)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupSolution* solution = nullptr;
+	int ier = getParticleGroupSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_ParticleGroup_RectCount_WithGridId");
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(groupname, xmin, xmax, ymin, ymax, &rows);
+	RETURN_IF_ERR;
+
+	*count = static_cast<int> (rows.size());
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupSolution* solution = nullptr;
+	int ier = getParticleGroupSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId");
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(groupname, xmin, xmax, ymin, ymax, &rows);
+	RETURN_IF_ERR;
+
+	ier = solution->readCoordinatesX(groupname, rows, x_arr);
+	RETURN_IF_ERR;
+	ier = solution->readCoordinatesY(groupname, rows, y_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr, double* z_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupSolution* solution = nullptr;
+	int ier = getParticleGroupSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId");
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(groupname, xmin, xmax, ymin, ymax, &rows);
+	RETURN_IF_ERR;
+
+	ier = solution->readCoordinatesX(groupname, rows, x_arr);
+	RETURN_IF_ERR;
+	ier = solution->readCoordinatesY(groupname, rows, y_arr);
+	RETURN_IF_ERR;
+	ier = solution->readCoordinatesZ(groupname, rows, z_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, double* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupSolution* solution = nullptr;
+	int ier = getParticleGroupSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId");
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(groupname, xmin, xmax, ymin, ymax, &rows);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
+	ier = solution->readValue(groupname, name, rows, v_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, int* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	H5CgnsParticleGroupSolution* solution = nullptr;
+	int ier = getParticleGroupSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId");
+	RETURN_IF_ERR;
+
+	std::vector<hsize_t> rows;
+	ier = solution->findRowsInRect(groupname, xmin, xmax, ymin, ymax, &rows);
+	RETURN_IF_ERR;
+
+	ier = solution->readValue(groupname, name, rows, v_arr);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -212,3 +432,71 @@ int cg_iRIC_Write_Sol_ParticleGroup_Real_WithGridId(int fid, int gid, const char
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
+
+int cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	int ier = _iric_check_count(count, "cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	H5CgnsParticleGroupSolution* solution = nullptr;
+	ier = getParticleGroupSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	solution->writePos2d(x_arr, y_arr, count);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr, double* z_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	int ier = _iric_check_count(count, "cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	H5CgnsParticleGroupSolution* solution = nullptr;
+	ier = getParticleGroupSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	solution->writePos3d(x_arr, y_arr, z_arr, count);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(int fid, int gid, const char* name, int count, int* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	int ier = _iric_check_count(count, "cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	H5CgnsParticleGroupSolution* solution = nullptr;
+	ier = getParticleGroupSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	solution->writeValue(name, v_arr, count);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(int fid, int gid, const char* name, int count, double* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	int ier = _iric_check_count(count, "cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	H5CgnsParticleGroupSolution* solution = nullptr;
+	ier = getParticleGroupSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	solution->writeValue(name, v_arr, count);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
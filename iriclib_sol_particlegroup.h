@@ -12,6 +12,19 @@ int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Pos2d_WithGridId(int fid, int gid,
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Pos3d_WithGridId(int fid, int gid, int step, const char* groupname, double* x_arr, double* y_arr, double* z_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Real_WithGridId(int fid, int gid, int step, const char* groupname, const char* name, double* v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(int fid, int gid, int step, const char* groupname, const char* name, int* v_arr);
+// trajectories of the particles with count ids in id_arr, in steps step_min - step_max, written with cg_iRIC_Set_ParticleGroupTrajectory()
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* size);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, int* pid_arr, int* step_arr, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, const char* name, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId(int fid, int gid, const char* groupname, int count, int* id_arr, int step_min, int step_max, const char* name, int* v_arr);
+// particles of the group in the rectangle. Only the spatial bins that intersect the rectangle are read, when
+// the particles were written with cg_iRIC_Set_ParticleBins().
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectCount_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, int* count);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, double* v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, int* v_arr);
 
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_GroupBegin_WithGridId(int fid, int gid, const char* groupname);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_GroupEnd_WithGridId(int fid, int gid);
@@ -19,6 +32,10 @@ int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos2d_WithGridId(int fid, int gid
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos3d_WithGridId(int fid, int gid, double x, double y, double z);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Integer_WithGridId(int fid, int gid, const char* name, int value);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Real_WithGridId(int fid, int gid, const char* name, double value);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr, double* z_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(int fid, int gid, const char* name, int count, int* v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(int fid, int gid, const char* name, int count, double* v_arr);
 
 #ifdef __cplusplus
 }
@@ -118,3 +118,20 @@ int cg_iRIC_Write_Sol_ParticleGroupImage_Pos2d_WithGridId(int fid, int gid, doub
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
+
+int cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr, double* size_arr, double* angle_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	int ier = _iric_check_count(count, "cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	H5CgnsParticleGroupImageSolution* solution = nullptr;
+	ier = getParticleGroupImageSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId");
+	RETURN_IF_ERR;
+
+	solution->writePos2d(x_arr, y_arr, size_arr, angle_arr, count);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
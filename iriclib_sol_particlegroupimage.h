@@ -13,6 +13,7 @@ int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d_WithGridId(int fid, int
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_GroupBegin_WithGridId(int fid, int gid, const char* groupname);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_GroupEnd_WithGridId(int fid, int gid);
 int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_Pos2d_WithGridId(int fid, int gid, double x, double y, double size, double angle);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(int fid, int gid, int count, double* x_arr, double* y_arr, double* size_arr, double* angle_arr);
 
 #ifdef __cplusplus
 }
@@ -72,14 +72,14 @@ int cg_iRIC_Read_Sol_PolyData_Pos2d_WithGridId(int fid, int gid, int step, const
 	int ier = getPolyDataSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_PolyData_WithGridId_Pos2d");
 	RETURN_IF_ERR;
 
-	std::vector<double> xvec, yvec;
-	ier = solution->readCoordinatesX(groupname, &xvec);
-	RETURN_IF_ERR;
-	ier = solution->readCoordinatesY(groupname, &yvec);
+	int count;
+	ier = solution->coordinatesCount(groupname, &count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(xvec, x_arr);
-	_vectorToPointerT(yvec, y_arr);
+	ier = solution->readCoordinatesX(groupname, x_arr, count);
+	RETURN_IF_ERR;
+	ier = solution->readCoordinatesY(groupname, y_arr, count);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -93,11 +93,12 @@ int cg_iRIC_Read_Sol_PolyData_Type_WithGridId(int fid, int gid, int step, const
 	int ier = getPolyDataSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_PolyData_WithGridId_Type");
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer;
-	ier = solution->readTypes(groupname, &buffer);
+	int count;
+	ier = solution->dataCount(groupname, &count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
+	ier = solution->readTypes(groupname, v_arr, count);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -111,11 +112,12 @@ int cg_iRIC_Read_Sol_PolyData_Real_WithGridId(int fid, int gid, int step, const
 	int ier = getPolyDataSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_PolyData_WithGridId_Real");
 	RETURN_IF_ERR;
 
-	std::vector<double> buffer;
-	ier = solution->readValue(groupname, name, &buffer);
+	int count;
+	ier = solution->dataCount(groupname, &count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
+	ier = solution->readValue(groupname, name, v_arr, count);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -129,11 +131,12 @@ int cg_iRIC_Read_Sol_PolyData_Integer_WithGridId(int fid, int gid, int step, con
 	int ier = getPolyDataSolutionForRead(fid, gid, step, &solution, "cg_iRIC_Read_Sol_PolyData_WithGridId_Integer");
 	RETURN_IF_ERR;
 
-	std::vector<int> buffer;
-	ier = solution->readValue(groupname, name, &buffer);
+	int count;
+	ier = solution->dataCount(groupname, &count);
 	RETURN_IF_ERR;
 
-	_vectorToPointerT(buffer, v_arr);
+	ier = solution->readValue(groupname, name, v_arr, count);
+	RETURN_IF_ERR;
 
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
@@ -233,3 +236,55 @@ int cg_iRIC_Write_Sol_PolyData_Real_WithGridId(int fid, int gid, const char* nam
 	_IRIC_LOGGER_TRACE_LEAVE();
 	return IRIC_NO_ERROR;
 }
+
+int cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(int fid, int gid, int count, int* types_arr, int* offsets_arr, double* x_arr, double* y_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	int ier = _iric_check_count(count, "cg_iRIC_Write_Sol_PolyData_GeometryMulti");
+	RETURN_IF_ERR;
+
+	H5CgnsPolyDataSolution* solution = nullptr;
+	ier = getPolyDataSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_PolyData_GeometryMulti");
+	RETURN_IF_ERR;
+
+	ier = solution->writePolyData(types_arr, offsets_arr, count, x_arr, y_arr);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(int fid, int gid, const char* name, int count, int* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	int ier = _iric_check_count(count, "cg_iRIC_Write_Sol_PolyData_IntegerMulti");
+	RETURN_IF_ERR;
+
+	H5CgnsPolyDataSolution* solution = nullptr;
+	ier = getPolyDataSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_PolyData_IntegerMulti");
+	RETURN_IF_ERR;
+
+	solution->writeValue(name, v_arr, count);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(int fid, int gid, const char* name, int count, double* v_arr)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	int ier = _iric_check_count(count, "cg_iRIC_Write_Sol_PolyData_RealMulti");
+	RETURN_IF_ERR;
+
+	H5CgnsPolyDataSolution* solution = nullptr;
+	ier = getPolyDataSolutionForWrite(fid, gid, &solution, "cg_iRIC_Write_Sol_PolyData_RealMulti");
+	RETURN_IF_ERR;
+
+	solution->writeValue(name, v_arr, count);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
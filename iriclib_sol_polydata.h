@@ -20,6 +20,10 @@ int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Polygon_WithGridId(int fid, int gid, i
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Polyline_WithGridId(int fid, int gid, int numPoints, double* x_arr, double* y_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Integer_WithGridId(int fid, int gid, const char* name, int value);
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Real_WithGridId(int fid, int gid, const char* name, double value);
+// offsets_arr has count + 1 items. coordinates of geometry i are x_arr[offsets_arr[i]] to x_arr[offsets_arr[i + 1] - 1]
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(int fid, int gid, int count, int* types_arr, int* offsets_arr, double* x_arr, double* y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(int fid, int gid, const char* name, int count, int* v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(int fid, int gid, const char* name, int count, double* v_arr);
 
 #ifdef __cplusplus
 }
@@ -4,6 +4,7 @@
 #include "h5cgnsbase.h"
 #include "h5cgnsbaseiterativedata.h"
 #include "h5cgnsfile.h"
+#include "h5cgnsfilesolutionreader.h"
 
 #include "internal/iric_h5cgnsfiles.h"
 #include "internal/iric_logger.h"
@@ -21,6 +22,12 @@ using namespace iRICLib;
 	int ier = _iric_h5cgnsfiles_get(fid, &file);\
 	RETURN_IF_ERR;
 
+// for writes that the solution writer may queue for its background thread
+#define GET_F_NOWAIT \
+	H5CgnsFile* file = nullptr;\
+	int ier = _iric_h5cgnsfiles_get_nowait(fid, &file);\
+	RETURN_IF_ERR;
+
 int cg_iRIC_Read_Sol_Count(int fid, int* count)
 {
 	_IRIC_LOGGER_TRACE_ENTER();
@@ -134,9 +141,7 @@ int cg_iRIC_Write_Sol_Start(int fid)
 {
 	_IRIC_LOGGER_TRACE_ENTER();
 
-	H5CgnsFile* file;
-	int ier = _iric_h5cgnsfiles_get(fid, &file);
-	RETURN_IF_ERR;
+	GET_F_NOWAIT;
 
 	ier = file->solutionWriter()->writeSolStart();
 	RETURN_IF_ERR;
@@ -149,16 +154,26 @@ int cg_iRIC_Write_Sol_End(int fid)
 {
 	_IRIC_LOGGER_TRACE_ENTER();
 
+	// writes queued for the background thread are waited for only when the step is flushed,
+	// so that the solver computes the next step while they are written.
+	GET_F_NOWAIT;
+
+	auto writer = file->solutionWriter();
+	if (writer->mode() == H5CgnsFileSolutionWriter::Mode::SeparateSwmr) {
+		// readers open the file in SWMR mode, so the step is flushed without waiting for a request
+		ier = writer->flush();
+		RETURN_IF_ERR;
+
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_NO_ERROR;
+	}
+
 	Poco::File f(".flush");
 	if (! f.exists()) {
 		return IRIC_NO_ERROR;
 	}
 
-	H5CgnsFile* file;
-	int ier = _iric_h5cgnsfiles_get(fid, &file);
-	RETURN_IF_ERR;
-
-	ier = file->solutionWriter()->flush();
+	ier = writer->flush();
 	RETURN_IF_ERR;
 
 	f.remove();
@@ -171,7 +186,7 @@ int cg_iRIC_Write_Sol_Time(int fid, double time)
 {
 	_IRIC_LOGGER_TRACE_ENTER();
 
-	GET_F;
+	GET_F_NOWAIT;
 
 	ier = file->solutionWriter()->writeTime(time);
 	RETURN_IF_ERR;
@@ -184,7 +199,7 @@ int cg_iRIC_Write_Sol_Iteration(int fid, int iteration)
 {
 	_IRIC_LOGGER_TRACE_ENTER();
 
-	GET_F;
+	GET_F_NOWAIT;
 
 	ier = file->solutionWriter()->writeIteration(iteration);
 	RETURN_IF_ERR;
@@ -197,7 +212,7 @@ int cg_iRIC_Write_Sol_BaseIterative_Integer(int fid, const char* name, int value
 {
 	_IRIC_LOGGER_TRACE_ENTER();
 
-	GET_F;
+	GET_F_NOWAIT;
 
 	ier = file->solutionWriter()->writeBaseIterativeData(name, value);
 	RETURN_IF_ERR;
@@ -210,7 +225,7 @@ int cg_iRIC_Write_Sol_BaseIterative_Real(int fid, const char* name, double value
 {
 	_IRIC_LOGGER_TRACE_ENTER();
 
-	GET_F;
+	GET_F_NOWAIT;
 
 	ier = file->solutionWriter()->writeBaseIterativeData(name, value);
 	RETURN_IF_ERR;
@@ -223,7 +238,7 @@ int cg_iRIC_Write_Sol_BaseIterative_String(int fid, const char* name, const char
 {
 	_IRIC_LOGGER_TRACE_ENTER();
 
-	GET_F;
+	GET_F_NOWAIT;
 
 	ier = file->solutionWriter()->writeBaseIterativeData(name, value);
 	RETURN_IF_ERR;
@@ -258,3 +273,89 @@ int cg_iRIC_Clear_Sol(int fid)
 	return IRIC_NO_ERROR;
 
 }
+
+int cg_iRIC_Set_Sol_Cache(int fid, int capacity, int prefetch)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	GET_F;
+
+	if (capacity < 1) {
+		std::ostringstream ss;
+		ss << "In cg_iRIC_Set_Sol_Cache(), capacity should be 1 or larger";
+		_iric_logger_error(ss.str());
+
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_INVALID_ARGUMENT;
+	}
+
+	auto reader = file->solutionReader();
+	reader->setCacheCapacity(capacity);
+	reader->setPrefetchEnabled(prefetch != 0);
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_CacheStats(int fid, int* hits, int* misses)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	GET_F;
+
+	auto reader = file->solutionReader();
+	*hits = reader->cacheHitCount();
+	*misses = reader->cacheMissCount();
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_Refresh(int fid)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	GET_F;
+
+	ier = file->refresh();
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Set_Sol_AsyncWrite(int fid, int queueSize)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	GET_F;
+
+	if (queueSize < 0) {
+		std::ostringstream ss;
+		ss << "In cg_iRIC_Set_Sol_AsyncWrite(), queueSize should be 0 or larger";
+		_iric_logger_error(ss.str());
+
+		_IRIC_LOGGER_TRACE_LEAVE();
+		return IRIC_INVALID_ARGUMENT;
+	}
+
+	ier = file->solutionWriter()->setAsyncQueueSize(queueSize);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
+
+int cg_iRIC_Read_Sol_AsyncWriteStats(int fid, int* maxQueueDepth, double* stallSeconds)
+{
+	_IRIC_LOGGER_TRACE_ENTER();
+
+	GET_F;
+
+	auto writer = file->solutionWriter();
+	*maxQueueDepth = writer->asyncMaxQueueDepth();
+	*stallSeconds = writer->asyncStallSeconds();
+
+	_IRIC_LOGGER_TRACE_LEAVE();
+	return IRIC_NO_ERROR;
+}
@@ -26,6 +26,12 @@ int IRICLIBDLL cg_iRIC_Write_ErrorCode(int fid, int errorcode);
 
 int IRICLIBDLL cg_iRIC_Clear_Sol(int fid);
 
+int IRICLIBDLL cg_iRIC_Set_Sol_Cache(int fid, int capacity, int prefetch);
+int IRICLIBDLL cg_iRIC_Read_Sol_CacheStats(int fid, int* hits, int* misses);
+int IRICLIBDLL cg_iRIC_Set_Sol_AsyncWrite(int fid, int queueSize);
+int IRICLIBDLL cg_iRIC_Read_Sol_AsyncWriteStats(int fid, int* maxQueueDepth, double* stallSeconds);
+int IRICLIBDLL cg_iRIC_Read_Sol_Refresh(int fid);
+
 #ifdef __cplusplus
 }
 #endif
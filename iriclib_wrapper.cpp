@@ -1,9 +1,14 @@
 #include "iriclib.h"
+#include "iriclib_errorcodes.h"
 #include "iriclib_wrapper.h"
 
 #include "intarraycontainer.h"
 #include "realarraycontainer.h"
 
+#include "internal/iric_logger.h"
+
+using namespace iRICLib;
+
 // from iriclib_bc.h
 int cg_iRIC_Read_BC_Indices_WithGridId(int fid, int gid, const char* type, int num, IntArrayContainer& idx_arr)
 {
@@ -155,6 +160,16 @@ int cg_iRIC_Read_Grid3d_Coords_WithGridId(int fid, int gid, RealArrayContainer&
 	return cg_iRIC_Read_Grid3d_Coords_WithGridId(fid, gid, x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
 }
 
+int cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(fid, gid, imin, imax, jmin, jmax, stride, x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(fid, gid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
 int cg_iRIC_Read_Grid_TriangleElements_WithGridId(int fid, int gid, IntArrayContainer& id_arr)
 {
 	return cg_iRIC_Read_Grid_TriangleElements_WithGridId(fid, gid, id_arr.pointer());
@@ -372,6 +387,21 @@ int cg_iRIC_Read_Grid2d_InterpolateWithCell(int grid_handle, double x, double y,
 	return cg_iRIC_Read_Grid2d_InterpolateWithCell(grid_handle, x, y, cellId, nodeids_arr.pointer(), weights_arr.pointer());
 }
 
+int cg_iRIC_Read_Grid2d_InterpolateWithHint(int grid_handle, double x, double y, int hintCellId, int* ok, int* cellId, int* count, IntArrayContainer& nodeids_arr, RealArrayContainer& weights_arr)
+{
+	return cg_iRIC_Read_Grid2d_InterpolateWithHint(grid_handle, x, y, hintCellId, ok, cellId, count, nodeids_arr.pointer(), weights_arr.pointer());
+}
+
+int cg_iRIC_Read_Grid2d_FindCellMulti(int grid_handle, int count, RealArrayContainer& x_arr, RealArrayContainer& y_arr, IntArrayContainer& cellids_arr)
+{
+	return cg_iRIC_Read_Grid2d_FindCellMulti(grid_handle, count, x_arr.pointer(), y_arr.pointer(), cellids_arr.pointer());
+}
+
+int cg_iRIC_Read_Grid2d_InterpolateMulti(int grid_handle, int count, RealArrayContainer& x_arr, RealArrayContainer& y_arr, IntArrayContainer& ok_arr, IntArrayContainer& nodecount_arr, IntArrayContainer& nodeids_arr, RealArrayContainer& weights_arr)
+{
+	return cg_iRIC_Read_Grid2d_InterpolateMulti(grid_handle, count, x_arr.pointer(), y_arr.pointer(), ok_arr.pointer(), nodecount_arr.pointer(), nodeids_arr.pointer(), weights_arr.pointer());
+}
+
 
 // from iriclib_not_withbaseid.h
 int cg_iRIC_Read_Complex_Functional(int fid, const char* groupname, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
@@ -481,6 +511,16 @@ int cg_iRIC_Read_Grid3d_Coords(int fid, RealArrayContainer& x_arr, RealArrayCont
 	return cg_iRIC_Read_Grid3d_Coords(fid, x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
 }
 
+int cg_iRIC_Read_Grid2d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Read_Grid2d_Coords_Region(fid, imin, imax, jmin, jmax, stride, x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Read_Grid3d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Read_Grid3d_Coords_Region(fid, imin, imax, jmin, jmax, kmin, kmax, stride, x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
 int cg_iRIC_Read_Grid_TriangleElements(int fid, IntArrayContainer& id_arr)
 {
 	return cg_iRIC_Read_Grid_TriangleElements(fid, id_arr.pointer());
@@ -696,6 +736,36 @@ int cg_iRIC_Read_Sol_Cell_Real(int fid, int step, const char* name, RealArrayCon
 	return cg_iRIC_Read_Sol_Cell_Real(fid, step, name, v_arr.pointer());
 }
 
+int cg_iRIC_Read_Sol_Cell_Integer_Series(int fid, const char* name, int count, IntArrayContainer& idx_arr, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Integer_Series(fid, name, count, idx_arr.pointer(), v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Real_Series(int fid, const char* name, int count, IntArrayContainer& idx_arr, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Real_Series(fid, name, count, idx_arr.pointer(), v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Integer_Region2d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Real_Region2d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Integer_Region3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Real_Region3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr.pointer());
+}
+
 int cg_iRIC_Write_Sol_Cell_Integer(int fid, const char* name, IntArrayContainer& v_arr)
 {
 	return cg_iRIC_Write_Sol_Cell_Integer(fid, name, v_arr.pointer());
@@ -796,6 +866,36 @@ int cg_iRIC_Read_Sol_Node_Real(int fid, int step, const char* name, RealArrayCon
 	return cg_iRIC_Read_Sol_Node_Real(fid, step, name, v_arr.pointer());
 }
 
+int cg_iRIC_Read_Sol_Node_Integer_Series(int fid, const char* name, int count, IntArrayContainer& idx_arr, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Integer_Series(fid, name, count, idx_arr.pointer(), v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Series(int fid, const char* name, int count, IntArrayContainer& idx_arr, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Real_Series(fid, name, count, idx_arr.pointer(), v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Integer_Region2d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Real_Region2d(fid, step, name, imin, imax, jmin, jmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Integer_Region3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Real_Region3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr.pointer());
+}
+
 int cg_iRIC_Write_Sol_Node_Integer(int fid, const char* name, IntArrayContainer& v_arr)
 {
 	return cg_iRIC_Write_Sol_Node_Integer(fid, name, v_arr.pointer());
@@ -826,6 +926,26 @@ int cg_iRIC_Read_Sol_Particle_Integer(int fid, int step, const char* name, IntAr
 	return cg_iRIC_Read_Sol_Particle_Integer(fid, step, name, v_arr.pointer());
 }
 
+int cg_iRIC_Read_Sol_Particle_RectPos2d(int fid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Read_Sol_Particle_RectPos2d(fid, step, xmin, xmax, ymin, ymax, x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Particle_RectPos3d(int fid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Read_Sol_Particle_RectPos3d(fid, step, xmin, xmax, ymin, ymax, x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Particle_RectReal(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Particle_RectReal(fid, step, xmin, xmax, ymin, ymax, name, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Particle_RectInteger(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Particle_RectInteger(fid, step, xmin, xmax, ymin, ymax, name, v_arr.pointer());
+}
+
 int cg_iRIC_Write_Sol_Particle_Pos2d(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
 {
 	return cg_iRIC_Write_Sol_Particle_Pos2d(fid, x_arr.size(), x_arr.pointer(), y_arr.pointer());
@@ -866,11 +986,81 @@ int cg_iRIC_Read_Sol_ParticleGroup_Integer(int fid, int step, const char* groupn
 	return cg_iRIC_Read_Sol_ParticleGroup_Integer(fid, step, groupname, name, v_arr.pointer());
 }
 
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, int* size)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(fid, groupname, count, id_arr.pointer(), step_min, step_max, size);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(fid, groupname, count, id_arr.pointer(), step_min, step_max, pid_arr.pointer(), step_arr.pointer(), x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d(fid, groupname, count, id_arr.pointer(), step_min, step_max, pid_arr.pointer(), step_arr.pointer(), x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(fid, groupname, count, id_arr.pointer(), step_min, step_max, name, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger(fid, groupname, count, id_arr.pointer(), step_min, step_max, name, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos2d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_RectPos2d(fid, step, groupname, xmin, xmax, ymin, ymax, x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos3d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_RectPos3d(fid, step, groupname, xmin, xmax, ymin, ymax, x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectReal(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_RectReal(fid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectInteger(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_RectInteger(fid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, x_arr.size(), x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti(fid, x_arr.size(), x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(int fid, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, name, v_arr.size(), v_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_RealMulti(int fid, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, name, v_arr.size(), v_arr.pointer());
+}
+
 int cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d(int fid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr)
 {
 	return cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d(fid, step, groupname, x_arr.pointer(), y_arr.pointer(), size_arr.pointer(), angle_arr.pointer());
 }
 
+int cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(fid, x_arr.size(), x_arr.pointer(), y_arr.pointer(), size_arr.pointer(), angle_arr.pointer());
+}
+
 int cg_iRIC_Read_Sol_PolyData_Pos2d(int fid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
 {
 	return cg_iRIC_Read_Sol_PolyData_Pos2d(fid, step, groupname, x_arr.pointer(), y_arr.pointer());
@@ -901,6 +1091,26 @@ int cg_iRIC_Write_Sol_PolyData_Polyline(int fid, int numPoints, RealArrayContain
 	return cg_iRIC_Write_Sol_PolyData_Polyline(fid, numPoints, x_arr.pointer(), y_arr.pointer());
 }
 
+int cg_iRIC_Write_Sol_PolyData_GeometryMulti(int fid, IntArrayContainer& types_arr, IntArrayContainer& offsets_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	if (offsets_arr.size() != types_arr.size() + 1 || offsets_arr.pointer()[types_arr.size()] != x_arr.size() || y_arr.size() != x_arr.size()) {
+		_iric_logger_error("In cg_iRIC_Write_Sol_PolyData_GeometryMulti(), sizes of offsets_arr, x_arr and y_arr do not match");
+		return IRIC_INVALID_ARGUMENT;
+	}
+
+	return cg_iRIC_Write_Sol_PolyData_GeometryMulti(fid, types_arr.size(), types_arr.pointer(), offsets_arr.pointer(), x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_PolyData_IntegerMulti(int fid, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Write_Sol_PolyData_IntegerMulti(fid, name, v_arr.size(), v_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_PolyData_RealMulti(int fid, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Write_Sol_PolyData_RealMulti(fid, name, v_arr.size(), v_arr.pointer());
+}
+
 
 // from iriclib_sol_cell.h
 int cg_iRIC_Read_Sol_Cell_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr)
@@ -913,6 +1123,36 @@ int cg_iRIC_Read_Sol_Cell_Real_WithGridId(int fid, int gid, int step, const char
 	return cg_iRIC_Read_Sol_Cell_Real_WithGridId(fid, gid, step, name, v_arr.pointer());
 }
 
+int cg_iRIC_Read_Sol_Cell_Integer_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& idx_arr, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Integer_Series_WithGridId(fid, gid, name, count, idx_arr.pointer(), v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Real_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& idx_arr, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Real_Series_WithGridId(fid, gid, name, count, idx_arr.pointer(), v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Integer_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Integer_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Real_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Real_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Integer_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Integer_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Cell_Real_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Cell_Real_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr.pointer());
+}
+
 int cg_iRIC_Write_Sol_Cell_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr)
 {
 	return cg_iRIC_Write_Sol_Cell_Integer_WithGridId(fid, gid, name, v_arr.pointer());
@@ -1023,6 +1263,36 @@ int cg_iRIC_Read_Sol_Node_Real_WithGridId(int fid, int gid, int step, const char
 	return cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, gid, step, name, v_arr.pointer());
 }
 
+int cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& idx_arr, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId(fid, gid, name, count, idx_arr.pointer(), v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& idx_arr, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Real_Series_WithGridId(fid, gid, name, count, idx_arr.pointer(), v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride, v_arr.pointer());
+}
+
 int cg_iRIC_Write_Sol_Node_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr)
 {
 	return cg_iRIC_Write_Sol_Node_Integer_WithGridId(fid, gid, name, v_arr.pointer());
@@ -1055,6 +1325,26 @@ int cg_iRIC_Read_Sol_Particle_Integer_WithGridId(int fid, int gid, int step, con
 	return cg_iRIC_Read_Sol_Particle_Integer_WithGridId(fid, gid, step, name, v_arr.pointer());
 }
 
+int cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Particle_RectReal_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Particle_RectReal_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, name, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, name, v_arr.pointer());
+}
+
 int cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
 {
 	return cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(fid, gid, x_arr.size(), x_arr.pointer(), y_arr.pointer());
@@ -1097,6 +1387,71 @@ int cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(int fid, int gid, int step
 	return cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(fid, gid, step, groupname, name, v_arr.pointer());
 }
 
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, int* size)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId(fid, gid, groupname, count, id_arr.pointer(), step_min, step_max, size);
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId(fid, gid, groupname, count, id_arr.pointer(), step_min, step_max, pid_arr.pointer(), step_arr.pointer(), x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId(fid, gid, groupname, count, id_arr.pointer(), step_min, step_max, pid_arr.pointer(), step_arr.pointer(), x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId(fid, gid, groupname, count, id_arr.pointer(), step_min, step_max, name, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId(fid, gid, groupname, count, id_arr.pointer(), step_min, step_max, name, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr.pointer());
+}
+
+int cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, name, v_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(fid, gid, x_arr.size(), x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(fid, gid, x_arr.size(), x_arr.pointer(), y_arr.pointer(), z_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(fid, gid, name, v_arr.size(), v_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(fid, gid, name, v_arr.size(), v_arr.pointer());
+}
+
 
 // from iriclib_sol_particlegroupimage.h
 int cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d_WithGridId(int fid, int gid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr)
@@ -1104,6 +1459,11 @@ int cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d_WithGridId(int fid, int gid, int s
 	return cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d_WithGridId(fid, gid, step, groupname, x_arr.pointer(), y_arr.pointer(), size_arr.pointer(), angle_arr.pointer());
 }
 
+int cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr)
+{
+	return cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(fid, gid, x_arr.size(), x_arr.pointer(), y_arr.pointer(), size_arr.pointer(), angle_arr.pointer());
+}
+
 
 // from iriclib_sol_polydata.h
 int cg_iRIC_Read_Sol_PolyData_Pos2d_WithGridId(int fid, int gid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
@@ -1136,6 +1496,26 @@ int cg_iRIC_Write_Sol_PolyData_Polyline_WithGridId(int fid, int gid, int numPoin
 	return cg_iRIC_Write_Sol_PolyData_Polyline_WithGridId(fid, gid, numPoints, x_arr.pointer(), y_arr.pointer());
 }
 
+int cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(int fid, int gid, IntArrayContainer& types_arr, IntArrayContainer& offsets_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr)
+{
+	if (offsets_arr.size() != types_arr.size() + 1 || offsets_arr.pointer()[types_arr.size()] != x_arr.size() || y_arr.size() != x_arr.size()) {
+		_iric_logger_error("In cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(), sizes of offsets_arr, x_arr and y_arr do not match");
+		return IRIC_INVALID_ARGUMENT;
+	}
+
+	return cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(fid, gid, types_arr.size(), types_arr.pointer(), offsets_arr.pointer(), x_arr.pointer(), y_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr)
+{
+	return cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(fid, gid, name, v_arr.size(), v_arr.pointer());
+}
+
+int cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr)
+{
+	return cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(fid, gid, name, v_arr.size(), v_arr.pointer());
+}
+
 
 // from iriclib_solution.h
 
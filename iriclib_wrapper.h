@@ -45,6 +45,8 @@ int IRICLIBDLL iRIC_Geo_RiverSurvey_Read_Altitudes(int geo_handle, int csid, Rea
 // from iriclib_grid.h
 int IRICLIBDLL cg_iRIC_Read_Grid2d_Coords_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid3d_Coords_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid_TriangleElements_WithGridId(int fid, int gid, IntArrayContainer& id_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid_LineElements_WithGridId(int fid, int gid, IntArrayContainer& id_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid_Real_Node_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
@@ -90,6 +92,9 @@ int IRICLIBDLL cg_iRIC_Write_Grid_Integer_JFace_WithGridId(int fid, int gid, con
 // from iriclib_grid_solverlib.h
 int IRICLIBDLL cg_iRIC_Read_Grid2d_Interpolate(int grid_handle, double x, double y, int* ok, int* count, IntArrayContainer& nodeids_arr, RealArrayContainer& weights_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid2d_InterpolateWithCell(int grid_handle, double x, double y, int cellId, IntArrayContainer& nodeids_arr, RealArrayContainer& weights_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_InterpolateWithHint(int grid_handle, double x, double y, int hintCellId, int* ok, int* cellId, int* count, IntArrayContainer& nodeids_arr, RealArrayContainer& weights_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_FindCellMulti(int grid_handle, int count, RealArrayContainer& x_arr, RealArrayContainer& y_arr, IntArrayContainer& cellids_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_InterpolateMulti(int grid_handle, int count, RealArrayContainer& x_arr, RealArrayContainer& y_arr, IntArrayContainer& ok_arr, IntArrayContainer& nodecount_arr, IntArrayContainer& nodeids_arr, RealArrayContainer& weights_arr);
 
 // from iriclib_not_withbaseid.h
 int IRICLIBDLL cg_iRIC_Read_Complex_Functional(int fid, const char* groupname, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
@@ -115,6 +120,8 @@ int IRICLIBDLL cg_iRIC_Write_Grid_Complex_IFace(int fid, const char* groupname,
 int IRICLIBDLL cg_iRIC_Write_Grid_Complex_JFace(int fid, const char* groupname, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid2d_Coords(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid3d_Coords(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid2d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Read_Grid3d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid_TriangleElements(int fid, IntArrayContainer& id_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid_LineElements(int fid, IntArrayContainer& id_arr);
 int IRICLIBDLL cg_iRIC_Read_Grid_Real_Node(int fid, const char* name, RealArrayContainer& v_arr);
@@ -158,6 +165,12 @@ int IRICLIBDLL cg_iRIC_Write_Grid_Real_JFace(int fid, const char* name, RealArra
 int IRICLIBDLL cg_iRIC_Write_Grid_Integer_JFace(int fid, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer(int fid, int step, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real(int fid, int step, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_Series(int fid, const char* name, int count, IntArrayContainer& idx_arr, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_Series(int fid, const char* name, int count, IntArrayContainer& idx_arr, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Cell_Integer(int fid, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Cell_Real(int fid, const char* name, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Grid2d_Coords(int fid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
@@ -178,12 +191,22 @@ int IRICLIBDLL cg_iRIC_Write_Sol_KFace_Integer(int fid, const char* name, IntArr
 int IRICLIBDLL cg_iRIC_Write_Sol_KFace_Real(int fid, const char* name, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer(int fid, int step, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real(int fid, int step, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Series(int fid, const char* name, int count, IntArrayContainer& idx_arr, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Series(int fid, const char* name, int count, IntArrayContainer& idx_arr, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Node_Integer(int fid, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Node_Real(int fid, const char* name, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Pos2d(int fid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Pos3d(int fid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Real(int fid, int step, const char* name, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Integer(int fid, int step, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectPos2d(int fid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectPos3d(int fid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectReal(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectInteger(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Pos2d(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Pos3d(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Real(int fid, const char* name, RealArrayContainer& v_arr);
@@ -192,17 +215,40 @@ int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Pos2d(int fid, int step, const cha
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Pos3d(int fid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Real(int fid, int step, const char* groupname, const char* name, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Integer(int fid, int step, const char* groupname, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, int* size);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectPos2d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectPos3d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectReal(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectInteger(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(int fid, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_RealMulti(int fid, const char* name, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d(int fid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_PolyData_Pos2d(int fid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_PolyData_Type(int fid, int step, const char* groupname, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_PolyData_Real(int fid, int step, const char* groupname, const char* name, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_PolyData_Integer(int fid, int step, const char* groupname, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Polygon(int fid, int numPoints, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Polyline(int fid, int numPoints, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_GeometryMulti(int fid, IntArrayContainer& types_arr, IntArrayContainer& offsets_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_IntegerMulti(int fid, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_RealMulti(int fid, const char* name, RealArrayContainer& v_arr);
 
 // from iriclib_sol_cell.h
 int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_WithGridId(int fid, int gid, int step, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& idx_arr, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& idx_arr, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Integer_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Cell_Real_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Cell_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Cell_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
 
@@ -233,6 +279,12 @@ int IRICLIBDLL cg_iRIC_Write_Sol_KFace_Real_WithGridId(int fid, int gid, const c
 // from iriclib_sol_node.h
 int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_WithGridId(int fid, int gid, int step, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& idx_arr, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& idx_arr, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Node_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Node_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
 
@@ -241,6 +293,10 @@ int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Pos2d_WithGridId(int fid, int gid, int
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Pos3d_WithGridId(int fid, int gid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Real_WithGridId(int fid, int gid, int step, const char* name, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_Particle_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectReal_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Pos3d_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_Particle_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
@@ -251,9 +307,23 @@ int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Pos2d_WithGridId(int fid, int gid,
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Pos3d_WithGridId(int fid, int gid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Real_WithGridId(int fid, int gid, int step, const char* groupname, const char* name, RealArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(int fid, int gid, int step, const char* groupname, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, int* size);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
 
 // from iriclib_sol_particlegroupimage.h
 int IRICLIBDLL cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d_WithGridId(int fid, int gid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr);
 
 // from iriclib_sol_polydata.h
 int IRICLIBDLL cg_iRIC_Read_Sol_PolyData_Pos2d_WithGridId(int fid, int gid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
@@ -262,6 +332,9 @@ int IRICLIBDLL cg_iRIC_Read_Sol_PolyData_Real_WithGridId(int fid, int gid, int s
 int IRICLIBDLL cg_iRIC_Read_Sol_PolyData_Integer_WithGridId(int fid, int gid, int step, const char* groupname, const char* name, IntArrayContainer& v_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Polygon_WithGridId(int fid, int gid, int numPoints, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_Polyline_WithGridId(int fid, int gid, int numPoints, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(int fid, int gid, IntArrayContainer& types_arr, IntArrayContainer& offsets_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
+int IRICLIBDLL cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
 
 // from iriclib_solution.h
 
@@ -13,12 +13,18 @@
 #include "iricsolverlib_tricell.h"
 #include "iriclib_errorcodes.h"
 
+#include "internal/iric_logger.h"
 #include "internal/iric_util.h"
 
+#include "private/iricsolverlib_cellinterpolation.h"
 #include "private/iricsolverlib_grid2d_impl.h"
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <utility>
 #include <vector>
 
 using namespace iRICLib;
@@ -26,17 +32,82 @@ using namespace iRICSolverLib;
 
 namespace {
 
+// lines are equally spaced by delta, so the range is computed directly, then corrected for rounding errors.
+// the result is the same as searching the lines with std::lower_bound().
+size_t backGridLineIndex(const std::vector<double>& lines, double delta, double v, size_t max)
+{
+	if (! (delta > 0)) {return 0;}
+
+	double pos = (v - lines.front()) / delta;
+	if (! (pos > 0)) {return 0;}
+	if (pos >= max) {return max;}
+	return static_cast<size_t> (pos);
+}
+
+void backGridRange(const std::vector<double>& lines, double delta, double min, double max, size_t* begin, size_t* end)
+{
+	size_t last = lines.size() - 1;
+
+	// begin: the last line not greater than min
+	size_t b = backGridLineIndex(lines, delta, min, last);
+	while (b > 0 && lines[b] > min) {--b;}
+	while (b < last && lines[b + 1] <= min) {++b;}
+
+	// end: the first line not less than max
+	size_t e = backGridLineIndex(lines, delta, max, last) + 1;
+	if (e > lines.size()) {e = lines.size();}
+	while (e > 0 && lines[e - 1] >= max) {--e;}
+	while (e < lines.size() && lines[e] < max) {++e;}
+
+	*begin = b;
+	*end = e;
+}
+
 } // namespace
 
 Grid2D::Impl::Impl(Grid2D* grid) :
-	m_grid (grid)
+	m_grid (grid),
+	m_spatialIndex (SpatialIndex::BackGrid),
+	m_spatialIndexReady (false),
+	m_threadCount (0)
 {}
 
 Grid2D::Impl::~Impl()
 {
-	for (size_t i = 0; i < m_cells.size(); ++i) {
-		delete m_cells.at(i);
+	clearCells();
+}
+
+int Grid2D::Impl::load(const iRICLib::H5CgnsZone& zone, iRICLib::H5CgnsGridCoordinates* coords)
+{
+	invalidateSpatialIndex();
+	clearCells();
+
+	std::vector<int> size = zone.size();
+	std::vector<int> indices;
+	if (zone.type() == iRICLib::H5CgnsZone::Type::Unstructured) {
+		int ier = zone.readTriangleElements(&indices);
+		RETURN_IF_ERR;
+	}
+
+	// cells are built while the coordinates are read. HDF5 is accessed only from this thread.
+	std::thread cellBuilder([&]() {
+		if (zone.type() == iRICLib::H5CgnsZone::Type::Structured) {
+			buildStructuredCells(size);
+		} else if (zone.type() == iRICLib::H5CgnsZone::Type::Unstructured) {
+			buildUnstructuredCells(indices);
+		}
+	});
+	int ier = loadNodes(coords);
+	cellBuilder.join();
+	RETURN_IF_ERR;
+
+	if (! cellNodeIdsValid()) {
+		_iric_logger_error("In Grid2D::load(), a cell refers to a node that does not exist");
+		clearCells();
+		return IRIC_WRONG_DATASIZE;
 	}
+
+	return IRIC_NO_ERROR;
 }
 
 int Grid2D::Impl::loadNodes(iRICLib::H5CgnsGridCoordinates* coords)
@@ -61,18 +132,11 @@ int Grid2D::Impl::loadNodes(iRICLib::H5CgnsGridCoordinates* coords)
 	return IRIC_NO_ERROR;
 }
 
-int Grid2D::Impl::loadCells(const iRICLib::H5CgnsZone& zone)
-{
-	if (zone.type() == iRICLib::H5CgnsZone::Type::Structured) {
-		return loadStructuredGrid(zone);
-	} else if (zone.type() == iRICLib::H5CgnsZone::Type::Unstructured) {
-		return loadUnstructuredGrid(zone);
-	}
-}
-
-int Grid2D::Impl::loadStructuredGrid(const iRICLib::H5CgnsZone& zone)
+void Grid2D::Impl::buildStructuredCells(const std::vector<int>& size)
 {
-	std::vector<int> size = zone.size();
+	size_t cellCount = static_cast<size_t> ((std::max)(0, size[0] - 1)) * static_cast<size_t> ((std::max)(0, size[1] - 1));
+	m_cellTypes.reserve(cellCount);
+	m_cellNodeIds.reserve(cellCount * MAX_CELL_NODES);
 
 	for (int i = 0; i < size[0] - 1; ++i) {
 		for (int j = 0; j < size[1] - 1; ++j) {
@@ -80,42 +144,200 @@ int Grid2D::Impl::loadStructuredGrid(const iRICLib::H5CgnsZone& zone)
 			int id1 = structuredIndex(i + 1, j    , size.data());
 			int id2 = structuredIndex(i + 1, j + 1, size.data());
 			int id3 = structuredIndex(i    , j + 1, size.data());
-			auto cell = new QuadCell(id0 + 1, id1 + 1, id2 + 1, id3 + 1, m_grid);
-			cell->setId(static_cast<int> (m_cells.size()) + 1);
-			m_cells.push_back(cell);
+			addCell(Quad, id0 + 1, id1 + 1, id2 + 1, id3 + 1);
 		}
 	}
-
-	return IRIC_NO_ERROR;
 }
 
-int Grid2D::Impl::loadUnstructuredGrid(const iRICLib::H5CgnsZone& zone)
+void Grid2D::Impl::buildUnstructuredCells(const std::vector<int>& indices)
 {
-	std::vector<int> indices;
-	int ier = zone.readTriangleElements(&indices);
-	RETURN_IF_ERR;
+	size_t cellCount = indices.size() / 3;
+	m_cellTypes.reserve(cellCount);
+	m_cellNodeIds.reserve(cellCount * MAX_CELL_NODES);
 
-	for (int i = 0; i < static_cast<int> (indices.size()) / 3; ++i) {
+	for (int i = 0; i < static_cast<int> (cellCount); ++i) {
 		int id1 = indices.at(i * 3 + 0);
 		int id2 = indices.at(i * 3 + 1);
 		int id3 = indices.at(i * 3 + 2);
 
-		auto cell = new TriCell(id1, id2, id3, m_grid);
-		cell->setId(static_cast<int> (m_cells.size()) + 1);
-		m_cells.push_back(cell);
+		addCell(Triangle, id1, id2, id3, 0);
 	}
+}
 
-	return IRIC_NO_ERROR;
+void Grid2D::Impl::clearCells()
+{
+	for (size_t i = 0; i < m_cellViews.size(); ++i) {
+		delete m_cellViews.at(i);
+	}
+	m_cellViews.clear();
+
+	m_cellTypes.clear();
+	m_cellNodeIds.clear();
+	m_cellRects.clear();
+	m_cellNeighbors.clear();
 }
 
-void Grid2D::Impl::setupBackGrid()
+void Grid2D::Impl::addCell(CellType type, int id1, int id2, int id3, int id4)
+{
+	m_cellTypes.push_back(static_cast<unsigned char> (type));
+	m_cellNodeIds.push_back(id1 - 1);
+	m_cellNodeIds.push_back(id2 - 1);
+	m_cellNodeIds.push_back(id3 - 1);
+	m_cellNodeIds.push_back(type == Quad ? id4 - 1 : -1);
+}
+
+bool Grid2D::Impl::cellNodeIdsValid() const
 {
+	int nodeCount = static_cast<int> (m_nodes.size());
+	for (size_t i = 0; i < m_cellTypes.size(); ++i) {
+		const int* ids = m_cellNodeIds.data() + i * MAX_CELL_NODES;
+		for (int j = 0; j < m_cellTypes[i]; ++j) {
+			if (ids[j] < 0 || ids[j] >= nodeCount) {return false;}
+		}
+	}
+	return true;
+}
+
+void Grid2D::Impl::updateCellBoundingRects()
+{
+	int cellCount = static_cast<int> (m_cellTypes.size());
+	m_cellRects.resize(cellCount);
+
+	runParallel(cellCount, [this](int begin, int end) {
+		for (int i = begin; i < end; ++i) {
+			const int* ids = m_cellNodeIds.data() + i * MAX_CELL_NODES;
+			int nodeCount = m_cellTypes[i];
+
+			const Point2D& p0 = m_nodes[ids[0]];
+			CellRect& r = m_cellRects[i];
+			r.xMin = p0.x(); r.xMax = p0.x(); r.yMin = p0.y(); r.yMax = p0.y();
+			for (int j = 1; j < nodeCount; ++j) {
+				const Point2D& p = m_nodes[ids[j]];
+				if (r.xMin > p.x()) {r.xMin = p.x();}
+				if (r.xMax < p.x()) {r.xMax = p.x();}
+				if (r.yMin > p.y()) {r.yMin = p.y();}
+				if (r.yMax < p.y()) {r.yMax = p.y();}
+			}
+		}
+	});
+}
+
+void Grid2D::Impl::setupSpatialIndex()
+{
+	// node ids are checked here, because the worker threads below must not throw
+	if (! cellNodeIdsValid()) {
+		throw std::out_of_range("Grid2D::setupSpatialIndex");
+	}
+
+	// cell adjacency does not depend on the index, so it is set up on another thread
+	std::thread neighborBuilder([this]() {
+		setupCellNeighbors();
+	});
+
+	updateCellBoundingRects();
+
 	m_backGridX.clear();
 	m_backGridY.clear();
-	m_backGridCells.clear();
+	m_backGridCellOffsets.clear();
+	m_backGridCellIndices.clear();
+	m_bvhNodes.clear();
+	m_bvhCellIndices.clear();
+	m_bvhCellRects.clear();
+
+	if (m_spatialIndex == SpatialIndex::BVH) {
+		setupBvh();
+	} else {
+		setupBackGrid();
+	}
+
+	neighborBuilder.join();
+	m_spatialIndexReady = true;
+}
+
+void Grid2D::Impl::ensureSpatialIndex() const
+{
+	if (m_spatialIndexReady) {return;}
+
+	std::lock_guard<std::mutex> lock(m_spatialIndexMutex);
+	if (m_spatialIndexReady) {return;}
 
-	Rect2D rect = m_grid->boundingRect();
-	size_t numCells = m_grid->cellCount();
+	const_cast<Impl*> (this)->setupSpatialIndex();
+}
+
+void Grid2D::Impl::invalidateSpatialIndex()
+{
+	m_spatialIndexReady = false;
+}
+
+void Grid2D::Impl::setupCellNeighbors()
+{
+	size_t cellCount = m_cellTypes.size();
+	m_cellNeighbors.assign(cellCount * MAX_CELL_NODES, -1);
+
+	// group edges by their smaller node id, so that the two sides of an edge fall in the same bucket.
+	std::vector<int> offsets(m_nodes.size() + 1, 0);
+	for (size_t i = 0; i < cellCount; ++i) {
+		const int* ids = m_cellNodeIds.data() + i * MAX_CELL_NODES;
+		int nodeCount = m_cellTypes[i];
+		for (int j = 0; j < nodeCount; ++j) {
+			++ offsets[(std::min)(ids[j], ids[(j + 1) % nodeCount]) + 1];
+		}
+	}
+	for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+		offsets[i + 1] += offsets[i];
+	}
+	std::vector<int> slots(offsets.back());
+	std::vector<int> pos(offsets.begin(), offsets.end() - 1);
+	for (size_t i = 0; i < cellCount; ++i) {
+		const int* ids = m_cellNodeIds.data() + i * MAX_CELL_NODES;
+		int nodeCount = m_cellTypes[i];
+		for (int j = 0; j < nodeCount; ++j) {
+			slots[pos[(std::min)(ids[j], ids[(j + 1) % nodeCount])] ++] = static_cast<int> (i * MAX_CELL_NODES + j);
+		}
+	}
+
+	// buckets hold only a few edges, so pairs are found by comparing the other node ids directly.
+	auto otherNode = [this](int slot) {
+		const int* ids = m_cellNodeIds.data() + (slot / MAX_CELL_NODES) * MAX_CELL_NODES;
+		int nodeCount = m_cellTypes[slot / MAX_CELL_NODES];
+		int j = slot % MAX_CELL_NODES;
+		return (std::max)(ids[j], ids[(j + 1) % nodeCount]);
+	};
+	for (size_t n = 0; n + 1 < offsets.size(); ++n) {
+		for (int a = offsets[n]; a < offsets[n + 1]; ++a) {
+			int slot1 = slots[a];
+			if (m_cellNeighbors[slot1] != -1) {continue;}
+
+			int node1 = otherNode(slot1);
+			for (int b = a + 1; b < offsets[n + 1]; ++b) {
+				int slot2 = slots[b];
+				if (m_cellNeighbors[slot2] != -1 || otherNode(slot2) != node1) {continue;}
+
+				m_cellNeighbors[slot1] = slot2 / MAX_CELL_NODES;
+				m_cellNeighbors[slot2] = slot1 / MAX_CELL_NODES;
+				break;
+			}
+		}
+	}
+}
+
+void Grid2D::Impl::setupBackGrid()
+{
+	m_backGridX.clear();
+	m_backGridY.clear();
+	m_backGridCellOffsets.clear();
+	m_backGridCellIndices.clear();
+
+	// same as m_grid->boundingRect(), but without going through the nodes again
+	Rect2D rect;
+	for (size_t i = 0; i < m_cellRects.size(); ++i) {
+		const CellRect& r = m_cellRects[i];
+		if (i == 0 || rect.xMin() > r.xMin) {rect.setXMin(r.xMin);}
+		if (i == 0 || rect.xMax() < r.xMax) {rect.setXMax(r.xMax);}
+		if (i == 0 || rect.yMin() > r.yMin) {rect.setYMin(r.yMin);}
+		if (i == 0 || rect.yMax() < r.yMax) {rect.setYMax(r.yMax);}
+	}
+	size_t numCells = m_cellRects.size();
 	int divNum = static_cast<int> (std::sqrt(static_cast<double>(numCells) / 4));
 	if (divNum == 0) {divNum = 1;}
 
@@ -128,40 +350,333 @@ void Grid2D::Impl::setupBackGrid()
 	m_backGridX.push_back(rect.xMax());
 	m_backGridY.push_back(rect.yMax());
 
-	std::vector<Cell2D*> emptyVec;
-	for (int i = 0; i < divNum; ++i) {
-		for (int j = 0; j < divNum; ++j) {
-			m_backGridCells.push_back(emptyVec);
+	// count cells in each back grid cell first, then fill the indices.
+	size_t bgXCount = m_backGridX.size() - 1;
+	std::vector<int> counts(bgXCount * (m_backGridY.size() - 1), 0);
+
+	for (int pass = 0; pass < 2; ++pass) {
+		if (pass == 1) {
+			m_backGridCellOffsets.assign(counts.size() + 1, 0);
+			for (size_t i = 0; i < counts.size(); ++i) {
+				m_backGridCellOffsets[i + 1] = m_backGridCellOffsets[i] + counts[i];
+				counts[i] = m_backGridCellOffsets[i];
+			}
+			m_backGridCellIndices.assign(m_backGridCellOffsets.back(), 0);
+		}
+		for (size_t i = 0; i < m_cellTypes.size(); ++i) {
+			size_t x_begin, x_end, y_begin, y_end;
+			backGridRange(m_backGridX, xDelta, m_cellRects[i].xMin, m_cellRects[i].xMax, &x_begin, &x_end);
+			backGridRange(m_backGridY, yDelta, m_cellRects[i].yMin, m_cellRects[i].yMax, &y_begin, &y_end);
+
+			for (size_t x_idx = x_begin; x_idx < x_end; ++x_idx) {
+				for (size_t y_idx = y_begin; y_idx < y_end; ++y_idx) {
+					size_t idx = x_idx + y_idx * bgXCount;
+					if (pass == 0) {
+						++ counts[idx];
+					} else {
+						m_backGridCellIndices[counts[idx] ++] = static_cast<int> (i);
+					}
+				}
+			}
 		}
 	}
+}
 
-	for (size_t i = 0; i < m_cells.size(); ++i) {
-		Cell2D* cell = m_cells.at(i);
-		Rect2D rect = cell->boundingRect();
+void Grid2D::Impl::setupBvh()
+{
+	size_t cellCount = m_cellTypes.size();
+	if (cellCount == 0) {return;}
+
+	// cells are sorted together with their bounding rects, so that the build does not jump around in memory
+	std::vector<BvhItem> items(cellCount);
+	for (size_t i = 0; i < cellCount; ++i) {
+		items[i].rect = m_cellRects[i];
+		items[i].cellIndex = static_cast<int> (i);
+	}
 
-		std::vector<double>::const_iterator x_lb = std::lower_bound(m_backGridX.begin(), m_backGridX.end(), rect.xMin());
-		if (*x_lb != rect.xMin() && x_lb != m_backGridX.begin()) {--x_lb;}
+	m_bvhNodes.reserve(cellCount / BVH_LEAF_SIZE + 1);
+	if (cellCount <= BVH_LEAF_SIZE) {
+		// a root with a single leaf
+		BvhNode root;
+		setupBvhChild(&items, &root, 0, 0, static_cast<int> (cellCount));
+		setupBvhChild(&items, &root, 1, 0, 0);
+		m_bvhNodes.push_back(root);
+	} else {
+		buildBvhNode(&items, 0, static_cast<int> (cellCount));
+	}
 
-		std::vector<double>::const_iterator x_ub = std::lower_bound(m_backGridX.begin(), m_backGridX.end(), rect.xMax());
+	// leaves refer to ranges of these arrays
+	m_bvhCellIndices.resize(cellCount);
+	m_bvhCellRects.resize(cellCount);
+	for (size_t i = 0; i < cellCount; ++i) {
+		m_bvhCellIndices[i] = items[i].cellIndex;
+		m_bvhCellRects[i] = items[i].rect;
+	}
+}
 
-		std::vector<double>::const_iterator y_lb = std::lower_bound(m_backGridY.begin(), m_backGridY.end(), rect.yMin());
-		if (*y_lb != rect.yMin() && y_lb != m_backGridY.begin()) {--y_lb;}
+int Grid2D::Impl::buildBvhNode(std::vector<BvhItem>* items, int begin, int end)
+{
+	int nodeIndex = static_cast<int> (m_bvhNodes.size());
+	m_bvhNodes.push_back(BvhNode());
+
+	// split at the median of cell centers, along the longer axis
+	double cxmin = 0, cxmax = 0, cymin = 0, cymax = 0;
+	for (int i = begin; i < end; ++i) {
+		const CellRect& r = (*items)[i].rect;
+		double cx = r.xMin + r.xMax;
+		double cy = r.yMin + r.yMax;
+		if (i == begin || cx < cxmin) {cxmin = cx;}
+		if (i == begin || cx > cxmax) {cxmax = cx;}
+		if (i == begin || cy < cymin) {cymin = cy;}
+		if (i == begin || cy > cymax) {cymax = cy;}
+	}
+	bool splitX = (cxmax - cxmin) >= (cymax - cymin);
+	int mid = begin + (end - begin) / 2;
+	std::nth_element(items->begin() + begin, items->begin() + mid, items->begin() + end,
+		[splitX](const BvhItem& a, const BvhItem& b) {
+			if (splitX) {
+				return a.rect.xMin + a.rect.xMax < b.rect.xMin + b.rect.xMax;
+			} else {
+				return a.rect.yMin + a.rect.yMax < b.rect.yMin + b.rect.yMax;
+			}
+		});
 
-		std::vector<double>::const_iterator y_ub = std::lower_bound(m_backGridY.begin(), m_backGridY.end(), rect.yMax());
+	BvhNode node;
+	setupBvhChild(items, &node, 0, begin, mid);
+	setupBvhChild(items, &node, 1, mid, end);
+	m_bvhNodes[nodeIndex] = node;
+
+	return nodeIndex;
+}
+
+void Grid2D::Impl::setupBvhChild(std::vector<BvhItem>* items, BvhNode* node, int child, int begin, int end)
+{
+	if (begin == end) {
+		// empty child, never contains any point
+		node->xMin[child] = 1; node->xMax[child] = 0;
+		node->yMin[child] = 1; node->yMax[child] = 0;
+		node->index[child] = 0;
+		node->count[child] = 0;
+		return;
+	}
 
-		for (std::vector<double>::const_iterator xit = x_lb; xit != x_ub; ++xit) {
-			size_t x_idx = xit - m_backGridX.begin();
-			for (std::vector<double>::const_iterator yit = y_lb; yit != y_ub; ++yit) {
-				size_t y_idx = yit - m_backGridY.begin();
+	double xmin = 0, xmax = 0, ymin = 0, ymax = 0;
+	for (int i = begin; i < end; ++i) {
+		const CellRect& r = (*items)[i].rect;
+		if (i == begin || r.xMin < xmin) {xmin = r.xMin;}
+		if (i == begin || r.xMax > xmax) {xmax = r.xMax;}
+		if (i == begin || r.yMin < ymin) {ymin = r.yMin;}
+		if (i == begin || r.yMax > ymax) {ymax = r.yMax;}
+	}
+	// boxes are stored in float to keep nodes small, so round them outward.
+	node->xMin[child] = roundDown(xmin);
+	node->xMax[child] = roundUp(xmax);
+	node->yMin[child] = roundDown(ymin);
+	node->yMax[child] = roundUp(ymax);
+
+	if (end - begin <= BVH_LEAF_SIZE) {
+		node->index[child] = begin;
+		node->count[child] = end - begin;
+	} else {
+		node->index[child] = buildBvhNode(items, begin, end);
+		node->count[child] = 0;
+	}
+}
+
+float Grid2D::Impl::roundDown(double v)
+{
+	float f = static_cast<float> (v);
+	if (f > v) {f = std::nextafter(f, - std::numeric_limits<float>::infinity());}
+	return f;
+}
 
-				size_t idx = x_idx + y_idx * (m_backGridX.size() - 1);
-				m_backGridCells[idx].push_back(cell);
+float Grid2D::Impl::roundUp(double v)
+{
+	float f = static_cast<float> (v);
+	if (f < v) {f = std::nextafter(f, std::numeric_limits<float>::infinity());}
+	return f;
+}
+
+int Grid2D::Impl::locateBvh(double x, double y, double* weights) const
+{
+	if (m_bvhNodes.size() == 0) {return -1;}
+
+	int stack[BVH_MAX_DEPTH];
+	int stackSize = 0;
+	stack[stackSize ++] = 0;
+
+	while (stackSize > 0) {
+		const BvhNode& node = m_bvhNodes[stack[-- stackSize]];
+		for (int child = 0; child < 2; ++child) {
+			if (x < node.xMin[child] || x > node.xMax[child] || y < node.yMin[child] || y > node.yMax[child]) {continue;}
+
+			if (node.count[child] == 0) {
+				stack[stackSize ++] = node.index[child];
+				continue;
+			}
+			for (int i = node.index[child]; i < node.index[child] + node.count[child]; ++i) {
+				const CellRect& r = m_bvhCellRects[i];
+				if (x < r.xMin || x > r.xMax || y < r.yMin || y > r.yMax) {continue;}
+
+				int cellIndex = m_bvhCellIndices[i];
+				if (interpolateCell(cellIndex, x, y, weights)) {return cellIndex;}
+			}
+		}
+	}
+	return -1;
+}
+
+bool Grid2D::Impl::findBackGridCell(const Point2D& point, size_t* bgCellIdx) const
+{
+	if (m_backGridCellOffsets.size() == 0) {return false;}
+
+	std::vector<double>::const_iterator lb_x = std::lower_bound(m_backGridX.begin(), m_backGridX.end(), point.x());
+	if (lb_x == m_backGridX.end()) {return false;}
+	if (*lb_x != point.x() && lb_x != m_backGridX.begin()) {-- lb_x;}
+	if (lb_x + 1 == m_backGridX.end() && lb_x != m_backGridX.begin()) {-- lb_x;}
+
+	std::vector<double>::const_iterator lb_y = std::lower_bound(m_backGridY.begin(), m_backGridY.end(), point.y());
+	if (lb_y == m_backGridY.end()) {return false;}
+	if (*lb_y != point.y() && lb_y != m_backGridY.begin()) {--lb_y;}
+	if (lb_y + 1 == m_backGridY.end() && lb_y != m_backGridY.begin()) {-- lb_y;}
+
+	*bgCellIdx = (lb_x - m_backGridX.begin()) +
+			(lb_y - m_backGridY.begin()) * (m_backGridX.size() - 1);
+	return true;
+}
+
+int Grid2D::Impl::copyCellNodeIds(int cellIndex, int* nodeIds) const
+{
+	int nodeCount = m_cellTypes[cellIndex];
+	const int* ids = m_cellNodeIds.data() + cellIndex * MAX_CELL_NODES;
+	for (int j = 0; j < nodeCount; ++j) {
+		*(nodeIds + j) = ids[j] + 1;
+	}
+	return nodeCount;
+}
+
+bool Grid2D::Impl::interpolateCell(int cellIndex, double x, double y, double* weights) const
+{
+	const CellRect& r = m_cellRects[cellIndex];
+	if (x < r.xMin || x > r.xMax || y < r.yMin || y > r.yMax) {
+		return false;
+	}
+
+	const int* ids = m_cellNodeIds.data() + cellIndex * MAX_CELL_NODES;
+	if (m_cellTypes[cellIndex] == Triangle) {
+		return CellInterpolation::triangle(x, y, m_nodes[ids[0]], m_nodes[ids[1]], m_nodes[ids[2]], weights);
+	} else {
+		return CellInterpolation::quad(x, y, m_nodes[ids[0]], m_nodes[ids[1]], m_nodes[ids[2]], m_nodes[ids[3]], weights);
+	}
+}
+
+int Grid2D::Impl::locate(double x, double y, double* weights) const
+{
+	if (m_spatialIndex == SpatialIndex::BVH) {
+		return locateBvh(x, y, weights);
+	}
+
+	size_t bgCellIdx;
+	if (! findBackGridCell(Point2D(x, y), &bgCellIdx)) {return -1;}
+
+	const int* indices = m_backGridCellIndices.data();
+	for (int i = m_backGridCellOffsets[bgCellIdx]; i < m_backGridCellOffsets[bgCellIdx + 1]; ++i) {
+		int cellIndex = indices[i];
+		if (interpolateCell(cellIndex, x, y, weights)) {return cellIndex;}
+	}
+	return -1;
+}
+
+int Grid2D::Impl::locate(double x, double y, int hintCellIndex, double* weights) const
+{
+	if (hintCellIndex >= 0 && hintCellIndex < static_cast<int> (m_cellTypes.size()) && m_cellNeighbors.size() != 0) {
+		int cellIndex = walk(hintCellIndex, x, y, weights);
+		if (cellIndex >= 0) {return cellIndex;}
+	}
+	return locate(x, y, weights);
+}
+
+int Grid2D::Impl::walk(int startCellIndex, double x, double y, double* weights) const
+{
+	int cellIndex = startCellIndex;
+	int prevCellIndex = -1;
+
+	for (int step = 0; step < MAX_WALK_STEPS; ++step) {
+		if (interpolateCell(cellIndex, x, y, weights)) {return cellIndex;}
+
+		const int* ids = m_cellNodeIds.data() + cellIndex * MAX_CELL_NODES;
+		int nodeCount = m_cellTypes[cellIndex];
+
+		// orientation of the cell, to tell on which side of an edge the point is
+		double area2 = 0;
+		for (int j = 0; j < nodeCount; ++j) {
+			const Point2D& p1 = m_nodes[ids[j]];
+			const Point2D& p2 = m_nodes[ids[(j + 1) % nodeCount]];
+			area2 += p1 * p2;
+		}
+		double orientation = (area2 < 0) ? -1 : 1;
+
+		// move across the edge the point is farthest outside of
+		int nextCellIndex = -1;
+		double maxDistance = 0;
+		for (int j = 0; j < nodeCount; ++j) {
+			int neighbor = m_cellNeighbors[cellIndex * MAX_CELL_NODES + j];
+			if (neighbor == prevCellIndex) {continue;}
+
+			const Point2D& p1 = m_nodes[ids[j]];
+			const Point2D& p2 = m_nodes[ids[(j + 1) % nodeCount]];
+			Point2D edge = p2 - p1;
+			double len = std::sqrt(edge.x() * edge.x() + edge.y() * edge.y());
+			if (len == 0) {continue;}
+
+			double distance = - orientation * (edge * (Point2D(x, y) - p1)) / len;
+			if (distance > maxDistance) {
+				maxDistance = distance;
+				nextCellIndex = neighbor;
 			}
 		}
+		// the point is outside of the grid, or the walk got stuck
+		if (nextCellIndex < 0) {return -1;}
+
+		prevCellIndex = cellIndex;
+		cellIndex = nextCellIndex;
 	}
+	return -1;
 }
 
-int Grid2D::Impl::structuredIndex(int i, int j, int* size) const
+int Grid2D::Impl::workerCount(int count) const
+{
+	int workers = m_threadCount;
+	if (workers == 0) {
+		workers = static_cast<int> (std::thread::hardware_concurrency());
+	}
+	workers = (std::min)(workers, count / MIN_POINTS_PER_THREAD);
+	return (std::max)(1, workers);
+}
+
+Cell2D* Grid2D::Impl::cellView(int cellIndex) const
+{
+	std::lock_guard<std::mutex> lock(m_cellViewsMutex);
+
+	if (m_cellViews.size() != m_cellTypes.size()) {
+		m_cellViews.resize(m_cellTypes.size(), nullptr);
+	}
+	Cell2D* view = m_cellViews.at(cellIndex);
+	if (view != nullptr) {return view;}
+
+	const int* ids = m_cellNodeIds.data() + cellIndex * MAX_CELL_NODES;
+	if (m_cellTypes[cellIndex] == Triangle) {
+		view = new TriCell(ids[0] + 1, ids[1] + 1, ids[2] + 1, m_grid);
+	} else {
+		view = new QuadCell(ids[0] + 1, ids[1] + 1, ids[2] + 1, ids[3] + 1, m_grid);
+	}
+	view->setId(cellIndex + 1);
+	m_cellViews[cellIndex] = view;
+
+	return view;
+}
+
+int Grid2D::Impl::structuredIndex(int i, int j, const int* size) const
 {
 	return i + j * (*size);
 }
@@ -196,31 +711,12 @@ int Grid2D::load(int fid, int gid, int solid)
 	RETURN_IF_ERR;
 
 	zone->setSolutionId(solid);
-	auto coords = zone->gridCoordinatesForSolution();
-	impl->loadNodes(coords);
-	ier = impl->loadNodes(coords);
-	RETURN_IF_ERR;
-
-	ier = impl->loadCells(*zone);
-	RETURN_IF_ERR;
-
-	impl->setupBackGrid();
-
-	return IRIC_NO_ERROR;
+	return impl->load(*zone, zone->gridCoordinatesForSolution());
 }
 
 int Grid2D::load(iRICLib::H5CgnsZone* zone)
 {
-	auto coords = zone->gridCoordinates();
-	int ier = impl->loadNodes(coords);
-	RETURN_IF_ERR;
-
-	ier = impl->loadCells(*zone);
-	RETURN_IF_ERR;
-
-	impl->setupBackGrid();
-
-	return IRIC_NO_ERROR;
+	return impl->load(*zone, zone->gridCoordinates());
 }
 
 int Grid2D::nodeCount() const
@@ -235,85 +731,141 @@ Point2D Grid2D::node(int nodeId) const
 
 int Grid2D::cellCount() const
 {
-	return static_cast<int> (impl->m_cells.size());
+	return static_cast<int> (impl->m_cellTypes.size());
 }
 
 Cell2D* Grid2D::cell(int cellId) const
 {
-	return impl->m_cells.at(cellId - 1);
+	if (cellId < 1 || cellId > cellCount()) {
+		throw std::out_of_range("Grid2D::cell");
+	}
+	return impl->cellView(cellId - 1);
 }
 
 Rect2D Grid2D::boundingRect() const
 {
-	Rect2D ret;
-	for (int i = 0; i < static_cast<int> (impl->m_cells.size()); ++i) {
-		Rect2D cellRect = impl->m_cells.at(i)->boundingRect();
-		if (i == 0) {
-			ret = cellRect;
-		} else {
-			ret = ret + cellRect;
+	double xmin = 0, xmax = 0, ymin = 0, ymax = 0;
+	bool first = true;
+	for (size_t i = 0; i < impl->m_cellTypes.size(); ++i) {
+		const int* ids = impl->m_cellNodeIds.data() + i * Impl::MAX_CELL_NODES;
+		for (int j = 0; j < impl->m_cellTypes[i]; ++j) {
+			const Point2D& p = impl->m_nodes.at(ids[j]);
+			if (first || xmin > p.x()) {xmin = p.x();}
+			if (first || xmax < p.x()) {xmax = p.x();}
+			if (first || ymin > p.y()) {ymin = p.y();}
+			if (first || ymax < p.y()) {ymax = p.y();}
+			first = false;
 		}
 	}
-	return ret;
+	if (first) {return Rect2D();}
+
+	return Rect2D(xmin, xmax, ymin, ymax);
 }
 
 bool Grid2D::findCell(const Point2D& point, int* cellId) const
 {
-	std::vector<double>::iterator lb_x = std::lower_bound(impl->m_backGridX.begin(), impl->m_backGridX.end(), point.x());
-	if (lb_x == impl->m_backGridX.end()) {return false;}
-	if (*lb_x != point.x() && lb_x != impl->m_backGridX.begin()) {-- lb_x;}
-
-	std::vector<double>::iterator lb_y = std::lower_bound(impl->m_backGridY.begin(), impl->m_backGridY.end(), point.y());
-	if (lb_y == impl->m_backGridY.end()) {return false;}
-	if (*lb_y != point.y() && lb_y != impl->m_backGridY.begin()) {--lb_y;}
-
-	size_t bgCellIdx = (lb_x - impl->m_backGridX.begin()) +
-			(lb_y - impl->m_backGridY.begin()) * (impl->m_backGridX.size() - 1);
-
-	const std::vector<Cell2D*>& cells = impl->m_backGridCells.at(bgCellIdx);
-	for (int i = 0; i < static_cast<int> (cells.size()); ++i) {
-		Cell2D* cell = cells.at(i);
-		int nodeCount = cell->nodeCount();
-		std::vector<double> weights(nodeCount, 0);
-		bool ok = cell->interpolate(point, weights.data());
-		if (ok) {
-			*cellId = cell->id();
-			return true;
-		}
-	}
-	return false;
+	double weights[Impl::MAX_CELL_NODES];
+	impl->ensureSpatialIndex();
+	int cellIndex = impl->locate(point.x(), point.y(), weights);
+	if (cellIndex < 0) {return false;}
+
+	*cellId = cellIndex + 1;
+	return true;
 }
 
 bool Grid2D::interpolate(const Point2D& point, int *count, int* nodeIds, double* weight) const
 {
-	std::vector<double>::iterator lb_x = std::lower_bound(impl->m_backGridX.begin(), impl->m_backGridX.end(), point.x());
-	if (lb_x == impl->m_backGridX.end()) {return false;}
-	if (*lb_x != point.x() && lb_x != impl->m_backGridX.begin()) {-- lb_x;}
-
-	std::vector<double>::iterator lb_y = std::lower_bound(impl->m_backGridY.begin(), impl->m_backGridY.end(), point.y());
-	if (lb_y == impl->m_backGridY.end()) {return false;}
-	if (*lb_y != point.y() && lb_y != impl->m_backGridY.begin()) {--lb_y;}
-
-	size_t bgCellIdx = (lb_x - impl->m_backGridX.begin()) +
-			(lb_y - impl->m_backGridY.begin()) * (impl->m_backGridX.size() - 1);
-
-	const std::vector<Cell2D*>& cells = impl->m_backGridCells.at(bgCellIdx);
-	for (int i = 0; i < static_cast<int> (cells.size()); ++i) {
-		Cell2D* cell = cells.at(i);
-		*count = cell->nodeCount();
-		bool ok = cell->interpolate(point, weight);
-		if (ok) {
-			for (int j = 0; j < cell->nodeCount(); ++j) {
-				*(nodeIds + j) = cell->nodeId(j + 1);
+	impl->ensureSpatialIndex();
+	int cellIndex = impl->locate(point.x(), point.y(), weight);
+	if (cellIndex < 0) {return false;}
+
+	*count = impl->copyCellNodeIds(cellIndex, nodeIds);
+	return true;
+}
+
+bool Grid2D::findCell(const Point2D& point, int hintCellId, int* cellId) const
+{
+	double weights[Impl::MAX_CELL_NODES];
+	impl->ensureSpatialIndex();
+	int cellIndex = impl->locate(point.x(), point.y(), hintCellId - 1, weights);
+	if (cellIndex < 0) {return false;}
+
+	*cellId = cellIndex + 1;
+	return true;
+}
+
+bool Grid2D::interpolate(const Point2D& point, int hintCellId, int* cellId, int *count, int* nodeIds, double* weight) const
+{
+	impl->ensureSpatialIndex();
+	int cellIndex = impl->locate(point.x(), point.y(), hintCellId - 1, weight);
+	if (cellIndex < 0) {return false;}
+
+	*cellId = cellIndex + 1;
+	*count = impl->copyCellNodeIds(cellIndex, nodeIds);
+	return true;
+}
+
+void Grid2D::findCells(int count, const double* x, const double* y, int* cellIds) const
+{
+	impl->ensureSpatialIndex();
+	impl->runParallel(count, [=](int begin, int end) {
+		double weights[Impl::MAX_CELL_NODES];
+		for (int i = begin; i < end; ++i) {
+			*(cellIds + i) = impl->locate(*(x + i), *(y + i), weights) + 1;
+		}
+	});
+}
+
+void Grid2D::interpolate(int count, const double* x, const double* y, int* ok, int* nodeCounts, int* nodeIds, double* weights) const
+{
+	impl->ensureSpatialIndex();
+	impl->runParallel(count, [=](int begin, int end) {
+		for (int i = begin; i < end; ++i) {
+			int* pointNodeIds = nodeIds + i * Impl::MAX_CELL_NODES;
+			double* pointWeights = weights + i * Impl::MAX_CELL_NODES;
+			for (int j = 0; j < Impl::MAX_CELL_NODES; ++j) {
+				*(pointNodeIds + j) = 0;
+				*(pointWeights + j) = 0;
 			}
-			return true;
+
+			int cellIndex = impl->locate(*(x + i), *(y + i), pointWeights);
+			if (cellIndex < 0) {
+				*(ok + i) = 0;
+				*(nodeCounts + i) = 0;
+				continue;
+			}
+			*(ok + i) = 1;
+			*(nodeCounts + i) = impl->copyCellNodeIds(cellIndex, pointNodeIds);
 		}
-	}
-	return false;
+	});
+}
+
+Grid2D::SpatialIndex Grid2D::spatialIndex() const
+{
+	return impl->m_spatialIndex;
+}
+
+void Grid2D::setSpatialIndex(SpatialIndex index)
+{
+	if (impl->m_spatialIndex == index) {return;}
+
+	impl->m_spatialIndex = index;
+	impl->invalidateSpatialIndex();
+}
+
+int Grid2D::threadCount() const
+{
+	return impl->m_threadCount;
+}
+
+void Grid2D::setThreadCount(int count)
+{
+	impl->m_threadCount = (std::max)(0, count);
 }
 
 void Grid2D::addNode(const Point2D& p)
 {
+	impl->invalidateSpatialIndex();
 	impl->m_nodes.push_back(p);
 }
 
@@ -324,15 +876,17 @@ void Grid2D::addNode(double x, double y)
 
 void Grid2D::addTriCell(int id1, int id2, int id3)
 {
-	impl->m_cells.push_back(new TriCell(id1, id2, id3, this));
+	impl->invalidateSpatialIndex();
+	impl->addCell(Impl::Triangle, id1, id2, id3, 0);
 }
 
 void Grid2D::addQuadCell(int id1, int id2, int id3, int id4)
 {
-	impl->m_cells.push_back(new QuadCell(id1, id2, id3, id4, this));
+	impl->invalidateSpatialIndex();
+	impl->addCell(Impl::Quad, id1, id2, id3, id4);
 }
 
 void Grid2D::setupBackGrid()
 {
-	impl->setupBackGrid();
+	impl->setupSpatialIndex();
 }
@@ -16,6 +16,12 @@ class Rect2D;
 class IRICLIBDLL Grid2D
 {
 public:
+	// BVH (bounding volume hierarchy) keeps query cost stable on strongly graded or anisotropic grids
+	enum class SpatialIndex {
+		BackGrid,
+		BVH
+	};
+
 	Grid2D();
 	~Grid2D();
 
@@ -32,7 +38,24 @@ public:
 	Rect2D boundingRect() const;
 
 	bool findCell(const Point2D& point, int* cellId) const;
+	// walks from hintCellId toward point, and uses the back grid only when the walk fails.
+	bool findCell(const Point2D& point, int hintCellId, int* cellId) const;
 	bool interpolate(const Point2D& point, int *count, int* nodeIds, double* weight) const;
+	bool interpolate(const Point2D& point, int hintCellId, int* cellId, int *count, int* nodeIds, double* weight) const;
+
+	// batch versions. cellIds is 0 for points outside the grid.
+	// nodeIds and weights have 4 slots per point, unused slots are set to 0.
+	void findCells(int count, const double* x, const double* y, int* cellIds) const;
+	void interpolate(int count, const double* x, const double* y, int* ok, int* nodeCounts, int* nodeIds, double* weights) const;
+
+	// index used by findCell() and interpolate(). it is built on the first query after load(),
+	// or when setupBackGrid() is called.
+	SpatialIndex spatialIndex() const;
+	void setSpatialIndex(SpatialIndex index);
+
+	// number of threads used by batch queries. 0 means number of cores.
+	int threadCount() const;
+	void setThreadCount(int count);
 
 	void addNode(const Point2D& p);
 	void addNode(double x, double y);
@@ -40,6 +63,7 @@ public:
 	void addTriCell(int id1, int id2, int id3);
 	void addQuadCell(int id1, int id2, int id3, int id4);
 
+	// builds the spatial index now, instead of on the first query
 	void setupBackGrid();
 
 private:
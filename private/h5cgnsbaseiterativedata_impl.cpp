@@ -58,6 +58,7 @@ int H5CgnsBaseIterativeData::Impl::readAllValues()
 			_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsBaseIterativeData::Impl::readValues", ier);
 			RETURN_IF_ERR;
 
+			m_writtenCounts[name] = vals.size();
 			m_intValues.insert({name, vals});
 		} else if (type == H5Util::DataArrayValueType::RealDouble) {
 			std::vector<double> vals;
@@ -66,6 +67,7 @@ int H5CgnsBaseIterativeData::Impl::readAllValues()
 			_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsBaseIterativeData::Impl::readValues", ier);
 			RETURN_IF_ERR;
 
+			m_writtenCounts[name] = vals.size();
 			m_realValues.insert({name, vals});
 		} else if (type == H5Util::DataArrayValueType::Char) {
 			std::vector<std::string> vals;
@@ -74,6 +76,7 @@ int H5CgnsBaseIterativeData::Impl::readAllValues()
 			_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsBaseIterativeData::Impl::readValues", ier);
 			RETURN_IF_ERR;
 
+			m_writtenCounts[name] = vals.size();
 			m_stringValues.insert({name, vals});
 		}
 	}
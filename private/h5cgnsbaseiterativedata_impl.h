@@ -26,6 +26,9 @@ public:
 	std::map<std::string, std::vector<double> > m_realValues;
 	std::map<std::string, std::vector<std::string> > m_stringValues;
 
+	// number of values already written to the file, for each name
+	std::map<std::string, size_t> m_writtenCounts;
+
 private:
 	H5CgnsBaseIterativeData* m_data;
 };
@@ -1,6 +1,7 @@
 #include "../h5cgnsbase.h"
 #include "../h5cgnsfilesolutionreader.h"
 #include "../h5cgnsfilesolutionwriter.h"
+#include "../h5propertylistcloser.h"
 #include "../h5util.h"
 #include "../iriclib_errorcodes.h"
 
@@ -18,9 +19,12 @@ using namespace iRICLib;
 
 H5CgnsFile::Impl::Impl(H5CgnsFile* file) :
 	m_ccBase {nullptr},
+	m_swmr {false},
+	m_swmrWriting {false},
 	m_solutionReader {nullptr},
 	m_solutionWriter {nullptr},
 	m_writerMode {H5CgnsFileSolutionWriter::Mode::Standard},
+	m_particleBinLevel {0},
 	m_file {file}
 {}
 
@@ -53,6 +57,8 @@ int H5CgnsFile::Impl::close()
 	m_baseMap.clear();
 	m_zones.clear();
 
+	H5Util::clearStoragePolicy(m_fileId);
+
 	_IRIC_LOGGER_TRACE_CALL_START("H5Fclose");
 	herr_t status = H5Fclose(m_fileId);
 	_IRIC_LOGGER_TRACE_CALL_END("H5Fclose");
@@ -153,3 +159,70 @@ int H5CgnsFile::Impl::getGridId(H5CgnsZone* zone, int* gridId)
 
 	return IRIC_GRID_NOT_FOUND;
 }
+
+hid_t H5CgnsFile::Impl::createFileAccessProperty(bool usePageBuffer) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pcreate");
+	hid_t fileAccessProperty = H5Pcreate(H5P_FILE_ACCESS);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pcreate");
+	if (fileAccessProperty < 0) {
+		_iric_logger_error("H5CgnsFile::Impl::createFileAccessProperty", "H5Pcreate", fileAccessProperty);
+		return fileAccessProperty;
+	}
+
+	// page buffering is not used with SWMR. settings that failed are left as HDF5 defaults
+	m_accessProfile.setupAccessProperty(fileAccessProperty, usePageBuffer && ! m_swmr);
+
+	if (! m_swmr || m_mode == Mode::OpenReadOnly) {
+		return fileAccessProperty;
+	}
+
+	// data arrays are created with chunk indices that can be appended while being read
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pset_libver_bounds");
+	herr_t status = H5Pset_libver_bounds(fileAccessProperty, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pset_libver_bounds");
+	if (status < 0) {
+		_iric_logger_error("H5CgnsFile::Impl::createFileAccessProperty", "H5Pset_libver_bounds", status);
+	}
+
+	return fileAccessProperty;
+}
+
+hid_t H5CgnsFile::Impl::openFile() const
+{
+	hid_t fileId;
+	if (m_accessProfile.pageBufferSize() != 0 && ! m_swmr) {
+		// page buffering can be used only for files created with paged file space strategy,
+		// so when opening fails the file is opened again without it
+		hid_t fileAccessProperty = createFileAccessProperty(true);
+		H5PropertyListCloser fileAccessPropertyCloser(fileAccessProperty);
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5Fopen");
+		H5E_BEGIN_TRY {
+			fileId = H5Fopen(m_fileName.c_str(), openFlags(), fileAccessProperty);
+		} H5E_END_TRY;
+		_IRIC_LOGGER_TRACE_CALL_END("H5Fopen");
+
+		if (fileId >= 0) {return fileId;}
+	}
+
+	hid_t fileAccessProperty = createFileAccessProperty(false);
+	H5PropertyListCloser fileAccessPropertyCloser(fileAccessProperty);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Fopen");
+	fileId = H5Fopen(m_fileName.c_str(), openFlags(), fileAccessProperty);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Fopen");
+
+	return fileId;
+}
+
+unsigned int H5CgnsFile::Impl::openFlags() const
+{
+	if (m_mode != Mode::OpenReadOnly) {
+		return H5F_ACC_RDWR;
+	}
+	if (m_swmr) {
+		return H5F_ACC_RDONLY | H5F_ACC_SWMR_READ;
+	}
+	return H5F_ACC_RDONLY;
+}
@@ -4,6 +4,8 @@
 #include "../h5cgnsfile.h"
 #include "../h5cgnsfilesolutionwriter.h"
 #include "../h5cgnszone.h"
+#include "../h5datasetstoragepolicy.h"
+#include "../h5fileaccessprofile.h"
 
 #include <hdf5.h>
 
@@ -27,6 +29,10 @@ public:
 	static std::string baseName(int dimension);
 
 	void loadZones();
+
+	hid_t createFileAccessProperty(bool usePageBuffer) const;
+	hid_t openFile() const;
+	unsigned int openFlags() const;
 	int getGridId(H5CgnsZone* zone, int* gridId);
 
 	std::vector<H5CgnsBase*> m_bases;
@@ -39,10 +45,16 @@ public:
 	Mode m_mode;
 	std::string m_fileName;
 	std::string m_resultFolder;
+	bool m_swmr;
+	bool m_swmrWriting;
 
 	H5CgnsFileSolutionReader* m_solutionReader;
 	H5CgnsFileSolutionWriter* m_solutionWriter;
 	H5CgnsFileSolutionWriter::Mode m_writerMode;
+	H5DatasetStoragePolicy m_storagePolicy;
+	H5FileAccessProfile m_accessProfile;
+	std::string m_particleGroupTrajectoryIdName;
+	int m_particleBinLevel;
 
 	H5CgnsFile* m_file;
 };
@@ -10,6 +10,8 @@
 
 #include <Poco/File.h>
 
+#include <hdf5.h>
+
 #include <algorithm>
 #include <sstream>
 
@@ -20,12 +22,17 @@ H5CgnsFileSolutionReader::Impl::Impl(H5CgnsFileSolutionReader* reader) :
 	m_file {nullptr},
 	m_targetFile {nullptr},
 	m_solutionId {0},
+	m_cacheCapacity {1},
+	m_cacheHitCount {0},
+	m_cacheMissCount {0},
+	m_prefetchEnabled {false},
+	m_prefetchSolutionId {0},
 	m_reader {reader}
 {}
 
 H5CgnsFileSolutionReader::Impl::~Impl()
 {
-	delete m_targetFile;
+	clearCache();
 }
 
 int H5CgnsFileSolutionReader::Impl::setSolutionId(int id)
@@ -80,21 +87,116 @@ int H5CgnsFileSolutionReader::Impl::setSolutionIdSeparate(int id)
 {
 	if (m_solutionId == id) {return IRIC_NO_ERROR;}
 
-	delete m_targetFile;
+	collectPrefetch();
+
+	auto file = takeCachedFile(id);
+	if (file != nullptr) {
+		++ m_cacheHitCount;
+	} else {
+		++ m_cacheMissCount;
+
+		auto Fname = H5CgnsFileSeparateSolutionUtil::fileNameForSolution(m_file->resultFolder(), id);
+		try {
+			file = new H5CgnsFile(Fname, H5CgnsFile::Mode::OpenReadOnly, "result", false, m_file->accessProfile());
+			_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::setSolutionId");
+			int ier = file->setSolutionId(1);
+			_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::setSolutionId", ier);
+		} catch (...) {
+			std::ostringstream ss;
+			ss << "In H5CgnsFileSolutionReader::Impl::setSolutionIdSeparate(), opening " << Fname << " failed";
+			_iric_logger_error(ss.str());
+
+			m_targetFile = nullptr;
+			m_solutionId = 0;
+			return IRIC_H5_CREATE_FAIL;
+		}
+		m_cachedFiles.push_front(std::make_pair(id, file));
+	}
+
+	m_targetFile = file;
+	m_solutionId = id;
+	shrinkCache();
+
+	if (m_prefetchEnabled) {
+		startPrefetch(id + 1);
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+void H5CgnsFileSolutionReader::Impl::shrinkCache()
+{
+	while (static_cast<int> (m_cachedFiles.size()) > m_cacheCapacity) {
+		delete m_cachedFiles.back().second;
+		m_cachedFiles.pop_back();
+	}
+}
+
+void H5CgnsFileSolutionReader::Impl::clearCache()
+{
+	collectPrefetch();
+
+	for (const auto& pair : m_cachedFiles) {
+		delete pair.second;
+	}
+	m_cachedFiles.clear();
+
 	m_targetFile = nullptr;
+	m_solutionId = 0;
+}
+
+H5CgnsFile* H5CgnsFileSolutionReader::Impl::takeCachedFile(int id)
+{
+	for (auto it = m_cachedFiles.begin(); it != m_cachedFiles.end(); ++it) {
+		if (it->first != id) {continue;}
+
+		m_cachedFiles.splice(m_cachedFiles.begin(), m_cachedFiles, it);
+		return it->second;
+	}
+	return nullptr;
+}
+
+void H5CgnsFileSolutionReader::Impl::collectPrefetch()
+{
+	if (! m_prefetchFile.valid()) {return;}
+
+	auto file = m_prefetchFile.get();
+	if (file == nullptr) {return;}
+
+	m_cachedFiles.push_front(std::make_pair(m_prefetchSolutionId, file));
+}
+
+void H5CgnsFileSolutionReader::Impl::startPrefetch(int id)
+{
+	for (const auto& pair : m_cachedFiles) {
+		if (pair.first == id) {return;}
+	}
 
-	auto Fname = H5CgnsFileSeparateSolutionUtil::fileNameForSolution(m_file->resultFolder(), id);
-	try {
-		m_targetFile = new H5CgnsFile(Fname, H5CgnsFile::Mode::OpenReadOnly);
-		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::setSolutionId");
-		int ier = m_targetFile->setSolutionId(1);
-		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::setSolutionId", ier);
-		m_solutionId = id;
-		return IRIC_NO_ERROR;
-	} catch (...) {
-		std::ostringstream ss;
-		ss << "In H5CgnsFileSolutionReader::Impl::setSolutionIdSeparate(), opening " << Fname << " failed";
-		_iric_logger_error(ss.str());
-		return IRIC_H5_CREATE_FAIL;
+	auto fName = H5CgnsFileSeparateSolutionUtil::fileNameForSolution(m_file->resultFolder(), id);
+	if (! Poco::File(fName).exists()) {return;}
+
+	m_prefetchSolutionId = id;
+
+	hbool_t threadSafe = false;
+	H5is_library_threadsafe(&threadSafe);
+
+	if (threadSafe) {
+		auto profile = m_file->accessProfile();
+		m_prefetchFile = std::async(std::launch::async, [fName, profile]() -> H5CgnsFile* {
+			try {
+				auto file = new H5CgnsFile(fName, H5CgnsFile::Mode::OpenReadOnly, "result", false, profile);
+				file->setSolutionId(1);
+				return file;
+			} catch (...) {
+				return nullptr;
+			}
+		});
+	} else {
+		// HDF5 may not be called from two threads. Only read the file into the OS cache,
+		// so that opening it with HDF5 does not wait for the disk.
+		m_prefetchFile = std::async(std::launch::async, [fName]() -> H5CgnsFile* {
+			H5CgnsFileSeparateSolutionUtil::readAhead(fName);
+			return nullptr;
+		});
 	}
 }
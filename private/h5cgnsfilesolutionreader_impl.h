@@ -3,6 +3,10 @@
 
 #include "../h5cgnsfilesolutionreader.h"
 
+#include <future>
+#include <list>
+#include <utility>
+
 namespace iRICLib {
 
 class H5CgnsFileSolutionReader::Impl
@@ -14,6 +18,9 @@ public:
 	int setSolutionId(int id);
 	void detectMode();
 
+	void shrinkCache();
+	void clearCache();
+
 	Mode m_mode;
 
 	H5CgnsFile* m_file;
@@ -21,10 +28,24 @@ public:
 
 	int m_solutionId;
 
+	// opened solution files, most recently used first. m_targetFile is the first one.
+	std::list<std::pair<int, H5CgnsFile*> > m_cachedFiles;
+	int m_cacheCapacity;
+	int m_cacheHitCount;
+	int m_cacheMissCount;
+
+	bool m_prefetchEnabled;
+	int m_prefetchSolutionId;
+	std::future<H5CgnsFile*> m_prefetchFile;
+
 private:
 	int setSolutionIdStandard(int id);
 	int setSolutionIdSeparate(int id);
 
+	H5CgnsFile* takeCachedFile(int id);
+	void collectPrefetch();
+	void startPrefetch(int id);
+
 	H5CgnsFileSolutionReader* m_reader;
 };
 
@@ -9,6 +9,9 @@
 
 #include "h5cgnsfilesolutionwriter_impl.h"
 
+#include <Poco/Path.h>
+
+#include <chrono>
 #include <sstream>
 
 using namespace iRICLib;
@@ -16,11 +19,18 @@ using namespace iRICLib;
 H5CgnsFileSolutionWriter::Impl::Impl(H5CgnsFileSolutionWriter* writer) :
 	m_targetFile {nullptr},
 	m_solutionId {0},
+	m_asyncQueueSize {0},
+	m_asyncTaskRunning {false},
+	m_asyncStopping {false},
+	m_asyncError {IRIC_NO_ERROR},
+	m_asyncMaxQueueDepth {0},
+	m_asyncStallSeconds {0},
 	m_writer {writer}
 {}
 
 H5CgnsFileSolutionWriter::Impl::~Impl()
 {
+	stopAsyncThread();
 	delete m_targetFile;
 }
 
@@ -28,16 +38,20 @@ int H5CgnsFileSolutionWriter::Impl::writeSolStart()
 {
 	if (m_mode == Mode::Standard) {
 		return writeSolStartStandard();
-	} else if (m_mode == Mode::Separate) {
+	} else if (m_mode == Mode::Separate || m_mode == Mode::SeparateSharedGrid) {
 		return writeSolStartSeparate();
+	} else if (m_mode == Mode::SeparateSwmr) {
+		return writeSolStartSeparateSwmr();
 	}
+
+	return IRIC_NO_ERROR;
 }
 
 int H5CgnsFileSolutionWriter::Impl::writeTime(double time)
 {
 	if (m_mode == Mode::Standard) {
 		return writeTimeStandard(time);
-	} else if (m_mode == Mode::Separate) {
+	} else if (isSeparate()) {
 		return writeTimeSeparate(time);
 	}
 
@@ -48,7 +62,7 @@ int H5CgnsFileSolutionWriter::Impl::writeIteration(int iteration)
 {
 	if (m_mode == Mode::Standard) {
 		return writeIterationStandard(iteration);
-	} else if (m_mode == Mode::Separate) {
+	} else if (isSeparate()) {
 		return writeIterationSeparate(iteration);
 	}
 
@@ -60,7 +74,7 @@ int H5CgnsFileSolutionWriter::Impl::writeBaseIterativeData(const std::string& na
 	int ier = m_file->ccBase()->biterData()->writeData(name, value);
 	RETURN_IF_ERR;
 
-	if (m_mode == Mode::Separate) {
+	if (isSeparate()) {
 		ier = m_targetFile->ccBase()->biterData()->writeData(name, value);
 		RETURN_IF_ERR;
 	}
@@ -72,7 +86,7 @@ int H5CgnsFileSolutionWriter::Impl::writeBaseIterativeData(const std::string& na
 	int ier = m_file->ccBase()->biterData()->writeData(name, value);
 	RETURN_IF_ERR;
 
-	if (m_mode == Mode::Separate) {
+	if (isSeparate()) {
 		ier = m_targetFile->ccBase()->biterData()->writeData(name, value);
 		RETURN_IF_ERR;
 	}
@@ -84,13 +98,139 @@ int H5CgnsFileSolutionWriter::Impl::writeBaseIterativeData(const std::string& na
 	int ier = m_file->ccBase()->biterData()->writeData(name, value);
 	RETURN_IF_ERR;
 
-	if (m_mode == Mode::Separate) {
+	if (isSeparate()) {
 		ier = m_targetFile->ccBase()->biterData()->writeData(name, value);
 		RETURN_IF_ERR;
 	}
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsFileSolutionWriter::Impl::flushSwmr()
+{
+	// the solution file is complete before the main file tells readers that the step exists
+	delete m_targetFile;
+	m_targetFile = nullptr;
+
+	if (m_solutionId == 0) {return IRIC_NO_ERROR;}
+
+	int ier;
+	if (m_file->swmrWriting()) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::flush");
+		ier = m_file->flush();
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::flush", ier);
+		RETURN_IF_ERR;
+	} else {
+		// data arrays of the first step are created now, and only appended in the following steps
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::startSwmrWrite");
+		ier = m_file->startSwmrWrite();
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::startSwmrWrite", ier);
+		RETURN_IF_ERR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+bool H5CgnsFileSolutionWriter::Impl::isSeparate() const
+{
+	return m_mode == Mode::Separate || m_mode == Mode::SeparateSwmr || m_mode == Mode::SeparateSharedGrid;
+}
+
+int H5CgnsFileSolutionWriter::Impl::writeAsync(const std::function<int()>& task)
+{
+	if (m_asyncQueueSize == 0) {
+		return task();
+	}
+
+	std::unique_lock<std::mutex> lock(m_asyncMutex);
+
+	if (! m_asyncThread.joinable()) {
+		m_asyncStopping = false;
+		m_asyncThread = std::thread(&Impl::runAsyncTasks, this);
+	}
+
+	if (static_cast<int> (m_asyncTasks.size()) >= m_asyncQueueSize) {
+		// the solver is faster than the disk. wait until the background thread catches up.
+		auto start = std::chrono::steady_clock::now();
+		m_asyncTaskDone.wait(lock, [this] {return static_cast<int> (m_asyncTasks.size()) < m_asyncQueueSize;});
+		std::chrono::duration<double> stall = std::chrono::steady_clock::now() - start;
+		m_asyncStallSeconds += stall.count();
+	}
+
+	m_asyncTasks.push_back(task);
+	int depth = static_cast<int> (m_asyncTasks.size());
+	if (depth > m_asyncMaxQueueDepth) {
+		m_asyncMaxQueueDepth = depth;
+	}
+	m_asyncTaskAdded.notify_one();
+
+	// an error of a write done before is reported as soon as it is known
+	int ier = m_asyncError;
+	m_asyncError = IRIC_NO_ERROR;
+	return ier;
+}
+
+int H5CgnsFileSolutionWriter::Impl::waitForAsyncWrites()
+{
+	std::unique_lock<std::mutex> lock(m_asyncMutex);
+	m_asyncTaskDone.wait(lock, [this] {return m_asyncTasks.empty() && ! m_asyncTaskRunning;});
+
+	int ier = m_asyncError;
+	m_asyncError = IRIC_NO_ERROR;
+	return ier;
+}
+
+void H5CgnsFileSolutionWriter::Impl::drainAsyncWrites()
+{
+	std::unique_lock<std::mutex> lock(m_asyncMutex);
+	m_asyncTaskDone.wait(lock, [this] {return m_asyncTasks.empty() && ! m_asyncTaskRunning;});
+}
+
+void H5CgnsFileSolutionWriter::Impl::stopAsyncThread()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_asyncMutex);
+		if (! m_asyncThread.joinable()) {return;}
+
+		m_asyncStopping = true;
+	}
+	m_asyncTaskAdded.notify_one();
+	m_asyncThread.join();
+
+	if (m_asyncMaxQueueDepth > 0) {
+		std::ostringstream ss;
+		ss << "Background solution writer: max queue depth " << m_asyncMaxQueueDepth << ", stall time " << m_asyncStallSeconds << " sec";
+		_iric_logger_info(ss.str());
+	}
+}
+
+void H5CgnsFileSolutionWriter::Impl::runAsyncTasks()
+{
+	std::unique_lock<std::mutex> lock(m_asyncMutex);
+	while (true) {
+		m_asyncTaskAdded.wait(lock, [this] {return m_asyncStopping || ! m_asyncTasks.empty();});
+		// remaining tasks are written before the thread stops
+		if (m_asyncTasks.empty()) {return;}
+
+		auto task = m_asyncTasks.front();
+		m_asyncTasks.pop_front();
+		m_asyncTaskRunning = true;
+		lock.unlock();
+
+		int ier;
+		try {
+			ier = task();
+		} catch (...) {
+			ier = IRIC_H5_CALL_ERROR;
+		}
+
+		lock.lock();
+		m_asyncTaskRunning = false;
+		if (ier != IRIC_NO_ERROR && m_asyncError == IRIC_NO_ERROR) {
+			m_asyncError = ier;
+		}
+		m_asyncTaskDone.notify_all();
+	}
+}
 
 int H5CgnsFileSolutionWriter::Impl::writeSolStartStandard()
 {
@@ -107,13 +247,29 @@ int H5CgnsFileSolutionWriter::Impl::writeSolStartSeparate()
 
 	auto fName = H5CgnsFileSeparateSolutionUtil::fileNameForSolution(m_file->resultFolder(), m_solutionId);
 	try {
-		m_targetFile = new H5CgnsFile(fName, H5CgnsFile::Mode::Create);
+		m_targetFile = new H5CgnsFile(fName, H5CgnsFile::Mode::Create, "result", false, m_file->accessProfile());
 	} catch (...) {
 		std::ostringstream ss;
 		ss << "In H5CgnsFileSolutionWriter::Impl::writeIterationSeparate(), creating " << fName << " failed";
 		_iric_logger_error(ss.str());
 		return IRIC_H5_CREATE_FAIL;
 	}
+	m_targetFile->setStoragePolicy(m_file->storagePolicy());
+	m_targetFile->setParticleBinLevel(m_file->particleBinLevel());
+
+	if (m_mode == Mode::SeparateSharedGrid) {
+		if (m_solutionId == 1) {
+			// the grid file is written once for each run of the solver
+			ier = writeSharedGridFile();
+			RETURN_IF_ERR;
+		}
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::linkGridsTo");
+		ier = m_file->linkGridsTo(m_targetFile, H5CgnsFileSeparateSolutionUtil::sharedGridFileName());
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::linkGridsTo", ier);
+		RETURN_IF_ERR;
+
+		return IRIC_NO_ERROR;
+	}
 
 	_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::copyGrids");
 	ier = m_file->copyGridsTo(m_targetFile);
@@ -123,6 +279,44 @@ int H5CgnsFileSolutionWriter::Impl::writeSolStartSeparate()
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsFileSolutionWriter::Impl::writeSharedGridFile()
+{
+	auto fName = Poco::Path(m_file->resultFolder()).append(H5CgnsFileSeparateSolutionUtil::sharedGridFileName()).toString();
+	try {
+		H5CgnsFile gridFile(fName, H5CgnsFile::Mode::Create, "result", false, m_file->accessProfile());
+		gridFile.setStoragePolicy(m_file->storagePolicy());
+
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::copyGrids");
+		int ier = m_file->copyGridsTo(&gridFile);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::copyGrids", ier);
+		RETURN_IF_ERR;
+	} catch (...) {
+		std::ostringstream ss;
+		ss << "In H5CgnsFileSolutionWriter::Impl::writeSharedGridFile(), creating " << fName << " failed";
+		_iric_logger_error(ss.str());
+		return IRIC_H5_CREATE_FAIL;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsFileSolutionWriter::Impl::writeSolStartSeparateSwmr()
+{
+	int ier;
+	if (m_targetFile != nullptr) {
+		// cg_iRIC_Write_Sol_End() was not called for the last step
+		ier = flushSwmr();
+		RETURN_IF_ERR;
+	} else if (m_solutionId == 0 && ! m_file->swmrWriting()) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5CgnsFile::setupSwmrWrite");
+		ier = m_file->setupSwmrWrite();
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5CgnsFile::setupSwmrWrite", ier);
+		RETURN_IF_ERR;
+	}
+
+	return writeSolStartSeparate();
+}
+
 int H5CgnsFileSolutionWriter::Impl::writeTimeStandard(double time)
 {
 	return m_file->writeTime(time);
@@ -3,6 +3,12 @@
 
 #include "../h5cgnsfilesolutionwriter.h"
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 namespace iRICLib {
 
 class H5CgnsFileSolutionWriter::Impl
@@ -19,6 +25,14 @@ public:
 	int writeBaseIterativeData(const std::string& name, double value);
 	int writeBaseIterativeData(const std::string& name, const std::string value);
 
+	int flushSwmr();
+	bool isSeparate() const;
+
+	int writeAsync(const std::function<int()>& task);
+	int waitForAsyncWrites();
+	void drainAsyncWrites();
+	void stopAsyncThread();
+
 	Mode m_mode;
 
 	H5CgnsFile* m_file;
@@ -26,9 +40,26 @@ public:
 
 	int m_solutionId;
 
+	// writes queued for the background thread. 0 for m_asyncQueueSize means writing synchronously.
+	int m_asyncQueueSize;
+	std::deque<std::function<int()> > m_asyncTasks;
+	std::thread m_asyncThread;
+	std::mutex m_asyncMutex;
+	std::condition_variable m_asyncTaskAdded;
+	std::condition_variable m_asyncTaskDone;
+	// true while the background thread is running a task it has taken from m_asyncTasks
+	bool m_asyncTaskRunning;
+	bool m_asyncStopping;
+	// the first error returned by a background write, reported by the next barrier
+	int m_asyncError;
+	int m_asyncMaxQueueDepth;
+	double m_asyncStallSeconds;
+
 private:
 	int writeSolStartStandard();
 	int writeSolStartSeparate();
+	int writeSolStartSeparateSwmr();
+	int writeSharedGridFile();
 
 	int writeTimeStandard(double time);
 	int writeTimeSeparate(double time);
@@ -36,6 +67,8 @@ private:
 	int writeIterationStandard(int iteration);
 	int writeIterationSeparate(int iteration);
 
+	void runAsyncTasks();
+
 	H5CgnsFileSolutionWriter* m_writer;
 };
 
@@ -1,10 +1,15 @@
+#include "../error_macros.h"
 #include "../h5cgnsbase.h"
 #include "../h5cgnszone.h"
+#include "../h5util.h"
+#include "../iriclib_errorcodes.h"
 
 #include "../internal/iric_logger.h"
 
 #include "h5cgnsgridcoordinates_impl.h"
 
+#include <cctype>
+
 using namespace iRICLib;
 
 H5CgnsGridCoordinates::Impl::Impl() :
@@ -40,3 +45,71 @@ std::vector<hsize_t> H5CgnsGridCoordinates::Impl::dimensions() const
 		return ret;
 	}
 }
+
+int H5CgnsGridCoordinates::Impl::readCoordinates(const std::string& name, double* values, size_t count) const
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	int ier = H5Util::readDataArrayValue(m_groupId, name, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	if (ier == IRIC_NO_ERROR || ier == IRIC_WRONG_DATASIZE) {return ier;}
+
+	// older files have names like "coordinateX"
+	std::string lowerName = name;
+	lowerName[0] = static_cast<char> (std::tolower(lowerName[0]));
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValue");
+	ier = H5Util::readDataArrayValue(m_groupId, lowerName, values, count);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValue", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsGridCoordinates::Impl::readCoordinatesRegion(const std::string& name, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const
+{
+	// start, stride and count are in (i, j, k) order, and dimensions() are in reverse order
+	auto dims = dimensions();
+	if (start.size() != dims.size() || stride.size() != dims.size() || count.size() != dims.size()) {
+		_iric_logger_error("In H5CgnsGridCoordinates::Impl::readCoordinatesRegion(), the region dimension does not match the grid dimension");
+		return IRIC_WRONG_DATASIZE;
+	}
+	std::vector<hsize_t> start2(start.rbegin(), start.rend());
+	std::vector<hsize_t> stride2(stride.rbegin(), stride.rend());
+	std::vector<hsize_t> count2(count.rbegin(), count.rend());
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValueRegion");
+	int ier = H5Util::readDataArrayValueRegion(m_groupId, name, dims, start2, stride2, count2, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValueRegion", ier);
+	if (ier == IRIC_NO_ERROR || ier == IRIC_WRONG_DATASIZE) {return ier;}
+
+	// older files have names like "coordinateX"
+	std::string lowerName = name;
+	lowerName[0] = static_cast<char> (std::tolower(lowerName[0]));
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readDataArrayValueRegion");
+	ier = H5Util::readDataArrayValueRegion(m_groupId, lowerName, dims, start2, stride2, count2, values);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readDataArrayValueRegion", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsGridCoordinates::Impl::writeCoordinates(const std::string& name, const double* coords, size_t count) const
+{
+	auto dims = dimensions();
+	hsize_t size = 1;
+	for (hsize_t d : dims) {
+		size *= d;
+	}
+	if (count < size) {
+		_iric_logger_error("In H5CgnsGridCoordinates::Impl::writeCoordinates(), count is smaller than the node count");
+		return IRIC_WRONG_DATASIZE;
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createDataArray");
+	int ier = H5Util::createDataArray(m_groupId, name, coords, dims);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createDataArray", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
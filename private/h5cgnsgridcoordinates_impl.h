@@ -12,6 +12,9 @@ public:
 	~Impl();
 
 	std::vector<hsize_t> dimensions() const;
+	int readCoordinates(const std::string& name, double* values, size_t count) const;
+	int readCoordinatesRegion(const std::string& name, const std::vector<hsize_t>& start, const std::vector<hsize_t>& stride, const std::vector<hsize_t>& count, double* values) const;
+	int writeCoordinates(const std::string& name, const double* coords, size_t count) const;
 
 	std::string m_name;
 	hid_t m_groupId;
@@ -1,3 +1,11 @@
+#include "../error_macros.h"
+#include "../h5cgnsparticlegrouptrajectories.h"
+#include "../h5cgnszone.h"
+#include "../h5particlebins.h"
+#include "../iriclib_errorcodes.h"
+
+#include "../internal/iric_logger.h"
+
 #include "h5cgnsparticlegroupsolution_impl.h"
 
 using namespace iRICLib;
@@ -13,3 +21,67 @@ void H5CgnsParticleGroupSolution::Impl::clear()
 	m_intValues.clear();
 	m_realValues.clear();
 }
+
+std::vector<int>* H5CgnsParticleGroupSolution::Impl::intValues(const std::string& name)
+{
+	auto it = m_intValues.find(name);
+	if (it != m_intValues.end()) {return &(it->second);}
+
+	// values are written for each particle, so reserve for the particles already written
+	auto it2 = m_intValues.insert({name, std::vector<int>()});
+	it2.first->second.reserve(m_coordinateX.size());
+	return &(it2.first->second);
+}
+
+std::vector<double>* H5CgnsParticleGroupSolution::Impl::realValues(const std::string& name)
+{
+	auto it = m_realValues.find(name);
+	if (it != m_realValues.end()) {return &(it->second);}
+
+	auto it2 = m_realValues.insert({name, std::vector<double>()});
+	it2.first->second.reserve(m_coordinateX.size());
+	return &(it2.first->second);
+}
+
+H5CgnsParticleGroupTrajectories* H5CgnsParticleGroupSolution::Impl::trajectories(const std::string& groupName) const
+{
+	if (! m_zone->particleGroupTrajectoriesExists()) {return nullptr;}
+
+	auto t = m_zone->particleGroupTrajectories();
+	if (t == nullptr || ! t->stepExists(groupName, m_zone->solutionId())) {return nullptr;}
+
+	return t;
+}
+
+int H5CgnsParticleGroupSolution::Impl::writeBins(int level)
+{
+	auto count = m_coordinateX.size();
+	if (m_coordinateY.size() != count) {return IRIC_NO_ERROR;}
+
+	std::vector<double> box;
+	m_zone->readGridBoundingBox(&box);
+
+	std::vector<int> order, binCodes, binStarts;
+	H5ParticleBins::sort(m_coordinateX.data(), m_coordinateY.data(), count, level, &box, &order, &binCodes, &binStarts);
+
+	m_coordinateX = H5ParticleBins::sorted(order, m_coordinateX.data());
+	m_coordinateY = H5ParticleBins::sorted(order, m_coordinateY.data());
+	if (m_coordinateZ.size() == count) {
+		m_coordinateZ = H5ParticleBins::sorted(order, m_coordinateZ.data());
+	}
+	for (auto& pair : m_intValues) {
+		if (pair.second.size() != count) {continue;}
+		pair.second = H5ParticleBins::sorted(order, pair.second.data());
+	}
+	for (auto& pair : m_realValues) {
+		if (pair.second.size() != count) {continue;}
+		pair.second = H5ParticleBins::sorted(order, pair.second.data());
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5ParticleBins::write");
+	int ier = H5ParticleBins::write(m_groupId, m_groupName + "_coordinate", level, box, binCodes, binStarts);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5ParticleBins::write", ier);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
@@ -8,12 +8,21 @@
 
 namespace iRICLib {
 
+class H5CgnsParticleGroupTrajectories;
+
 class H5CgnsParticleGroupSolution::Impl
 {
 public:
 	Impl();
 	void clear();
 
+	std::vector<int>* intValues(const std::string& name);
+	std::vector<double>* realValues(const std::string& name);
+	// returns the trajectories of the zone when they have the group at the current step
+	H5CgnsParticleGroupTrajectories* trajectories(const std::string& groupName) const;
+	// sorts the particles into spatial bins, and writes the bin directory
+	int writeBins(int level);
+
 	std::string m_name;
 	std::string m_groupName;
 	std::vector<double> m_coordinateX;
@@ -0,0 +1,584 @@
+#include "../error_macros.h"
+#include "../h5groupcloser.h"
+#include "../iriclib_errorcodes.h"
+
+#include "../internal/iric_logger.h"
+
+#include "h5cgnsparticlegrouptrajectories_impl.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <sstream>
+#include <utility>
+
+using namespace iRICLib;
+
+namespace {
+
+// chunk size (in bytes) of the arrays that have a row for each particle of each step.
+// chunks are read as a whole, so they are kept small to read trajectories fast.
+const hsize_t ROW_CHUNK_SIZE = 65536;
+// chunk size (in bytes) of the arrays that have a value for each step
+const hsize_t STEP_CHUNK_SIZE = 4096;
+// number of the ids (and rows) held in memory while building the index, for all steps
+const hsize_t MERGE_BUFFER_SIZE = 1 << 22;
+// number of the index entries written at once while building the index
+const size_t INDEX_WRITE_SIZE = 1 << 20;
+
+const std::string STEPS = "Steps";
+const std::string COUNTS = "Counts";
+const std::string IDNAME = "IdName";
+const std::string COORDINATEX = "coordinateX";
+const std::string COORDINATEY = "coordinateY";
+const std::string COORDINATEZ = "coordinateZ";
+const std::string RUNIDS = "RunIds";
+const std::string RUNROWS = "RunRows";
+const std::string INDEXIDS = "IndexIds";
+const std::string INDEXCOUNTS = "IndexCounts";
+const std::string INDEXSTEPS = "IndexSteps";
+const std::string INDEXROWS = "IndexRows";
+const std::string INDEXEDSTEPS = "IndexedSteps";
+
+std::string valueName(const std::string& name)
+{
+	return std::string("__") + name;
+}
+
+int readRange(hid_t groupId, const std::string& name, hsize_t size, hsize_t start, hsize_t count, int* values)
+{
+	if (count == 0) {return IRIC_NO_ERROR;}
+
+	std::vector<hsize_t> dims(1, size), starts(1, start), strides(1, 1), counts(1, count);
+	return H5Util::readDataArrayValueRegion(groupId, name, dims, starts, strides, counts, values);
+}
+
+// sorts the rows of a step by the ids with a radix sort (16 bits per pass). The sort is stable,
+// so the rows of the same id stay in ascending order.
+void sortRowsById(const std::vector<int>& ids, std::vector<int>* sortedIds, std::vector<int>* rows)
+{
+	const size_t count = ids.size();
+	const unsigned int BUCKETS = 1 << 16;
+
+	std::vector<unsigned int> keys(count), keys2(count);
+	std::vector<int> rows2(count);
+	rows->resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		keys[i] = static_cast<unsigned int> (ids[i]) ^ 0x80000000u; // signed order
+		(*rows)[i] = static_cast<int> (i);
+	}
+
+	std::vector<size_t> offsets(BUCKETS);
+	for (int shift = 0; shift < 32; shift += 16) {
+		std::fill(offsets.begin(), offsets.end(), 0);
+		for (size_t i = 0; i < count; ++i) {
+			++offsets[(keys[i] >> shift) & (BUCKETS - 1)];
+		}
+		size_t sum = 0;
+		for (unsigned int b = 0; b < BUCKETS; ++b) {
+			size_t c = offsets[b];
+			offsets[b] = sum;
+			sum += c;
+		}
+		for (size_t i = 0; i < count; ++i) {
+			size_t& pos = offsets[(keys[i] >> shift) & (BUCKETS - 1)];
+			keys2[pos] = keys[i];
+			rows2[pos] = (*rows)[i];
+			++pos;
+		}
+		keys.swap(keys2);
+		rows->swap(rows2);
+	}
+
+	sortedIds->resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		(*sortedIds)[i] = static_cast<int> (keys[i] ^ 0x80000000u);
+	}
+}
+
+// the ids of a step, sorted, read in blocks while building the index
+class Run
+{
+public:
+	Run(hid_t groupId, hsize_t size, hsize_t start, hsize_t count, hsize_t bufferSize, int step) :
+		m_groupId {groupId},
+		m_size {size},
+		m_next {start},
+		m_end {start + count},
+		m_bufferSize {bufferSize},
+		m_pos {0},
+		m_step {step}
+	{}
+
+	bool atEnd() const
+	{
+		return m_pos == m_ids.size() && m_next == m_end;
+	}
+
+	int fill()
+	{
+		if (m_pos < m_ids.size() || m_next == m_end) {return IRIC_NO_ERROR;}
+
+		hsize_t count = (std::min)(m_bufferSize, m_end - m_next);
+		m_ids.assign(count, 0);
+		m_rows.assign(count, 0);
+		int ier = readRange(m_groupId, RUNIDS, m_size, m_next, count, m_ids.data());
+		RETURN_IF_ERR;
+		ier = readRange(m_groupId, RUNROWS, m_size, m_next, count, m_rows.data());
+		RETURN_IF_ERR;
+
+		m_next += count;
+		m_pos = 0;
+		return IRIC_NO_ERROR;
+	}
+
+	int id() const {return m_ids[m_pos];}
+	int row() const {return m_rows[m_pos];}
+	int step() const {return m_step;}
+	void next() {++ m_pos;}
+
+private:
+	hid_t m_groupId;
+	hsize_t m_size;
+	hsize_t m_next;
+	hsize_t m_end;
+	hsize_t m_bufferSize;
+	size_t m_pos;
+	int m_step;
+	std::vector<int> m_ids;
+	std::vector<int> m_rows;
+};
+
+} // namespace
+
+H5CgnsParticleGroupTrajectories::Impl::Group::Group() :
+	m_groupId {0},
+	m_indexedSteps {0},
+	m_indexLoaded {false}
+{}
+
+H5CgnsParticleGroupTrajectories::Impl::Group::~Group()
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Gclose");
+	herr_t status = H5Gclose(m_groupId);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Gclose");
+
+	if (status < 0) {
+		_iric_logger_error("H5CgnsParticleGroupTrajectories::Impl::Group::~Group", "H5Gclose", status);
+	}
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::Group::load()
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getLinkNames");
+	int ier = H5Util::getLinkNames(m_groupId, &m_names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getLinkNames", ier);
+	RETURN_IF_ERR;
+
+	if (m_names.find(STEPS) != m_names.end()) {
+		ier = H5Util::readDataArrayValue(m_groupId, STEPS, &m_steps);
+		RETURN_IF_ERR;
+		ier = H5Util::readDataArrayValue(m_groupId, COUNTS, &m_counts);
+		RETURN_IF_ERR;
+	}
+	// counts are written before steps, so steps tell the steps written completely
+	m_counts.resize(m_steps.size());
+
+	m_starts.assign(1, 0);
+	for (int c : m_counts) {
+		m_starts.push_back(m_starts.back() + c);
+	}
+
+	if (m_names.find(IDNAME) != m_names.end()) {
+		ier = H5Util::readDataArrayValue(m_groupId, IDNAME, &m_idName);
+		RETURN_IF_ERR;
+	}
+	if (m_names.find(INDEXEDSTEPS) != m_names.end()) {
+		std::vector<int> vals;
+		ier = H5Util::readDataArrayValue(m_groupId, INDEXEDSTEPS, &vals);
+		RETURN_IF_ERR;
+		if (vals.size() > 0) {
+			m_indexedSteps = (std::min)(vals[0], static_cast<int> (m_steps.size()));
+		}
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::Group::loadIndex()
+{
+	if (m_indexLoaded) {return IRIC_NO_ERROR;}
+
+	m_indexIds.clear();
+	m_indexStarts.assign(1, 0);
+
+	if (m_indexedSteps > 0) {
+		int ier = H5Util::readDataArrayValue(m_groupId, INDEXIDS, &m_indexIds);
+		RETURN_IF_ERR;
+
+		std::vector<int> counts;
+		ier = H5Util::readDataArrayValue(m_groupId, INDEXCOUNTS, &counts);
+		RETURN_IF_ERR;
+
+		if (counts.size() != m_indexIds.size()) {
+			_iric_logger_error("In H5CgnsParticleGroupTrajectories::Impl::Group::loadIndex(), the index is broken");
+			return IRIC_WRONG_DATASIZE;
+		}
+		m_indexStarts.reserve(counts.size() + 1);
+		for (int c : counts) {
+			m_indexStarts.push_back(m_indexStarts.back() + c);
+		}
+	}
+	m_indexLoaded = true;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::Group::stepIndex(int step) const
+{
+	auto it = std::lower_bound(m_steps.begin(), m_steps.end(), step);
+	if (it == m_steps.end() || *it != step) {return -1;}
+
+	return static_cast<int> (it - m_steps.begin());
+}
+
+hsize_t H5CgnsParticleGroupTrajectories::Impl::Group::rowCount() const
+{
+	return m_starts.back();
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::Group::appendStep(int step, const std::string& idName, const std::vector<double>& coordinateX, const std::vector<double>& coordinateY, const std::vector<double>& coordinateZ, const std::map<std::string, std::vector<int> >& intValues, const std::map<std::string, std::vector<double> >& realValues)
+{
+	if (m_steps.size() > 0 && step <= m_steps.back()) {
+		std::ostringstream ss;
+		ss << "In H5CgnsParticleGroupTrajectories::writeStep(), step " << step << " is not larger than the last step " << m_steps.back();
+		_iric_logger_error(ss.str());
+		return IRIC_INVALID_ARGUMENT;
+	}
+	if (m_idName.size() > 0 && m_idName != idName) {
+		std::ostringstream ss;
+		ss << "In H5CgnsParticleGroupTrajectories::writeStep(), id value " << idName << " is different from " << m_idName << " used for the steps already written";
+		_iric_logger_error(ss.str());
+		return IRIC_INVALID_ARGUMENT;
+	}
+	auto idIt = intValues.find(idName);
+	if (idIt == intValues.end()) {
+		std::ostringstream ss;
+		ss << "In H5CgnsParticleGroupTrajectories::writeStep(), id value " << idName << " is not written";
+		_iric_logger_error(ss.str());
+		return IRIC_DATA_NOT_FOUND;
+	}
+
+	size_t count = coordinateX.size();
+	bool sizeOk = (coordinateY.size() == count) && (coordinateZ.size() == 0 || coordinateZ.size() == count);
+	for (const auto& pair : intValues) {
+		sizeOk = sizeOk && (pair.second.size() == count);
+	}
+	for (const auto& pair : realValues) {
+		sizeOk = sizeOk && (pair.second.size() == count);
+	}
+	if (! sizeOk) {
+		_iric_logger_error("In H5CgnsParticleGroupTrajectories::writeStep(), the number of values is different from the number of particles");
+		return IRIC_WRONG_DATASIZE;
+	}
+
+	int ier;
+	if (m_idName.size() == 0) {
+		ier = H5Util::createDataArray(m_groupId, IDNAME, idName);
+		RETURN_IF_ERR;
+		m_names.insert(IDNAME);
+		m_idName = idName;
+	}
+
+	hsize_t written = rowCount();
+	ier = appendRows(step, idIt->second, coordinateX, coordinateY, coordinateZ, intValues, realValues);
+	if (ier != IRIC_NO_ERROR) {
+		// the arrays appended before the error are truncated, so that all arrays have the rows of the steps written
+		int ier2 = truncate(written, m_steps.size());
+		if (ier2 != IRIC_NO_ERROR) {
+			_iric_logger_error("H5CgnsParticleGroupTrajectories::Impl::Group::appendStep", "H5CgnsParticleGroupTrajectories::Impl::Group::truncate", ier2);
+		}
+		return ier;
+	}
+
+	m_steps.push_back(step);
+	m_counts.push_back(static_cast<int> (coordinateX.size()));
+	m_starts.push_back(written + coordinateX.size());
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::Group::appendRows(int step, const std::vector<int>& ids, const std::vector<double>& coordinateX, const std::vector<double>& coordinateY, const std::vector<double>& coordinateZ, const std::map<std::string, std::vector<int> >& intValues, const std::map<std::string, std::vector<double> >& realValues)
+{
+	size_t count = coordinateX.size();
+	hsize_t written = rowCount();
+
+	int ier = H5Util::appendDataArray(m_groupId, COORDINATEX, coordinateX.data(), count, ROW_CHUNK_SIZE, &m_names);
+	RETURN_IF_ERR;
+	ier = H5Util::appendDataArray(m_groupId, COORDINATEY, coordinateY.data(), count, ROW_CHUNK_SIZE, &m_names);
+	RETURN_IF_ERR;
+
+	// values that are not written in some steps are filled with zeros
+	bool zExists = (m_names.find(COORDINATEZ) != m_names.end());
+	if (coordinateZ.size() > 0) {
+		if (! zExists && written > 0) {
+			ier = appendZeros(COORDINATEZ, written, false);
+			RETURN_IF_ERR;
+		}
+		ier = H5Util::appendDataArray(m_groupId, COORDINATEZ, coordinateZ.data(), count, ROW_CHUNK_SIZE, &m_names);
+		RETURN_IF_ERR;
+	} else if (zExists) {
+		ier = appendZeros(COORDINATEZ, count, false);
+		RETURN_IF_ERR;
+	}
+
+	std::unordered_set<std::string> writtenNames;
+	for (const auto& pair : intValues) {
+		auto name = valueName(pair.first);
+		if (m_names.find(name) == m_names.end() && written > 0) {
+			ier = appendZeros(name, written, true);
+			RETURN_IF_ERR;
+		}
+		ier = H5Util::appendDataArray(m_groupId, name, pair.second.data(), count, ROW_CHUNK_SIZE, &m_names);
+		RETURN_IF_ERR;
+		writtenNames.insert(name);
+	}
+	for (const auto& pair : realValues) {
+		auto name = valueName(pair.first);
+		if (m_names.find(name) == m_names.end() && written > 0) {
+			ier = appendZeros(name, written, false);
+			RETURN_IF_ERR;
+		}
+		ier = H5Util::appendDataArray(m_groupId, name, pair.second.data(), count, ROW_CHUNK_SIZE, &m_names);
+		RETURN_IF_ERR;
+		writtenNames.insert(name);
+	}
+	std::vector<std::string> names(m_names.begin(), m_names.end());
+	for (const auto& name : names) {
+		if (name.substr(0, 2) != "__" || writtenNames.find(name) != writtenNames.end()) {continue;}
+
+		H5Util::DataArrayValueType type;
+		ier = H5Util::readDataArrayValueType(m_groupId, name, &type);
+		RETURN_IF_ERR;
+		ier = appendZeros(name, count, type == H5Util::DataArrayValueType::Int);
+		RETURN_IF_ERR;
+	}
+
+	// the ids of the step sorted, with the rows in the step. They are merged to build the index.
+	std::vector<int> sortedIds, rows;
+	sortRowsById(ids, &sortedIds, &rows);
+	ier = H5Util::appendDataArray(m_groupId, RUNIDS, sortedIds.data(), count, ROW_CHUNK_SIZE, &m_names);
+	RETURN_IF_ERR;
+	ier = H5Util::appendDataArray(m_groupId, RUNROWS, rows.data(), count, ROW_CHUNK_SIZE, &m_names);
+	RETURN_IF_ERR;
+
+	int c = static_cast<int> (count);
+	ier = H5Util::appendDataArray(m_groupId, COUNTS, &c, 1, STEP_CHUNK_SIZE, &m_names);
+	RETURN_IF_ERR;
+	ier = H5Util::appendDataArray(m_groupId, STEPS, &step, 1, STEP_CHUNK_SIZE, &m_names);
+	RETURN_IF_ERR;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::Group::truncate(hsize_t rows, hsize_t steps)
+{
+	for (const auto& name : m_names) {
+		hsize_t size;
+		if (name == STEPS || name == COUNTS) {
+			size = steps;
+		} else if (name == COORDINATEX || name == COORDINATEY || name == COORDINATEZ || name == RUNIDS || name == RUNROWS || name.substr(0, 2) == "__") {
+			size = rows;
+		} else {
+			continue;
+		}
+		int ier = H5Util::truncateDataArray(m_groupId, name, size);
+		RETURN_IF_ERR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::Group::appendZeros(const std::string& name, hsize_t count, bool isInt)
+{
+	const hsize_t blockSize = 1 << 20;
+	std::vector<int> intZeros;
+	std::vector<double> realZeros;
+	if (isInt) {
+		intZeros.assign(static_cast<size_t> ((std::min)(count, blockSize)), 0);
+	} else {
+		realZeros.assign(static_cast<size_t> ((std::min)(count, blockSize)), 0);
+	}
+
+	while (count > 0) {
+		size_t c = static_cast<size_t> ((std::min)(count, blockSize));
+		int ier;
+		if (isInt) {
+			ier = H5Util::appendDataArray(m_groupId, name, intZeros.data(), c, ROW_CHUNK_SIZE, &m_names);
+		} else {
+			ier = H5Util::appendDataArray(m_groupId, name, realZeros.data(), c, ROW_CHUNK_SIZE, &m_names);
+		}
+		RETURN_IF_ERR;
+		count -= c;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::Group::buildIndex()
+{
+	if (m_indexedSteps == static_cast<int> (m_steps.size())) {return IRIC_NO_ERROR;}
+
+	// the index is rebuilt from the sorted ids of all steps, with a k-way merge.
+	int ier = H5Util::updateOrCreateDataArray(m_groupId, INDEXEDSTEPS, std::vector<int>(1, 0), &m_names);
+	RETURN_IF_ERR;
+	m_indexedSteps = 0;
+	m_indexLoaded = false;
+
+	std::vector<std::string> indexNames = {INDEXIDS, INDEXCOUNTS, INDEXSTEPS, INDEXROWS};
+	for (const auto& name : indexNames) {
+		if (m_names.find(name) == m_names.end()) {continue;}
+
+		ier = H5Util::deleteData(m_groupId, name);
+		RETURN_IF_ERR;
+		m_names.erase(name);
+	}
+
+	hsize_t bufferSize = (std::max)(static_cast<hsize_t> (256), MERGE_BUFFER_SIZE / (std::max)(static_cast<hsize_t> (1), static_cast<hsize_t> (m_steps.size())));
+	std::vector<Run> runs;
+	runs.reserve(m_steps.size());
+	for (size_t i = 0; i < m_steps.size(); ++i) {
+		runs.push_back(Run(m_groupId, rowCount(), m_starts[i], m_counts[i], bufferSize, m_steps[i]));
+	}
+
+	// (id, run) in ascending order, so that the rows of an id are sorted by step
+	typedef std::pair<int, size_t> HeapItem;
+	std::priority_queue<HeapItem, std::vector<HeapItem>, std::greater<HeapItem> > heap;
+	for (size_t i = 0; i < runs.size(); ++i) {
+		ier = runs[i].fill();
+		RETURN_IF_ERR;
+		if (! runs[i].atEnd()) {heap.push(HeapItem(runs[i].id(), i));}
+	}
+
+	std::vector<int> ids, counts, steps, rows;
+	auto flushIds = [&]() {
+		int ier = H5Util::appendDataArray(m_groupId, INDEXIDS, ids.data(), ids.size(), ROW_CHUNK_SIZE, &m_names);
+		RETURN_IF_ERR;
+		ier = H5Util::appendDataArray(m_groupId, INDEXCOUNTS, counts.data(), counts.size(), ROW_CHUNK_SIZE, &m_names);
+		RETURN_IF_ERR;
+		ids.clear();
+		counts.clear();
+		return IRIC_NO_ERROR;
+	};
+	auto flushRows = [&]() {
+		int ier = H5Util::appendDataArray(m_groupId, INDEXSTEPS, steps.data(), steps.size(), ROW_CHUNK_SIZE, &m_names);
+		RETURN_IF_ERR;
+		ier = H5Util::appendDataArray(m_groupId, INDEXROWS, rows.data(), rows.size(), ROW_CHUNK_SIZE, &m_names);
+		RETURN_IF_ERR;
+		steps.clear();
+		rows.clear();
+		return IRIC_NO_ERROR;
+	};
+
+	while (! heap.empty()) {
+		auto item = heap.top();
+		heap.pop();
+		auto& run = runs[item.second];
+
+		if (ids.size() == 0 || ids.back() != item.first) {
+			if (ids.size() >= INDEX_WRITE_SIZE) {
+				ier = flushIds();
+				RETURN_IF_ERR;
+			}
+			ids.push_back(item.first);
+			counts.push_back(0);
+		}
+		++ counts.back();
+		steps.push_back(run.step());
+		rows.push_back(run.row());
+		if (rows.size() >= INDEX_WRITE_SIZE) {
+			ier = flushRows();
+			RETURN_IF_ERR;
+		}
+
+		run.next();
+		ier = run.fill();
+		RETURN_IF_ERR;
+		if (! run.atEnd()) {heap.push(HeapItem(run.id(), item.second));}
+	}
+	ier = flushIds();
+	RETURN_IF_ERR;
+	ier = flushRows();
+	RETURN_IF_ERR;
+
+	int indexedSteps = static_cast<int> (m_steps.size());
+	ier = H5Util::updateOrCreateDataArray(m_groupId, INDEXEDSTEPS, std::vector<int>(1, indexedSteps), &m_names);
+	RETURN_IF_ERR;
+	m_indexedSteps = indexedSteps;
+
+	return IRIC_NO_ERROR;
+}
+
+H5CgnsParticleGroupTrajectories::Impl::Impl() :
+	m_groupId {0},
+	m_zone {nullptr}
+{}
+
+H5CgnsParticleGroupTrajectories::Impl::~Impl()
+{
+	for (const auto& pair : m_groups) {
+		delete pair.second;
+	}
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::group(const std::string& groupName, Group** group) const
+{
+	auto it = m_groups.find(groupName);
+	if (it != m_groups.end()) {
+		*group = it->second;
+		return IRIC_NO_ERROR;
+	}
+
+	std::unordered_set<std::string> names;
+	int ier = H5Util::getLinkNames(m_groupId, &names);
+	RETURN_IF_ERR;
+	if (names.find(groupName) == names.end()) {return IRIC_DATA_NOT_FOUND;}
+
+	hid_t gId;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::openGroup");
+	ier = H5Util::openGroup(m_groupId, groupName, H5Util::userDefinedDataLabel(), &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::openGroup", ier);
+	RETURN_IF_ERR;
+
+	auto g = new Group();
+	g->m_groupId = gId;
+	ier = g->load();
+	if (ier != IRIC_NO_ERROR) {
+		delete g;
+		return ier;
+	}
+	m_groups.insert({groupName, g});
+	*group = g;
+
+	return IRIC_NO_ERROR;
+}
+
+int H5CgnsParticleGroupTrajectories::Impl::openOrCreateGroup(const std::string& groupName, Group** group)
+{
+	int ier = this->group(groupName, group);
+	if (ier != IRIC_DATA_NOT_FOUND) {return ier;}
+
+	hid_t gId;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createUserDefinedDataGroup");
+	ier = H5Util::createUserDefinedDataGroup(m_groupId, groupName, &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createUserDefinedDataGroup", ier);
+	RETURN_IF_ERR;
+
+	auto g = new Group();
+	g->m_groupId = gId;
+	g->m_starts.assign(1, 0);
+	m_groups.insert({groupName, g});
+	*group = g;
+
+	return IRIC_NO_ERROR;
+}
@@ -0,0 +1,67 @@
+#ifndef H5CGNSPARTICLEGROUPTRAJECTORIES_IMPL_H
+#define H5CGNSPARTICLEGROUPTRAJECTORIES_IMPL_H
+
+#include "../h5cgnsparticlegrouptrajectories.h"
+
+#include <map>
+#include <unordered_set>
+#include <vector>
+
+namespace iRICLib {
+
+class H5CgnsParticleGroupTrajectories::Impl
+{
+public:
+	// data of one particle group. Steps and counts are small, so they are kept in memory.
+	class Group
+	{
+	public:
+		Group();
+		~Group();
+
+		int load();
+		int loadIndex();
+		int stepIndex(int step) const;
+		hsize_t rowCount() const;
+
+		int appendStep(int step, const std::string& idName, const std::vector<double>& coordinateX, const std::vector<double>& coordinateY, const std::vector<double>& coordinateZ, const std::map<std::string, std::vector<int> >& intValues, const std::map<std::string, std::vector<double> >& realValues);
+		int appendRows(int step, const std::vector<int>& ids, const std::vector<double>& coordinateX, const std::vector<double>& coordinateY, const std::vector<double>& coordinateZ, const std::map<std::string, std::vector<int> >& intValues, const std::map<std::string, std::vector<double> >& realValues);
+		// truncates the arrays with rows to rows values, and the arrays with a value for each step to steps values
+		int truncate(hsize_t rows, hsize_t steps);
+		int appendZeros(const std::string& name, hsize_t count, bool isInt);
+		int buildIndex();
+
+		hid_t m_groupId;
+		std::string m_idName;
+		std::unordered_set<std::string> m_names;
+
+		std::vector<int> m_steps;
+		std::vector<int> m_counts;
+		std::vector<hsize_t> m_starts; // the first row of each step, and the row count at the end
+
+		int m_indexedSteps;
+		bool m_indexLoaded;
+		std::vector<int> m_indexIds;
+		std::vector<hsize_t> m_indexStarts;
+	};
+
+	Impl();
+	~Impl();
+
+	int group(const std::string& groupName, Group** group) const;
+	int openOrCreateGroup(const std::string& groupName, Group** group);
+
+	template <typename V>
+	int readStep(const std::string& groupName, int step, const std::string& name, V* values, size_t count) const;
+	template <typename V>
+	int readRows(const std::string& groupName, const std::string& name, const std::vector<hsize_t>& rows, V* values) const;
+
+	hid_t m_groupId;
+	mutable std::map<std::string, Group*> m_groups;
+
+	H5CgnsZone* m_zone;
+};
+
+} // namespace iRICLib
+
+#endif // H5CGNSPARTICLEGROUPTRAJECTORIES_IMPL_H
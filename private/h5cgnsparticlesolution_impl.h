@@ -13,6 +13,9 @@ public:
 	hid_t m_groupId;
 
 	H5CgnsZone* m_zone;
+
+	// the order of the particles sorted into bins by writeCoordinates()
+	std::vector<int> m_binOrder;
 };
 
 } // namespace iRICLib
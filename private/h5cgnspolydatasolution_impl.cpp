@@ -14,3 +14,24 @@ void H5CgnsPolyDataSolution::Impl::clear()
 	m_intValues.clear();
 	m_realValues.clear();
 }
+
+std::vector<int>* H5CgnsPolyDataSolution::Impl::intValues(const std::string& name)
+{
+	auto it = m_intValues.find(name);
+	if (it != m_intValues.end()) {return &(it->second);}
+
+	// values are written for each geometry, so reserve for the geometries already written
+	auto it2 = m_intValues.insert({name, std::vector<int>()});
+	it2.first->second.reserve(m_types.size());
+	return &(it2.first->second);
+}
+
+std::vector<double>* H5CgnsPolyDataSolution::Impl::realValues(const std::string& name)
+{
+	auto it = m_realValues.find(name);
+	if (it != m_realValues.end()) {return &(it->second);}
+
+	auto it2 = m_realValues.insert({name, std::vector<double>()});
+	it2.first->second.reserve(m_types.size());
+	return &(it2.first->second);
+}
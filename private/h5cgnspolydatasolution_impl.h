@@ -14,6 +14,9 @@ public:
 	Impl();
 	void clear();
 
+	std::vector<int>* intValues(const std::string& name);
+	std::vector<double>* realValues(const std::string& name);
+
 	std::string m_name;
 	std::string m_groupName;
 	std::vector<double> m_coordinateX;
@@ -11,6 +11,7 @@
 #include "../h5cgnsnodeflowsolution.h"
 #include "../h5cgnsparticlegroupimagesolution.h"
 #include "../h5cgnsparticlegroupsolution.h"
+#include "../h5cgnsparticlegrouptrajectories.h"
 #include "../h5cgnsparticlesolution.h"
 #include "../h5cgnspolydatasolution.h"
 #include "../h5cgnszone.h"
@@ -88,6 +89,7 @@ H5CgnsZone::Impl::Impl(H5CgnsZone* zone) :
 	m_particleGroupImageSolution {nullptr},
 	m_particleSolution {nullptr},
 	m_polyDataSolution {nullptr},
+	m_particleGroupTrajectories {nullptr},
 	m_base {nullptr},
 	m_zone {zone}
 {}
@@ -172,9 +174,9 @@ void H5CgnsZone::Impl::writeSizeAndType()
 
 void H5CgnsZone::Impl::loadNames()
 {
-	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getGroupNames");
-	int ier = H5Util::getGroupNames(m_groupId, &m_names);
-	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getGroupNames", ier);
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getLinkNames");
+	int ier = H5Util::getLinkNames(m_groupId, &m_names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getLinkNames", ier);
 }
 
 void H5CgnsZone::Impl::loadFlowSolutionPointerNames()
@@ -187,9 +189,9 @@ void H5CgnsZone::Impl::loadFlowSolutionPointerNames()
 
 	H5GroupCloser closer(gId);
 
-	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getGroupNames");
-	ier = H5Util::getGroupNames(gId, &m_flowSolutionPointerNames);
-	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getGroupNames", ier);
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getLinkNames");
+	ier = H5Util::getLinkNames(gId, &m_flowSolutionPointerNames);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getLinkNames", ier);
 }
 
 int H5CgnsZone::Impl::getSolutionExists(bool* exists) const
@@ -221,6 +223,69 @@ H5CgnsGridCoordinates* H5CgnsZone::Impl::createGridCoordinates()
 	return new H5CgnsGridCoordinates(GRIDCOORDINATES_NAME, gId, m_zone);
 }
 
+int H5CgnsZone::Impl::linkGroup(const std::string& fileName, const std::string& name)
+{
+	_IRIC_LOGGER_TRACE_CALL_START("H5Iget_name");
+	ssize_t len = H5Iget_name(m_groupId, nullptr, 0);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Iget_name");
+	if (len < 0) {
+		_iric_logger_error("H5CgnsZone::Impl::linkGroup", "H5Iget_name", static_cast<int> (len));
+		return IRIC_H5_CALL_ERROR;
+	}
+	std::vector<char> buffer(len + 1);
+	H5Iget_name(m_groupId, buffer.data(), buffer.size());
+	std::string path = buffer.data();
+	path.append("/").append(name);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Lexists");
+	htri_t exists = H5Lexists(m_groupId, name.c_str(), H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Lexists");
+	if (exists > 0) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Ldelete");
+		herr_t status = H5Ldelete(m_groupId, name.c_str(), H5P_DEFAULT);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Ldelete");
+		if (status < 0) {
+			_iric_logger_error("H5CgnsZone::Impl::linkGroup", "H5Ldelete", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Lcreate_external");
+	herr_t status = H5Lcreate_external(fileName.c_str(), path.c_str(), m_groupId, name.c_str(), H5P_DEFAULT, H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Lcreate_external");
+	if (status < 0) {
+		_iric_logger_error("H5CgnsZone::Impl::linkGroup", "H5Lcreate_external", status);
+		return IRIC_H5_CALL_ERROR;
+	}
+	m_names.insert(name);
+
+	return IRIC_NO_ERROR;
+}
+
+H5CgnsGridCoordinates* H5CgnsZone::Impl::openLinkedGridCoordinates()
+{
+	// the linked grid is shared by many files, so it is opened read only even from files being written
+	_IRIC_LOGGER_TRACE_CALL_START("H5Pcreate");
+	hid_t lapl = H5Pcreate(H5P_LINK_ACCESS);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Pcreate");
+	if (lapl < 0) {
+		_iric_logger_error("H5CgnsZone::Impl::openLinkedGridCoordinates", "H5Pcreate", lapl);
+		return nullptr;
+	}
+	H5Pset_elink_acc_flags(lapl, H5F_ACC_RDONLY);
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Gopen2");
+	hid_t gId = H5Gopen2(m_groupId, GRIDCOORDINATES_NAME, lapl);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Gopen2");
+	H5Pclose(lapl);
+	if (gId < 0) {
+		_iric_logger_error("H5CgnsZone::Impl::openLinkedGridCoordinates", "H5Gopen2", gId);
+		return nullptr;
+	}
+
+	return new H5CgnsGridCoordinates(GRIDCOORDINATES_NAME, gId, m_zone);
+}
+
 H5CgnsGridAttributes* H5CgnsZone::Impl::openOrCreateGridAttributes()
 {
 	hid_t gId;
@@ -283,6 +348,7 @@ void H5CgnsZone::Impl::createZoneIterativeData()
 	int ier = H5Util::createGroup(m_groupId, ZONEITERATIVEDATA_NAME, ZONEITERATIVEDATA_LABEL, H5Util::userDefinedDataType(), &gId);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createGroup", ier);
 	if (ier != IRIC_NO_ERROR) {return;}
+	m_names.insert(ZONEITERATIVEDATA_NAME);
 
 	H5GroupCloser closer(gId);
 }
@@ -320,6 +386,7 @@ H5CgnsGridCoordinates* H5CgnsZone::Impl::createGridCoordinatesForSolution()
 	int ier = H5Util::createGroup(m_groupId, name, H5CgnsGridCoordinates::label(), H5Util::userDefinedDataType(), &gId);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createGroup", ier);
 	if (ier != IRIC_NO_ERROR) {return nullptr;}
+	m_names.insert(name);
 
 	auto coords = new H5CgnsGridCoordinates(name, gId, m_zone);
 	m_gridCoordinatesForSolution = coords;
@@ -358,6 +425,7 @@ H5CgnsFlowSolution* H5CgnsZone::Impl::createNodeSolution()
 	int ier = H5Util::createGroup(m_groupId, name, H5CgnsFlowSolution::label(), H5Util::userDefinedDataType(), &gId);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createGroup", ier);
 	if (ier != IRIC_NO_ERROR) {return nullptr;}
+	m_names.insert(name);
 
 	auto sol = new H5CgnsNodeFlowSolution(name, gId, m_zone);
 	m_nodeSolution = sol;
@@ -544,6 +612,7 @@ H5CgnsParticleGroupSolution* H5CgnsZone::Impl::createParticleGroupSolution()
 	int ier = H5Util::createUserDefinedDataGroup(m_groupId, ss.str(), &gId);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createUserDefinedDataGroup", ier);
 	if (ier != IRIC_NO_ERROR) {return nullptr;}
+	m_names.insert(ss.str());
 
 	auto sol = new H5CgnsParticleGroupSolution(ss.str(), gId, m_zone);
 	m_particleGroupSolution = sol;
@@ -551,6 +620,31 @@ H5CgnsParticleGroupSolution* H5CgnsZone::Impl::createParticleGroupSolution()
 	return sol;
 }
 
+H5CgnsParticleGroupTrajectories* H5CgnsZone::Impl::openParticleGroupTrajectories()
+{
+	hid_t gId;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::openGroup");
+	int ier = H5Util::openGroup(m_groupId, "ParticleGroupTrajectories", H5Util::userDefinedDataLabel(), &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::openGroup", ier);
+	if (ier != IRIC_NO_ERROR) {return nullptr;}
+
+	m_particleGroupTrajectories = new H5CgnsParticleGroupTrajectories(gId, m_zone);
+	return m_particleGroupTrajectories;
+}
+
+H5CgnsParticleGroupTrajectories* H5CgnsZone::Impl::createParticleGroupTrajectories()
+{
+	hid_t gId;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createUserDefinedDataGroup");
+	int ier = H5Util::createUserDefinedDataGroup(m_groupId, "ParticleGroupTrajectories", &gId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createUserDefinedDataGroup", ier);
+	if (ier != IRIC_NO_ERROR) {return nullptr;}
+	m_names.insert("ParticleGroupTrajectories");
+
+	m_particleGroupTrajectories = new H5CgnsParticleGroupTrajectories(gId, m_zone);
+	return m_particleGroupTrajectories;
+}
+
 H5CgnsParticleGroupImageSolution* H5CgnsZone::Impl::openParticleGroupImageSolution()
 {
 	if (m_solutionId == 0) {return nullptr;}
@@ -581,6 +675,7 @@ H5CgnsParticleGroupImageSolution* H5CgnsZone::Impl::createParticleGroupImageSolu
 	int ier = H5Util::createUserDefinedDataGroup(m_groupId, ss.str(), &gId);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createUserDefinedDataGroup", ier);
 	if (ier != IRIC_NO_ERROR) {return nullptr;}
+	m_names.insert(ss.str());
 
 	auto sol = new H5CgnsParticleGroupImageSolution(ss.str(), gId, m_zone);
 	m_particleGroupImageSolution = sol;
@@ -618,6 +713,7 @@ H5CgnsParticleSolution* H5CgnsZone::Impl::createParticleSolution()
 	int ier = H5Util::createUserDefinedDataGroup(m_groupId, ss.str(), &gId);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createUserDefinedDataGroup", ier);
 	if (ier != IRIC_NO_ERROR) {return nullptr;}
+	m_names.insert(ss.str());
 
 	auto sol = new H5CgnsParticleSolution(ss.str(), gId, m_zone);
 	m_particleSolution = sol;
@@ -655,6 +751,7 @@ H5CgnsPolyDataSolution* H5CgnsZone::Impl::createPolyDataSolution()
 	int ier = H5Util::createUserDefinedDataGroup(m_groupId, ss.str(), &gId);
 	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createUserDefinedDataGroup", ier);
 	if (ier != IRIC_NO_ERROR) {return nullptr;}
+	m_names.insert(ss.str());
 
 	auto sol = new H5CgnsPolyDataSolution(ss.str(), gId, m_zone);
 	m_polyDataSolution = sol;
@@ -671,11 +768,12 @@ int H5CgnsZone::Impl::writeZoneIterativeData()
 	RETURN_IF_ERR;
 
 	H5GroupCloser closer(gId);
+	m_solutionPointers.clear();
 
 	std::unordered_set<std::string> names;
-	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getGroupNames");
-	ier = H5Util::getGroupNames(gId, &names);
-	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getGroupNames", ier);
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::getLinkNames");
+	ier = H5Util::getLinkNames(gId, &names);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::getLinkNames", ier);
 	RETURN_IF_ERR;
 
 	if (m_gridCoordinatesForSolution != nullptr) {
@@ -751,6 +849,79 @@ int H5CgnsZone::Impl::writeZoneIterativeData()
 	return IRIC_NO_ERROR;
 }
 
+int H5CgnsZone::Impl::copySolutionGroupTo(const std::string& pointersName, const std::string& prefix, Impl* target, std::string* targetName, hid_t* targetGroupId)
+{
+	*targetGroupId = -1;
+
+	if (m_solutionId == 0 || target->m_solutionId == 0) {
+		std::ostringstream ss;
+		ss << "In H5CgnsZone::Impl::copySolutionGroupTo(), solution id is not set";
+		_iric_logger_error(ss.str());
+		return IRIC_SOLUTION_ID_INVALID;
+	}
+
+	auto name = getSolutionName(pointersName, prefix, m_solutionId);
+	if (m_names.find(name) == m_names.end()) {return IRIC_NO_ERROR;}
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Gopen2");
+	hid_t srcId = H5Gopen2(m_groupId, name.c_str(), H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Gopen2");
+	if (srcId < 0) {
+		_iric_logger_error("H5CgnsZone::Impl::copySolutionGroupTo", "H5Gopen2", srcId);
+		return IRIC_H5_CALL_ERROR;
+	}
+
+	H5GroupCloser srcCloser(srcId);
+
+	std::string label, type;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readAttribute");
+	int ier = H5Util::readAttribute(srcId, "label", &label);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readAttribute", ier);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::readAttribute");
+	ier = H5Util::readAttribute(srcId, "type", &type);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::readAttribute", ier);
+	RETURN_IF_ERR;
+
+	auto tgtName = target->getStandardSolutionName(prefix, target->m_solutionId);
+
+	// remove the group left by a previous (interrupted) copy
+	_IRIC_LOGGER_TRACE_CALL_START("H5Lexists");
+	htri_t exists = H5Lexists(target->m_groupId, tgtName.c_str(), H5P_DEFAULT);
+	_IRIC_LOGGER_TRACE_CALL_END("H5Lexists");
+	if (exists > 0) {
+		_IRIC_LOGGER_TRACE_CALL_START("H5Ldelete");
+		herr_t status = H5Ldelete(target->m_groupId, tgtName.c_str(), H5P_DEFAULT);
+		_IRIC_LOGGER_TRACE_CALL_END("H5Ldelete");
+		if (status < 0) {
+			_iric_logger_error("H5CgnsZone::Impl::copySolutionGroupTo", "H5Ldelete", status);
+			return IRIC_H5_CALL_ERROR;
+		}
+	}
+
+	hid_t tgtId;
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::createGroup");
+	ier = H5Util::createGroup(target->m_groupId, tgtName, label, type, &tgtId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::createGroup", ier);
+	RETURN_IF_ERR;
+
+	_IRIC_LOGGER_TRACE_CALL_START("H5Util::copyGroupRecursively");
+	ier = H5Util::copyGroupRecursively(srcId, tgtId);
+	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::copyGroupRecursively", ier);
+	if (ier != IRIC_NO_ERROR) {
+		H5GroupCloser tgtCloser(tgtId);
+		return ier;
+	}
+
+	target->m_names.insert(tgtName);
+
+	*targetName = tgtName;
+	*targetGroupId = tgtId;
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsZone::Impl::openSolutionGroup(const std::string& name, hid_t* gId)
 {
 	if (m_solutionId == 0) {
@@ -804,6 +975,7 @@ int H5CgnsZone::Impl::createSolutionGroup(const std::string& name, const std::st
 		}
 		return ier;
 	}
+	m_names.insert(name);
 
 	return IRIC_NO_ERROR;
 }
@@ -814,17 +986,24 @@ std::string H5CgnsZone::Impl::getSolutionName(const std::string& pointersName, c
 		return getStandardSolutionName(prefix, solId);
 	}
 
-	hid_t gId;
-	_IRIC_LOGGER_TRACE_CALL_START("H5Util::openGroup");
-	int ier = H5Util::openGroup(m_groupId, ZONEITERATIVEDATA_NAME, ZONEITERATIVEDATA_LABEL, &gId);
-	_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::openGroup", ier);
-	if (ier != IRIC_NO_ERROR) {return "";}
+	// pointers are read once, instead of every time a solution is opened
+	auto it = m_solutionPointers.find(pointersName);
+	if (it == m_solutionPointers.end()) {
+		hid_t gId;
+		_IRIC_LOGGER_TRACE_CALL_START("H5Util::openGroup");
+		int ier = H5Util::openGroup(m_groupId, ZONEITERATIVEDATA_NAME, ZONEITERATIVEDATA_LABEL, &gId);
+		_IRIC_LOGGER_TRACE_CALL_END_WITHVAL("H5Util::openGroup", ier);
+		if (ier != IRIC_NO_ERROR) {return "";}
 
-	H5GroupCloser closer(gId);
+		H5GroupCloser closer(gId);
+
+		std::vector<std::string> pointers;
+		H5Util::readDataArrayValue(gId, pointersName, &pointers);
+		it = m_solutionPointers.insert({pointersName, pointers}).first;
+	}
 
-	std::vector<std::string> names;
-	H5Util::readDataArrayValue(gId, pointersName, &names);
-	if (solId >= static_cast<int>(names.size())) {
+	const auto& names = it->second;
+	if (solId < 1 || solId > static_cast<int>(names.size())) {
 		return getStandardSolutionName(prefix, solId);
 	}
 
@@ -3,6 +3,7 @@
 
 #include "../h5cgnszone.h"
 
+#include <map>
 #include <unordered_set>
 
 namespace iRICLib {
@@ -54,6 +55,9 @@ public:
 	H5CgnsParticleGroupSolution* openParticleGroupSolution();
 	H5CgnsParticleGroupSolution* createParticleGroupSolution();
 
+	H5CgnsParticleGroupTrajectories* openParticleGroupTrajectories();
+	H5CgnsParticleGroupTrajectories* createParticleGroupTrajectories();
+
 	H5CgnsParticleGroupImageSolution* openParticleGroupImageSolution();
 	H5CgnsParticleGroupImageSolution* createParticleGroupImageSolution();
 
@@ -65,6 +69,11 @@ public:
 
 	int writeZoneIterativeData();
 
+	int linkGroup(const std::string& fileName, const std::string& name);
+	H5CgnsGridCoordinates* openLinkedGridCoordinates();
+
+	int copySolutionGroupTo(const std::string& pointersName, const std::string& prefix, Impl* target, std::string* targetName, hid_t* targetGroupId);
+
 	std::string m_name;
 	Type m_type;
 	std::vector<int> m_size;
@@ -86,9 +95,12 @@ public:
 	H5CgnsParticleGroupImageSolution* m_particleGroupImageSolution;
 	H5CgnsParticleSolution* m_particleSolution;
 	H5CgnsPolyDataSolution* m_polyDataSolution;
+	H5CgnsParticleGroupTrajectories* m_particleGroupTrajectories;
 
 	std::unordered_set<std::string> m_names;
 	std::unordered_set<std::string> m_flowSolutionPointerNames;
+	std::map<std::string, std::vector<std::string> > m_solutionPointers;
+	std::vector<double> m_gridBoundingBox;
 
 	H5CgnsBase* m_base;
 
@@ -0,0 +1,72 @@
+#ifndef IRICSOLVERLIB_CELLINTERPOLATION_H
+#define IRICSOLVERLIB_CELLINTERPOLATION_H
+
+#include "../iricsolverlib_point2d.h"
+
+namespace iRICSolverLib {
+
+// Non-virtual, allocation free interpolation kernels shared by TriCell,
+// QuadCell and the flat cell storage in Grid2D.
+namespace CellInterpolation {
+
+const double INSIDE_DELTA = 1.0E-8;
+
+inline void calcSTU(double x, double y, const Point2D& node0, const Point2D& node1, const Point2D& node2, double* s, double* t, double* u)
+{
+	double px = x - node0.x();
+	double py = y - node0.y();
+	double p1x = node1.x() - node0.x();
+	double p1y = node1.y() - node0.y();
+	double p2x = node2.x() - node0.x();
+	double p2y = node2.y() - node0.y();
+
+	double m = p1x * p2y - p1y * p2x;
+	*t = (px * p2y - py * p2x) / m;
+	*u = - (px * p1y - py * p1x) / m;
+	*s = (1 - *t - *u);
+}
+
+inline bool triangle(double x, double y, const Point2D& node0, const Point2D& node1, const Point2D& node2, double* weights)
+{
+	double s, t, u;
+	calcSTU(x, y, node0, node1, node2, &s, &t, &u);
+
+	if (s < - INSIDE_DELTA || t < - INSIDE_DELTA || u < - INSIDE_DELTA) {
+		return false;
+	}
+
+	*(weights)     = s;
+	*(weights + 1) = t;
+	*(weights + 2) = u;
+	return true;
+}
+
+inline bool quad(double x, double y, const Point2D& node0, const Point2D& node1, const Point2D& node2, const Point2D& node3, double* weights)
+{
+	double tmpWeights[3];
+
+	// try triangle with 0, 1, 2
+	if (triangle(x, y, node0, node1, node2, tmpWeights)) {
+		*(weights)     = tmpWeights[0];
+		*(weights + 1) = tmpWeights[1];
+		*(weights + 2) = tmpWeights[2];
+		*(weights + 3) = 0;
+		return true;
+	}
+
+	// try triangle with 0, 2, 3
+	if (triangle(x, y, node0, node2, node3, tmpWeights)) {
+		*(weights)     = tmpWeights[0];
+		*(weights + 1) = 0;
+		*(weights + 2) = tmpWeights[1];
+		*(weights + 3) = tmpWeights[2];
+		return true;
+	}
+	return false;
+}
+
+} // CellInterpolation
+
+} // iRICSolverLib
+
+#endif // IRICSOLVERLIB_CELLINTERPOLATION_H
@@ -3,6 +3,10 @@
 
 #include "../iricsolverlib_grid2d.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace iRICLib
@@ -16,28 +20,144 @@ namespace iRICSolverLib {
 class Grid2D::Impl
 {
 public:
+	enum CellType {
+		Triangle = 3,
+		Quad = 4,
+	};
+	// node ids of a cell are stored in fixed size slots
+	static const int MAX_CELL_NODES = 4;
+	// batch queries smaller than this are not split between threads
+	static const int MIN_POINTS_PER_THREAD = 4096;
+	// walking search gives up and uses the back grid after this many cells
+	static const int MAX_WALK_STEPS = 32;
+	// number of cells in a BVH leaf
+	static const int BVH_LEAF_SIZE = 4;
+	// the BVH is built with median splits, so depth is about log2(cellCount)
+	static const int BVH_MAX_DEPTH = 128;
+
+	struct CellRect {
+		double xMin;
+		double xMax;
+		double yMin;
+		double yMax;
+	};
+
+	// BVH node, holding the bounding boxes of both children
+	struct BvhNode {
+		float xMin[2];
+		float xMax[2];
+		float yMin[2];
+		float yMax[2];
+		// for leaf: first index in m_bvhCellIndices. otherwise: index of the child node
+		int index[2];
+		// number of cells for leaf, 0 otherwise
+		int count[2];
+	};
+
+	// cell used while building the BVH
+	struct BvhItem {
+		CellRect rect;
+		int cellIndex;
+	};
+
 	Impl(Grid2D* grid);
 	~Impl();
 
+	int load(const iRICLib::H5CgnsZone& zone, iRICLib::H5CgnsGridCoordinates* coords);
 	int loadNodes(iRICLib::H5CgnsGridCoordinates* coords);
-	int loadCells(const iRICLib::H5CgnsZone& zone);
-	int loadStructuredGrid(const iRICLib::H5CgnsZone& zone);
-	int loadUnstructuredGrid(const iRICLib::H5CgnsZone& zone);
+	void buildStructuredCells(const std::vector<int>& size);
+	void buildUnstructuredCells(const std::vector<int>& indices);
+
+	void clearCells();
+	void addCell(CellType type, int id1, int id2, int id3, int id4);
+	bool cellNodeIdsValid() const;
+	void updateCellBoundingRects();
+	void setupCellNeighbors();
 
+	void setupSpatialIndex();
+	void ensureSpatialIndex() const;
+	void invalidateSpatialIndex();
 	void setupBackGrid();
+	void setupBvh();
+	int buildBvhNode(std::vector<BvhItem>* items, int begin, int end);
+	void setupBvhChild(std::vector<BvhItem>* items, BvhNode* node, int child, int begin, int end);
+	static float roundDown(double v);
+	static float roundUp(double v);
+	int locateBvh(double x, double y, double* weights) const;
+	bool findBackGridCell(const Point2D& point, size_t* bgCellIdx) const;
 
-	int structuredIndex(int i, int j, int* size) const;
+	int copyCellNodeIds(int cellIndex, int* nodeIds) const;
+	bool interpolateCell(int cellIndex, double x, double y, double* weights) const;
+	int locate(double x, double y, double* weights) const;
+	int locate(double x, double y, int hintCellIndex, double* weights) const;
+	int walk(int startCellIndex, double x, double y, double* weights) const;
+
+	int workerCount(int count) const;
+	template <typename F>
+	void runParallel(int count, F func) const;
+
+	Cell2D* cellView(int cellIndex) const;
+
+	int structuredIndex(int i, int j, const int* size) const;
 
 	Grid2D* m_grid;
 	std::vector<Point2D> m_nodes;
-	std::vector<Cell2D*> m_cells;
+
+	// cells, stored as structure of arrays.
+	// node ids are zero-based, MAX_CELL_NODES slots per cell.
+	std::vector<unsigned char> m_cellTypes;
+	std::vector<int> m_cellNodeIds;
+	std::vector<CellRect> m_cellRects;
+	// neighbor cell index across edge (i, i + 1), -1 for boundary edges
+	std::vector<int> m_cellNeighbors;
+
+	// Cell2D objects, created on demand by Grid2D::cell()
+	mutable std::vector<Cell2D*> m_cellViews;
+	mutable std::mutex m_cellViewsMutex;
 
 	std::vector<double> m_backGridX;
 	std::vector<double> m_backGridY;
 
-	std::vector< std::vector<Cell2D*> > m_backGridCells;
+	// cell indices in each back grid cell, stored in CSR form
+	std::vector<int> m_backGridCellOffsets;
+	std::vector<int> m_backGridCellIndices;
+
+	// bounding volume hierarchy, the root is the first node
+	std::vector<BvhNode> m_bvhNodes;
+	std::vector<int> m_bvhCellIndices;
+	std::vector<CellRect> m_bvhCellRects;
+
+	SpatialIndex m_spatialIndex;
+	// the index is built on the first spatial query, not on load
+	mutable std::atomic<bool> m_spatialIndexReady;
+	mutable std::mutex m_spatialIndexMutex;
+
+	int m_threadCount;
 };
 
+template <typename F>
+void Grid2D::Impl::runParallel(int count, F func) const
+{
+	int workers = workerCount(count);
+	if (workers == 1) {
+		func(0, count);
+		return;
+	}
+
+	std::vector<std::thread> threads;
+	int chunk = (count + workers - 1) / workers;
+	for (int w = 1; w < workers; ++w) {
+		int begin = (std::min)(count, w * chunk);
+		int end = (std::min)(count, begin + chunk);
+		threads.push_back(std::thread(func, begin, end));
+	}
+	func(0, (std::min)(count, chunk));
+
+	for (auto& t : threads) {
+		t.join();
+	}
+}
+
 } // iRICSolverLib
 
 #endif // IRICSOLVERLIB_GRID2D_IMPL_H
@@ -25,6 +25,47 @@ H5CgnsPolyDataSolution::GroupReader::GroupReader(const std::string& groupName, H
 	m_solution {sol}
 {}
 
+int H5CgnsPolyDataSolution::GroupReader::readAll(Data* data) const
+{
+	int ier = m_solution->readTypes(m_groupName, &data->types);
+	RETURN_IF_ERR;
+
+	std::vector<int> sizes;
+	ier = m_solution->readSizes(m_groupName, &sizes);
+	RETURN_IF_ERR;
+
+	data->offsets.assign(sizes.size() + 1, 0);
+	for (unsigned int i = 0; i < sizes.size(); ++i) {
+		data->offsets[i + 1] = data->offsets[i] + sizes[i];
+	}
+
+	ier = m_solution->readCoordinatesX(m_groupName, &data->coordinatesX);
+	RETURN_IF_ERR;
+	ier = m_solution->readCoordinatesY(m_groupName, &data->coordinatesY);
+	RETURN_IF_ERR;
+
+	std::vector<std::string> names;
+	ier = m_solution->readValueNames(m_groupName, &names);
+	RETURN_IF_ERR;
+
+	data->intValues.clear();
+	data->realValues.clear();
+	for (const auto& name : names) {
+		H5Util::DataArrayValueType type;
+		ier = m_solution->readValueType(m_groupName, name, &type);
+		RETURN_IF_ERR;
+
+		if (type == H5Util::DataArrayValueType::Int) {
+			ier = m_solution->readValue(m_groupName, name, &(data->intValues[name]));
+		} else if (type == H5Util::DataArrayValueType::RealDouble) {
+			ier = m_solution->readValue(m_groupName, name, &(data->realValues[name]));
+		}
+		RETURN_IF_ERR;
+	}
+
+	return IRIC_NO_ERROR;
+}
+
 int H5CgnsPolyDataSolution::GroupReader::readValueNames(std::vector<std::string>* names) const
 {
 	return m_solution->readValueNames(m_groupName, names);
@@ -5,6 +5,7 @@
 #include "../h5cgnspolydatasolution.h"
 #include "../h5cgnssolutioni.h"
 
+#include <map>
 #include <vector>
 
 namespace iRICLib {
@@ -12,8 +13,21 @@ namespace iRICLib {
 class IRICLIBDLL H5CgnsPolyDataSolution::GroupReader : public H5CgnsSolutionI
 {
 public:
+	// all columns of a group. coordinates of geometry i are coordinatesX[offsets[i]] to coordinatesX[offsets[i + 1] - 1],
+	// and values have one item for each geometry
+	struct Data {
+		std::vector<int> types;
+		std::vector<int> offsets;
+		std::vector<double> coordinatesX;
+		std::vector<double> coordinatesY;
+		std::map<std::string, std::vector<int> > intValues;
+		std::map<std::string, std::vector<double> > realValues;
+	};
+
 	GroupReader(const std::string& groupName, H5CgnsPolyDataSolution* sol);
 
+	int readAll(Data* data) const;
+
 	int readValueNames(std::vector<std::string>* names) const override;
 	int readValueNames(std::unordered_set<std::string>* names) const override;
 	int readValueType(const std::string& name, H5Util::DataArrayValueType *type) const override;
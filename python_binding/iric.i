@@ -5,10 +5,60 @@
 %{
 #include "../iriclib.h"
 #include "../iriclib_wrapper.h"
+
+#include <cstring>
+
+// returns true if a buffer format (PEP 3118) is a single native item of one of the accepted types
+static bool iric_buffer_format_is(const char* format, const char* accepted)
+{
+	if (format == nullptr) {return false;}
+
+	const int one = 1;
+	bool littleEndian = (*reinterpret_cast<const char*> (&one) == 1);
+	if (*format == '@' || *format == '=' || (*format == '<' && littleEndian)) {++ format;}
+
+	return *format != '\0' && *(format + 1) == '\0' && std::strchr(accepted, *format) != nullptr;
+}
 %}
 
 %cstring_bounded_output(char *strvalue, 2048);
 
+// Array arguments accept IntArrayContainer / RealArrayContainer, and also any C-contiguous buffer
+// (NumPy array etc.) of the same item type. Buffers are wrapped, not copied.
+// The C functions write into output arrays, so their buffers must be writable. Input arrays
+// (declared as "INPUT" below) may be read only.
+%define IRIC_ARRAY_TYPEMAP_IMPL(PARAM, CONTAINER, CTYPE, FORMATS, BUFFLAGS, DESC)
+%typemap(in) PARAM (CONTAINER* view = nullptr, Py_buffer buffer, int hasBuffer = 0) {
+	void* ptr = nullptr;
+	if (SWIG_IsOK(SWIG_ConvertPtr($input, &ptr, $descriptor(CONTAINER*), 0)) && ptr != nullptr) {
+		$1 = reinterpret_cast<CONTAINER*> (ptr);
+	} else {
+		if (PyObject_GetBuffer($input, &buffer, BUFFLAGS | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+			PyErr_Clear();
+			SWIG_exception_fail(SWIG_TypeError, "in method '$symname', argument $argnum must be a " DESC "contiguous array of " #CTYPE);
+		}
+		hasBuffer = 1;
+		if (buffer.itemsize != sizeof(CTYPE) || ! iric_buffer_format_is(buffer.format, FORMATS)) {
+			SWIG_exception_fail(SWIG_TypeError, "in method '$symname', argument $argnum must be a " DESC "contiguous array of " #CTYPE);
+		}
+		view = new CONTAINER(static_cast<CTYPE*> (buffer.buf), static_cast<int> (buffer.len / buffer.itemsize));
+		$1 = view;
+	}
+}
+%typemap(freearg) PARAM {
+	delete view$argnum;
+	if (hasBuffer$argnum) {PyBuffer_Release(&buffer$argnum);}
+}
+%enddef
+
+%define IRIC_ARRAY_TYPEMAP(CONTAINER, CTYPE, FORMATS)
+IRIC_ARRAY_TYPEMAP_IMPL(CONTAINER&, CONTAINER, CTYPE, FORMATS, PyBUF_WRITABLE, "writable ")
+IRIC_ARRAY_TYPEMAP_IMPL(CONTAINER& INPUT, CONTAINER, CTYPE, FORMATS, 0, "")
+%enddef
+
+IRIC_ARRAY_TYPEMAP(IntArrayContainer, int, "il")
+IRIC_ARRAY_TYPEMAP(RealArrayContainer, double, "d")
+
 class IntArrayContainer
 {
 public:
@@ -125,9 +175,11 @@ int cg_iRIC_Copy_Grid_WithGridId(int fid_from, int fid_to, int gid);
 int cg_iRIC_Read_Grid2d_Open_WithGridId(int fid, int gid, int* OUTPUT);
 int cg_iRIC_Read_Sol_Grid2d_Open_WithGridId(int fid, int gid, int step, int* OUTPUT);
 int cg_iRIC_Read_Grid2d_Close(int grid_handle);
+int cg_iRIC_Set_Grid2d_SpatialIndex(int grid_handle, int type);
 int cg_iRIC_Read_Grid2d_CellArea(int grid_handle, int cellId, double* OUTPUT);
 int cg_iRIC_Read_Grid2d_FindCell(int grid_handle, double x, double y, int* OUTPUT);
 int cg_iRIC_Read_Grid2d_CellNodeCount(int grid_handle, int cellId, int* OUTPUT);
+int cg_iRIC_Read_Grid2d_FindCellWithHint(int grid_handle, double x, double y, int hintCellId, int* OUTPUT);
 
 // from iriclib_gui_coorp.h
 int iRIC_Check_Cancel();
@@ -137,6 +189,10 @@ int cg_iRIC_Check_Update(int fid);
 int cg_iRIC_Open(const char* filename, int mode, int* OUTPUT);
 int cg_iRIC_Close(int fid);
 int iRIC_InitOption(int option);
+int cg_iRIC_Set_StoragePolicy(int fid, int compression, int level, int shuffle);
+int cg_iRIC_Set_StorageChunking(int fid, int contiguous_limit, int chunk_size);
+int cg_iRIC_Set_ParticleGroupTrajectory(int fid, const char* idname);
+int cg_iRIC_Set_ParticleBins(int fid, int level);
 
 // from iriclib_not_withbaseid.h
 int cg_iRIC_Read_Complex_Count(int fid, const char* groupname, int* OUTPUT);
@@ -183,7 +239,9 @@ int cg_iRIC_Copy_Grid(int fid_from, int fid_to);
 int cg_iRIC_Read_Grid2d_Open(int fid, int* OUTPUT);
 int cg_iRIC_Read_Sol_Grid2d_Open(int fid, int step, int* OUTPUT);
 int cg_iRIC_Read_Sol_Particle_Count(int fid, int step, int* OUTPUT);
+int cg_iRIC_Read_Sol_Particle_RectCount(int fid, int step, double xmin, double xmax, double ymin, double ymax, int* OUTPUT);
 int cg_iRIC_Read_Sol_ParticleGroup_Count(int fid, int step, const char* groupname, int* OUTPUT);
+int cg_iRIC_Read_Sol_ParticleGroup_RectCount(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, int* OUTPUT);
 int cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(int fid, const char* groupname);
 int cg_iRIC_Write_Sol_ParticleGroup_GroupEnd(int fid);
 int cg_iRIC_Write_Sol_ParticleGroup_Pos2d(int fid, double x, double y);
@@ -203,9 +261,11 @@ int cg_iRIC_Write_Sol_PolyData_Real(int fid, const char* name, double value);
 
 // from iriclib_sol_particle.h
 int cg_iRIC_Read_Sol_Particle_Count_WithGridId(int fid, int gid, int step, int* OUTPUT);
+int cg_iRIC_Read_Sol_Particle_RectCount_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, int* OUTPUT);
 
 // from iriclib_sol_particlegroup.h
 int cg_iRIC_Read_Sol_ParticleGroup_Count_WithGridId(int fid, int gid, int step, const char* groupname, int* OUTPUT);
+int cg_iRIC_Read_Sol_ParticleGroup_RectCount_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, int* OUTPUT);
 int cg_iRIC_Write_Sol_ParticleGroup_GroupBegin_WithGridId(int fid, int gid, const char* groupname);
 int cg_iRIC_Write_Sol_ParticleGroup_GroupEnd_WithGridId(int fid, int gid);
 int cg_iRIC_Write_Sol_ParticleGroup_Pos2d_WithGridId(int fid, int gid, double x, double y);
@@ -243,36 +303,43 @@ int cg_iRIC_Write_Sol_BaseIterative_Real(int fid, const char* name, double value
 int cg_iRIC_Write_Sol_BaseIterative_String(int fid, const char* name, const char* value);
 int cg_iRIC_Write_ErrorCode(int fid, int errorcode);
 int cg_iRIC_Clear_Sol(int fid);
+int cg_iRIC_Set_Sol_Cache(int fid, int capacity, int prefetch);
+int cg_iRIC_Read_Sol_CacheStats(int fid, int* OUTPUT, int* OUTPUT);
+int cg_iRIC_Set_Sol_AsyncWrite(int fid, int queueSize);
+int cg_iRIC_Read_Sol_AsyncWriteStats(int fid, int* OUTPUT, double* OUTPUT);
+int cg_iRIC_Read_Sol_Refresh(int fid);
 
 // from iriclib_wrapper.h
 int cg_iRIC_Read_BC_Indices_WithGridId(int fid, int gid, const char* type, int num, IntArrayContainer& idx_arr);
 int cg_iRIC_Read_BC_Functional_WithGridId(int fid, int gid, const char* type, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_BC_FunctionalWithName_WithGridId(int fid, int gid, const char* type, int num, const char* name, const char* paramname, RealArrayContainer& v_arr);
-int cg_iRIC_Write_BC_Indices_WithGridId(int fid, int gid, const char* type, int num, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_BC_Indices2_WithGridId(int fid, int gid, const char* type, int num, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_BC_Functional_WithGridId(int fid, int gid, const char* type, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_BC_FunctionalWithName_WithGridId(int fid, int gid, const char* type, int num, const char* name, const char* paramname, RealArrayContainer& v_arr);
+int cg_iRIC_Write_BC_Indices_WithGridId(int fid, int gid, const char* type, int num, IntArrayContainer& INPUT);
+int cg_iRIC_Write_BC_Indices2_WithGridId(int fid, int gid, const char* type, int num, IntArrayContainer& INPUT);
+int cg_iRIC_Write_BC_Functional_WithGridId(int fid, int gid, const char* type, int num, const char* name, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_BC_FunctionalWithName_WithGridId(int fid, int gid, const char* type, int num, const char* name, const char* paramname, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Functional(int fid, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_FunctionalWithName(int fid, const char* name, const char* paramname, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Functional(int fid, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_FunctionalWithName(int fid, const char* name, const char* paramname, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Functional(int fid, const char* name, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_FunctionalWithName(int fid, const char* name, const char* paramname, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Complex_Functional_WithBaseId(int fid, int bid, const char* groupname, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Complex_FunctionalWithName_WithBaseId(int fid, int bid, const char* groupname, int num, const char* name, const char* paramname, RealArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Complex_Node_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Complex_Cell_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Complex_IFace_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Complex_JFace_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Complex_Functional_WithBaseId(int fid, int bid, const char* groupname, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_Complex_FunctionalWithName_WithBaseId(int fid, int bid, const char* groupname, int num, const char* name, const char* paramname, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Complex_Node_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Complex_Cell_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Complex_IFace_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Complex_JFace_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& v_arr);
+int cg_iRIC_Write_Complex_Functional_WithBaseId(int fid, int bid, const char* groupname, int num, const char* name, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Complex_FunctionalWithName_WithBaseId(int fid, int bid, const char* groupname, int num, const char* name, const char* paramname, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Complex_Node_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Complex_Cell_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Complex_IFace_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Complex_JFace_WithGridId(int fid, int gid, const char* groupname, IntArrayContainer& INPUT);
 int iRIC_Geo_Polygon_Read_Points(int geo_handle, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int iRIC_Geo_Polygon_Read_HolePoints(int geo_handle, int holeid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int iRIC_Geo_RiverSurvey_Read_Altitudes(int geo_handle, int csid, RealArrayContainer& position_arr, RealArrayContainer& height_arr, IntArrayContainer& active_arr);
 int cg_iRIC_Read_Grid2d_Coords_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Grid3d_Coords_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(int fid, int gid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int cg_iRIC_Read_Grid_TriangleElements_WithGridId(int fid, int gid, IntArrayContainer& id_arr);
 int cg_iRIC_Read_Grid_LineElements_WithGridId(int fid, int gid, IntArrayContainer& id_arr);
 int cg_iRIC_Read_Grid_Real_Node_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
@@ -294,48 +361,53 @@ int cg_iRIC_Read_Grid_Functional_Integer_IFace_WithGridId(int fid, int gid, cons
 int cg_iRIC_Read_Grid_Functional_Real_IFace_WithGridId(int fid, int gid, const char* name, int dimid, RealArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Functional_Integer_JFace_WithGridId(int fid, int gid, const char* name, int dimid, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Functional_Real_JFace_WithGridId(int fid, int gid, const char* name, int dimid, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid1d_Coords_WithGridId(int fid, int isize, RealArrayContainer& x_arr, int* OUTPUT);
-int cg_iRIC_Write_Grid2d_Coords_WithGridId(int fid, int isize, int jsize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int* OUTPUT);
-int cg_iRIC_Write_Grid3d_Coords_WithGridId(int fid, int isize, int jsize, int ksize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr, int* OUTPUT);
-int cg_iRIC_Write_NamedGrid1d_Coords_WithGridId(int fid, const char* name, int isize, RealArrayContainer& x_arr, int* OUTPUT);
-int cg_iRIC_Write_NamedGrid2d_Coords_WithGridId(int fid, const char* name, int isize, int jsize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int* OUTPUT);
-int cg_iRIC_Write_NamedGrid3d_Coords_WithGridId(int fid, const char* name, int isize, int jsize, int ksize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr, int* OUTPUT);
-int cg_iRIC_Write_Grid2d_Unst_Triangles_WithGridId(int fid, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int csize, IntArrayContainer& idx_arr, int* OUTPUT);
-int cg_iRIC_Write_Grid2d_Unst_Lines_WithGridId(int fid, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int csize, IntArrayContainer& idx_arr, int* OUTPUT);
-int cg_iRIC_Write_Grid3d_Unst_Lines_WithGridId(int fid, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr, int csize, IntArrayContainer& idx_arr, int* OUTPUT);
-int cg_iRIC_Write_NamedGrid2d_Unst_Triangles_WithGridId(int fid, const char* name, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int csize, IntArrayContainer& idx_arr, int* OUTPUT);
-int cg_iRIC_Write_NamedGrid2d_Unst_Lines_WithGridId(int fid, const char* name, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int csize, IntArrayContainer& idx_arr, int* OUTPUT);
-int cg_iRIC_Write_NamedGrid3d_Unst_Lines_WithGridId(int fid, const char* name, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr, int csize, IntArrayContainer& idx_arr, int* OUTPUT);
-int cg_iRIC_Write_Grid_Real_Node_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Integer_Node_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Real_Cell_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Integer_Cell_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Real_IFace_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Integer_IFace_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Real_JFace_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Integer_JFace_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Write_Grid1d_Coords_WithGridId(int fid, int isize, RealArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_Grid2d_Coords_WithGridId(int fid, int isize, int jsize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_Grid3d_Coords_WithGridId(int fid, int isize, int jsize, int ksize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_NamedGrid1d_Coords_WithGridId(int fid, const char* name, int isize, RealArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_NamedGrid2d_Coords_WithGridId(int fid, const char* name, int isize, int jsize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_NamedGrid3d_Coords_WithGridId(int fid, const char* name, int isize, int jsize, int ksize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_Grid2d_Unst_Triangles_WithGridId(int fid, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_Grid2d_Unst_Lines_WithGridId(int fid, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_Grid3d_Unst_Lines_WithGridId(int fid, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_NamedGrid2d_Unst_Triangles_WithGridId(int fid, const char* name, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_NamedGrid2d_Unst_Lines_WithGridId(int fid, const char* name, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_NamedGrid3d_Unst_Lines_WithGridId(int fid, const char* name, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT, int* OUTPUT);
+int cg_iRIC_Write_Grid_Real_Node_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Integer_Node_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Real_Cell_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Integer_Cell_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Real_IFace_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Integer_IFace_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Real_JFace_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Integer_JFace_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
 int cg_iRIC_Read_Grid2d_InterpolateWithCell(int grid_handle, double x, double y, int cellId, IntArrayContainer& nodeids_arr, RealArrayContainer& weights_arr);
+int cg_iRIC_Read_Grid2d_InterpolateWithHint(int grid_handle, double x, double y, int hintCellId, int* OUTPUT, int* OUTPUT, int* OUTPUT, IntArrayContainer& nodeids_arr, RealArrayContainer& weights_arr);
+int cg_iRIC_Read_Grid2d_FindCellMulti(int grid_handle, int count, RealArrayContainer& INPUT, RealArrayContainer& INPUT, IntArrayContainer& cellids_arr);
+int cg_iRIC_Read_Grid2d_InterpolateMulti(int grid_handle, int count, RealArrayContainer& INPUT, RealArrayContainer& INPUT, IntArrayContainer& ok_arr, IntArrayContainer& nodecount_arr, IntArrayContainer& nodeids_arr, RealArrayContainer& weights_arr);
 int cg_iRIC_Read_Complex_Functional(int fid, const char* groupname, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Complex_FunctionalWithName(int fid, const char* groupname, int num, const char* name, const char* paramname, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Complex_Functional(int fid, const char* groupname, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_Complex_FunctionalWithName(int fid, const char* groupname, int num, const char* name, const char* paramname, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Complex_Functional(int fid, const char* groupname, int num, const char* name, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Complex_FunctionalWithName(int fid, const char* groupname, int num, const char* name, const char* paramname, RealArrayContainer& INPUT);
 int cg_iRIC_Read_BC_Indices(int fid, const char* type, int num, IntArrayContainer& idx_arr);
 int cg_iRIC_Read_BC_Functional(int fid, const char* type, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_BC_FunctionalWithName(int fid, const char* type, int num, const char* name, const char* paramname, RealArrayContainer& v_arr);
-int cg_iRIC_Write_BC_Indices(int fid, const char* type, int num, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_BC_Indices2(int fid, const char* type, int num, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_BC_Functional(int fid, const char* type, int num, const char* name, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_BC_FunctionalWithName(int fid, const char* type, int num, const char* name, const char* paramname, RealArrayContainer& v_arr);
+int cg_iRIC_Write_BC_Indices(int fid, const char* type, int num, IntArrayContainer& INPUT);
+int cg_iRIC_Write_BC_Indices2(int fid, const char* type, int num, IntArrayContainer& INPUT);
+int cg_iRIC_Write_BC_Functional(int fid, const char* type, int num, const char* name, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_BC_FunctionalWithName(int fid, const char* type, int num, const char* name, const char* paramname, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Grid_Complex_Node(int fid, const char* groupname, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Complex_Cell(int fid, const char* groupname, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Complex_IFace(int fid, const char* groupname, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Complex_JFace(int fid, const char* groupname, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Complex_Node(int fid, const char* groupname, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Complex_Cell(int fid, const char* groupname, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Complex_IFace(int fid, const char* groupname, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Complex_JFace(int fid, const char* groupname, IntArrayContainer& v_arr);
+int cg_iRIC_Write_Grid_Complex_Node(int fid, const char* groupname, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Complex_Cell(int fid, const char* groupname, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Complex_IFace(int fid, const char* groupname, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Complex_JFace(int fid, const char* groupname, IntArrayContainer& INPUT);
 int cg_iRIC_Read_Grid2d_Coords(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Grid3d_Coords(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Read_Grid2d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Read_Grid3d_Coords_Region(int fid, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int cg_iRIC_Read_Grid_TriangleElements(int fid, IntArrayContainer& id_arr);
 int cg_iRIC_Read_Grid_LineElements(int fid, IntArrayContainer& id_arr);
 int cg_iRIC_Read_Grid_Real_Node(int fid, const char* name, RealArrayContainer& v_arr);
@@ -357,110 +429,176 @@ int cg_iRIC_Read_Grid_Functional_Integer_IFace(int fid, const char* name, int di
 int cg_iRIC_Read_Grid_Functional_Real_IFace(int fid, const char* name, int dimid, RealArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Functional_Integer_JFace(int fid, const char* name, int dimid, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Grid_Functional_Real_JFace(int fid, const char* name, int dimid, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid1d_Coords(int fid, int isize, RealArrayContainer& x_arr);
-int cg_iRIC_Write_Grid2d_Coords(int fid, int isize, int jsize, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_Grid3d_Coords(int fid, int isize, int jsize, int ksize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
-int cg_iRIC_Write_NamedGrid1d_Coords(int fid, const char* name, int isize, RealArrayContainer& x_arr);
-int cg_iRIC_Write_NamedGrid2d_Coords(int fid, const char* name, int isize, int jsize, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_NamedGrid3d_Coords(int fid, const char* name, int isize, int jsize, int ksize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
-int cg_iRIC_Write_Grid2d_Unst_Triangles(int fid, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int csize, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_Grid2d_Unst_Lines(int fid, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int csize, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_Grid3d_Unst_Lines(int fid, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr, int csize, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_NamedGrid2d_Unst_Triangles(int fid, const char* name, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int csize, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_NamedGrid2d_Unst_Lines(int fid, const char* name, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, int csize, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_NamedGrid3d_Unst_Lines(int fid, const char* name, int psize, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr, int csize, IntArrayContainer& idx_arr);
-int cg_iRIC_Write_Grid_Real_Node(int fid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Integer_Node(int fid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Real_Cell(int fid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Integer_Cell(int fid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Real_IFace(int fid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Integer_IFace(int fid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Real_JFace(int fid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Grid_Integer_JFace(int fid, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Write_Grid1d_Coords(int fid, int isize, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid2d_Coords(int fid, int isize, int jsize, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid3d_Coords(int fid, int isize, int jsize, int ksize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_NamedGrid1d_Coords(int fid, const char* name, int isize, RealArrayContainer& INPUT);
+int cg_iRIC_Write_NamedGrid2d_Coords(int fid, const char* name, int isize, int jsize, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_NamedGrid3d_Coords(int fid, const char* name, int isize, int jsize, int ksize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid2d_Unst_Triangles(int fid, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid2d_Unst_Lines(int fid, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid3d_Unst_Lines(int fid, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT);
+int cg_iRIC_Write_NamedGrid2d_Unst_Triangles(int fid, const char* name, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT);
+int cg_iRIC_Write_NamedGrid2d_Unst_Lines(int fid, const char* name, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT);
+int cg_iRIC_Write_NamedGrid3d_Unst_Lines(int fid, const char* name, int psize, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT, int csize, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Real_Node(int fid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Integer_Node(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Real_Cell(int fid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Integer_Cell(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Real_IFace(int fid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Integer_IFace(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Real_JFace(int fid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Grid_Integer_JFace(int fid, const char* name, IntArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_Cell_Integer(int fid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_Cell_Real(int fid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Cell_Integer(int fid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Cell_Real(int fid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Integer_Series(int fid, const char* name, int count, IntArrayContainer& INPUT, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Real_Series(int fid, const char* name, int count, IntArrayContainer& INPUT, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_Cell_Integer(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Cell_Real(int fid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_Grid2d_Coords(int fid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Sol_Grid3d_Coords(int fid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
-int cg_iRIC_Write_Sol_Grid2d_Coords(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_Sol_Grid3d_Coords(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Write_Sol_Grid2d_Coords(int fid, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Grid3d_Coords(int fid, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_IFace_Integer(int fid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_IFace_Real(int fid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_IFace_Integer(int fid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_IFace_Real(int fid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_IFace_Integer(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_IFace_Real(int fid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_JFace_Integer(int fid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_JFace_Real(int fid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_JFace_Integer(int fid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_JFace_Real(int fid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_JFace_Integer(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_JFace_Real(int fid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_KFace_Integer(int fid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_KFace_Real(int fid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_KFace_Integer(int fid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_KFace_Real(int fid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_KFace_Integer(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_KFace_Real(int fid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_Node_Integer(int fid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_Node_Real(int fid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Node_Integer(int fid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Node_Real(int fid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Integer_Series(int fid, const char* name, int count, IntArrayContainer& INPUT, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Real_Series(int fid, const char* name, int count, IntArrayContainer& INPUT, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Integer_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Real_Region2d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Integer_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Real_Region3d(int fid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_Node_Integer(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Node_Real(int fid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_Particle_Pos2d(int fid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Sol_Particle_Pos3d(int fid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int cg_iRIC_Read_Sol_Particle_Real(int fid, int step, const char* name, RealArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_Particle_Integer(int fid, int step, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Particle_Pos2d(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_Sol_Particle_Pos3d(int fid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
-int cg_iRIC_Write_Sol_Particle_Real(int fid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Particle_Integer(int fid, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Particle_RectPos2d(int fid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Read_Sol_Particle_RectPos3d(int fid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Read_Sol_Particle_RectReal(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Particle_RectInteger(int fid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_Particle_Pos2d(int fid, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Particle_Pos3d(int fid, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Particle_Real(int fid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Particle_Integer(int fid, const char* name, IntArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_ParticleGroup_Pos2d(int fid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Sol_ParticleGroup_Pos3d(int fid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int cg_iRIC_Read_Sol_ParticleGroup_Real(int fid, int step, const char* groupname, const char* name, RealArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_ParticleGroup_Integer(int fid, int step, const char* groupname, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, int* OUTPUT);
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger(int fid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos2d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos3d(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_RectReal(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_RectInteger(int fid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(int fid, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti(int fid, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_ParticleGroup_RealMulti(int fid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d(int fid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr);
+int cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(int fid, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_PolyData_Pos2d(int fid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Sol_PolyData_Type(int fid, int step, const char* groupname, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_PolyData_Real(int fid, int step, const char* groupname, const char* name, RealArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_PolyData_Integer(int fid, int step, const char* groupname, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_PolyData_Polygon(int fid, int numPoints, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_Sol_PolyData_Polyline(int fid, int numPoints, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Write_Sol_PolyData_Polygon(int fid, int numPoints, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_PolyData_Polyline(int fid, int numPoints, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_PolyData_GeometryMulti(int fid, IntArrayContainer& INPUT, IntArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_PolyData_IntegerMulti(int fid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_PolyData_RealMulti(int fid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_Cell_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_Cell_Real_WithGridId(int fid, int gid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Cell_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Cell_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Integer_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& INPUT, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Real_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& INPUT, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Integer_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Real_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Integer_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Cell_Real_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_Cell_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Cell_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_Grid2d_Coords_WithGridId(int fid, int gid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Sol_Grid3d_Coords_WithGridId(int fid, int gid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
-int cg_iRIC_Write_Sol_Grid2d_Coords_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_Sol_Grid3d_Coords_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Write_Sol_Grid2d_Coords_WithGridId(int fid, int gid, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Grid3d_Coords_WithGridId(int fid, int gid, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_IFace_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_IFace_Real_WithGridId(int fid, int gid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_IFace_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_IFace_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_IFace_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_IFace_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_JFace_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_JFace_Real_WithGridId(int fid, int gid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_JFace_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_JFace_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_JFace_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_JFace_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_KFace_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_KFace_Real_WithGridId(int fid, int gid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_KFace_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_KFace_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_KFace_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_KFace_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_Node_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_Node_Real_WithGridId(int fid, int gid, int step, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Node_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Node_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& INPUT, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Real_Series_WithGridId(int fid, int gid, const char* name, int count, IntArrayContainer& INPUT, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int stride, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId(int fid, int gid, int step, const char* name, int imin, int imax, int jmin, int jmax, int kmin, int kmax, int stride, RealArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_Node_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Node_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_Particle_Pos2d_WithGridId(int fid, int gid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Sol_Particle_Pos3d_WithGridId(int fid, int gid, int step, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int cg_iRIC_Read_Sol_Particle_Real_WithGridId(int fid, int gid, int step, const char* name, RealArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_Particle_Integer_WithGridId(int fid, int gid, int step, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_Sol_Particle_Pos3d_WithGridId(int fid, int gid, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
-int cg_iRIC_Write_Sol_Particle_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_Particle_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Read_Sol_Particle_RectReal_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId(int fid, int gid, int step, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(int fid, int gid, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Particle_Pos3d_WithGridId(int fid, int gid, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Particle_Real_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_Particle_Integer_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_ParticleGroup_Pos2d_WithGridId(int fid, int gid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Sol_ParticleGroup_Pos3d_WithGridId(int fid, int gid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
 int cg_iRIC_Read_Sol_ParticleGroup_Real_WithGridId(int fid, int gid, int step, const char* groupname, const char* name, RealArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(int fid, int gid, int step, const char* groupname, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, int* OUTPUT);
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, IntArrayContainer& pid_arr, IntArrayContainer& step_arr, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId(int fid, int gid, const char* groupname, int count, IntArrayContainer& id_arr, int step_min, int step_max, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& z_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, RealArrayContainer& v_arr);
+int cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId(int fid, int gid, int step, const char* groupname, double xmin, double xmax, double ymin, double ymax, const char* name, IntArrayContainer& v_arr);
+int cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(int fid, int gid, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(int fid, int gid, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d_WithGridId(int fid, int gid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr, RealArrayContainer& size_arr, RealArrayContainer& angle_arr);
+int cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(int fid, int gid, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
 int cg_iRIC_Read_Sol_PolyData_Pos2d_WithGridId(int fid, int gid, int step, const char* groupname, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
 int cg_iRIC_Read_Sol_PolyData_Type_WithGridId(int fid, int gid, int step, const char* groupname, IntArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_PolyData_Real_WithGridId(int fid, int gid, int step, const char* groupname, const char* name, RealArrayContainer& v_arr);
 int cg_iRIC_Read_Sol_PolyData_Integer_WithGridId(int fid, int gid, int step, const char* groupname, const char* name, IntArrayContainer& v_arr);
-int cg_iRIC_Write_Sol_PolyData_Polygon_WithGridId(int fid, int gid, int numPoints, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
-int cg_iRIC_Write_Sol_PolyData_Polyline_WithGridId(int fid, int gid, int numPoints, RealArrayContainer& x_arr, RealArrayContainer& y_arr);
+int cg_iRIC_Write_Sol_PolyData_Polygon_WithGridId(int fid, int gid, int numPoints, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_PolyData_Polyline_WithGridId(int fid, int gid, int numPoints, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(int fid, int gid, IntArrayContainer& INPUT, IntArrayContainer& INPUT, RealArrayContainer& INPUT, RealArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(int fid, int gid, const char* name, IntArrayContainer& INPUT);
+int cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(int fid, int gid, const char* name, RealArrayContainer& INPUT);
 
@@ -73,10 +73,24 @@ CG_MODE_MODIFY = 2
 IRIC_MODE_READ = 0
 IRIC_MODE_WRITE = 1
 IRIC_MODE_MODIFY = 2
+IRIC_MODE_READ_SWMR = 3
 
 IRIC_OPTION_CANCEL = 1
 IRIC_OPTION_DIVIDESOLUTIONS = 2
 IRIC_OPTION_STDSOLUTION = 3
+IRIC_OPTION_SWMRSOLUTIONS = 4
+IRIC_OPTION_SHAREDGRIDSOLUTIONS = 5
+IRIC_OPTION_FILEACCESS_DEFAULT = 6
+IRIC_OPTION_FILEACCESS_SOLVERWRITE = 7
+IRIC_OPTION_FILEACCESS_GUIREAD = 8
+IRIC_OPTION_FILEACCESS_ARCHIVE = 9
+
+IRIC_COMPRESSION_NONE = 0
+IRIC_COMPRESSION_DEFLATE = 1
+IRIC_COMPRESSION_SZIP = 2
+
+IRIC_SPATIALINDEX_BACKGRID = 0
+IRIC_SPATIALINDEX_BVH = 1
 
 class IntArrayContainer(object):
     thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc="The membership flag")
@@ -498,6 +512,10 @@ def cg_iRIC_Read_Grid2d_Close(grid_handle):
 	ier = _iric.cg_iRIC_Read_Grid2d_Close(grid_handle)
 	_checkErrorCode(ier)
 
+def cg_iRIC_Set_Grid2d_SpatialIndex(grid_handle, type):
+	ier = _iric.cg_iRIC_Set_Grid2d_SpatialIndex(grid_handle, type)
+	_checkErrorCode(ier)
+
 def cg_iRIC_Read_Grid2d_CellArea(grid_handle, cellId):
 	ier, area = _iric.cg_iRIC_Read_Grid2d_CellArea(grid_handle, cellId)
 	_checkErrorCode(ier)
@@ -513,6 +531,11 @@ def cg_iRIC_Read_Grid2d_CellNodeCount(grid_handle, cellId):
 	_checkErrorCode(ier)
 	return count
 
+def cg_iRIC_Read_Grid2d_FindCellWithHint(grid_handle, x, y, hintCellId):
+	ier, cellId = _iric.cg_iRIC_Read_Grid2d_FindCellWithHint(grid_handle, x, y, hintCellId)
+	_checkErrorCode(ier)
+	return cellId
+
 
 # from iriclib_gui_coorp.h
 def iRIC_Check_Cancel():
@@ -538,6 +561,22 @@ def iRIC_InitOption(option):
 	ier = _iric.iRIC_InitOption(option)
 	_checkErrorCode(ier)
 
+def cg_iRIC_Set_StoragePolicy(fid, compression, level, shuffle):
+	ier = _iric.cg_iRIC_Set_StoragePolicy(fid, compression, level, shuffle)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Set_StorageChunking(fid, contiguous_limit, chunk_size):
+	ier = _iric.cg_iRIC_Set_StorageChunking(fid, contiguous_limit, chunk_size)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Set_ParticleGroupTrajectory(fid, idname):
+	ier = _iric.cg_iRIC_Set_ParticleGroupTrajectory(fid, idname)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Set_ParticleBins(fid, level):
+	ier = _iric.cg_iRIC_Set_ParticleBins(fid, level)
+	_checkErrorCode(ier)
+
 
 # from iriclib_not_withbaseid.h
 def cg_iRIC_Read_Complex_Count(fid, groupname):
@@ -965,1613 +1004,1846 @@ def cg_iRIC_Clear_Sol(fid):
 	ier = _iric.cg_iRIC_Clear_Sol(fid)
 	_checkErrorCode(ier)
 
+def cg_iRIC_Set_Sol_Cache(fid, capacity, prefetch):
+	ier = _iric.cg_iRIC_Set_Sol_Cache(fid, capacity, prefetch)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Read_Sol_CacheStats(fid):
+	ier, hits, misses = _iric.cg_iRIC_Read_Sol_CacheStats(fid)
+	_checkErrorCode(ier)
+	return hits, misses
+
+def cg_iRIC_Set_Sol_AsyncWrite(fid, queueSize):
+	ier = _iric.cg_iRIC_Set_Sol_AsyncWrite(fid, queueSize)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Read_Sol_AsyncWriteStats(fid):
+	ier, maxQueueDepth, stallSeconds = _iric.cg_iRIC_Read_Sol_AsyncWriteStats(fid)
+	_checkErrorCode(ier)
+	return maxQueueDepth, stallSeconds
+
+def cg_iRIC_Read_Sol_Refresh(fid):
+	ier = _iric.cg_iRIC_Read_Sol_Refresh(fid)
+	_checkErrorCode(ier)
+
 
 # from iriclib_wrapper.h
 def cg_iRIC_Read_BC_Indices_WithGridId(fid, gid, type, num):
 	size = cg_iRIC_Read_BC_IndicesSize2_WithGridId(fid, gid, type, num)
-	idx = IntArrayContainer(size)
+	idx = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_BC_Indices_WithGridId(fid, gid, type, num, idx)
 	_checkErrorCode(ier)
-	return idx.get()
+	return idx
 
 def cg_iRIC_Read_BC_Functional_WithGridId(fid, gid, type, num, name):
 	size = cg_iRIC_Read_BC_FunctionalSize_WithGridId(fid, gid, type, num, name)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_BC_Functional_WithGridId(fid, gid, type, num, name, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_BC_FunctionalWithName_WithGridId(fid, gid, type, num, name, paramname):
 	size = cg_iRIC_Read_BC_FunctionalSize_WithGridId(fid, gid, type, num, name)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_BC_FunctionalWithName_WithGridId(fid, gid, type, num, name, paramname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_BC_Indices_WithGridId(fid, gid, type, num, idx_arr):
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_BC_Indices_WithGridId(fid, gid, type, num, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_BC_Indices2_WithGridId(fid, gid, type, num, idx_arr):
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_BC_Indices2_WithGridId(fid, gid, type, num, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_BC_Functional_WithGridId(fid, gid, type, num, name, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_BC_Functional_WithGridId(fid, gid, type, num, name, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_BC_FunctionalWithName_WithGridId(fid, gid, type, num, name, paramname, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_BC_FunctionalWithName_WithGridId(fid, gid, type, num, name, paramname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Functional(fid, name):
 	size = cg_iRIC_Read_FunctionalSize(fid, name)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Functional(fid, name, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_FunctionalWithName(fid, name, paramname):
 	size = cg_iRIC_Read_FunctionalSize(fid, name)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_FunctionalWithName(fid, name, paramname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Functional(fid, name, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Functional(fid, name, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_FunctionalWithName(fid, name, paramname, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_FunctionalWithName(fid, name, paramname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Complex_Functional_WithBaseId(fid, bid, groupname, num, name):
 	size = cg_iRIC_Read_Complex_FunctionalSize_WithBaseId(fid, bid, groupname, num, name)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Complex_Functional_WithBaseId(fid, bid, groupname, num, name, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Complex_FunctionalWithName_WithBaseId(fid, bid, groupname, num, name, paramname):
 	size = cg_iRIC_Read_Complex_FunctionalSize_WithBaseId(fid, bid, groupname, num, name)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Complex_FunctionalWithName_WithBaseId(fid, bid, groupname, num, name, paramname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Complex_Node_WithGridId(fid, gid, groupname):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Complex_Node_WithGridId(fid, gid, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Complex_Cell_WithGridId(fid, gid, groupname):
 	size = cg_iRIC_Read_Grid_CellCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Complex_Cell_WithGridId(fid, gid, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Complex_IFace_WithGridId(fid, gid, groupname):
 	size = cg_iRIC_Read_Grid_IFaceCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Complex_IFace_WithGridId(fid, gid, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Complex_JFace_WithGridId(fid, gid, groupname):
 	size = cg_iRIC_Read_Grid_JFaceCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Complex_JFace_WithGridId(fid, gid, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Complex_Functional_WithBaseId(fid, bid, groupname, num, name, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Complex_Functional_WithBaseId(fid, bid, groupname, num, name, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Complex_FunctionalWithName_WithBaseId(fid, bid, groupname, num, name, paramname, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Complex_FunctionalWithName_WithBaseId(fid, bid, groupname, num, name, paramname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Complex_Node_WithGridId(fid, gid, groupname, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Complex_Node_WithGridId(fid, gid, groupname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Complex_Cell_WithGridId(fid, gid, groupname, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Complex_Cell_WithGridId(fid, gid, groupname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Complex_IFace_WithGridId(fid, gid, groupname, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Complex_IFace_WithGridId(fid, gid, groupname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Complex_JFace_WithGridId(fid, gid, groupname, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Complex_JFace_WithGridId(fid, gid, groupname, v)
 	_checkErrorCode(ier)
 
 def iRIC_Geo_Polygon_Read_Points(geo_handle):
 	size = iRIC_Geo_Polygon_Read_PointCount(geo_handle)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.iRIC_Geo_Polygon_Read_Points(geo_handle, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def iRIC_Geo_Polygon_Read_HolePoints(geo_handle, holeid):
 	size = iRIC_Geo_Polygon_Read_HolePointCount(geo_handle, holeid)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.iRIC_Geo_Polygon_Read_HolePoints(geo_handle, holeid, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def iRIC_Geo_RiverSurvey_Read_Altitudes(geo_handle, csid):
 	size = iRIC_Geo_RiverSurvey_Read_AltitudeCount(geo_handle, csid)
-	position = RealArrayContainer(size)
-	height = RealArrayContainer(size)
-	active = IntArrayContainer(size)
+	position = np.zeros(size, dtype=np.float64)
+	height = np.zeros(size, dtype=np.float64)
+	active = np.zeros(size, dtype=np.int32)
 	ier = _iric.iRIC_Geo_RiverSurvey_Read_Altitudes(geo_handle, csid, position, height, active)
 	_checkErrorCode(ier)
-	return position.get(), height.get(), active.get()
+	return position, height, active
 
 def cg_iRIC_Read_Grid2d_Coords_WithGridId(fid, gid):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid2d_Coords_WithGridId(fid, gid, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Grid3d_Coords_WithGridId(fid, gid):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	z = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	z = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid3d_Coords_WithGridId(fid, gid, x, y, z)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), z.get()
+	return x, y, z
 
 def cg_iRIC_Read_Grid_TriangleElements_WithGridId(fid, gid):
 	size = cg_iRIC_Read_Grid_TriangleElementsSize2_WithGridId(fid, gid)
-	id = IntArrayContainer(size)
+	id = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_TriangleElements_WithGridId(fid, gid, id)
 	_checkErrorCode(ier)
-	return id.get()
+	return id
 
 def cg_iRIC_Read_Grid_LineElements_WithGridId(fid, gid):
 	size = cg_iRIC_Read_Grid_LineElementsSize2_WithGridId(fid, gid)
-	id = IntArrayContainer(size)
+	id = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_LineElements_WithGridId(fid, gid, id)
 	_checkErrorCode(ier)
-	return id.get()
+	return id
 
 def cg_iRIC_Read_Grid_Real_Node_WithGridId(fid, gid, name):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Real_Node_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Integer_Node_WithGridId(fid, gid, name):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Integer_Node_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Real_Cell_WithGridId(fid, gid, name):
 	size = cg_iRIC_Read_Grid_CellCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Real_Cell_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Integer_Cell_WithGridId(fid, gid, name):
 	size = cg_iRIC_Read_Grid_CellCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Integer_Cell_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Real_IFace_WithGridId(fid, gid, name):
 	size = cg_iRIC_Read_Grid_IFaceCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Real_IFace_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Integer_IFace_WithGridId(fid, gid, name):
 	size = cg_iRIC_Read_Grid_IFaceCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Integer_IFace_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Real_JFace_WithGridId(fid, gid, name):
 	size = cg_iRIC_Read_Grid_JFaceCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Real_JFace_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Integer_JFace_WithGridId(fid, gid, name):
 	size = cg_iRIC_Read_Grid_JFaceCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Integer_JFace_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_FunctionalDimension_Integer_WithGridId(fid, gid, name, dimname):
 	size = cg_iRIC_Read_Grid_FunctionalDimensionSize_WithGridId(fid, gid, name, dimname)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_FunctionalDimension_Integer_WithGridId(fid, gid, name, dimname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_FunctionalDimension_Real_WithGridId(fid, gid, name, dimname):
 	size = cg_iRIC_Read_Grid_FunctionalDimensionSize_WithGridId(fid, gid, name, dimname)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_FunctionalDimension_Real_WithGridId(fid, gid, name, dimname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_FunctionalTime_WithGridId(fid, gid, name):
 	size = cg_iRIC_Read_Grid_FunctionalTimeSize_WithGridId(fid, gid, name)
-	time = RealArrayContainer(size)
+	time = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_FunctionalTime_WithGridId(fid, gid, name, time)
 	_checkErrorCode(ier)
-	return time.get()
+	return time
 
 def cg_iRIC_Read_Grid_Functional_Integer_Node_WithGridId(fid, gid, name, dimid):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Integer_Node_WithGridId(fid, gid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Real_Node_WithGridId(fid, gid, name, dimid):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Real_Node_WithGridId(fid, gid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Integer_Cell_WithGridId(fid, gid, name, dimid):
 	size = cg_iRIC_Read_Grid_CellCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Integer_Cell_WithGridId(fid, gid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Real_Cell_WithGridId(fid, gid, name, dimid):
 	size = cg_iRIC_Read_Grid_CellCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Real_Cell_WithGridId(fid, gid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Integer_IFace_WithGridId(fid, gid, name, dimid):
 	size = cg_iRIC_Read_Grid_IFaceCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Integer_IFace_WithGridId(fid, gid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Real_IFace_WithGridId(fid, gid, name, dimid):
 	size = cg_iRIC_Read_Grid_IFaceCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Real_IFace_WithGridId(fid, gid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Integer_JFace_WithGridId(fid, gid, name, dimid):
 	size = cg_iRIC_Read_Grid_JFaceCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Integer_JFace_WithGridId(fid, gid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Real_JFace_WithGridId(fid, gid, name, dimid):
 	size = cg_iRIC_Read_Grid_JFaceCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Real_JFace_WithGridId(fid, gid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Grid1d_Coords_WithGridId(fid, isize, x_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
 	ier, gid = _iric.cg_iRIC_Write_Grid1d_Coords_WithGridId(fid, isize, x)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_Grid2d_Coords_WithGridId(fid, isize, jsize, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier, gid = _iric.cg_iRIC_Write_Grid2d_Coords_WithGridId(fid, isize, jsize, x, y)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_Grid3d_Coords_WithGridId(fid, isize, jsize, ksize, x_arr, y_arr, z_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
 	ier, gid = _iric.cg_iRIC_Write_Grid3d_Coords_WithGridId(fid, isize, jsize, ksize, x, y, z)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_NamedGrid1d_Coords_WithGridId(fid, name, isize, x_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
 	ier, gid = _iric.cg_iRIC_Write_NamedGrid1d_Coords_WithGridId(fid, name, isize, x)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_NamedGrid2d_Coords_WithGridId(fid, name, isize, jsize, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier, gid = _iric.cg_iRIC_Write_NamedGrid2d_Coords_WithGridId(fid, name, isize, jsize, x, y)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_NamedGrid3d_Coords_WithGridId(fid, name, isize, jsize, ksize, x_arr, y_arr, z_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
 	ier, gid = _iric.cg_iRIC_Write_NamedGrid3d_Coords_WithGridId(fid, name, isize, jsize, ksize, x, y, z)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_Grid2d_Unst_Triangles_WithGridId(fid, psize, x_arr, y_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier, gid = _iric.cg_iRIC_Write_Grid2d_Unst_Triangles_WithGridId(fid, psize, x, y, csize, idx)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_Grid2d_Unst_Lines_WithGridId(fid, psize, x_arr, y_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier, gid = _iric.cg_iRIC_Write_Grid2d_Unst_Lines_WithGridId(fid, psize, x, y, csize, idx)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_Grid3d_Unst_Lines_WithGridId(fid, psize, x_arr, y_arr, z_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier, gid = _iric.cg_iRIC_Write_Grid3d_Unst_Lines_WithGridId(fid, psize, x, y, z, csize, idx)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_NamedGrid2d_Unst_Triangles_WithGridId(fid, name, psize, x_arr, y_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier, gid = _iric.cg_iRIC_Write_NamedGrid2d_Unst_Triangles_WithGridId(fid, name, psize, x, y, csize, idx)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_NamedGrid2d_Unst_Lines_WithGridId(fid, name, psize, x_arr, y_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier, gid = _iric.cg_iRIC_Write_NamedGrid2d_Unst_Lines_WithGridId(fid, name, psize, x, y, csize, idx)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_NamedGrid3d_Unst_Lines_WithGridId(fid, name, psize, x_arr, y_arr, z_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier, gid = _iric.cg_iRIC_Write_NamedGrid3d_Unst_Lines_WithGridId(fid, name, psize, x, y, z, csize, idx)
 	_checkErrorCode(ier)
 	return gid
 
 def cg_iRIC_Write_Grid_Real_Node_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid_Real_Node_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Integer_Node_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Integer_Node_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Real_Cell_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid_Real_Cell_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Integer_Cell_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Integer_Cell_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Real_IFace_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid_Real_IFace_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Integer_IFace_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Integer_IFace_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Real_JFace_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid_Real_JFace_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Integer_JFace_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Integer_JFace_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Grid2d_InterpolateWithCell(grid_handle, x, y, cellId):
 	size = cg_iRIC_Read_Grid2d_CellNodeCount(grid_handle, cellId)
-	nodeids = IntArrayContainer(size)
-	weights = RealArrayContainer(size)
+	nodeids = np.zeros(size, dtype=np.int32)
+	weights = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid2d_InterpolateWithCell(grid_handle, x, y, cellId, nodeids, weights)
 	_checkErrorCode(ier)
-	return nodeids.get(), weights.get()
+	return nodeids, weights
 
 def cg_iRIC_Read_Complex_Functional(fid, groupname, num, name):
 	size = cg_iRIC_Read_Complex_FunctionalSize(fid, groupname, num, name)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Complex_Functional(fid, groupname, num, name, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Complex_FunctionalWithName(fid, groupname, num, name, paramname):
 	size = cg_iRIC_Read_Complex_FunctionalSize(fid, groupname, num, name)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Complex_FunctionalWithName(fid, groupname, num, name, paramname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Complex_Functional(fid, groupname, num, name, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Complex_Functional(fid, groupname, num, name, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Complex_FunctionalWithName(fid, groupname, num, name, paramname, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Complex_FunctionalWithName(fid, groupname, num, name, paramname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_BC_Indices(fid, type, num):
 	size = cg_iRIC_Read_BC_IndicesSize2(fid, type, num)
-	idx = IntArrayContainer(size)
+	idx = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_BC_Indices(fid, type, num, idx)
 	_checkErrorCode(ier)
-	return idx.get()
+	return idx
 
 def cg_iRIC_Read_BC_Functional(fid, type, num, name):
 	size = cg_iRIC_Read_BC_FunctionalSize(fid, type, num, name)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_BC_Functional(fid, type, num, name, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_BC_FunctionalWithName(fid, type, num, name, paramname):
 	size = cg_iRIC_Read_BC_FunctionalSize(fid, type, num, name)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_BC_FunctionalWithName(fid, type, num, name, paramname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_BC_Indices(fid, type, num, idx_arr):
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_BC_Indices(fid, type, num, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_BC_Indices2(fid, type, num, idx_arr):
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_BC_Indices2(fid, type, num, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_BC_Functional(fid, type, num, name, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_BC_Functional(fid, type, num, name, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_BC_FunctionalWithName(fid, type, num, name, paramname, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_BC_FunctionalWithName(fid, type, num, name, paramname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Grid_Complex_Node(fid, groupname):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Complex_Node(fid, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Complex_Cell(fid, groupname):
 	size = cg_iRIC_Read_Grid_CellCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Complex_Cell(fid, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Complex_IFace(fid, groupname):
 	size = cg_iRIC_Read_Grid_IFaceCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Complex_IFace(fid, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Complex_JFace(fid, groupname):
 	size = cg_iRIC_Read_Grid_JFaceCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Complex_JFace(fid, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Grid_Complex_Node(fid, groupname, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Complex_Node(fid, groupname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Complex_Cell(fid, groupname, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Complex_Cell(fid, groupname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Complex_IFace(fid, groupname, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Complex_IFace(fid, groupname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Complex_JFace(fid, groupname, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Complex_JFace(fid, groupname, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Grid2d_Coords(fid):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid2d_Coords(fid, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Grid3d_Coords(fid):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	z = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	z = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid3d_Coords(fid, x, y, z)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), z.get()
+	return x, y, z
 
 def cg_iRIC_Read_Grid_TriangleElements(fid):
 	size = cg_iRIC_Read_Grid_TriangleElementsSize2(fid)
-	id = IntArrayContainer(size)
+	id = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_TriangleElements(fid, id)
 	_checkErrorCode(ier)
-	return id.get()
+	return id
 
 def cg_iRIC_Read_Grid_LineElements(fid):
 	size = cg_iRIC_Read_Grid_LineElementsSize2(fid)
-	id = IntArrayContainer(size)
+	id = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_LineElements(fid, id)
 	_checkErrorCode(ier)
-	return id.get()
+	return id
 
 def cg_iRIC_Read_Grid_Real_Node(fid, name):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Real_Node(fid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Integer_Node(fid, name):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Integer_Node(fid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Real_Cell(fid, name):
 	size = cg_iRIC_Read_Grid_CellCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Real_Cell(fid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Integer_Cell(fid, name):
 	size = cg_iRIC_Read_Grid_CellCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Integer_Cell(fid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Real_IFace(fid, name):
 	size = cg_iRIC_Read_Grid_IFaceCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Real_IFace(fid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Integer_IFace(fid, name):
 	size = cg_iRIC_Read_Grid_IFaceCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Integer_IFace(fid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Real_JFace(fid, name):
 	size = cg_iRIC_Read_Grid_JFaceCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Real_JFace(fid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Integer_JFace(fid, name):
 	size = cg_iRIC_Read_Grid_JFaceCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Integer_JFace(fid, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_FunctionalDimension_Integer(fid, name, dimname):
 	size = cg_iRIC_Read_Grid_FunctionalDimensionSize(fid, name, dimname)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_FunctionalDimension_Integer(fid, name, dimname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_FunctionalDimension_Real(fid, name, dimname):
 	size = cg_iRIC_Read_Grid_FunctionalDimensionSize(fid, name, dimname)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_FunctionalDimension_Real(fid, name, dimname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_FunctionalTime(fid, name):
 	size = cg_iRIC_Read_Grid_FunctionalTimeSize(fid, name)
-	time = RealArrayContainer(size)
+	time = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_FunctionalTime(fid, name, time)
 	_checkErrorCode(ier)
-	return time.get()
+	return time
 
 def cg_iRIC_Read_Grid_Functional_Integer_Node(fid, name, dimid):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Integer_Node(fid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Real_Node(fid, name, dimid):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Real_Node(fid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Integer_Cell(fid, name, dimid):
 	size = cg_iRIC_Read_Grid_CellCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Integer_Cell(fid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Real_Cell(fid, name, dimid):
 	size = cg_iRIC_Read_Grid_CellCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Real_Cell(fid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Integer_IFace(fid, name, dimid):
 	size = cg_iRIC_Read_Grid_IFaceCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Integer_IFace(fid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Real_IFace(fid, name, dimid):
 	size = cg_iRIC_Read_Grid_IFaceCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Real_IFace(fid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Integer_JFace(fid, name, dimid):
 	size = cg_iRIC_Read_Grid_JFaceCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Integer_JFace(fid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Grid_Functional_Real_JFace(fid, name, dimid):
 	size = cg_iRIC_Read_Grid_JFaceCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Grid_Functional_Real_JFace(fid, name, dimid, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Grid1d_Coords(fid, isize, x_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid1d_Coords(fid, isize, x)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid2d_Coords(fid, isize, jsize, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid2d_Coords(fid, isize, jsize, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid3d_Coords(fid, isize, jsize, ksize, x_arr, y_arr, z_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid3d_Coords(fid, isize, jsize, ksize, x, y, z)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_NamedGrid1d_Coords(fid, name, isize, x_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_NamedGrid1d_Coords(fid, name, isize, x)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_NamedGrid2d_Coords(fid, name, isize, jsize, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_NamedGrid2d_Coords(fid, name, isize, jsize, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_NamedGrid3d_Coords(fid, name, isize, jsize, ksize, x_arr, y_arr, z_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_NamedGrid3d_Coords(fid, name, isize, jsize, ksize, x, y, z)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid2d_Unst_Triangles(fid, psize, x_arr, y_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid2d_Unst_Triangles(fid, psize, x, y, csize, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid2d_Unst_Lines(fid, psize, x_arr, y_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid2d_Unst_Lines(fid, psize, x, y, csize, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid3d_Unst_Lines(fid, psize, x_arr, y_arr, z_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid3d_Unst_Lines(fid, psize, x, y, z, csize, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_NamedGrid2d_Unst_Triangles(fid, name, psize, x_arr, y_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_NamedGrid2d_Unst_Triangles(fid, name, psize, x, y, csize, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_NamedGrid2d_Unst_Lines(fid, name, psize, x_arr, y_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_NamedGrid2d_Unst_Lines(fid, name, psize, x, y, csize, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_NamedGrid3d_Unst_Lines(fid, name, psize, x_arr, y_arr, z_arr, csize, idx_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
-	idx = IntArrayContainer(idx_arr.size)
-	idx.set(idx_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
+	idx = np.ascontiguousarray(idx_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_NamedGrid3d_Unst_Lines(fid, name, psize, x, y, z, csize, idx)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Real_Node(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid_Real_Node(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Integer_Node(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Integer_Node(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Real_Cell(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid_Real_Cell(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Integer_Cell(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Integer_Cell(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Real_IFace(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid_Real_IFace(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Integer_IFace(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Integer_IFace(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Real_JFace(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Grid_Real_JFace(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Grid_Integer_JFace(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Grid_Integer_JFace(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_Cell_Integer(fid, step, name):
 	size = cg_iRIC_Read_Grid_CellCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_Cell_Integer(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_Cell_Real(fid, step, name):
 	size = cg_iRIC_Read_Grid_CellCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Cell_Real(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_Cell_Integer(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_Cell_Integer(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Cell_Real(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Cell_Real(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_Grid2d_Coords(fid, step):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Grid2d_Coords(fid, step, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Sol_Grid3d_Coords(fid, step):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	z = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	z = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Grid3d_Coords(fid, step, x, y, z)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), z.get()
+	return x, y, z
 
 def cg_iRIC_Write_Sol_Grid2d_Coords(fid, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Grid2d_Coords(fid, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Grid3d_Coords(fid, x_arr, y_arr, z_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Grid3d_Coords(fid, x, y, z)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_IFace_Integer(fid, step, name):
 	size = cg_iRIC_Read_Grid_IFaceCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_IFace_Integer(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_IFace_Real(fid, step, name):
 	size = cg_iRIC_Read_Grid_IFaceCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_IFace_Real(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_IFace_Integer(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_IFace_Integer(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_IFace_Real(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_IFace_Real(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_JFace_Integer(fid, step, name):
 	size = cg_iRIC_Read_Grid_JFaceCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_JFace_Integer(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_JFace_Real(fid, step, name):
 	size = cg_iRIC_Read_Grid_JFaceCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_JFace_Real(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_JFace_Integer(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_JFace_Integer(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_JFace_Real(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_JFace_Real(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_KFace_Integer(fid, step, name):
 	size = cg_iRIC_Read_Grid_KFaceCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_KFace_Integer(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_KFace_Real(fid, step, name):
 	size = cg_iRIC_Read_Grid_KFaceCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_KFace_Real(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_KFace_Integer(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_KFace_Integer(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_KFace_Real(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_KFace_Real(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_Node_Integer(fid, step, name):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_Node_Integer(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_Node_Real(fid, step, name):
 	size = cg_iRIC_Read_Grid_NodeCount(fid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Node_Real(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_Node_Integer(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_Node_Integer(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Node_Real(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Node_Real(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_Particle_Pos2d(fid, step):
 	size = cg_iRIC_Read_Sol_Particle_Count(fid, step)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Particle_Pos2d(fid, step, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Sol_Particle_Pos3d(fid, step):
 	size = cg_iRIC_Read_Sol_Particle_Count(fid, step)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	z = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	z = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Particle_Pos3d(fid, step, x, y, z)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), z.get()
+	return x, y, z
 
 def cg_iRIC_Read_Sol_Particle_Real(fid, step, name):
 	size = cg_iRIC_Read_Sol_Particle_Count(fid, step)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Particle_Real(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_Particle_Integer(fid, step, name):
 	size = cg_iRIC_Read_Sol_Particle_Count(fid, step)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_Particle_Integer(fid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_Particle_Pos2d(fid, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Particle_Pos2d(fid, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Particle_Pos3d(fid, x_arr, y_arr, z_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Particle_Pos3d(fid, x, y, z)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Particle_Real(fid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Particle_Real(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Particle_Integer(fid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_Particle_Integer(fid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_ParticleGroup_Pos2d(fid, step, groupname):
 	size = cg_iRIC_Read_Sol_ParticleGroup_Count(fid, step, groupname)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroup_Pos2d(fid, step, groupname, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Sol_ParticleGroup_Pos3d(fid, step, groupname):
 	size = cg_iRIC_Read_Sol_ParticleGroup_Count(fid, step, groupname)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	z = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	z = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroup_Pos3d(fid, step, groupname, x, y, z)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), z.get()
+	return x, y, z
 
 def cg_iRIC_Read_Sol_ParticleGroup_Real(fid, step, groupname, name):
 	size = cg_iRIC_Read_Sol_ParticleGroup_Count(fid, step, groupname)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroup_Real(fid, step, groupname, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_ParticleGroup_Integer(fid, step, groupname, name):
 	size = cg_iRIC_Read_Sol_ParticleGroup_Count(fid, step, groupname)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroup_Integer(fid, step, groupname, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
+
+def cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, x_arr, y_arr):
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, x, y)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti(fid, x_arr, y_arr, z_arr):
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti(fid, x, y, z)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, name, v_arr):
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, name, v)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, name, v_arr):
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, name, v)
+	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d(fid, step, groupname):
 	size = cg_iRIC_Read_Sol_ParticleGroupImage_Count(fid, step, groupname)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	size = RealArrayContainer(size)
-	angle = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	size = np.zeros(size, dtype=np.float64)
+	angle = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d(fid, step, groupname, x, y, size, angle)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), size.get(), angle.get()
+	return x, y, size, angle
+
+def cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(fid, x_arr, y_arr, size_arr, angle_arr):
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	size = np.ascontiguousarray(size_arr, dtype=np.float64)
+	angle = np.ascontiguousarray(angle_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(fid, x, y, size, angle)
+	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_PolyData_Pos2d(fid, step, groupname):
 	size = cg_iRIC_Read_Sol_PolyData_CoordinateCount(fid, step, groupname)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_PolyData_Pos2d(fid, step, groupname, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Sol_PolyData_Type(fid, step, groupname):
 	size = cg_iRIC_Read_Sol_PolyData_DataCount(fid, step, groupname)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_PolyData_Type(fid, step, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_PolyData_Real(fid, step, groupname, name):
 	size = cg_iRIC_Read_Sol_PolyData_DataCount(fid, step, groupname)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_PolyData_Real(fid, step, groupname, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_PolyData_Integer(fid, step, groupname, name):
 	size = cg_iRIC_Read_Sol_PolyData_DataCount(fid, step, groupname)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_PolyData_Integer(fid, step, groupname, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_PolyData_Polygon(fid, numPoints, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_PolyData_Polygon(fid, numPoints, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_PolyData_Polyline(fid, numPoints, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_PolyData_Polyline(fid, numPoints, x, y)
 	_checkErrorCode(ier)
 
+def cg_iRIC_Write_Sol_PolyData_GeometryMulti(fid, types_arr, offsets_arr, x_arr, y_arr):
+	types = np.ascontiguousarray(types_arr, dtype=np.int32)
+	offsets = np.ascontiguousarray(offsets_arr, dtype=np.int32)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_PolyData_GeometryMulti(fid, types, offsets, x, y)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_PolyData_IntegerMulti(fid, name, v_arr):
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
+	ier = _iric.cg_iRIC_Write_Sol_PolyData_IntegerMulti(fid, name, v)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_PolyData_RealMulti(fid, name, v_arr):
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_PolyData_RealMulti(fid, name, v)
+	_checkErrorCode(ier)
+
 def cg_iRIC_Read_Sol_Cell_Integer_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_CellCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_Cell_Integer_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_Cell_Real_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_CellCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Cell_Real_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_Cell_Integer_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_Cell_Integer_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Cell_Real_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Cell_Real_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_Grid2d_Coords_WithGridId(fid, gid, step):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Grid2d_Coords_WithGridId(fid, gid, step, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Sol_Grid3d_Coords_WithGridId(fid, gid, step):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	z = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	z = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Grid3d_Coords_WithGridId(fid, gid, step, x, y, z)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), z.get()
+	return x, y, z
 
 def cg_iRIC_Write_Sol_Grid2d_Coords_WithGridId(fid, gid, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Grid2d_Coords_WithGridId(fid, gid, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Grid3d_Coords_WithGridId(fid, gid, x_arr, y_arr, z_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Grid3d_Coords_WithGridId(fid, gid, x, y, z)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_IFace_Integer_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_IFaceCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_IFace_Integer_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_IFace_Real_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_IFaceCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_IFace_Real_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_IFace_Integer_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_IFace_Integer_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_IFace_Real_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_IFace_Real_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_JFace_Integer_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_JFaceCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_JFace_Integer_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_JFace_Real_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_JFaceCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_JFace_Real_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_JFace_Integer_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_JFace_Integer_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_JFace_Real_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_JFace_Real_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_KFace_Integer_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_KFaceCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_KFace_Integer_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_KFace_Real_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_KFaceCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_KFace_Real_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_KFace_Integer_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_KFace_Integer_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_KFace_Real_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_KFace_Real_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_Node_Integer_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_Node_Integer_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Grid_NodeCount_WithGridId(fid, gid)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_Node_Integer_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_Node_Integer_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Node_Real_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Node_Real_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_Particle_Pos2d_WithGridId(fid, gid, step):
 	size = cg_iRIC_Read_Sol_Particle_Count_WithGridId(fid, gid, step)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Particle_Pos2d_WithGridId(fid, gid, step, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Sol_Particle_Pos3d_WithGridId(fid, gid, step):
 	size = cg_iRIC_Read_Sol_Particle_Count_WithGridId(fid, gid, step)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	z = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	z = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Particle_Pos3d_WithGridId(fid, gid, step, x, y, z)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), z.get()
+	return x, y, z
 
 def cg_iRIC_Read_Sol_Particle_Real_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Sol_Particle_Count_WithGridId(fid, gid, step)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_Particle_Real_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_Particle_Integer_WithGridId(fid, gid, step, name):
 	size = cg_iRIC_Read_Sol_Particle_Count_WithGridId(fid, gid, step)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_Particle_Integer_WithGridId(fid, gid, step, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(fid, gid, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Particle_Pos2d_WithGridId(fid, gid, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Particle_Pos3d_WithGridId(fid, gid, x_arr, y_arr, z_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
-	z = RealArrayContainer(z_arr.size)
-	z.set(z_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Particle_Pos3d_WithGridId(fid, gid, x, y, z)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Particle_Real_WithGridId(fid, gid, name, v_arr):
-	v = RealArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_Particle_Real_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_Particle_Integer_WithGridId(fid, gid, name, v_arr):
-	v = IntArrayContainer(v_arr.size)
-	v.set(v_arr)
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
 	ier = _iric.cg_iRIC_Write_Sol_Particle_Integer_WithGridId(fid, gid, name, v)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_ParticleGroup_Pos2d_WithGridId(fid, gid, step, groupname):
 	size = cg_iRIC_Read_Sol_ParticleGroup_Count_WithGridId(fid, gid, step, groupname)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroup_Pos2d_WithGridId(fid, gid, step, groupname, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Sol_ParticleGroup_Pos3d_WithGridId(fid, gid, step, groupname):
 	size = cg_iRIC_Read_Sol_ParticleGroup_Count_WithGridId(fid, gid, step, groupname)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	z = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	z = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroup_Pos3d_WithGridId(fid, gid, step, groupname, x, y, z)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), z.get()
+	return x, y, z
 
 def cg_iRIC_Read_Sol_ParticleGroup_Real_WithGridId(fid, gid, step, groupname, name):
 	size = cg_iRIC_Read_Sol_ParticleGroup_Count_WithGridId(fid, gid, step, groupname)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroup_Real_WithGridId(fid, gid, step, groupname, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(fid, gid, step, groupname, name):
 	size = cg_iRIC_Read_Sol_ParticleGroup_Count_WithGridId(fid, gid, step, groupname)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroup_Integer_WithGridId(fid, gid, step, groupname, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
+
+def cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(fid, gid, x_arr, y_arr):
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti_WithGridId(fid, gid, x, y)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(fid, gid, x_arr, y_arr, z_arr):
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	z = np.ascontiguousarray(z_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroup_Pos3dMulti_WithGridId(fid, gid, x, y, z)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(fid, gid, name, v_arr):
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti_WithGridId(fid, gid, name, v)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(fid, gid, name, v_arr):
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroup_RealMulti_WithGridId(fid, gid, name, v)
+	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d_WithGridId(fid, gid, step, groupname):
 	size = cg_iRIC_Read_Sol_ParticleGroupImage_Count_WithGridId(fid, gid, step, groupname)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
-	size = RealArrayContainer(size)
-	angle = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
+	size = np.zeros(size, dtype=np.float64)
+	angle = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d_WithGridId(fid, gid, step, groupname, x, y, size, angle)
 	_checkErrorCode(ier)
-	return x.get(), y.get(), size.get(), angle.get()
+	return x, y, size, angle
+
+def cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(fid, gid, x_arr, y_arr, size_arr, angle_arr):
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	size = np.ascontiguousarray(size_arr, dtype=np.float64)
+	angle = np.ascontiguousarray(angle_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti_WithGridId(fid, gid, x, y, size, angle)
+	_checkErrorCode(ier)
 
 def cg_iRIC_Read_Sol_PolyData_Pos2d_WithGridId(fid, gid, step, groupname):
 	size = cg_iRIC_Read_Sol_PolyData_CoordinateCount_WithGridId(fid, gid, step, groupname)
-	x = RealArrayContainer(size)
-	y = RealArrayContainer(size)
+	x = np.zeros(size, dtype=np.float64)
+	y = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_PolyData_Pos2d_WithGridId(fid, gid, step, groupname, x, y)
 	_checkErrorCode(ier)
-	return x.get(), y.get()
+	return x, y
 
 def cg_iRIC_Read_Sol_PolyData_Type_WithGridId(fid, gid, step, groupname):
 	size = cg_iRIC_Read_Sol_PolyData_DataCount_WithGridId(fid, gid, step, groupname)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_PolyData_Type_WithGridId(fid, gid, step, groupname, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_PolyData_Real_WithGridId(fid, gid, step, groupname, name):
 	size = cg_iRIC_Read_Sol_PolyData_DataCount_WithGridId(fid, gid, step, groupname)
-	v = RealArrayContainer(size)
+	v = np.zeros(size, dtype=np.float64)
 	ier = _iric.cg_iRIC_Read_Sol_PolyData_Real_WithGridId(fid, gid, step, groupname, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Read_Sol_PolyData_Integer_WithGridId(fid, gid, step, groupname, name):
 	size = cg_iRIC_Read_Sol_PolyData_DataCount_WithGridId(fid, gid, step, groupname)
-	v = IntArrayContainer(size)
+	v = np.zeros(size, dtype=np.int32)
 	ier = _iric.cg_iRIC_Read_Sol_PolyData_Integer_WithGridId(fid, gid, step, groupname, name, v)
 	_checkErrorCode(ier)
-	return v.get()
+	return v
 
 def cg_iRIC_Write_Sol_PolyData_Polygon_WithGridId(fid, gid, numPoints, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_PolyData_Polygon_WithGridId(fid, gid, numPoints, x, y)
 	_checkErrorCode(ier)
 
 def cg_iRIC_Write_Sol_PolyData_Polyline_WithGridId(fid, gid, numPoints, x_arr, y_arr):
-	x = RealArrayContainer(x_arr.size)
-	x.set(x_arr)
-	y = RealArrayContainer(y_arr.size)
-	y.set(y_arr)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
 	ier = _iric.cg_iRIC_Write_Sol_PolyData_Polyline_WithGridId(fid, gid, numPoints, x, y)
 	_checkErrorCode(ier)
 
+def cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(fid, gid, types_arr, offsets_arr, x_arr, y_arr):
+	types = np.ascontiguousarray(types_arr, dtype=np.int32)
+	offsets = np.ascontiguousarray(offsets_arr, dtype=np.int32)
+	x = np.ascontiguousarray(x_arr, dtype=np.float64)
+	y = np.ascontiguousarray(y_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_PolyData_GeometryMulti_WithGridId(fid, gid, types, offsets, x, y)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(fid, gid, name, v_arr):
+	v = np.ascontiguousarray(v_arr, dtype=np.int32)
+	ier = _iric.cg_iRIC_Write_Sol_PolyData_IntegerMulti_WithGridId(fid, gid, name, v)
+	_checkErrorCode(ier)
+
+def cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(fid, gid, name, v_arr):
+	v = np.ascontiguousarray(v_arr, dtype=np.float64)
+	ier = _iric.cg_iRIC_Write_Sol_PolyData_RealMulti_WithGridId(fid, gid, name, v)
+	_checkErrorCode(ier)
+
 
 def cg_iRIC_Read_Grid2d_Interpolate(grid_handle, x, y):
     cellId = cg_iRIC_Read_Grid2d_FindCell(grid_handle, x, y)
     return cg_iRIC_Read_Grid2d_InterpolateWithCell(grid_handle, x, y, cellId)
+
+def cg_iRIC_Read_Grid2d_InterpolateWithHint(grid_handle, x, y, hintCellId):
+    cellId = cg_iRIC_Read_Grid2d_FindCellWithHint(grid_handle, x, y, hintCellId)
+    nodeids, weights = cg_iRIC_Read_Grid2d_InterpolateWithCell(grid_handle, x, y, cellId)
+    return cellId, nodeids, weights
+
+def cg_iRIC_Read_Grid2d_FindCellMulti(grid_handle, x_arr, y_arr):
+    x = np.ascontiguousarray(x_arr, dtype=np.float64)
+    y = np.ascontiguousarray(y_arr, dtype=np.float64)
+    count = x.size
+    cellids = np.zeros(count, dtype=np.int32)
+    ier = _iric.cg_iRIC_Read_Grid2d_FindCellMulti(grid_handle, count, x, y, cellids)
+    _checkErrorCode(ier)
+    return cellids
+
+def cg_iRIC_Read_Grid2d_InterpolateMulti(grid_handle, x_arr, y_arr):
+    x = np.ascontiguousarray(x_arr, dtype=np.float64)
+    y = np.ascontiguousarray(y_arr, dtype=np.float64)
+    count = x.size
+    ok = np.zeros(count, dtype=np.int32)
+    nodecount = np.zeros(count, dtype=np.int32)
+    nodeids = np.zeros((count, 4), dtype=np.int32)
+    weights = np.zeros((count, 4), dtype=np.float64)
+    ier = _iric.cg_iRIC_Read_Grid2d_InterpolateMulti(grid_handle, count, x, y, ok, nodecount, nodeids, weights)
+    _checkErrorCode(ier)
+    return ok, nodecount, nodeids, weights
+
+def _read_sol_series(func, fid, gid, name, indices, dtype):
+    idx = np.ascontiguousarray(indices, dtype=np.int32)
+    count = idx.size
+    steps = cg_iRIC_Read_Sol_Count(fid)
+    values = np.zeros((steps, count), dtype=dtype)
+    if gid is None:
+        ier = func(fid, name, count, idx, values)
+    else:
+        ier = func(fid, gid, name, count, idx, values)
+    _checkErrorCode(ier)
+    return values
+
+def cg_iRIC_Read_Sol_Node_Integer_Series(fid, name, indices):
+    return _read_sol_series(_iric.cg_iRIC_Read_Sol_Node_Integer_Series, fid, None, name, indices, np.int32)
+
+def cg_iRIC_Read_Sol_Node_Real_Series(fid, name, indices):
+    return _read_sol_series(_iric.cg_iRIC_Read_Sol_Node_Real_Series, fid, None, name, indices, np.float64)
+
+def cg_iRIC_Read_Sol_Cell_Integer_Series(fid, name, indices):
+    return _read_sol_series(_iric.cg_iRIC_Read_Sol_Cell_Integer_Series, fid, None, name, indices, np.int32)
+
+def cg_iRIC_Read_Sol_Cell_Real_Series(fid, name, indices):
+    return _read_sol_series(_iric.cg_iRIC_Read_Sol_Cell_Real_Series, fid, None, name, indices, np.float64)
+
+def cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId(fid, gid, name, indices):
+    return _read_sol_series(_iric.cg_iRIC_Read_Sol_Node_Integer_Series_WithGridId, fid, gid, name, indices, np.int32)
+
+def cg_iRIC_Read_Sol_Node_Real_Series_WithGridId(fid, gid, name, indices):
+    return _read_sol_series(_iric.cg_iRIC_Read_Sol_Node_Real_Series_WithGridId, fid, gid, name, indices, np.float64)
+
+def cg_iRIC_Read_Sol_Cell_Integer_Series_WithGridId(fid, gid, name, indices):
+    return _read_sol_series(_iric.cg_iRIC_Read_Sol_Cell_Integer_Series_WithGridId, fid, gid, name, indices, np.int32)
+
+def cg_iRIC_Read_Sol_Cell_Real_Series_WithGridId(fid, gid, name, indices):
+    return _read_sol_series(_iric.cg_iRIC_Read_Sol_Cell_Real_Series_WithGridId, fid, gid, name, indices, np.float64)
+
+def _region_count(vmin, vmax, stride):
+    return (vmax - vmin) // stride + 1
+
+def _read_sol_region(func, dtype, fid, gid, step, name, ranges, stride):
+    size = 1
+    for vmin, vmax in ranges:
+        size *= _region_count(vmin, vmax, stride)
+    values = np.zeros(size, dtype=dtype)
+    args = [fid] if gid is None else [fid, gid]
+    args += [step, name]
+    for vmin, vmax in ranges:
+        args += [vmin, vmax]
+    ier = func(*(args + [stride, values]))
+    _checkErrorCode(ier)
+    return values
+
+def cg_iRIC_Read_Sol_Node_Integer_Region2d(fid, step, name, imin, imax, jmin, jmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Node_Integer_Region2d, np.int32, fid, None, step, name, [(imin, imax), (jmin, jmax)], stride)
+
+def cg_iRIC_Read_Sol_Node_Integer_Region3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Node_Integer_Region3d, np.int32, fid, None, step, name, [(imin, imax), (jmin, jmax), (kmin, kmax)], stride)
+
+def cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Node_Integer_Region2d_WithGridId, np.int32, fid, gid, step, name, [(imin, imax), (jmin, jmax)], stride)
+
+def cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Node_Integer_Region3d_WithGridId, np.int32, fid, gid, step, name, [(imin, imax), (jmin, jmax), (kmin, kmax)], stride)
+
+def cg_iRIC_Read_Sol_Node_Real_Region2d(fid, step, name, imin, imax, jmin, jmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Node_Real_Region2d, np.float64, fid, None, step, name, [(imin, imax), (jmin, jmax)], stride)
+
+def cg_iRIC_Read_Sol_Node_Real_Region3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Node_Real_Region3d, np.float64, fid, None, step, name, [(imin, imax), (jmin, jmax), (kmin, kmax)], stride)
+
+def cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Node_Real_Region2d_WithGridId, np.float64, fid, gid, step, name, [(imin, imax), (jmin, jmax)], stride)
+
+def cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Node_Real_Region3d_WithGridId, np.float64, fid, gid, step, name, [(imin, imax), (jmin, jmax), (kmin, kmax)], stride)
+
+def cg_iRIC_Read_Sol_Cell_Integer_Region2d(fid, step, name, imin, imax, jmin, jmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Cell_Integer_Region2d, np.int32, fid, None, step, name, [(imin, imax), (jmin, jmax)], stride)
+
+def cg_iRIC_Read_Sol_Cell_Integer_Region3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Cell_Integer_Region3d, np.int32, fid, None, step, name, [(imin, imax), (jmin, jmax), (kmin, kmax)], stride)
+
+def cg_iRIC_Read_Sol_Cell_Integer_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Cell_Integer_Region2d_WithGridId, np.int32, fid, gid, step, name, [(imin, imax), (jmin, jmax)], stride)
+
+def cg_iRIC_Read_Sol_Cell_Integer_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Cell_Integer_Region3d_WithGridId, np.int32, fid, gid, step, name, [(imin, imax), (jmin, jmax), (kmin, kmax)], stride)
+
+def cg_iRIC_Read_Sol_Cell_Real_Region2d(fid, step, name, imin, imax, jmin, jmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Cell_Real_Region2d, np.float64, fid, None, step, name, [(imin, imax), (jmin, jmax)], stride)
+
+def cg_iRIC_Read_Sol_Cell_Real_Region3d(fid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Cell_Real_Region3d, np.float64, fid, None, step, name, [(imin, imax), (jmin, jmax), (kmin, kmax)], stride)
+
+def cg_iRIC_Read_Sol_Cell_Real_Region2d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Cell_Real_Region2d_WithGridId, np.float64, fid, gid, step, name, [(imin, imax), (jmin, jmax)], stride)
+
+def cg_iRIC_Read_Sol_Cell_Real_Region3d_WithGridId(fid, gid, step, name, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    return _read_sol_region(_iric.cg_iRIC_Read_Sol_Cell_Real_Region3d_WithGridId, np.float64, fid, gid, step, name, [(imin, imax), (jmin, jmax), (kmin, kmax)], stride)
+
+def cg_iRIC_Read_Grid2d_Coords_Region(fid, imin, imax, jmin, jmax, stride=1):
+    size = _region_count(imin, imax, stride) * _region_count(jmin, jmax, stride)
+    x = np.zeros(size, dtype=np.float64)
+    y = np.zeros(size, dtype=np.float64)
+    ier = _iric.cg_iRIC_Read_Grid2d_Coords_Region(fid, imin, imax, jmin, jmax, stride, x, y)
+    _checkErrorCode(ier)
+    return x, y
+
+def cg_iRIC_Read_Grid3d_Coords_Region(fid, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    size = _region_count(imin, imax, stride) * _region_count(jmin, jmax, stride) * _region_count(kmin, kmax, stride)
+    x = np.zeros(size, dtype=np.float64)
+    y = np.zeros(size, dtype=np.float64)
+    z = np.zeros(size, dtype=np.float64)
+    ier = _iric.cg_iRIC_Read_Grid3d_Coords_Region(fid, imin, imax, jmin, jmax, kmin, kmax, stride, x, y, z)
+    _checkErrorCode(ier)
+    return x, y, z
+
+def cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(fid, gid, imin, imax, jmin, jmax, stride=1):
+    size = _region_count(imin, imax, stride) * _region_count(jmin, jmax, stride)
+    x = np.zeros(size, dtype=np.float64)
+    y = np.zeros(size, dtype=np.float64)
+    ier = _iric.cg_iRIC_Read_Grid2d_Coords_Region_WithGridId(fid, gid, imin, imax, jmin, jmax, stride, x, y)
+    _checkErrorCode(ier)
+    return x, y
+
+def cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(fid, gid, imin, imax, jmin, jmax, kmin, kmax, stride=1):
+    size = _region_count(imin, imax, stride) * _region_count(jmin, jmax, stride) * _region_count(kmin, kmax, stride)
+    x = np.zeros(size, dtype=np.float64)
+    y = np.zeros(size, dtype=np.float64)
+    z = np.zeros(size, dtype=np.float64)
+    ier = _iric.cg_iRIC_Read_Grid3d_Coords_Region_WithGridId(fid, gid, imin, imax, jmin, jmax, kmin, kmax, stride, x, y, z)
+    _checkErrorCode(ier)
+    return x, y, z
+
+def _read_particle_trajectory(func, fid, gid, groupname, ids, step_min, step_max, dims=0, name=None, dtype=np.float64):
+    idarr = np.ascontiguousarray(ids, dtype=np.int32)
+    count = idarr.size
+    prefix = [fid] if gid is None else [fid, gid]
+    prefix += [groupname, count, idarr, step_min, step_max]
+    if gid is None:
+        ier, size = _iric.cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(*prefix)
+    else:
+        ier, size = _iric.cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize_WithGridId(*prefix)
+    _checkErrorCode(ier)
+    if name is None:
+        pids = np.zeros(size, dtype=np.int32)
+        steps = np.zeros(size, dtype=np.int32)
+        coords = [np.zeros(size, dtype=np.float64) for i in range(dims)]
+        ier = func(*(prefix + [pids, steps] + coords))
+        _checkErrorCode(ier)
+        return tuple([pids, steps] + coords)
+    # values are in the same order as the ids and steps returned by the Trajectory2d / 3d functions
+    values = np.zeros(size, dtype=dtype)
+    ier = func(*(prefix + [name, values]))
+    _checkErrorCode(ier)
+    return values
+
+def cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(fid, groupname, ids, step_min, step_max):
+    return _read_particle_trajectory(_iric.cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d, fid, None, groupname, ids, step_min, step_max, dims=2)
+
+def cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d(fid, groupname, ids, step_min, step_max):
+    return _read_particle_trajectory(_iric.cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d, fid, None, groupname, ids, step_min, step_max, dims=3)
+
+def cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(fid, groupname, ids, step_min, step_max, name):
+    return _read_particle_trajectory(_iric.cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal, fid, None, groupname, ids, step_min, step_max, name=name, dtype=np.float64)
+
+def cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger(fid, groupname, ids, step_min, step_max, name):
+    return _read_particle_trajectory(_iric.cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger, fid, None, groupname, ids, step_min, step_max, name=name, dtype=np.int32)
+
+def cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId(fid, gid, groupname, ids, step_min, step_max):
+    return _read_particle_trajectory(_iric.cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d_WithGridId, fid, gid, groupname, ids, step_min, step_max, dims=2)
+
+def cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId(fid, gid, groupname, ids, step_min, step_max):
+    return _read_particle_trajectory(_iric.cg_iRIC_Read_Sol_ParticleGroup_Trajectory3d_WithGridId, fid, gid, groupname, ids, step_min, step_max, dims=3)
+
+def cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId(fid, gid, groupname, ids, step_min, step_max, name):
+    return _read_particle_trajectory(_iric.cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal_WithGridId, fid, gid, groupname, ids, step_min, step_max, name=name, dtype=np.float64)
+
+def cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId(fid, gid, groupname, ids, step_min, step_max, name):
+    return _read_particle_trajectory(_iric.cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger_WithGridId, fid, gid, groupname, ids, step_min, step_max, name=name, dtype=np.int32)
+
+def _read_particles_in_rect(kind, fid, gid, args, rect, dims=0, name=None, dtype=np.float64):
+    suffix = '' if gid is None else '_WithGridId'
+    prefix = [fid] if gid is None else [fid, gid]
+    args = prefix + args + list(rect)
+    ier, size = getattr(_iric, 'cg_iRIC_Read_Sol_%s_RectCount%s' % (kind, suffix))(*args)
+    _checkErrorCode(ier)
+    if name is None:
+        coords = [np.zeros(size, dtype=np.float64) for i in range(dims)]
+        ier = getattr(_iric, 'cg_iRIC_Read_Sol_%s_RectPos%dd%s' % (kind, dims, suffix))(*(args + coords))
+        _checkErrorCode(ier)
+        return tuple(coords)
+    values = np.zeros(size, dtype=dtype)
+    func = 'RectInteger' if dtype == np.int32 else 'RectReal'
+    ier = getattr(_iric, 'cg_iRIC_Read_Sol_%s_%s%s' % (kind, func, suffix))(*(args + [name, values]))
+    _checkErrorCode(ier)
+    return values
+
+def cg_iRIC_Read_Sol_Particle_RectPos2d(fid, step, xmin, xmax, ymin, ymax):
+    return _read_particles_in_rect('Particle', fid, None, [step], [xmin, xmax, ymin, ymax], dims=2)
+
+def cg_iRIC_Read_Sol_Particle_RectPos3d(fid, step, xmin, xmax, ymin, ymax):
+    return _read_particles_in_rect('Particle', fid, None, [step], [xmin, xmax, ymin, ymax], dims=3)
+
+def cg_iRIC_Read_Sol_Particle_RectReal(fid, step, xmin, xmax, ymin, ymax, name):
+    return _read_particles_in_rect('Particle', fid, None, [step], [xmin, xmax, ymin, ymax], name=name, dtype=np.float64)
+
+def cg_iRIC_Read_Sol_Particle_RectInteger(fid, step, xmin, xmax, ymin, ymax, name):
+    return _read_particles_in_rect('Particle', fid, None, [step], [xmin, xmax, ymin, ymax], name=name, dtype=np.int32)
+
+def cg_iRIC_Read_Sol_Particle_RectPos2d_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax):
+    return _read_particles_in_rect('Particle', fid, gid, [step], [xmin, xmax, ymin, ymax], dims=2)
+
+def cg_iRIC_Read_Sol_Particle_RectPos3d_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax):
+    return _read_particles_in_rect('Particle', fid, gid, [step], [xmin, xmax, ymin, ymax], dims=3)
+
+def cg_iRIC_Read_Sol_Particle_RectReal_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, name):
+    return _read_particles_in_rect('Particle', fid, gid, [step], [xmin, xmax, ymin, ymax], name=name, dtype=np.float64)
+
+def cg_iRIC_Read_Sol_Particle_RectInteger_WithGridId(fid, gid, step, xmin, xmax, ymin, ymax, name):
+    return _read_particles_in_rect('Particle', fid, gid, [step], [xmin, xmax, ymin, ymax], name=name, dtype=np.int32)
+
+def cg_iRIC_Read_Sol_ParticleGroup_RectPos2d(fid, step, groupname, xmin, xmax, ymin, ymax):
+    return _read_particles_in_rect('ParticleGroup', fid, None, [step, groupname], [xmin, xmax, ymin, ymax], dims=2)
+
+def cg_iRIC_Read_Sol_ParticleGroup_RectPos3d(fid, step, groupname, xmin, xmax, ymin, ymax):
+    return _read_particles_in_rect('ParticleGroup', fid, None, [step, groupname], [xmin, xmax, ymin, ymax], dims=3)
+
+def cg_iRIC_Read_Sol_ParticleGroup_RectReal(fid, step, groupname, xmin, xmax, ymin, ymax, name):
+    return _read_particles_in_rect('ParticleGroup', fid, None, [step, groupname], [xmin, xmax, ymin, ymax], name=name, dtype=np.float64)
+
+def cg_iRIC_Read_Sol_ParticleGroup_RectInteger(fid, step, groupname, xmin, xmax, ymin, ymax, name):
+    return _read_particles_in_rect('ParticleGroup', fid, None, [step, groupname], [xmin, xmax, ymin, ymax], name=name, dtype=np.int32)
+
+def cg_iRIC_Read_Sol_ParticleGroup_RectPos2d_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax):
+    return _read_particles_in_rect('ParticleGroup', fid, gid, [step, groupname], [xmin, xmax, ymin, ymax], dims=2)
+
+def cg_iRIC_Read_Sol_ParticleGroup_RectPos3d_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax):
+    return _read_particles_in_rect('ParticleGroup', fid, gid, [step, groupname], [xmin, xmax, ymin, ymax], dims=3)
+
+def cg_iRIC_Read_Sol_ParticleGroup_RectReal_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, name):
+    return _read_particles_in_rect('ParticleGroup', fid, gid, [step, groupname], [xmin, xmax, ymin, ymax], name=name, dtype=np.float64)
+
+def cg_iRIC_Read_Sol_ParticleGroup_RectInteger_WithGridId(fid, gid, step, groupname, xmin, xmax, ymin, ymax, name):
+    return _read_particles_in_rect('ParticleGroup', fid, gid, [step, groupname], [xmin, xmax, ymin, ymax], name=name, dtype=np.int32)
@@ -0,0 +1,78 @@
+# Compares reading and writing large node arrays with NumPy arrays, which are
+# passed to iriclib without copying, and with the element by element copy
+# through RealArrayContainer.get() / set().
+#
+# usage: python bench_arrays.py [isize] [jsize] [repeat]
+
+import os
+import sys
+import time
+
+import numpy as np
+
+import iric
+
+FILENAME = "data/bench_arrays.cgn"
+
+
+def container_write(fid, name, vals):
+    v = iric.RealArrayContainer(vals.size)
+    v.set(vals)
+    ier = iric._iric.cg_iRIC_Write_Sol_Node_Real(fid, name, v)
+    iric._checkErrorCode(ier)
+
+
+def container_read(fid, step, name, size):
+    v = iric.RealArrayContainer(size)
+    ier = iric._iric.cg_iRIC_Read_Sol_Node_Real(fid, step, name, v)
+    iric._checkErrorCode(ier)
+    return v.get()
+
+
+def measure(func, repeat):
+    best = None
+    for i in range(repeat):
+        t0 = time.perf_counter()
+        ret = func()
+        t = time.perf_counter() - t0
+        if best is None or t < best:
+            best = t
+    return best, ret
+
+
+def main():
+    isize = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+    jsize = int(sys.argv[2]) if len(sys.argv) > 2 else 1000
+    repeat = int(sys.argv[3]) if len(sys.argv) > 3 else 3
+    size = isize * jsize
+
+    x = np.tile(np.arange(isize, dtype=np.float64), jsize)
+    y = np.repeat(np.arange(jsize, dtype=np.float64), isize)
+    depth = np.linspace(0, 1, size)
+
+    fid = iric.cg_iRIC_Open(FILENAME, iric.IRIC_MODE_WRITE)
+    iric.cg_iRIC_Write_Grid2d_Coords(fid, isize, jsize, x, y)
+    iric.cg_iRIC_Write_Sol_Start(fid)
+    iric.cg_iRIC_Write_Sol_Time(fid, 0.0)
+
+    t_write_numpy, dummy = measure(lambda: iric.cg_iRIC_Write_Sol_Node_Real(fid, "DepthNumpy", depth), 1)
+    t_write_container, dummy = measure(lambda: container_write(fid, "DepthContainer", depth), 1)
+    iric.cg_iRIC_Close(fid)
+
+    fid = iric.cg_iRIC_Open(FILENAME, iric.IRIC_MODE_READ)
+    t_read_numpy, v1 = measure(lambda: iric.cg_iRIC_Read_Sol_Node_Real(fid, 1, "DepthNumpy"), repeat)
+    t_read_container, v2 = measure(lambda: container_read(fid, 1, "DepthContainer", size), repeat)
+    iric.cg_iRIC_Close(fid)
+    os.remove(FILENAME)
+
+    if not np.array_equal(v1, depth) or not np.array_equal(v2, depth):
+        raise Exception("values read differ from values written")
+
+    print("grid: {0} x {1} ({2} nodes)".format(isize, jsize, size))
+    print("{0:<8} {1:>12} {2:>12} {3:>9}".format("", "numpy (s)", "container (s)", "speedup"))
+    print("{0:<8} {1:>12.4f} {2:>12.4f} {3:>8.1f}x".format("write", t_write_numpy, t_write_container, t_write_container / t_write_numpy))
+    print("{0:<8} {1:>12.4f} {2:>12.4f} {3:>8.1f}x".format("read", t_read_numpy, t_read_container, t_read_container / t_read_numpy))
+
+
+if __name__ == "__main__":
+    main()
@@ -411,7 +411,7 @@ def case_GridCopy():
 
     fid_from = iric.cg_iRIC_Open("data/case_grid.cgn", iric.IRIC_MODE_READ)
     util.verify_log("cg_iRIC_Open() fid_from != 0", fid_from != 0)
-    fid_to = iric.cg_iRIC_Open("data/case_gridwrite2d.cgn", iric.iRIC_MODE_MODIFY)
+    fid_to = iric.cg_iRIC_Open("data/case_gridwrite2d.cgn", iric.IRIC_MODE_MODIFY)
     util.verify_log("cg_iRIC_Open() fid_to != 0", fid_to != 0)
     
     iric.cg_iRIC_Copy_Grid(fid_from, fid_to)
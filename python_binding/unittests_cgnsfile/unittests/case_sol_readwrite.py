@@ -336,8 +336,117 @@ def case_SolWriteStd(cgnsName):
 
     util.remove("data/case_solstditer.cgn")
 
+def case_SolWriteParticleGroupTrajectory(cgnsName):
+    iric.iRIC_InitOption(iric.IRIC_OPTION_STDSOLUTION)
+
+    util.remove("data/case_soltraj.cgn")
+
+    shutil.copy(cgnsName, "data/case_soltraj.cgn")
+
+    fid = iric.cg_iRIC_Open("data/case_soltraj.cgn", iric.IRIC_MODE_MODIFY)
+    util.verify_log("cg_iRIC_Open() fid != 0", fid != 0)
+
+    iric.cg_iRIC_Set_ParticleGroupTrajectory(fid, "Id")
+
+    # particle i has id i * 10, and step s has particles 0 - (count - s)
+    steps = 4
+    count = 20
+    for s in range(1, steps + 1):
+        i = np.arange(count - s + 1)
+        iric.cg_iRIC_Write_Sol_Start(fid)
+        iric.cg_iRIC_Write_Sol_Time(fid, float(s))
+        iric.cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(fid, "group1")
+        iric.cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, i + s * 0.5, np.full(i.size, float(s)))
+        iric.cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, "Id", i * 10)
+        iric.cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, "Depth", i * 0.1 + s)
+        iric.cg_iRIC_Write_Sol_ParticleGroup_GroupEnd(fid)
+        iric.cg_iRIC_Write_Sol_End(fid)
+
+    iric.cg_iRIC_Close(fid)
+
+    fid = iric.cg_iRIC_Open("data/case_soltraj.cgn", iric.IRIC_MODE_READ)
+    util.verify_log("cg_iRIC_Open() fid != 0", fid != 0)
+
+    # id 170 exists in steps 1 - 3, id 150 in steps 1 - 4, and id 999 does not exist
+    ids = [170, 150, 999]
+    pids, psteps, x, y = iric.cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(fid, "group1", ids, 1, steps)
+    util.verify_log("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() ids are correct", list(pids) == [170, 170, 170, 150, 150, 150, 150])
+    util.verify_log("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() steps are correct", list(psteps) == [1, 2, 3, 1, 2, 3, 4])
+    util.verify_log("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() positions are correct", np.array_equal(x, pids // 10 + psteps * 0.5) and np.array_equal(y, psteps))
+
+    depth = iric.cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(fid, "group1", ids, 1, steps, "Depth")
+    util.verify_log("cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal() values are correct", np.allclose(depth, pids // 10 * 0.1 + psteps))
+
+    idvals = iric.cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger(fid, "group1", ids, 1, steps, "Id")
+    util.verify_log("cg_iRIC_Read_Sol_ParticleGroup_TrajectoryInteger() values are correct", np.array_equal(idvals, pids))
+
+    iric.cg_iRIC_Close(fid)
+
+    util.remove("data/case_soltraj.cgn")
+
+def expectTypeError(msg, f):
+    try:
+        f()
+        util.verify_log(msg, False)
+    except TypeError:
+        util.verify_log(msg, True)
+
+def case_SolArrayArguments(cgnsName):
+    iric.iRIC_InitOption(iric.IRIC_OPTION_STDSOLUTION)
+
+    util.remove("data/case_solarray.cgn")
+
+    shutil.copy(cgnsName, "data/case_solarray.cgn")
+
+    fid = iric.cg_iRIC_Open("data/case_solarray.cgn", iric.IRIC_MODE_MODIFY)
+    util.verify_log("cg_iRIC_Open() fid != 0", fid != 0)
+
+    isize, jsize = iric.cg_iRIC_Read_Grid2d_Str_Size(fid)
+    size = isize * jsize
+
+    # read only arrays are accepted as input
+    vals = np.arange(size, dtype=np.float64)
+    vals.flags.writeable = False
+    iric.cg_iRIC_Write_Sol_Start(fid)
+    iric.cg_iRIC_Write_Sol_Time(fid, 0.0)
+    ier = iric._iric.cg_iRIC_Write_Sol_Node_Real_WithGridId(fid, 1, "Value", vals)
+    util.verify_log("cg_iRIC_Write_Sol_Node_Real_WithGridId() read only array ier == 0", ier == 0)
+    iric.cg_iRIC_Write_Sol_End(fid)
+
+    # arrays are read into without copying
+    buf = np.zeros(size, dtype=np.float64)
+    ier = iric._iric.cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, 1, 1, "Value", buf)
+    util.verify_log("cg_iRIC_Read_Sol_Node_Real_WithGridId() ier == 0", ier == 0)
+    util.verify_log("cg_iRIC_Read_Sol_Node_Real_WithGridId() values are correct", np.array_equal(buf, vals))
+
+    container = iric.RealArrayContainer(size)
+    ier = iric._iric.cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, 1, 1, "Value", container)
+    util.verify_log("cg_iRIC_Read_Sol_Node_Real_WithGridId() with RealArrayContainer ier == 0", ier == 0)
+    util.verify_log("cg_iRIC_Read_Sol_Node_Real_WithGridId() with RealArrayContainer values are correct", np.array_equal(container.get(), vals))
+
+    read_only = np.zeros(size, dtype=np.float64)
+    read_only.flags.writeable = False
+    expectTypeError("cg_iRIC_Read_Sol_Node_Real_WithGridId() raises TypeError for read only array",
+        lambda: iric._iric.cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, 1, 1, "Value", read_only))
+    expectTypeError("cg_iRIC_Read_Sol_Node_Real_WithGridId() raises TypeError for float32 array",
+        lambda: iric._iric.cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, 1, 1, "Value", np.zeros(size, dtype=np.float32)))
+    expectTypeError("cg_iRIC_Read_Sol_Node_Real_WithGridId() raises TypeError for non contiguous array",
+        lambda: iric._iric.cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, 1, 1, "Value", np.zeros(size * 2, dtype=np.float64)[::2]))
+    expectTypeError("cg_iRIC_Read_Sol_Node_Real_WithGridId() raises TypeError for IntArrayContainer",
+        lambda: iric._iric.cg_iRIC_Read_Sol_Node_Real_WithGridId(fid, 1, 1, "Value", iric.IntArrayContainer(size)))
+
+    iric.cg_iRIC_Close(fid)
+
+    util.remove("data/case_solarray.cgn")
+
 def case_SolWriteStd_adf():
     case_SolWriteStd("data/case_init.cgn")
 
 def case_SolWriteStd_hdf5():
     case_SolWriteStd("data/case_init_hdf5.cgn")
+
+def case_SolWriteParticleGroupTrajectory_hdf5():
+    case_SolWriteParticleGroupTrajectory("data/case_init_hdf5.cgn")
+
+def case_SolArrayArguments_hdf5():
+    case_SolArrayArguments("data/case_init_hdf5.cgn")
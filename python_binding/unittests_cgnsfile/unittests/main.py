@@ -51,3 +51,7 @@ def main():
     # case_sol_readwrite.case_SolWriteStd_adf()
     print('case_sol_readwrite.case_SolWriteStd_hdf5()')
     case_sol_readwrite.case_SolWriteStd_hdf5()
+    print('case_sol_readwrite.case_SolWriteParticleGroupTrajectory_hdf5()')
+    case_sol_readwrite.case_SolWriteParticleGroupTrajectory_hdf5()
+    print('case_sol_readwrite.case_SolArrayArguments_hdf5()')
+    case_sol_readwrite.case_SolArrayArguments_hdf5()
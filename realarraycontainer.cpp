@@ -1,10 +1,16 @@
 #include "realarraycontainer.h"
 
 RealArrayContainer::RealArrayContainer(int size) :
-	m_value {new std::vector<double> {}}
-{
-	m_value->assign(size, 0);
-}
+	m_value {new std::vector<double> (size, 0)},
+	m_data {m_value->data()},
+	m_size {size}
+{}
+
+RealArrayContainer::RealArrayContainer(double* data, int size) :
+	m_value {nullptr},
+	m_data {data},
+	m_size {size}
+{}
 
 RealArrayContainer::~RealArrayContainer()
 {
@@ -13,7 +19,7 @@ RealArrayContainer::~RealArrayContainer()
 
 int RealArrayContainer::size() const
 {
-	return static_cast<int> (m_value->size());
+	return m_size;
 }
 
 double RealArrayContainer::value(int index) const
@@ -21,10 +27,10 @@ double RealArrayContainer::value(int index) const
 	if (index < 0) {
 		return 0;
 	}
-	if (index >= static_cast<int> (m_value->size())) {
+	if (index >= m_size) {
 		return 0;
 	}
-	return m_value->at(index);
+	return *(m_data + index);
 }
 
 void RealArrayContainer::setValue(int index, double v)
@@ -32,13 +38,13 @@ void RealArrayContainer::setValue(int index, double v)
 	if (index < 0) {
 		return;
 	}
-	if (index >= static_cast<int> (m_value->size())) {
+	if (index >= m_size) {
 		return;
 	}
-	(*m_value)[index] = v;
+	*(m_data + index) = v;
 }
 
 double* RealArrayContainer::pointer()
 {
-	return m_value->data();
+	return m_data;
 }
@@ -9,6 +9,8 @@ class IRICLIBDLL RealArrayContainer
 {
 public:
 	RealArrayContainer(int size);
+	// wraps memory owned by the caller, without copying. used to pass NumPy arrays from Python.
+	RealArrayContainer(double* data, int size);
 	~RealArrayContainer();
 
 	int size() const;
@@ -17,7 +19,10 @@ public:
 	double* pointer();
 
 private:
+	// nullptr when wrapping memory owned by the caller
 	std::vector<double>* m_value;
+	double* m_data;
+	int m_size;
 };
 
 #endif // REALARRAYCONTAINER_H
@@ -0,0 +1,115 @@
+#include <iriclib.h>
+
+#include <iostream>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+static int repeat_count = 20;
+static int timeout_secs = 120;
+
+void waitOneSecond()
+{
+#ifdef _MSC_VER
+	Sleep(1000);
+#else
+	sleep(1);
+#endif
+}
+
+int checkSolution(int fid, int step)
+{
+	double time;
+	int ier = cg_iRIC_Read_Sol_Time(fid, step, &time);
+	if (ier != 0 || time != step * 2.0) {
+		std::cout << "Time of solution " << step << " is wrong" << std::endl;
+		return 1;
+	}
+
+	int value;
+	ier = cg_iRIC_Read_Sol_BaseIterative_Integer(fid, step, "Step", &value);
+	if (ier != 0 || value != step) {
+		std::cout << "Step of solution " << step << " is wrong" << std::endl;
+		return 1;
+	}
+
+	int isize, jsize;
+	ier = cg_iRIC_Read_Grid2d_Str_Size(fid, &isize, &jsize);
+	if (ier != 0) {
+		std::cout << "cg_iRIC_Read_Grid2d_Str_Size() failed" << std::endl;
+		return 1;
+	}
+
+	std::vector<double> depth(isize * jsize, 0);
+	ier = cg_iRIC_Read_Sol_Node_Real(fid, step, "Depth", depth.data());
+	if (ier != 0) {
+		std::cout << "Depth of solution " << step << " could not be read" << std::endl;
+		return 1;
+	}
+	for (double v : depth) {
+		if (v == step) {continue;}
+
+		std::cout << "Depth of solution " << step << " is wrong" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int, char* [])
+{
+	int fid, ier;
+
+	char cgnsName[] = "Case1.cgn";
+
+	// the file can be opened once the solver has switched it to SWMR mode
+	int secs = 0;
+	while (cg_iRIC_Open(cgnsName, IRIC_MODE_READ_SWMR, &fid) != 0) {
+		if (++ secs > timeout_secs) {
+			std::cout << "cg_iRIC_Open() failed" << std::endl;
+			return 1;
+		}
+		waitOneSecond();
+	}
+	std::cout << "cg_iRIC_Open() succeeded" << std::endl;
+
+	int checked = 0;
+	secs = 0;
+	while (checked < repeat_count) {
+		ier = cg_iRIC_Read_Sol_Refresh(fid);
+		if (ier != 0) {
+			std::cout << "cg_iRIC_Read_Sol_Refresh() failed" << std::endl;
+			return 1;
+		}
+
+		int count;
+		ier = cg_iRIC_Read_Sol_Count(fid, &count);
+		if (ier != 0) {
+			std::cout << "cg_iRIC_Read_Sol_Count() failed" << std::endl;
+			return 1;
+		}
+
+		while (checked < count) {
+			++ checked;
+			if (checkSolution(fid, checked) != 0) {return 1;}
+
+			std::cout << "Sol read " << checked << std::endl;
+			secs = 0;
+		}
+		if (checked == repeat_count) {break;}
+
+		if (++ secs > timeout_secs) {
+			std::cout << "Timed out waiting for solution " << checked + 1 << std::endl;
+			return 1;
+		}
+		waitOneSecond();
+	}
+
+	cg_iRIC_Close(fid);
+
+	return 0;
+}
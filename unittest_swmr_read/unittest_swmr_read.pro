@@ -0,0 +1,20 @@
+TEMPLATE = app
+TARGET = unittest_swmr_read
+CONFIG   += console
+CONFIG   += c++11
+
+CONFIG(debug, debug|release) {
+	# iriclib
+	LIBS += -L"../debug"
+}
+else {
+	# iriclib
+	LIBS += -L"../release"
+}
+LIBS += -liriclib
+
+# iriclib
+INCLUDEPATH += ".."
+
+# Input
+SOURCES += main.cpp
@@ -0,0 +1,100 @@
+#include <iriclib.h>
+
+#include <iostream>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+static int repeat_count = 20;
+static int write_secs = 1;
+static int isize = 30;
+static int jsize = 20;
+
+int createCgnsFile(const char* cgnsName)
+{
+	int fid;
+	int ier = cg_iRIC_Open(cgnsName, IRIC_MODE_WRITE, &fid);
+	if (ier != 0) {return ier;}
+
+	std::vector<double> x, y;
+	for (int j = 0; j < jsize; ++j) {
+		for (int i = 0; i < isize; ++i) {
+			x.push_back(i);
+			y.push_back(j);
+		}
+	}
+	ier = cg_iRIC_Write_Grid2d_Coords(fid, isize, jsize, x.data(), y.data());
+	if (ier != 0) {return ier;}
+
+	return cg_iRIC_Close(fid);
+}
+
+int writeSolution(int fid, int i)
+{
+	std::vector<double> depth(isize * jsize, static_cast<double> (i));
+
+	int ier = cg_iRIC_Write_Sol_Time(fid, i * 2.0);
+	if (ier != 0) {return ier;}
+
+	ier = cg_iRIC_Write_Sol_Node_Real(fid, "Depth", depth.data());
+	if (ier != 0) {return ier;}
+
+	return cg_iRIC_Write_Sol_BaseIterative_Integer(fid, "Step", i);
+}
+
+int main(int, char* [])
+{
+	int fid, ier;
+
+	char cgnsName[] = "Case1.cgn";
+
+	// the file is created in the default file format, like the one created by the GUI
+	ier = createCgnsFile(cgnsName);
+	if (ier != 0) {
+		std::cout << "Creating " << cgnsName << " failed" << std::endl;
+		return 1;
+	}
+
+	iRIC_InitOption(IRIC_OPTION_SWMRSOLUTIONS);
+
+	ier = cg_iRIC_Open(cgnsName, IRIC_MODE_MODIFY, &fid);
+	if (ier != 0) {
+		std::cout << "cg_iRIC_Open() failed" << std::endl;
+		return 1;
+	}
+
+	for (int i = 1; i <= repeat_count; ++i) {
+		ier = cg_iRIC_Write_Sol_Start(fid);
+		if (ier != 0) {
+			std::cout << "cg_iRIC_Write_Sol_Start() failed" << std::endl;
+			return 1;
+		}
+
+		ier = writeSolution(fid, i);
+		if (ier != 0) {
+			std::cout << "Writing solution " << i << " failed" << std::endl;
+			return 1;
+		}
+
+		ier = cg_iRIC_Write_Sol_End(fid);
+		if (ier != 0) {
+			std::cout << "cg_iRIC_Write_Sol_End() failed" << std::endl;
+			return 1;
+		}
+		std::cout << "Sol written " << i << std::endl;
+
+#ifdef _MSC_VER
+		Sleep(write_secs * 1000);
+#else
+		sleep(write_secs);
+#endif
+	}
+
+	cg_iRIC_Close(fid);
+
+	return 0;
+}
@@ -0,0 +1,283 @@
+#include "macros.h"
+
+#include <iriclib.h>
+#include <iriclib_pointmap.h>
+#include <iriclib_polyline.h>
+
+#include <stdio.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+// writes the values in the binary format of the geographic data files
+class BinaryWriter
+{
+public:
+	BinaryWriter(const char* filename) :
+		m_stream(filename, std::ios::out | std::ios::binary)
+	{}
+	BinaryWriter& i(int v)
+	{
+		m_stream.write(reinterpret_cast<const char*>(&v), sizeof(int));
+		return *this;
+	}
+	BinaryWriter& d(double v)
+	{
+		m_stream.write(reinterpret_cast<const char*>(&v), sizeof(double));
+		return *this;
+	}
+	BinaryWriter& s(const std::string& v)
+	{
+		i(static_cast<int>(v.length()) + 1);
+		m_stream.write(v.c_str(), v.length() + 1);
+		return *this;
+	}
+
+private:
+	std::ofstream m_stream;
+};
+
+std::vector<char> readBytes(const char* filename)
+{
+	std::ifstream s(filename, std::ios::in | std::ios::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(s), std::istreambuf_iterator<char>());
+}
+
+// writes the first size bytes of the data in filename to truncatedFilename
+void writeTruncated(const char* filename, const char* truncatedFilename, size_t size)
+{
+	std::vector<char> bytes = readBytes(filename);
+	std::ofstream s(truncatedFilename, std::ios::out | std::ios::binary);
+	s.write(bytes.data(), size);
+}
+
+void writePolygon()
+{
+	BinaryWriter w("case_geo_polygon.dat");
+	// value, then the region (4 points) and one hole (3 points)
+	w.d(2.5);
+	w.i(4).d(0).d(10).d(10).d(0).d(0).d(0).d(10).d(10);
+	w.i(1);
+	w.i(3).d(1).d(2).d(1).d(1).d(1).d(2);
+}
+
+void writeRiverSurvey()
+{
+	BinaryWriter w("case_geo_riversurvey.dat");
+	w.i(2);
+	for (int p = 0; p < 2; ++p) {
+		w.s(p == 0 ? "12.5" : "20");
+		w.d(100 + p).d(200 + p);                // position
+		w.d(0).d(1);                            // direction
+		w.d(0.5);                               // left shift
+		w.i(3);                                 // altitudes
+		for (int a = 0; a < 3; ++a) {
+			w.d(a * 10 - 10).d(5 + a).i(a == 1 ? 0 : 1);
+		}
+		w.i(0);                                 // fixed point L
+		w.i(1).d(0.6).d(0.8).i(2);              // fixed point R
+		w.i(4);                                 // grid skip
+		w.i(2).d(0.25).d(0.75);                 // center to left control points
+		w.i(0);                                 // center to right control points
+		w.i(1).d(0.5);                          // center line control points
+		w.i(0);                                 // left bank control points
+		w.i(0);                                 // right bank control points
+		w.i(p).d(3.5);                          // water surface elevation
+	}
+}
+
+void writePolyline()
+{
+	BinaryWriter w("case_geo_polyline.dat");
+	// two values, then 3 points
+	w.i(2).d(1.5).d(-2);
+	w.i(3).d(0).d(5).d(10).d(0).d(1).d(0);
+}
+
+void writePointMap()
+{
+	BinaryWriter w("case_geo_pointmap.dat");
+	// real values at 4 points, 2 triangles and one breakline
+	w.i(1).i(4);
+	w.d(0).d(1).d(1).d(0);
+	w.d(0).d(0).d(1).d(1);
+	w.d(1.5).d(2.5).d(3.5).d(4.5);
+	w.i(2).i(0).i(1).i(2).i(0).i(2).i(3);
+	w.i(1).i(2).i(0).i(2);
+}
+
+} // namespace
+
+extern "C" {
+
+void case_GeoRead()
+{
+	writePolygon();
+
+	int id;
+	int ier = iRIC_Geo_Polygon_Open("case_geo_polygon.dat", &id);
+	VERIFY_LOG("iRIC_Geo_Polygon_Open() ier == 0", ier == 0);
+
+	double value;
+	ier = iRIC_Geo_Polygon_Read_RealValue(id, &value);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_RealValue() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_RealValue() value == 2.5", value == 2.5);
+
+	int count;
+	ier = iRIC_Geo_Polygon_Read_PointCount(id, &count);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_PointCount() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_PointCount() value == 4", count == 4);
+
+	std::vector<double> x(count), y(count);
+	ier = iRIC_Geo_Polygon_Read_Points(id, x.data(), y.data());
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_Points() ier == 0", ier == 0);
+	std::vector<double> expectedX = {0, 10, 10, 0};
+	std::vector<double> expectedY = {0, 0, 10, 10};
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_Points() x is correct", x == expectedX);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_Points() y is correct", y == expectedY);
+
+	ier = iRIC_Geo_Polygon_Read_HoleCount(id, &count);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_HoleCount() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_HoleCount() value == 1", count == 1);
+
+	ier = iRIC_Geo_Polygon_Read_HolePointCount(id, 1, &count);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_HolePointCount() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_HolePointCount() value == 3", count == 3);
+
+	x.assign(count, 0);
+	y.assign(count, 0);
+	ier = iRIC_Geo_Polygon_Read_HolePoints(id, 1, x.data(), y.data());
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_HolePoints() ier == 0", ier == 0);
+	expectedX = {1, 2, 1};
+	expectedY = {1, 1, 2};
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_HolePoints() x is correct", x == expectedX);
+	VERIFY_LOG("iRIC_Geo_Polygon_Read_HolePoints() y is correct", y == expectedY);
+
+	ier = iRIC_Geo_Polygon_Close(id);
+	VERIFY_LOG("iRIC_Geo_Polygon_Close() ier == 0", ier == 0);
+
+	// a negative point count is reported
+	{
+		BinaryWriter w("case_geo_polygon2.dat");
+		w.d(2.5).i(-1);
+	}
+	ier = iRIC_Geo_Polygon_Open("case_geo_polygon2.dat", &id);
+	VERIFY_LOG("iRIC_Geo_Polygon_Open() ier != 0 for negative point count", ier != 0);
+
+	writeRiverSurvey();
+
+	ier = iRIC_Geo_RiverSurvey_Open("case_geo_riversurvey.dat", &id);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Open() ier == 0", ier == 0);
+
+	ier = iRIC_Geo_RiverSurvey_Read_Count(id, &count);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Count() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Count() value == 2", count == 2);
+
+	char name[200];
+	ier = iRIC_Geo_RiverSurvey_Read_Name(id, 1, name);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Name() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Name() value == 12.5", std::string(name) == "12.5");
+	ier = iRIC_Geo_RiverSurvey_Read_RealName(id, 2, &value);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_RealName() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_RealName() value == 20", value == 20);
+
+	double px, py;
+	ier = iRIC_Geo_RiverSurvey_Read_Position(id, 2, &px, &py);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Position() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Position() value == (101, 201)", px == 101 && py == 201);
+
+	ier = iRIC_Geo_RiverSurvey_Read_AltitudeCount(id, 2, &count);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_AltitudeCount() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_AltitudeCount() value == 3", count == 3);
+
+	std::vector<double> positions(count), heights(count);
+	std::vector<int> actives(count);
+	ier = iRIC_Geo_RiverSurvey_Read_Altitudes(id, 2, positions.data(), heights.data(), actives.data());
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Altitudes() ier == 0", ier == 0);
+	std::vector<double> expectedPositions = {-10, 0, 10};
+	std::vector<double> expectedHeights = {5, 6, 7};
+	std::vector<int> expectedActives = {1, 0, 1};
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Altitudes() positions are correct", positions == expectedPositions);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Altitudes() heights are correct", heights == expectedHeights);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_Altitudes() actives are correct", actives == expectedActives);
+
+	int set, index;
+	double dirx, diry;
+	ier = iRIC_Geo_RiverSurvey_Read_FixedPointR(id, 2, &set, &dirx, &diry, &index);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_FixedPointR() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_FixedPointR() values are correct", set == 1 && dirx == 0.6 && diry == 0.8 && index == 2);
+
+	ier = iRIC_Geo_RiverSurvey_Read_WaterSurfaceElevation(id, 2, &set, &value);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_WaterSurfaceElevation() ier == 0", ier == 0);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Read_WaterSurfaceElevation() values are correct", set == 1 && value == 3.5);
+
+	ier = iRIC_Geo_RiverSurvey_Close(id);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Close() ier == 0", ier == 0);
+
+	writeTruncated("case_geo_riversurvey.dat", "case_geo_riversurvey2.dat", 100);
+	ier = iRIC_Geo_RiverSurvey_Open("case_geo_riversurvey2.dat", &id);
+	VERIFY_LOG("iRIC_Geo_RiverSurvey_Open() ier != 0 for truncated file", ier != 0);
+
+	writePolyline();
+
+	iRICLib::Polyline pl;
+	ier = pl.load("case_geo_polyline.dat");
+	VERIFY_LOG("Polyline::load() ier == 0", ier == 0);
+	std::vector<double> expectedPlValues = {1.5, -2};
+	VERIFY_LOG("Polyline::load() values are correct", pl.values == expectedPlValues);
+	VERIFY_LOG("Polyline::load() pointCount == 3", pl.polyline != nullptr && pl.polyline->pointCount == 3);
+	VERIFY_LOG("Polyline::load() points are correct", pl.polyline->x[2] == 10 && pl.polyline->y[1] == 1);
+
+	// saving writes the same bytes
+	ier = pl.save("case_geo_polyline2.dat");
+	VERIFY_LOG("Polyline::save() ier == 0", ier == 0);
+	VERIFY_LOG("Polyline::save() wrote the same data", readBytes("case_geo_polyline.dat") == readBytes("case_geo_polyline2.dat"));
+
+	writeTruncated("case_geo_polyline.dat", "case_geo_polyline3.dat", 40);
+	iRICLib::Polyline pl2;
+	ier = pl2.load("case_geo_polyline3.dat");
+	VERIFY_LOG("Polyline::load() ier != 0 for truncated file", ier != 0);
+
+	writePointMap();
+
+	iRICLib::PointMap pm;
+	ier = pm.load("case_geo_pointmap.dat");
+	VERIFY_LOG("PointMap::load() ier == 0", ier == 0);
+	VERIFY_LOG("PointMap::load() pointCount == 4", pm.pointCount == 4);
+	expectedX = {0, 1, 1, 0};
+	expectedY = {0, 0, 1, 1};
+	std::vector<double> expectedValues = {1.5, 2.5, 3.5, 4.5};
+	VERIFY_LOG("PointMap::load() x is correct", pm.x == expectedX);
+	VERIFY_LOG("PointMap::load() y is correct", pm.y == expectedY);
+	VERIFY_LOG("PointMap::load() values are correct", pm.valueType == iRICLib::PointMap::vtReal && pm.realValue == expectedValues);
+	VERIFY_LOG("PointMap::load() triangles are correct", pm.triangles.size() == 2 && pm.triangles[1].index1 == 0 && pm.triangles[1].index2 == 2 && pm.triangles[1].index3 == 3);
+	std::vector<int> expectedIndices = {0, 2};
+	VERIFY_LOG("PointMap::load() breaklines are correct", pm.breaklines.size() == 1 && pm.breaklines[0].indices == expectedIndices);
+
+	// saving writes the same bytes
+	ier = pm.save("case_geo_pointmap2.dat");
+	VERIFY_LOG("PointMap::save() ier == 0", ier == 0);
+	VERIFY_LOG("PointMap::save() wrote the same data", readBytes("case_geo_pointmap.dat") == readBytes("case_geo_pointmap2.dat"));
+
+	writeTruncated("case_geo_pointmap.dat", "case_geo_pointmap3.dat", 60);
+	iRICLib::PointMap pm2;
+	ier = pm2.load("case_geo_pointmap3.dat");
+	VERIFY_LOG("PointMap::load() ier != 0 for truncated file", ier != 0);
+
+	remove("case_geo_polygon.dat");
+	remove("case_geo_polygon2.dat");
+	remove("case_geo_riversurvey.dat");
+	remove("case_geo_riversurvey2.dat");
+	remove("case_geo_polyline.dat");
+	remove("case_geo_polyline2.dat");
+	remove("case_geo_polyline3.dat");
+	remove("case_geo_pointmap.dat");
+	remove("case_geo_pointmap2.dat");
+	remove("case_geo_pointmap3.dat");
+}
+
+} // extern "C"
@@ -3,12 +3,15 @@
 #include "fs_copy.h"
 
 #include <iriclib.h>
+#include <iricsolverlib_grid2d.h>
+#include <iricsolverlib_point2d.h>
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -55,6 +58,22 @@ void case_GridRead()
 	ier = cg_iRIC_Read_Grid2d_Coords(fid, x.data(), y.data());
 	VERIFY_LOG("cg_iRIC_Read_Grid2d_Str_Size() ier == 0", ier == 0);
 
+	// i = 2, 5, 8, j = 1, 4, 7, 10
+	std::vector<double> rx(3 * 4, 0), ry(3 * 4, 0);
+	ier = cg_iRIC_Read_Grid2d_Coords_Region(fid, 2, 9, 1, 11, 3, rx.data(), ry.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords_Region() ier == 0", ier == 0);
+	bool regionOk = true;
+	for (int j = 0; j < 4; ++j) {
+		for (int i = 0; i < 3; ++i) {
+			int idx = (j * 3) * isize + (1 + i * 3);
+			regionOk = regionOk && rx[j * 3 + i] == x[idx] && ry[j * 3 + i] == y[idx];
+		}
+	}
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords_Region() values are correct", regionOk);
+
+	ier = cg_iRIC_Read_Grid2d_Coords_Region(fid, 1, isize + 1, 1, jsize, 1, rx.data(), ry.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords_Region() with invalid range ier != 0", ier != 0);
+
 	std::vector<double> doubleArr;
 	std::vector<int> intArr;
 
@@ -134,6 +153,110 @@ void case_GridRead()
 	VERIFY_LOG("cg_iRIC_Read_Grid2d_Interpolate() weights[2] == 0.2123", std::abs(weights[2] - 0.2123) < 0.0001);
 	VERIFY_LOG("cg_iRIC_Read_Grid2d_Interpolate() weights[3] == 0", std::abs(weights[3] - 0) < 0.0001);
 
+	int cellId;
+	ier = cg_iRIC_Read_Grid2d_FindCell(grid_handle, 0.0, 0.0, &cellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCell() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCell() cellId > 0", cellId > 0);
+
+	int cellNodeIds[4];
+	double cellWeights[4];
+	ier = cg_iRIC_Read_Grid2d_InterpolateWithCell(grid_handle, 0.0, 0.0, cellId, cellNodeIds, cellWeights);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithCell() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithCell() nodeIds[0] == 93", cellNodeIds[0] == 93);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithCell() nodeIds[3] == 104", cellNodeIds[3] == 104);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithCell() weights[0] == 0.3863", std::abs(cellWeights[0] - 0.3863) < 0.0001);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithCell() weights[1] == 0.4012", std::abs(cellWeights[1] - 0.4012) < 0.0001);
+
+	ier = cg_iRIC_Read_Grid2d_FindCell(grid_handle, 1.0E10, 1.0E10, &cellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCell() ier != 0 for outside point", ier != 0);
+
+	int hintedCellId;
+	ier = cg_iRIC_Read_Grid2d_FindCellWithHint(grid_handle, 0.0, 0.0, cellId, &hintedCellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellWithHint() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellWithHint() hintedCellId == cellId", hintedCellId == cellId);
+
+	ier = cg_iRIC_Read_Grid2d_FindCellWithHint(grid_handle, 0.0, 0.0, 1, &hintedCellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellWithHint() ier == 0 with far hint", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellWithHint() hintedCellId == cellId with far hint", hintedCellId == cellId);
+
+	ier = cg_iRIC_Read_Grid2d_FindCellWithHint(grid_handle, 1.0E10, 1.0E10, cellId, &hintedCellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellWithHint() ier != 0 for outside point", ier != 0);
+
+	ier = cg_iRIC_Read_Grid2d_InterpolateWithHint(grid_handle, 0.0, 0.0, 1, &ok, &hintedCellId, &nodeCount, cellNodeIds, cellWeights);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithHint() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithHint() ok == 1", ok == 1);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithHint() hintedCellId == cellId", hintedCellId == cellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithHint() nodeCount == 4", nodeCount == 4);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithHint() nodeIds[0] == 93", cellNodeIds[0] == 93);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateWithHint() weights[1] == 0.4012", std::abs(cellWeights[1] - 0.4012) < 0.0001);
+
+	// batch queries, large enough to be split between threads
+	int batchCount = 20000;
+	std::vector<double> batchX(batchCount, 0.0), batchY(batchCount, 0.0);
+	for (int i = 1; i < batchCount; i += 2) {
+		batchX[i] = 1.0E10;
+		batchY[i] = 1.0E10;
+	}
+	std::vector<int> batchCellIds(batchCount, -1);
+	ier = cg_iRIC_Read_Grid2d_FindCellMulti(grid_handle, batchCount, batchX.data(), batchY.data(), batchCellIds.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellMulti() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellMulti() cellIds[0] == cellId", batchCellIds[0] == cellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellMulti() cellIds[1] == 0", batchCellIds[1] == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellMulti() cellIds[last - 1] == cellId", batchCellIds[batchCount - 2] == cellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellMulti() cellIds[last] == 0", batchCellIds[batchCount - 1] == 0);
+
+	std::vector<int> batchOk(batchCount, -1), batchNodeCount(batchCount, -1), batchNodeIds(batchCount * 4, -1);
+	std::vector<double> batchWeights(batchCount * 4, -1);
+	ier = cg_iRIC_Read_Grid2d_InterpolateMulti(grid_handle, batchCount, batchX.data(), batchY.data(), batchOk.data(), batchNodeCount.data(), batchNodeIds.data(), batchWeights.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() ok[0] == 1", batchOk[0] == 1);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() nodeCount[0] == 4", batchNodeCount[0] == 4);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() nodeIds[0] == 93", batchNodeIds[0] == 93);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() nodeIds[3] == 104", batchNodeIds[3] == 104);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() weights[0] == 0.3863", std::abs(batchWeights[0] - 0.3863) < 0.0001);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() ok[1] == 0", batchOk[1] == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() nodeIds[4] == 0", batchNodeIds[4] == 0);
+	int lastIdx = batchCount - 2;
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() ok[last - 1] == 1", batchOk[lastIdx] == 1);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() nodeIds[last - 1] == 93", batchNodeIds[lastIdx * 4] == 93);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_InterpolateMulti() weights[last - 1] == 0.4012", std::abs(batchWeights[lastIdx * 4 + 1] - 0.4012) < 0.0001);
+
+	// BVH spatial index gives the same results as the back grid
+	ier = cg_iRIC_Set_Grid2d_SpatialIndex(grid_handle, 99);
+	VERIFY_LOG("cg_iRIC_Set_Grid2d_SpatialIndex() ier != 0 for invalid type", ier != 0);
+
+	ier = cg_iRIC_Set_Grid2d_SpatialIndex(grid_handle, IRIC_SPATIALINDEX_BVH);
+	VERIFY_LOG("cg_iRIC_Set_Grid2d_SpatialIndex() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Read_Grid2d_FindCell(grid_handle, 0.0, 0.0, &hintedCellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCell() ier == 0 with BVH", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCell() cellId is the same with BVH", hintedCellId == cellId);
+
+	ier = cg_iRIC_Read_Grid2d_FindCell(grid_handle, 1.0E10, 1.0E10, &hintedCellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCell() ier != 0 for outside point with BVH", ier != 0);
+
+	ier = cg_iRIC_Read_Grid2d_Interpolate(grid_handle, 0.0, 0.0, &ok, &nodeCount, nodeIds, weights);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Interpolate() ier == 0 with BVH", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Interpolate() ok == 1 with BVH", ok == 1);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Interpolate() nodeCount == 4 with BVH", nodeCount == 4);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Interpolate() nodeIds[0] == 93 with BVH", nodeIds[0] == 93);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Interpolate() nodeIds[2] == 105 with BVH", nodeIds[2] == 105);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Interpolate() weights[0] == 0.3863 with BVH", std::abs(weights[0] - 0.3863) < 0.0001);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Interpolate() weights[2] == 0.2123 with BVH", std::abs(weights[2] - 0.2123) < 0.0001);
+
+	ier = cg_iRIC_Read_Grid2d_FindCellMulti(grid_handle, batchCount, batchX.data(), batchY.data(), batchCellIds.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellMulti() ier == 0 with BVH", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellMulti() cellIds[0] == cellId with BVH", batchCellIds[0] == cellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellMulti() cellIds[1] == 0 with BVH", batchCellIds[1] == 0);
+
+	// the index is rebuilt on the next query
+	ier = cg_iRIC_Set_Grid2d_SpatialIndex(grid_handle, IRIC_SPATIALINDEX_BACKGRID);
+	VERIFY_LOG("cg_iRIC_Set_Grid2d_SpatialIndex() ier == 0 for back grid", ier == 0);
+
+	ier = cg_iRIC_Read_Grid2d_FindCellWithHint(grid_handle, 0.0, 0.0, 1, &hintedCellId);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellWithHint() ier == 0 after index change", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_FindCellWithHint() hintedCellId == cellId after index change", hintedCellId == cellId);
+
 	ier = cg_iRIC_Read_Grid2d_Close(grid_handle);
 	VERIFY_LOG("cg_iRIC_Read_Grid2d_Close() ier == 0", ier == 0);
 
@@ -223,6 +346,9 @@ void case_GridReadUnstructured()
 	ier = cg_iRIC_Read_Grid_TriangleElements(fid, elems.data());
 	VERIFY_LOG("cg_iRIC_Read_Grid_TriangleElements() ier == 0", ier == 0);
 
+	ier = cg_iRIC_Read_Grid2d_Coords_Region(fid, 1, 2, 1, 1, 1, x.data(), y.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords_Region() for unstructured grid ier != 0", ier != 0);
+
 	int grid_handle;
 	ier = cg_iRIC_Read_Grid2d_Open(fid, &grid_handle);
 	VERIFY_LOG("cg_iRIC_Read_Grid2d_Open() ier == 0", ier == 0);
@@ -255,9 +381,37 @@ void case_GridReadUnstructured()
 	ier = cg_iRIC_Read_Grid2d_Close(grid_handle);
 	VERIFY_LOG("cg_iRIC_Read_Grid2d_Close() ier == 0", ier == 0);
 
+	// a grid with a triangle that refers to node 9 of 4 nodes
+	std::vector<double> badX = {0, 1, 1, 0};
+	std::vector<double> badY = {0, 0, 1, 1};
+	std::vector<int> badElems = {1, 2, 3, 1, 3, 9};
+	int gid;
+	ier = cg_iRIC_Write_Grid2d_Unst_Triangles_WithGridId(fid, 4, badX.data(), badY.data(), 2, badElems.data(), &gid);
+	VERIFY_LOG("cg_iRIC_Write_Grid2d_Unst_Triangles_WithGridId() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Read_Grid2d_Open_WithGridId(fid, gid, &grid_handle);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Open_WithGridId() ier != 0 for invalid node id", ier != 0);
+
 	cg_iRIC_Close(fid);
 
 	remove("case_grid_unstructured.cgn");
+
+	// the node ids are checked before the spatial index is built on worker threads
+	iRICSolverLib::Grid2D grid;
+	grid.setThreadCount(4);
+	grid.addNode(0, 0);
+	grid.addNode(1, 0);
+	grid.addNode(0, 1);
+	grid.addTriCell(1, 2, 3);
+	grid.addTriCell(2, 3, 5);
+	bool thrown = false;
+	try {
+		int cellId;
+		grid.findCell(iRICSolverLib::Point2D(0.2, 0.2), &cellId);
+	} catch (std::out_of_range&) {
+		thrown = true;
+	}
+	VERIFY_LOG("Grid2D::findCell() throws std::out_of_range for invalid node id", thrown);
 }
 
 void case_GridReadFunc()
@@ -422,6 +576,22 @@ void case_GridWrite()
 	ier = cg_iRIC_Write_Grid_Integer_Cell(fid, "intcell_test", int_cell_write.data());
 	VERIFY_LOG("cg_iRIC_Write_Grid_Integer_Cell() ier == 0", ier == 0);
 
+	std::vector<double> real_node_read(real_node_write.size(), 0);
+	ier = cg_iRIC_Read_Grid_Real_Node(fid, "realnode_test", real_node_read.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid_Real_Node() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid_Real_Node() value check", real_node_read == real_node_write);
+
+	std::vector<int> int_cell_read(int_cell_write.size(), 0);
+	ier = cg_iRIC_Read_Grid_Integer_Cell(fid, "intcell_test", int_cell_read.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid_Integer_Cell() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid_Integer_Cell() value check", int_cell_read == int_cell_write);
+
+	// node data does not fit in a buffer for cells, so it must not be read into it
+	std::vector<double> real_cell_read(real_cell_write.size(), 0);
+	ier = cg_iRIC_Read_Grid_Real_Cell(fid, "realnode_test", real_cell_read.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid_Real_Cell() for node data ier != 0", ier != 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid_Real_Cell() for node data buffer unchanged", real_cell_read == std::vector<double>(real_cell_write.size(), 0));
+
 	ier = cg_iRIC_Write_NamedGrid2d_Coords(fid, "testgrid", isize, jsize, x.data(), y.data());
 	VERIFY_LOG("cg_iRIC_Write_NamedGrid2d_Coords() ier == 0", ier == 0);
 
@@ -3,12 +3,20 @@
 #include "fs_copy.h"
 
 #include <iriclib.h>
+#include <h5cgnsfile.h>
+#include <h5cgnsfilesolutionreader.h>
+#include <h5cgnspolydatasolution.h>
+#include <h5cgnszone.h>
+#include <public/h5cgnspolydatasolution_groupreader.h>
 #ifdef _MSC_VER
 #endif
 
+#include <hdf5.h>
+
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <cmath>
 #include <iostream>
 #include <string>
 #include <sstream>
@@ -27,7 +35,7 @@ void writeSolution(const char* filename, int* fid, bool iterMode)
 	std::vector<double> vx, vy, depth;
 	std::vector<int> wet;
 	std::vector<double> ccdepth;
-	std::vector<int> ccwet;
+	std::vector<int> ccwet, ccindex;
 
 	// fill iface
 	std::vector<int> iface_is_edge;
@@ -104,6 +112,10 @@ void writeSolution(const char* filename, int* fid, bool iterMode)
 		ier = cg_iRIC_Write_Sol_Node_Real(*fid, "Depth", depth.data());
 		VERIFY_LOG("cg_iRIC_Write_Sol_Node_Real() for Depth ier == 0", ier == 0);
 
+		// VelocityX and CCIndex depend on the position, to check the values read by regions
+		for (size_t p = 0; p < vx.size(); ++p) {
+			vx[p] = i * 1000000.0 + p;
+		}
 		ier = cg_iRIC_Write_Sol_Node_Real(*fid, "VelocityX", vx.data());
 		VERIFY_LOG("cg_iRIC_Write_Sol_Node_Real() for VelocityX ier == 0", ier == 0);
 
@@ -124,6 +136,13 @@ void writeSolution(const char* filename, int* fid, bool iterMode)
 		ier = cg_iRIC_Write_Sol_Cell_Integer(*fid, "CCWet", ccwet.data());
 		VERIFY_LOG("cg_iRIC_Write_Sol_Cell_Integer() ier == 0", ier == 0);
 
+		ccindex.assign((isize - 1) * (jsize - 1), 0);
+		for (size_t p = 0; p < ccindex.size(); ++p) {
+			ccindex[p] = i * 1000000 + static_cast<int> (p);
+		}
+		ier = cg_iRIC_Write_Sol_Cell_Integer(*fid, "CCIndex", ccindex.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_Cell_Integer() for CCIndex ier == 0", ier == 0);
+
 		// IFaceCenter solutions
 
 		ier = cg_iRIC_Write_Sol_IFace_Integer(*fid, "IFaceIsEdge", iface_is_edge.data());
@@ -343,6 +362,113 @@ void writeSolution3d(const char* filename, int* fid)
 	}
 }
 
+void readSolutionSeries(int fid, int isize, int jsize, int sol_count)
+{
+	std::vector<int> nodeIndices;
+	nodeIndices.push_back(1);
+	nodeIndices.push_back(isize * jsize);
+	nodeIndices.push_back(isize + 2);
+
+	std::vector<double> real_series(sol_count * nodeIndices.size(), -1);
+	int ier = cg_iRIC_Read_Sol_Node_Real_Series(fid, "Depth", static_cast<int> (nodeIndices.size()), nodeIndices.data(), real_series.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_Node_Real_Series() ier == 0", ier == 0);
+	bool ok = true;
+	for (int S = 1; S <= sol_count; ++S) {
+		for (size_t p = 0; p < nodeIndices.size(); ++p) {
+			ok = ok && (real_series[(S - 1) * nodeIndices.size() + p] == (double)(S - 1));
+		}
+	}
+	VERIFY_LOG("cg_iRIC_Read_Sol_Node_Real_Series() values are correct", ok);
+
+	std::vector<int> int_series(sol_count * nodeIndices.size(), -1);
+	ier = cg_iRIC_Read_Sol_Node_Integer_Series(fid, "IBC", static_cast<int> (nodeIndices.size()), nodeIndices.data(), int_series.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_Node_Integer_Series() ier == 0", ier == 0);
+	ok = true;
+	for (int S = 1; S <= sol_count; ++S) {
+		for (size_t p = 0; p < nodeIndices.size(); ++p) {
+			ok = ok && (int_series[(S - 1) * nodeIndices.size() + p] == S - 1);
+		}
+	}
+	VERIFY_LOG("cg_iRIC_Read_Sol_Node_Integer_Series() values are correct", ok);
+
+	std::vector<int> cellIndices;
+	cellIndices.push_back((isize - 1) * (jsize - 1));
+	cellIndices.push_back(1);
+
+	real_series.assign(sol_count * cellIndices.size(), -1);
+	ier = cg_iRIC_Read_Sol_Cell_Real_Series(fid, "CCDepth", static_cast<int> (cellIndices.size()), cellIndices.data(), real_series.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_Cell_Real_Series() ier == 0", ier == 0);
+	ok = true;
+	for (int S = 1; S <= sol_count; ++S) {
+		for (size_t p = 0; p < cellIndices.size(); ++p) {
+			ok = ok && (real_series[(S - 1) * cellIndices.size() + p] == 0.2 + (S - 1));
+		}
+	}
+	VERIFY_LOG("cg_iRIC_Read_Sol_Cell_Real_Series() values are correct", ok);
+
+	int_series.assign(sol_count * cellIndices.size(), -1);
+	ier = cg_iRIC_Read_Sol_Cell_Integer_Series(fid, "CCWet", static_cast<int> (cellIndices.size()), cellIndices.data(), int_series.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_Cell_Integer_Series() ier == 0", ier == 0);
+	ok = true;
+	for (int S = 1; S <= sol_count; ++S) {
+		for (size_t p = 0; p < cellIndices.size(); ++p) {
+			ok = ok && (int_series[(S - 1) * cellIndices.size() + p] == S);
+		}
+	}
+	VERIFY_LOG("cg_iRIC_Read_Sol_Cell_Integer_Series() values are correct", ok);
+
+	int invalidIndex = isize * jsize + 1;
+	ier = cg_iRIC_Read_Sol_Node_Real_Series(fid, "Depth", 1, &invalidIndex, real_series.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_Node_Real_Series() with invalid index ier != 0", ier != 0);
+}
+
+void readSolutionRegion(int fid, int isize, int jsize, int sol_count)
+{
+	int icount = (isize - 2) / 2 + 1;
+	int jcount = (jsize - 1) / 2 + 1;
+	std::vector<double> real_region(icount * jcount, -1);
+	std::vector<int> int_region((isize - 1) * (jsize - 1), -1);
+
+	// VelocityX of node (i, j) is (S - 1) * 1000000 + i + j * isize, with zero-based i and j.
+	// i = 1, 3, 5, ..., j = 0, 2, 4, ...
+	bool ok = true;
+	for (int S = 1; S <= sol_count; ++S) {
+		int ier = cg_iRIC_Read_Sol_Node_Real_Region2d(fid, S, "VelocityX", 2, isize, 1, jsize, 2, real_region.data());
+		ok = ok && (ier == 0);
+		for (int j = 0; j < jcount; ++j) {
+			for (int i = 0; i < icount; ++i) {
+				double expected = (S - 1) * 1000000.0 + (1 + i * 2) + (j * 2) * isize;
+				ok = ok && (real_region[j * icount + i] == expected);
+			}
+		}
+	}
+	VERIFY_LOG("cg_iRIC_Read_Sol_Node_Real_Region2d() values are correct", ok);
+
+	int cell_icount = (isize - 2) / 3 + 1;
+	int cell_jcount = (jsize - 3) / 3 + 1;
+	int_region.assign(cell_icount * cell_jcount, -1);
+	// CCIndex of cell (i, j) is (S - 1) * 1000000 + i + j * (isize - 1).
+	// i = 0, 3, 6, ..., j = 1, 4, 7, ...
+	ok = true;
+	for (int S = 1; S <= sol_count; ++S) {
+		int ier = cg_iRIC_Read_Sol_Cell_Integer_Region2d(fid, S, "CCIndex", 1, isize - 1, 2, jsize - 1, 3, int_region.data());
+		ok = ok && (ier == 0);
+		for (int j = 0; j < cell_jcount; ++j) {
+			for (int i = 0; i < cell_icount; ++i) {
+				int expected = (S - 1) * 1000000 + (i * 3) + (1 + j * 3) * (isize - 1);
+				ok = ok && (int_region[j * cell_icount + i] == expected);
+			}
+		}
+	}
+	VERIFY_LOG("cg_iRIC_Read_Sol_Cell_Integer_Region2d() values are correct", ok);
+
+	int ier = cg_iRIC_Read_Sol_Node_Real_Region3d(fid, 1, "Depth", 1, isize, 1, jsize, 1, 1, 1, real_region.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_Node_Real_Region3d() for 2D grid ier != 0", ier != 0);
+
+	ier = cg_iRIC_Read_Sol_Node_Real_Region2d(fid, 1, "Depth", 1, isize, 1, jsize, 0, real_region.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_Node_Real_Region2d() with stride 0 ier != 0", ier != 0);
+}
+
 void readSolution(int fid)
 {
 	char buffer[200];
@@ -486,6 +612,9 @@ void readSolution(int fid)
 		sprintf(buffer, "cg_iRIC_Read_Sol_BaseIterative_String() for TestStr s == %s", validVal.c_str());
 		VERIFY_LOG(buffer, validVal == retval.data());
 	}
+
+	readSolutionSeries(fid, isize, jsize, sol_count);
+	readSolutionRegion(fid, isize, jsize, sol_count);
 }
 
 void delSolution(int fid)
@@ -722,24 +851,1574 @@ void case_SolWriteDivide(const std::string& origCgnsName)
 	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
 }
 
-void case_SolWriteStd_adf()
+void case_SolWriteSharedGrid(const std::string& origCgnsName)
 {
-	case_SolWriteStd("case_init.cgn");
+	iRIC_InitOption(IRIC_OPTION_SHAREDGRIDSOLUTIONS);
+
+	bool hdf = true;
+
+	remove("case_solsharedgrid.cgn");
+	remove("result/Grid.cgn");
+	remove("result/Solution1.cgn");
+	remove("result/Solution2.cgn");
+	remove("result/Solution3.cgn");
+	remove("result/Solution4.cgn");
+	remove("result/Solution5.cgn");
+
+	//
+	// Test Writing Divided Solutions that refer to the shared grid file (IRIC_OPTION_SHAREDGRIDSOLUTIONS)
+	//
+
+	fs::copy(origCgnsName, "case_solsharedgrid.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solsharedgrid.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	int isize, jsize;
+	ier = cg_iRIC_Read_Grid2d_Str_Size(fid, &isize, &jsize);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Str_Size() ier == 0", ier == 0);
+
+	std::vector<double> x(isize * jsize), y(isize * jsize);
+	ier = cg_iRIC_Read_Grid2d_Coords(fid, x.data(), y.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords() ier == 0", ier == 0);
+
+	writeSolution("case_solsharedgrid.cgn", &fid, false);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	//
+	// Test Reading Divided Solutions that refer to the shared grid file
+	//
+
+	ier = cg_iRIC_Open("case_solsharedgrid.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	readSolution(fid);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	// the grid in a solution file is read from the shared grid file through the link
+	ier = cg_iRIC_Open("result/Solution3.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	int isize2, jsize2;
+	ier = cg_iRIC_Read_Grid2d_Str_Size(fid, &isize2, &jsize2);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Str_Size() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Str_Size() isize2 == isize", isize2 == isize);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Str_Size() jsize2 == jsize", jsize2 == jsize);
+
+	std::vector<double> x2(isize * jsize), y2(isize * jsize);
+	ier = cg_iRIC_Read_Grid2d_Coords(fid, x2.data(), y2.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords() x2 == x", x2 == x);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords() y2 == y", y2 == y);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	VERIFY_REMOVE("case_solsharedgrid.cgn", hdf);
+	VERIFY_REMOVE("result/Grid.cgn", hdf);
+	VERIFY_REMOVE("result/Solution1.cgn", hdf);
+	VERIFY_REMOVE("result/Solution2.cgn", hdf);
+	VERIFY_REMOVE("result/Solution3.cgn", hdf);
+	VERIFY_REMOVE("result/Solution4.cgn", hdf);
+	VERIFY_REMOVE("result/Solution5.cgn", hdf);
 }
 
-void case_SolWriteStd_hdf5()
+void case_SolCombine(const std::string& origCgnsName)
 {
-	case_SolWriteStd("case_init_hdf5.cgn");
+	iRIC_InitOption(IRIC_OPTION_DIVIDESOLUTIONS);
+
+	bool hdf = true;
+
+	remove("case_solcombine.cgn");
+	remove("result/Solution1.cgn");
+	remove("result/Solution2.cgn");
+	remove("result/Solution3.cgn");
+	remove("result/Solution4.cgn");
+	remove("result/Solution5.cgn");
+
+	fs::copy(origCgnsName, "case_solcombine.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solcombine.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	writeSolution("case_solcombine.cgn", &fid, false);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	//
+	// Test combining divided solutions into the main file
+	//
+
+	ier = cg_iRIC_Open("case_solcombine.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	int progress = -1;
+	ier = cg_iRIC_Combine_Solutions(fid, &progress);
+	VERIFY_LOG("cg_iRIC_Combine_Solutions() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Combine_Solutions() progress == 100", progress == 100);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	// without divided solution files, solutions are read from the main file.
+	VERIFY_REMOVE("result/Solution1.cgn", hdf);
+	VERIFY_REMOVE("result/Solution2.cgn", hdf);
+	VERIFY_REMOVE("result/Solution3.cgn", hdf);
+	VERIFY_REMOVE("result/Solution4.cgn", hdf);
+	VERIFY_REMOVE("result/Solution5.cgn", hdf);
+
+	ier = cg_iRIC_Open("case_solcombine.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	readSolution(fid);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	VERIFY_REMOVE("case_solcombine.cgn", hdf);
 }
 
-void case_SolWriteDivide_adf()
+// reads the values of a step (starting with 1) from a variable of the solution index
+bool readSolutionIndexRow(hid_t fileId, const char* path, int step, hid_t memType, void* values, hsize_t count)
 {
-	case_SolWriteDivide("case_init.cgn");
+	hid_t dataId = H5Dopen2(fileId, path, H5P_DEFAULT);
+	if (dataId < 0) {return false;}
+
+	hid_t spaceId = H5Dget_space(dataId);
+	hsize_t dims[2] = {0, 0};
+	bool ok = (H5Sget_simple_extent_ndims(spaceId) == 2);
+	if (ok) {
+		H5Sget_simple_extent_dims(spaceId, dims, nullptr);
+		ok = (static_cast<hsize_t> (step) <= dims[0] && dims[1] == count);
+	}
+	if (ok) {
+		hsize_t start[2] = {static_cast<hsize_t> (step - 1), 0};
+		hsize_t block[2] = {1, count};
+		H5Sselect_hyperslab(spaceId, H5S_SELECT_SET, start, nullptr, block, nullptr);
+		hid_t memSpaceId = H5Screate_simple(1, &count, nullptr);
+		ok = (H5Dread(dataId, memType, memSpaceId, spaceId, H5P_DEFAULT, values) >= 0);
+		H5Sclose(memSpaceId);
+	}
+	H5Sclose(spaceId);
+	H5Dclose(dataId);
+
+	return ok;
 }
 
-void case_SolWriteDivide_hdf5()
+void case_SolIndex(const std::string& origCgnsName)
 {
-	case_SolWriteDivide("case_init_hdf5.cgn");
+	iRIC_InitOption(IRIC_OPTION_DIVIDESOLUTIONS);
+
+	bool hdf = true;
+
+	remove("case_solindex.cgn");
+	remove("result/SolutionIndex.h5");
+	remove("result/Solution1.cgn");
+	remove("result/Solution2.cgn");
+	remove("result/Solution3.cgn");
+	remove("result/Solution4.cgn");
+	remove("result/Solution5.cgn");
+	remove("result/Solution6.cgn");
+
+	fs::copy(origCgnsName, "case_solindex.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solindex.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	int stepCount = -1;
+	ier = cg_iRIC_Update_Sol_Index(fid, &stepCount);
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() stepCount == 0", stepCount == 0);
+
+	FILE* f = fopen("result/SolutionIndex.h5", "r");
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() index is not created without solutions", f == NULL);
+
+	writeSolution("case_solindex.cgn", &fid, false);
+
+	ier = cg_iRIC_Update_Sol_Index(fid, &stepCount);
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() stepCount == 5", stepCount == 5);
+
+	f = fopen("result/SolutionIndex.h5", "r");
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() index is created", f != NULL);
+	if (f != NULL) {fclose(f);}
+
+	// the index is up to date, so it is kept as it is.
+	ier = cg_iRIC_Update_Sol_Index(fid, &stepCount);
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() stepCount == 5", stepCount == 5);
+
+	int isize, jsize;
+	ier = cg_iRIC_Read_Grid2d_Str_Size(fid, &isize, &jsize);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Str_Size() ier == 0", ier == 0);
+	hsize_t nodeCount = static_cast<hsize_t> (isize) * jsize;
+	hsize_t cellCount = static_cast<hsize_t> (isize - 1) * (jsize - 1);
+
+	// the rows of the index are the values written in writeSolution(). step s has Depth == s - 1,
+	// IBC == s - 1, CCDepth == s - 0.8 and CCWet == s.
+	hid_t indexId = H5Fopen("result/SolutionIndex.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+	VERIFY_LOG("H5Fopen() for index fileId >= 0", indexId >= 0);
+
+	for (int step = 1; step <= 5; step += 2) {
+		std::vector<double> realValues(nodeCount, -1);
+		bool ok = readSolutionIndexRow(indexId, "/iRIC/iRICZone/FlowSolution/Depth", step, H5T_NATIVE_DOUBLE, realValues.data(), nodeCount);
+		VERIFY_LOG("index Depth row is read", ok);
+		VERIFY_LOG("index Depth row is correct", realValues == std::vector<double>(nodeCount, step - 1));
+
+		std::vector<int> intValues(nodeCount, -1);
+		ok = readSolutionIndexRow(indexId, "/iRIC/iRICZone/FlowSolution/IBC", step, H5T_NATIVE_INT, intValues.data(), nodeCount);
+		VERIFY_LOG("index IBC row is read", ok);
+		VERIFY_LOG("index IBC row is correct", intValues == std::vector<int>(nodeCount, step - 1));
+
+		realValues.assign(cellCount, -1);
+		ok = readSolutionIndexRow(indexId, "/iRIC/iRICZone/FlowCellSolution/CCDepth", step, H5T_NATIVE_DOUBLE, realValues.data(), cellCount);
+		VERIFY_LOG("index CCDepth row is read", ok);
+		VERIFY_LOG("index CCDepth row is correct", realValues == std::vector<double>(cellCount, 0.2 + (step - 1)));
+
+		intValues.assign(cellCount, -1);
+		ok = readSolutionIndexRow(indexId, "/iRIC/iRICZone/FlowCellSolution/CCWet", step, H5T_NATIVE_INT, intValues.data(), cellCount);
+		VERIFY_LOG("index CCWet row is read", ok);
+		VERIFY_LOG("index CCWet row is correct", intValues == std::vector<int>(cellCount, step));
+	}
+	H5Fclose(indexId);
+
+	// step 6 has a variable that the steps before do not have. it is read as NaN for them.
+	ier = cg_iRIC_Write_Sol_Start(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Start() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_Time(fid, 20);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Time() ier == 0", ier == 0);
+	std::vector<double> extra(nodeCount, 7.5);
+	ier = cg_iRIC_Write_Sol_Node_Real(fid, "Extra", extra.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_Node_Real() for Extra ier == 0", ier == 0);
+
+	ier = cg_iRIC_Update_Sol_Index(fid, &stepCount);
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Update_Sol_Index() stepCount == 6", stepCount == 6);
+
+	indexId = H5Fopen("result/SolutionIndex.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+	VERIFY_LOG("H5Fopen() for index fileId >= 0", indexId >= 0);
+
+	std::vector<double> realValues(nodeCount, -1);
+	bool ok = readSolutionIndexRow(indexId, "/iRIC/iRICZone/FlowSolution/Extra", 6, H5T_NATIVE_DOUBLE, realValues.data(), nodeCount);
+	VERIFY_LOG("index Extra row of step 6 is read", ok);
+	VERIFY_LOG("index Extra row of step 6 is correct", realValues == extra);
+
+	realValues.assign(nodeCount, -1);
+	ok = readSolutionIndexRow(indexId, "/iRIC/iRICZone/FlowSolution/Extra", 2, H5T_NATIVE_DOUBLE, realValues.data(), nodeCount);
+	VERIFY_LOG("index Extra row of step 2 is read", ok);
+	bool allNan = true;
+	for (double v : realValues) {
+		if (! std::isnan(v)) {allNan = false;}
+	}
+	VERIFY_LOG("index Extra row of step 2 is NaN", allNan);
+	H5Fclose(indexId);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	VERIFY_REMOVE("result/SolutionIndex.h5", hdf);
+	VERIFY_REMOVE("result/Solution1.cgn", hdf);
+	VERIFY_REMOVE("result/Solution2.cgn", hdf);
+	VERIFY_REMOVE("result/Solution3.cgn", hdf);
+	VERIFY_REMOVE("result/Solution4.cgn", hdf);
+	VERIFY_REMOVE("result/Solution5.cgn", hdf);
+	VERIFY_REMOVE("result/Solution6.cgn", hdf);
+	VERIFY_REMOVE("case_solindex.cgn", hdf);
+}
+
+void case_SolReadCached(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_DIVIDESOLUTIONS);
+
+	bool hdf = true;
+
+	remove("case_solcached.cgn");
+	remove("result/Solution1.cgn");
+	remove("result/Solution2.cgn");
+	remove("result/Solution3.cgn");
+	remove("result/Solution4.cgn");
+	remove("result/Solution5.cgn");
+
+	fs::copy(origCgnsName, "case_solcached.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solcached.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	writeSolution("case_solcached.cgn", &fid, false);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	//
+	// Test Reading Divided Solutions with solution file cache and prefetch
+	//
+
+	ier = cg_iRIC_Open("case_solcached.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Set_Sol_Cache(fid, 0, 0);
+	VERIFY_LOG("cg_iRIC_Set_Sol_Cache() ier != 0 for capacity 0", ier != 0);
+
+	ier = cg_iRIC_Set_Sol_Cache(fid, 5, 1);
+	VERIFY_LOG("cg_iRIC_Set_Sol_Cache() ier == 0", ier == 0);
+
+	readSolution(fid);
+
+	int hits, misses;
+	ier = cg_iRIC_Read_Sol_CacheStats(fid, &hits, &misses);
+	VERIFY_LOG("cg_iRIC_Read_Sol_CacheStats() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_CacheStats() misses <= 5", misses <= 5);
+
+	// all solution files are kept open, so reading again opens no files.
+	readSolution(fid);
+
+	int hits2, misses2;
+	ier = cg_iRIC_Read_Sol_CacheStats(fid, &hits2, &misses2);
+	VERIFY_LOG("cg_iRIC_Read_Sol_CacheStats() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_CacheStats() misses2 == misses", misses2 == misses);
+	VERIFY_LOG("cg_iRIC_Read_Sol_CacheStats() hits2 > hits", hits2 > hits);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	VERIFY_REMOVE("case_solcached.cgn", hdf);
+	VERIFY_REMOVE("result/Solution1.cgn", hdf);
+	VERIFY_REMOVE("result/Solution2.cgn", hdf);
+	VERIFY_REMOVE("result/Solution3.cgn", hdf);
+	VERIFY_REMOVE("result/Solution4.cgn", hdf);
+	VERIFY_REMOVE("result/Solution5.cgn", hdf);
+
+	// restore mode.
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+}
+
+void case_SolWriteCompressed(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	bool hdf = true;
+
+	remove("case_solcompressed.cgn");
+
+	//
+	// Test Writing with deflate compression and chunked layout
+	//
+
+	fs::copy(origCgnsName, "case_solcompressed.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solcompressed.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	ier = cg_iRIC_Set_StoragePolicy(fid, 99, 6, 1);
+	VERIFY_LOG("cg_iRIC_Set_StoragePolicy() with invalid compression ier != 0", ier != 0);
+
+	ier = cg_iRIC_Set_StoragePolicy(fid, IRIC_COMPRESSION_DEFLATE, 6, 1);
+	VERIFY_LOG("cg_iRIC_Set_StoragePolicy() ier == 0", ier == 0);
+
+	// chunk every dataset, even the small ones in this test grid
+	ier = cg_iRIC_Set_StorageChunking(fid, 0, 4096);
+	VERIFY_LOG("cg_iRIC_Set_StorageChunking() ier == 0", ier == 0);
+
+	writeSolution("case_solcompressed.cgn", &fid, false);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	//
+	// Test Reading compressed solutions
+	//
+
+	ier = cg_iRIC_Open("case_solcompressed.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	readSolution(fid);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	//
+	// Test the datasets are stored chunked and compressed
+	//
+
+	hid_t fileId = H5Fopen("case_solcompressed.cgn", H5F_ACC_RDONLY, H5P_DEFAULT);
+	VERIFY_LOG("H5Fopen() fileId >= 0", fileId >= 0);
+
+	hid_t dataId = H5Dopen2(fileId, "/iRIC/iRICZone/FlowSolution1/Depth/ data", H5P_DEFAULT);
+	VERIFY_LOG("H5Dopen2() for Depth dataId >= 0", dataId >= 0);
+
+	hid_t plistId = H5Dget_create_plist(dataId);
+	VERIFY_LOG("H5Pget_layout() for Depth == H5D_CHUNKED", H5Pget_layout(plistId) == H5D_CHUNKED);
+
+	hid_t spaceId = H5Dget_space(dataId);
+	hsize_t dims[2] = {0, 0};
+	int rank = H5Sget_simple_extent_dims(spaceId, dims, nullptr);
+	H5Sclose(spaceId);
+
+	// a chunk holds at most 4096 bytes (512 doubles), filling the fastest varying dimension first
+	hsize_t chunkDims[2] = {0, 0};
+	int chunkRank = H5Pget_chunk(plistId, 2, chunkDims);
+	VERIFY_LOG("H5Pget_chunk() for Depth rank is the dataset rank", rank > 0 && chunkRank == rank);
+	bool chunkOk = (chunkRank == rank);
+	hsize_t remaining = 512;
+	for (int i = rank - 1; i >= 0 && chunkOk; --i) {
+		hsize_t expected = (dims[i] <= remaining) ? dims[i] : remaining;
+		chunkOk = (chunkDims[i] == expected);
+		remaining = (dims[i] <= remaining) ? remaining / dims[i] : 1;
+	}
+	VERIFY_LOG("H5Pget_chunk() for Depth chunk dims are correct", chunkOk);
+	VERIFY_LOG("H5Pget_nfilters() for Depth > 0", H5Pget_nfilters(plistId) > 0);
+
+	H5Pclose(plistId);
+	H5Dclose(dataId);
+	H5Fclose(fileId);
+
+	VERIFY_REMOVE("case_solcompressed.cgn", hdf);
+}
+
+void case_SolWriteAccessProfile(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	bool hdf = true;
+
+	remove("case_solprofile.cgn");
+	remove("case_solprofile_paged.cgn");
+
+	//
+	// Test Writing and reading an existing file with the presets
+	//
+
+	fs::copy(origCgnsName, "case_solprofile.cgn");
+
+	iRIC_InitOption(IRIC_OPTION_FILEACCESS_SOLVERWRITE);
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solprofile.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	writeSolution("case_solprofile.cgn", &fid, false);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	// the file is not paged, so it is opened without the page buffer
+	iRIC_InitOption(IRIC_OPTION_FILEACCESS_GUIREAD);
+
+	ier = cg_iRIC_Open("case_solprofile.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	readSolution(fid);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	//
+	// Test Writing a paged file with the archive preset, and reading it with the page buffer
+	//
+
+	iRIC_InitOption(IRIC_OPTION_FILEACCESS_ARCHIVE);
+
+	ier = cg_iRIC_Open("case_solprofile_paged.cgn", IRIC_MODE_WRITE, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	int isize = 10;
+	int jsize = 8;
+	std::vector<double> x, y;
+	for (int j = 0; j < jsize; ++j) {
+		for (int i = 0; i < isize; ++i) {
+			x.push_back(i * 0.5);
+			y.push_back(j * 2.0);
+		}
+	}
+	ier = cg_iRIC_Write_Grid2d_Coords(fid, isize, jsize, x.data(), y.data());
+	VERIFY_LOG("cg_iRIC_Write_Grid2d_Coords() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	iRIC_InitOption(IRIC_OPTION_FILEACCESS_GUIREAD);
+
+	ier = cg_iRIC_Open("case_solprofile_paged.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	int isize2, jsize2;
+	ier = cg_iRIC_Read_Grid2d_Str_Size(fid, &isize2, &jsize2);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Str_Size() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Str_Size() isize == 10", isize2 == isize);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Str_Size() jsize == 8", jsize2 == jsize);
+
+	std::vector<double> x2(isize * jsize), y2(isize * jsize);
+	ier = cg_iRIC_Read_Grid2d_Coords(fid, x2.data(), y2.data());
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords() x is correct", x2 == x);
+	VERIFY_LOG("cg_iRIC_Read_Grid2d_Coords() y is correct", y2 == y);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	iRIC_InitOption(IRIC_OPTION_FILEACCESS_DEFAULT);
+
+	VERIFY_REMOVE("case_solprofile.cgn", hdf);
+	VERIFY_REMOVE("case_solprofile_paged.cgn", hdf);
+}
+
+void case_SolWriteParticleGroupMulti(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	bool hdf = true;
+
+	remove("case_solpgmulti.cgn");
+
+	fs::copy(origCgnsName, "case_solpgmulti.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solpgmulti.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	int count = 1000;
+	std::vector<double> x(count), y(count), vx(count), size(count), angle(count);
+	std::vector<int> active(count);
+	for (int i = 0; i < count; ++i) {
+		x[i] = i * 0.5;
+		y[i] = i * 2.0;
+		vx[i] = i * 0.1;
+		size[i] = 1 + i * 0.01;
+		angle[i] = i % 360;
+		active[i] = i % 2;
+	}
+
+	ier = cg_iRIC_Write_Sol_Start(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Start() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_Time(fid, 1.0);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Time() ier == 0", ier == 0);
+
+	// arrays are written in two calls, and a particle is added one at a time between them
+	int half = count / 2;
+	ier = cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(fid, "group1");
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupBegin() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, -1, x.data(), y.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti() ier != 0 for count -1", ier != 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, half, x.data(), y.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2d(fid, x[half], y[half]);
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_Pos2d() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, count - half - 1, x.data() + half + 1, y.data() + half + 1);
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, "VelX", count, vx.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_RealMulti() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, "Active", count, active.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_GroupEnd(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupEnd() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Write_Sol_ParticleGroupImage_GroupBegin(fid, "image1");
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroupImage_GroupBegin() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(fid, -1, x.data(), y.data(), size.data(), angle.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti() ier != 0 for count -1", ier != 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti(fid, count, x.data(), y.data(), size.data(), angle.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroupImage_Pos2dMulti() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroupImage_GroupEnd(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroupImage_GroupEnd() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Write_Sol_End(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_End() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Open("case_solpgmulti.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	int count2;
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Count(fid, 1, "group1", &count2);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Count() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Count() count == 1000", count2 == count);
+
+	std::vector<double> x2(count), y2(count), vx2(count), size2(count), angle2(count);
+	std::vector<int> active2(count);
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Pos2d(fid, 1, "group1", x2.data(), y2.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Pos2d() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Pos2d() x is correct", x2 == x);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Pos2d() y is correct", y2 == y);
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Real(fid, 1, "group1", "VelX", vx2.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Real() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Real() VelX is correct", vx2 == vx);
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Integer(fid, 1, "group1", "Active", active2.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Integer() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Integer() Active is correct", active2 == active);
+
+	ier = cg_iRIC_Read_Sol_ParticleGroupImage_Count(fid, 1, "image1", &count2);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroupImage_Count() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroupImage_Count() count == 1000", count2 == count);
+	ier = cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d(fid, 1, "image1", x2.data(), y2.data(), size2.data(), angle2.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d() x is correct", x2 == x);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d() size is correct", size2 == size);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroupImage_Pos2d() angle is correct", angle2 == angle);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	VERIFY_REMOVE("case_solpgmulti.cgn", hdf);
+}
+
+void case_SolWritePolyDataMulti(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	bool hdf = true;
+
+	remove("case_solpdmulti.cgn");
+
+	fs::copy(origCgnsName, "case_solpdmulti.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solpdmulti.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	// polygons with 3 to 5 points and polylines with 2 points
+	int count = 100;
+	std::vector<int> types, offsets, ids;
+	std::vector<double> x, y, depth;
+	offsets.push_back(0);
+	for (int i = 0; i < count; ++i) {
+		int numPoints = 2;
+		if (i % 2 == 0) {
+			types.push_back(IRIC_POLYDATA_POLYGON);
+			numPoints = 3 + i % 3;
+		} else {
+			types.push_back(IRIC_POLYDATA_POLYLINE);
+		}
+		for (int j = 0; j < numPoints; ++j) {
+			x.push_back(i + j * 0.1);
+			y.push_back(i * 2.0 - j);
+		}
+		offsets.push_back(static_cast<int> (x.size()));
+		ids.push_back(i + 1);
+		depth.push_back(i * 0.5);
+	}
+
+	ier = cg_iRIC_Write_Sol_Start(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Start() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_Time(fid, 1.0);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Time() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Write_Sol_PolyData_GroupBegin(fid, "group1");
+	VERIFY_LOG("cg_iRIC_Write_Sol_PolyData_GroupBegin() ier == 0", ier == 0);
+
+	std::vector<int> wrongOffsets(offsets);
+	wrongOffsets[2] = wrongOffsets[1] - 1;
+	ier = cg_iRIC_Write_Sol_PolyData_GeometryMulti(fid, count, types.data(), wrongOffsets.data(), x.data(), y.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_PolyData_GeometryMulti() with decreasing offsets ier != 0", ier != 0);
+	ier = cg_iRIC_Write_Sol_PolyData_GeometryMulti(fid, -1, types.data(), offsets.data(), x.data(), y.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_PolyData_GeometryMulti() with count -1 ier != 0", ier != 0);
+
+	ier = cg_iRIC_Write_Sol_PolyData_GeometryMulti(fid, count, types.data(), offsets.data(), x.data(), y.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_PolyData_GeometryMulti() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_PolyData_IntegerMulti(fid, "Id", count, ids.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_PolyData_IntegerMulti() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_PolyData_RealMulti(fid, "Depth", count, depth.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_PolyData_RealMulti() ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_PolyData_GroupEnd(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_PolyData_GroupEnd() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Write_Sol_End(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_End() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Open("case_solpdmulti.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	int dataCount, coordCount;
+	ier = cg_iRIC_Read_Sol_PolyData_DataCount(fid, 1, "group1", &dataCount);
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_DataCount() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_DataCount() count == 100", dataCount == count);
+	ier = cg_iRIC_Read_Sol_PolyData_CoordinateCount(fid, 1, "group1", &coordCount);
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_CoordinateCount() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_CoordinateCount() is correct", coordCount == static_cast<int> (x.size()));
+
+	std::vector<int> types2(count), ids2(count);
+	std::vector<double> x2(x.size()), y2(y.size()), depth2(count);
+	ier = cg_iRIC_Read_Sol_PolyData_Type(fid, 1, "group1", types2.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_Type() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_Type() is correct", types2 == types);
+	ier = cg_iRIC_Read_Sol_PolyData_Pos2d(fid, 1, "group1", x2.data(), y2.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_Pos2d() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_Pos2d() x is correct", x2 == x);
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_Pos2d() y is correct", y2 == y);
+	ier = cg_iRIC_Read_Sol_PolyData_Integer(fid, 1, "group1", "Id", ids2.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_Integer() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_Integer() is correct", ids2 == ids);
+	ier = cg_iRIC_Read_Sol_PolyData_Real(fid, 1, "group1", "Depth", depth2.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_Real() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_PolyData_Real() is correct", depth2 == depth);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	// all columns of the group at once
+	{
+		iRICLib::H5CgnsFile file("case_solpdmulti.cgn", iRICLib::H5CgnsFile::Mode::OpenReadOnly);
+		auto reader = file.solutionReader();
+		ier = reader->setSolutionId(1);
+		VERIFY_LOG("H5CgnsFileSolutionReader::setSolutionId() ier == 0", ier == 0);
+		auto sol = reader->targetFile()->zoneById(1)->polyDataSolution();
+
+		iRICLib::H5CgnsPolyDataSolution::GroupReader::Data data;
+		ier = sol->groupReader("group1").readAll(&data);
+		VERIFY_LOG("GroupReader::readAll() ier == 0", ier == 0);
+		VERIFY_LOG("GroupReader::readAll() types are correct", data.types == types);
+		VERIFY_LOG("GroupReader::readAll() offsets are correct", data.offsets == offsets);
+		VERIFY_LOG("GroupReader::readAll() x is correct", data.coordinatesX == x);
+		VERIFY_LOG("GroupReader::readAll() y is correct", data.coordinatesY == y);
+		VERIFY_LOG("GroupReader::readAll() Id is correct", data.intValues["Id"] == ids);
+		VERIFY_LOG("GroupReader::readAll() Depth is correct", data.realValues["Depth"] == depth);
+	}
+
+	VERIFY_REMOVE("case_solpdmulti.cgn", hdf);
+}
+
+void case_SolWriteParticleGroupTrajectory(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	bool hdf = true;
+
+	remove("case_soltraj.cgn");
+
+	fs::copy(origCgnsName, "case_soltraj.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_soltraj.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	ier = cg_iRIC_Set_ParticleGroupTrajectory(fid, "Id");
+	VERIFY_LOG("cg_iRIC_Set_ParticleGroupTrajectory() ier == 0", ier == 0);
+
+	// particle i has id i * 10, and the particles are written in reverse order.
+	// A particle leaves the group in each step: step s has particles 0 - (count - s).
+	const int steps = 4;
+	const int count = 20;
+	for (int s = 1; s <= steps; ++s) {
+		std::vector<int> ids;
+		std::vector<double> x, y, depth;
+		for (int i = count - s; i >= 0; --i) {
+			ids.push_back(i * 10);
+			x.push_back(i + s * 0.5);
+			y.push_back(s);
+			depth.push_back(i * 0.1 + s);
+		}
+		int n = static_cast<int> (ids.size());
+
+		ier = cg_iRIC_Write_Sol_Start(fid);
+		VERIFY_LOG("cg_iRIC_Write_Sol_Start() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_Time(fid, s * 1.0);
+		VERIFY_LOG("cg_iRIC_Write_Sol_Time() ier == 0", ier == 0);
+
+		ier = cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(fid, "group1");
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupBegin() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, n, x.data(), y.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, "Id", n, ids.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, "Depth", n, depth.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_RealMulti() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_ParticleGroup_GroupEnd(fid);
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupEnd() ier == 0", ier == 0);
+
+		ier = cg_iRIC_Write_Sol_End(fid);
+		VERIFY_LOG("cg_iRIC_Write_Sol_End() ier == 0", ier == 0);
+	}
+
+	// id 150 exists in steps 1 - 4, id 170 in steps 1 - 3, and id 999 does not exist
+	std::vector<int> queryIds;
+	queryIds.push_back(170);
+	queryIds.push_back(150);
+	queryIds.push_back(999);
+	std::vector<int> expectedIds = {170, 170, 170, 150, 150, 150, 150};
+	std::vector<int> expectedSteps = {1, 2, 3, 1, 2, 3, 4};
+
+	// before the file is closed, the index is not built and all steps are searched one by one
+	int size;
+	ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(fid, "group1", 3, queryIds.data(), 1, steps, &size);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() before closing ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() before closing value == 7", size == 7);
+
+	std::vector<int> pids(size), pSteps(size);
+	std::vector<double> px(size), py(size), pDepth(size);
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(fid, "group1", 3, queryIds.data(), 1, steps, pids.data(), pSteps.data(), px.data(), py.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() before closing ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() before closing ids are correct", pids == expectedIds);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() before closing steps are correct", pSteps == expectedSteps);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Open("case_soltraj.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	// the steps are read with the functions for particle groups of each step
+	int stepCount;
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Count(fid, 2, "group1", &stepCount);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Count() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Count() value == 19", stepCount == count - 1);
+
+	std::vector<int> stepIds(stepCount);
+	std::vector<double> stepX(stepCount), stepY(stepCount);
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Integer(fid, 2, "group1", "Id", stepIds.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Integer() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Integer() value[0] == 180", stepIds[0] == 180);
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Pos2d(fid, 2, "group1", stepX.data(), stepY.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Pos2d() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Pos2d() x[0] == 19", stepX[0] == 19);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Pos2d() y[0] == 2", stepY[0] == 2);
+
+	ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(fid, "group1", 3, queryIds.data(), 1, steps, &size);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() value == 7", size == 7);
+
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(fid, "group1", 3, queryIds.data(), 1, steps, pids.data(), pSteps.data(), px.data(), py.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() ids are correct", pids == expectedIds);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() steps are correct", pSteps == expectedSteps);
+	bool posOk = true;
+	for (int i = 0; i < size; ++i) {
+		posOk = posOk && px[i] == pids[i] / 10 + pSteps[i] * 0.5 && py[i] == pSteps[i];
+	}
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() positions are correct", posOk);
+
+	ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(fid, "group1", 3, queryIds.data(), 1, steps, "Depth", pDepth.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal() value[3] == 2.5", pDepth[3] == 15 * 0.1 + 1);
+
+	ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(fid, "group1", 3, queryIds.data(), 3, steps, &size);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() with step range ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() with step range value == 3", size == 3);
+
+	ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(fid, "group2", 3, queryIds.data(), 1, steps, &size);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() for group not exists ier != 0", ier != 0);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	// step 5 is appended after the index is built, so it is found by searching the step
+	ier = cg_iRIC_Open("case_soltraj.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() for appending ier == 0", ier == 0);
+	ier = cg_iRIC_Set_ParticleGroupTrajectory(fid, "Id");
+	VERIFY_LOG("cg_iRIC_Set_ParticleGroupTrajectory() for appending ier == 0", ier == 0);
+
+	std::vector<int> ids5 = {150, 10};
+	std::vector<double> x5 = {15 + 5 * 0.5, 1 + 5 * 0.5}, y5 = {5, 5}, depth5 = {15 * 0.1 + 5, 1 * 0.1 + 5};
+	ier = cg_iRIC_Write_Sol_Start(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Start() for appending ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_Time(fid, 5.0);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Time() for appending ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(fid, "group1");
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupBegin() for appending ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, 2, x5.data(), y5.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti() for appending ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, "Id", 2, ids5.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti() for appending ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, "Depth", 2, depth5.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_RealMulti() for appending ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_GroupEnd(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupEnd() for appending ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_End(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_End() for appending ier == 0", ier == 0);
+
+	ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(fid, "group1", 3, queryIds.data(), 1, steps + 1, &size);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() after appending ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() after appending value == 8", size == 8);
+
+	pids.assign(size, 0);
+	pSteps.assign(size, 0);
+	px.assign(size, 0);
+	py.assign(size, 0);
+	pDepth.assign(size, 0);
+	ier = cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d(fid, "group1", 3, queryIds.data(), 1, steps + 1, pids.data(), pSteps.data(), px.data(), py.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() after appending ier == 0", ier == 0);
+	expectedIds = {170, 170, 170, 150, 150, 150, 150, 150};
+	expectedSteps = {1, 2, 3, 1, 2, 3, 4, 5};
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() after appending ids are correct", pids == expectedIds);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() after appending steps are correct", pSteps == expectedSteps);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Trajectory2d() after appending position[7] is correct", px[7] == x5[0] && py[7] == y5[0]);
+
+	ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(fid, "group1", 3, queryIds.data(), 1, steps + 1, "Depth", pDepth.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal() after appending ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal() after appending value[6] and value[7] are correct", pDepth[6] == 15 * 0.1 + 4 && pDepth[7] == depth5[0]);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	// RunRows is replaced with an array that is not extendible, so that appending step 6 fails
+	// after the coordinates and the values are appended
+	const hsize_t rowCount = 20 + 19 + 18 + 17 + 2;
+	const std::string groupPath = "/iRIC/iRICZone/ParticleGroupTrajectories/group1/";
+	hid_t fileId = H5Fopen("case_soltraj.cgn", H5F_ACC_RDWR, H5P_DEFAULT);
+	VERIFY_LOG("H5Fopen() fileId >= 0", fileId >= 0);
+	herr_t status = H5Ldelete(fileId, (groupPath + "RunRows/ data").c_str(), H5P_DEFAULT);
+	VERIFY_LOG("H5Ldelete() status >= 0", status >= 0);
+	hid_t spaceId = H5Screate_simple(1, &rowCount, nullptr);
+	hid_t dataId = H5Dcreate2(fileId, (groupPath + "RunRows/ data").c_str(), H5T_STD_I32LE, spaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+	VERIFY_LOG("H5Dcreate2() dataId >= 0", dataId >= 0);
+	H5Dclose(dataId);
+	H5Sclose(spaceId);
+	H5Fclose(fileId);
+
+	ier = cg_iRIC_Open("case_soltraj.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() for failing append ier == 0", ier == 0);
+	ier = cg_iRIC_Set_ParticleGroupTrajectory(fid, "Id");
+	VERIFY_LOG("cg_iRIC_Set_ParticleGroupTrajectory() for failing append ier == 0", ier == 0);
+
+	ier = cg_iRIC_Write_Sol_Start(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Start() for failing append ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_Time(fid, 6.0);
+	VERIFY_LOG("cg_iRIC_Write_Sol_Time() for failing append ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(fid, "group1");
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupBegin() for failing append ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, 2, x5.data(), y5.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti() for failing append ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, "Id", 2, ids5.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti() for failing append ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, "Depth", 2, depth5.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_RealMulti() for failing append ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, "Speed", 2, depth5.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_RealMulti() for failing append ier == 0", ier == 0);
+	ier = cg_iRIC_Write_Sol_ParticleGroup_GroupEnd(fid);
+	VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupEnd() for failing append ier != 0", ier != 0);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() after failing append ier == 0", ier == 0);
+
+	// the arrays appended before the error are truncated to the rows of steps 1 - 5
+	fileId = H5Fopen("case_soltraj.cgn", H5F_ACC_RDONLY, H5P_DEFAULT);
+	VERIFY_LOG("H5Fopen() fileId >= 0", fileId >= 0);
+	auto arraySize = [&](const std::string& name) {
+		hsize_t dim = 0;
+		hid_t dId = H5Dopen2(fileId, (groupPath + name + "/ data").c_str(), H5P_DEFAULT);
+		if (dId < 0) {return dim;}
+		hid_t sId = H5Dget_space(dId);
+		H5Sget_simple_extent_dims(sId, &dim, nullptr);
+		H5Sclose(sId);
+		H5Dclose(dId);
+		return dim;
+	};
+	std::vector<std::string> rowArrays = {"coordinateX", "coordinateY", "__Id", "__Depth", "__Speed", "RunIds", "RunRows"};
+	bool sizeOk = true;
+	for (const auto& name : rowArrays) {
+		sizeOk = sizeOk && arraySize(name) == rowCount;
+	}
+	VERIFY_LOG("the arrays with rows have the rows of steps 1 - 5 after failing append", sizeOk);
+	VERIFY_LOG("the arrays for steps have 5 values after failing append", arraySize("Steps") == 5 && arraySize("Counts") == 5);
+	H5Fclose(fileId);
+
+	ier = cg_iRIC_Open("case_soltraj.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() after failing append ier == 0", ier == 0);
+	ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize(fid, "group1", 3, queryIds.data(), 1, steps + 1, &size);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() after failing append ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectorySize() after failing append value == 8", size == 8);
+	ier = cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal(fid, "group1", 3, queryIds.data(), 1, steps + 1, "Depth", pDepth.data());
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal() after failing append ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_TrajectoryReal() after failing append value[7] is correct", pDepth[7] == depth5[0]);
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	VERIFY_REMOVE("case_soltraj.cgn", hdf);
+}
+
+void case_SolWriteParticleBins(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	bool hdf = true;
+
+	remove("case_solbins.cgn");
+
+	fs::copy(origCgnsName, "case_solbins.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solbins.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	ier = cg_iRIC_Set_ParticleBins(fid, -1);
+	VERIFY_LOG("cg_iRIC_Set_ParticleBins() ier != 0 for level -1", ier != 0);
+
+	// particle i has Id i, and the particles are scattered in (0 - 9.9, 0 - 9.9).
+	// step 1 is written with bins, and step 2 without bins.
+	const int count = 100;
+	std::vector<int> ids;
+	std::vector<double> x, y, depth;
+	for (int i = 0; i < count; ++i) {
+		ids.push_back(i);
+		x.push_back((i * 37 % count) * 0.1);
+		y.push_back((i * 53 % count) * 0.1);
+		depth.push_back(i * 0.5);
+	}
+
+	for (int s = 1; s <= 2; ++s) {
+		ier = cg_iRIC_Set_ParticleBins(fid, s == 1 ? 3 : 0);
+		VERIFY_LOG("cg_iRIC_Set_ParticleBins() ier == 0", ier == 0);
+
+		ier = cg_iRIC_Write_Sol_Start(fid);
+		VERIFY_LOG("cg_iRIC_Write_Sol_Start() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_Time(fid, s * 1.0);
+		VERIFY_LOG("cg_iRIC_Write_Sol_Time() ier == 0", ier == 0);
+
+		ier = cg_iRIC_Write_Sol_Particle_Pos2d(fid, count, x.data(), y.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_Particle_Pos2d() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_Particle_Integer(fid, "Id", ids.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_Particle_Integer() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_Particle_Real(fid, "Depth", depth.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_Particle_Real() ier == 0", ier == 0);
+
+		ier = cg_iRIC_Write_Sol_ParticleGroup_GroupBegin(fid, "group1");
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupBegin() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti(fid, count, x.data(), y.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_Pos2dMulti() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti(fid, "Id", count, ids.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_IntegerMulti() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_ParticleGroup_RealMulti(fid, "Depth", count, depth.data());
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_RealMulti() ier == 0", ier == 0);
+		ier = cg_iRIC_Write_Sol_ParticleGroup_GroupEnd(fid);
+		VERIFY_LOG("cg_iRIC_Write_Sol_ParticleGroup_GroupEnd() ier == 0", ier == 0);
+
+		ier = cg_iRIC_Write_Sol_End(fid);
+		VERIFY_LOG("cg_iRIC_Write_Sol_End() ier == 0", ier == 0);
+	}
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Open("case_solbins.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	const double xmin = 2.05, xmax = 5.0, ymin = 3.0, ymax = 7.45;
+	int expectedCount = 0;
+	for (int i = 0; i < count; ++i) {
+		if (x[i] >= xmin && x[i] <= xmax && y[i] >= ymin && y[i] <= ymax) {++expectedCount;}
+	}
+
+	for (int s = 1; s <= 2; ++s) {
+		// the values read are in the same order as the positions
+		int readCount;
+		ier = cg_iRIC_Read_Sol_Particle_Count(fid, s, &readCount);
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_Count() ier == 0", ier == 0);
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_Count() value == 100", readCount == count);
+
+		std::vector<int> readIds(count);
+		std::vector<double> readX(count), readY(count), readDepth(count);
+		ier = cg_iRIC_Read_Sol_Particle_Pos2d(fid, s, readX.data(), readY.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_Pos2d() ier == 0", ier == 0);
+		ier = cg_iRIC_Read_Sol_Particle_Integer(fid, s, "Id", readIds.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_Integer() ier == 0", ier == 0);
+		ier = cg_iRIC_Read_Sol_Particle_Real(fid, s, "Depth", readDepth.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_Real() ier == 0", ier == 0);
+		bool valuesOk = true;
+		for (int i = 0; i < count; ++i) {
+			int id = readIds[i];
+			valuesOk = valuesOk && id >= 0 && id < count && readX[i] == x[id] && readY[i] == y[id] && readDepth[i] == depth[id];
+		}
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_*() values are correct", valuesOk);
+
+		ier = cg_iRIC_Read_Sol_Particle_RectCount(fid, s, xmin, xmax, ymin, ymax, &readCount);
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_RectCount() ier == 0", ier == 0);
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_RectCount() value is correct", readCount == expectedCount);
+
+		readIds.assign(readCount, 0);
+		readX.assign(readCount, 0);
+		readY.assign(readCount, 0);
+		readDepth.assign(readCount, 0);
+		ier = cg_iRIC_Read_Sol_Particle_RectPos2d(fid, s, xmin, xmax, ymin, ymax, readX.data(), readY.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_RectPos2d() ier == 0", ier == 0);
+		ier = cg_iRIC_Read_Sol_Particle_RectInteger(fid, s, xmin, xmax, ymin, ymax, "Id", readIds.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_RectInteger() ier == 0", ier == 0);
+		ier = cg_iRIC_Read_Sol_Particle_RectReal(fid, s, xmin, xmax, ymin, ymax, "Depth", readDepth.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_RectReal() ier == 0", ier == 0);
+		valuesOk = true;
+		for (int i = 0; i < readCount; ++i) {
+			int id = readIds[i];
+			valuesOk = valuesOk && id >= 0 && id < count && readX[i] == x[id] && readY[i] == y[id] && readDepth[i] == depth[id];
+			valuesOk = valuesOk && readX[i] >= xmin && readX[i] <= xmax && readY[i] >= ymin && readY[i] <= ymax;
+		}
+		VERIFY_LOG("cg_iRIC_Read_Sol_Particle_Rect*() values are correct", valuesOk);
+
+		ier = cg_iRIC_Read_Sol_ParticleGroup_Count(fid, s, "group1", &readCount);
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Count() ier == 0", ier == 0);
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Count() value == 100", readCount == count);
+
+		readIds.assign(count, 0);
+		readX.assign(count, 0);
+		readY.assign(count, 0);
+		ier = cg_iRIC_Read_Sol_ParticleGroup_Pos2d(fid, s, "group1", readX.data(), readY.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Pos2d() ier == 0", ier == 0);
+		ier = cg_iRIC_Read_Sol_ParticleGroup_Integer(fid, s, "group1", "Id", readIds.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Integer() ier == 0", ier == 0);
+		valuesOk = true;
+		for (int i = 0; i < count; ++i) {
+			int id = readIds[i];
+			valuesOk = valuesOk && id >= 0 && id < count && readX[i] == x[id] && readY[i] == y[id];
+		}
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_*() values are correct", valuesOk);
+
+		ier = cg_iRIC_Read_Sol_ParticleGroup_RectCount(fid, s, "group1", xmin, xmax, ymin, ymax, &readCount);
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_RectCount() ier == 0", ier == 0);
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_RectCount() value is correct", readCount == expectedCount);
+
+		readIds.assign(readCount, 0);
+		readX.assign(readCount, 0);
+		readY.assign(readCount, 0);
+		readDepth.assign(readCount, 0);
+		ier = cg_iRIC_Read_Sol_ParticleGroup_RectPos2d(fid, s, "group1", xmin, xmax, ymin, ymax, readX.data(), readY.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_RectPos2d() ier == 0", ier == 0);
+		ier = cg_iRIC_Read_Sol_ParticleGroup_RectInteger(fid, s, "group1", xmin, xmax, ymin, ymax, "Id", readIds.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_RectInteger() ier == 0", ier == 0);
+		ier = cg_iRIC_Read_Sol_ParticleGroup_RectReal(fid, s, "group1", xmin, xmax, ymin, ymax, "Depth", readDepth.data());
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_RectReal() ier == 0", ier == 0);
+		valuesOk = true;
+		for (int i = 0; i < readCount; ++i) {
+			int id = readIds[i];
+			valuesOk = valuesOk && id >= 0 && id < count && readX[i] == x[id] && readY[i] == y[id] && readDepth[i] == depth[id];
+			valuesOk = valuesOk && readX[i] >= xmin && readX[i] <= xmax && readY[i] >= ymin && readY[i] <= ymax;
+		}
+		VERIFY_LOG("cg_iRIC_Read_Sol_ParticleGroup_Rect*() values are correct", valuesOk);
+	}
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	// the bins are written in step 1 only
+	hid_t fileId = H5Fopen("case_solbins.cgn", H5F_ACC_RDONLY, H5P_DEFAULT);
+	VERIFY_LOG("H5Fopen() fileId >= 0", fileId >= 0);
+	for (int s = 1; s <= 2; ++s) {
+		std::ostringstream ss1, ss2;
+		ss1 << "/iRIC/iRICZone/ParticleSolution" << s << "/CoordinateBinCodes";
+		ss2 << "/iRIC/iRICZone/ParticleGroupSolution" << s << "/group1_coordinateBinCodes";
+		bool exists = H5Lexists(fileId, ss1.str().c_str(), H5P_DEFAULT) > 0;
+		VERIFY_LOG("H5Lexists() particle bin codes exist in step 1 only", exists == (s == 1));
+		exists = H5Lexists(fileId, ss2.str().c_str(), H5P_DEFAULT) > 0;
+		VERIFY_LOG("H5Lexists() particle group bin codes exist in step 1 only", exists == (s == 1));
+	}
+	H5Fclose(fileId);
+
+	VERIFY_REMOVE("case_solbins.cgn", hdf);
+}
+
+void case_SolWriteAppend(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	bool hdf = true;
+
+	remove("case_solappend.cgn");
+
+	//
+	// Test Writing iterative data step by step. Each step is flushed, and appended to the file
+	//
+
+	fs::copy(origCgnsName, "case_solappend.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solappend.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	// the iterative arrays are chunked, and extended in place with an unlimited max dimension
+	auto checkExtendible = [](const char* path, hsize_t size) {
+		bool ok = false;
+		hid_t fileId = H5Fopen("case_solappend.cgn", H5F_ACC_RDONLY, H5P_DEFAULT);
+		if (fileId < 0) {return ok;}
+
+		hid_t dataId = H5Dopen2(fileId, path, H5P_DEFAULT);
+		if (dataId >= 0) {
+			hid_t plistId = H5Dget_create_plist(dataId);
+			hid_t spaceId = H5Dget_space(dataId);
+			hsize_t dim = 0, maxDim = 0;
+			int rank = H5Sget_simple_extent_dims(spaceId, &dim, &maxDim);
+			ok = (H5Pget_layout(plistId) == H5D_CHUNKED) && (rank == 1) && (dim == size) && (maxDim == H5S_UNLIMITED);
+			H5Sclose(spaceId);
+			H5Pclose(plistId);
+			H5Dclose(dataId);
+		}
+		H5Fclose(fileId);
+		return ok;
+	};
+	// an attribute is added to the datasets, to check that they are not recreated when appended
+	auto setMarker = [](const char* path) {
+		hid_t fileId = H5Fopen("case_solappend.cgn", H5F_ACC_RDWR, H5P_DEFAULT);
+		if (fileId < 0) {return false;}
+
+		hid_t spaceId = H5Screate(H5S_SCALAR);
+		hid_t attId = H5Acreate_by_name(fileId, path, "marker", H5T_NATIVE_INT, spaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+		bool ok = (attId >= 0);
+		if (ok) {H5Aclose(attId);}
+		H5Sclose(spaceId);
+		H5Fclose(fileId);
+		return ok;
+	};
+	auto markerExists = [](const char* path) {
+		hid_t fileId = H5Fopen("case_solappend.cgn", H5F_ACC_RDONLY, H5P_DEFAULT);
+		if (fileId < 0) {return false;}
+
+		bool ok = H5Aexists_by_name(fileId, path, "marker", H5P_DEFAULT) > 0;
+		H5Fclose(fileId);
+		return ok;
+	};
+
+	const int steps = 20;
+	for (int i = 0; i < steps; ++i) {
+		if (i == steps / 2) {
+			ier = cg_iRIC_Close(fid);
+			VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+			VERIFY_LOG("TimeValues is extendible after 10 steps", checkExtendible("/iRIC/BaseIterativeData/TimeValues/ data", steps / 2));
+			VERIFY_LOG("Step is extendible after 10 steps", checkExtendible("/iRIC/BaseIterativeData/Step/ data", steps / 2));
+			VERIFY_LOG("H5Acreate_by_name() for TimeValues succeeds", setMarker("/iRIC/BaseIterativeData/TimeValues/ data"));
+			VERIFY_LOG("H5Acreate_by_name() for Step succeeds", setMarker("/iRIC/BaseIterativeData/Step/ data"));
+
+			ier = cg_iRIC_Open("case_solappend.cgn", IRIC_MODE_MODIFY, &fid);
+			VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+		}
+
+		ier = cg_iRIC_Write_Sol_Start(fid);
+		VERIFY_LOG("cg_iRIC_Write_Sol_Start() ier == 0", ier == 0);
+
+		ier = cg_iRIC_Write_Sol_Time(fid, i * 0.5);
+		VERIFY_LOG("cg_iRIC_Write_Sol_Time() ier == 0", ier == 0);
+
+		ier = cg_iRIC_Write_Sol_BaseIterative_Integer(fid, "Step", i);
+		VERIFY_LOG("cg_iRIC_Write_Sol_BaseIterative_Integer() ier == 0", ier == 0);
+
+		// string length grows, so the array is rewritten sometimes
+		std::string label(i / 5 + 1, 'a');
+		ier = cg_iRIC_Write_Sol_BaseIterative_String(fid, "Label", label.c_str());
+		VERIFY_LOG("cg_iRIC_Write_Sol_BaseIterative_String() ier == 0", ier == 0);
+
+		ier = cg_iRIC_Write_Sol_End(fid);
+		VERIFY_LOG("cg_iRIC_Write_Sol_End() ier == 0", ier == 0);
+	}
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	// the arrays written before reopening the file are extended, not rewritten
+	VERIFY_LOG("TimeValues is extendible after 20 steps", checkExtendible("/iRIC/BaseIterativeData/TimeValues/ data", steps));
+	VERIFY_LOG("Step is extendible after 20 steps", checkExtendible("/iRIC/BaseIterativeData/Step/ data", steps));
+	VERIFY_LOG("TimeValues is not recreated", markerExists("/iRIC/BaseIterativeData/TimeValues/ data"));
+	VERIFY_LOG("Step is not recreated", markerExists("/iRIC/BaseIterativeData/Step/ data"));
+
+	ier = cg_iRIC_Open("case_solappend.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	int count;
+	ier = cg_iRIC_Read_Sol_Count(fid, &count);
+	VERIFY_LOG("cg_iRIC_Read_Sol_Count() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Read_Sol_Count() count == steps", count == steps);
+
+	bool timeOk = true;
+	bool stepOk = true;
+	bool labelOk = true;
+	for (int i = 0; i < steps; ++i) {
+		double time;
+		ier = cg_iRIC_Read_Sol_Time(fid, i + 1, &time);
+		timeOk = timeOk && (ier == 0) && (time == i * 0.5);
+
+		int step;
+		ier = cg_iRIC_Read_Sol_BaseIterative_Integer(fid, i + 1, "Step", &step);
+		stepOk = stepOk && (ier == 0) && (step == i);
+
+		char label[32];
+		ier = cg_iRIC_Read_Sol_BaseIterative_String(fid, i + 1, "Label", label);
+		labelOk = labelOk && (ier == 0) && (std::string(label) == std::string(i / 5 + 1, 'a'));
+	}
+	VERIFY_LOG("cg_iRIC_Read_Sol_Time() values are correct", timeOk);
+	VERIFY_LOG("cg_iRIC_Read_Sol_BaseIterative_Integer() values are correct", stepOk);
+	VERIFY_LOG("cg_iRIC_Read_Sol_BaseIterative_String() values are correct", labelOk);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	VERIFY_REMOVE("case_solappend.cgn", hdf);
+}
+
+void case_SolWriteSwmr(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_SWMRSOLUTIONS);
+
+	bool hdf = true;
+
+	remove("case_solswmr.cgn");
+	remove("result/Solution1.cgn");
+	remove("result/Solution2.cgn");
+	remove("result/Solution3.cgn");
+	remove("result/Solution4.cgn");
+	remove("result/Solution5.cgn");
+
+	//
+	// Test Writing Solutions in SWMR mode (IRIC_OPTION_SWMRSOLUTIONS) with times.
+	// The file is rewritten in the latest file format when the first solution is written
+	//
+
+	fs::copy(origCgnsName, "case_solswmr.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solswmr.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	writeSolution("case_solswmr.cgn", &fid, false);
+
+	FILE* f = fopen("tmp/case_solswmr.cgn.copy", "r");
+	VERIFY_LOG("tmp/case_solswmr.cgn.copy is not created", f == NULL);
+	if (f != NULL) {
+		fclose(f);
+	}
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	//
+	// Test Reading Solutions with IRIC_MODE_READ_SWMR
+	//
+
+	ier = cg_iRIC_Open("case_solswmr.cgn", IRIC_MODE_READ_SWMR, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	ier = cg_iRIC_Read_Sol_Refresh(fid);
+	VERIFY_LOG("cg_iRIC_Read_Sol_Refresh() ier == 0", ier == 0);
+
+	readSolution(fid);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Open("case_solswmr.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Read_Sol_Refresh(fid);
+	VERIFY_LOG("cg_iRIC_Read_Sol_Refresh() ier == 0", ier == 0);
+
+	readSolution(fid);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	VERIFY_REMOVE("case_solswmr.cgn", hdf);
+	VERIFY_REMOVE("result/Solution1.cgn", hdf);
+	VERIFY_REMOVE("result/Solution2.cgn", hdf);
+	VERIFY_REMOVE("result/Solution3.cgn", hdf);
+	VERIFY_REMOVE("result/Solution4.cgn", hdf);
+	VERIFY_REMOVE("result/Solution5.cgn", hdf);
+}
+
+void case_SolWriteAsync(const std::string& origCgnsName)
+{
+	iRIC_InitOption(IRIC_OPTION_STDSOLUTION);
+
+	bool hdf = true;
+
+	remove("case_solasync.cgn");
+
+	//
+	// Test Writing Solutions in the background thread
+	//
+
+	fs::copy(origCgnsName, "case_solasync.cgn");
+
+	int fid;
+	int ier = cg_iRIC_Open("case_solasync.cgn", IRIC_MODE_MODIFY, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	ier = cg_iRIC_Set_Sol_AsyncWrite(fid, -1);
+	VERIFY_LOG("cg_iRIC_Set_Sol_AsyncWrite() ier != 0 for queueSize -1", ier != 0);
+
+	// the background thread is used only with thread-safe HDF5. Otherwise solutions are written synchronously.
+	hbool_t threadSafe = false;
+	H5is_library_threadsafe(&threadSafe);
+
+	// a small queue, so that the solver waits for the background thread sometimes
+	ier = cg_iRIC_Set_Sol_AsyncWrite(fid, 2);
+	if (threadSafe) {
+		VERIFY_LOG("cg_iRIC_Set_Sol_AsyncWrite() ier == 0", ier == 0);
+	} else {
+		VERIFY_LOG("cg_iRIC_Set_Sol_AsyncWrite() ier != 0 without thread-safe HDF5", ier != 0);
+	}
+
+	// a second file opened while the first one has queued writes
+	remove("case_solasync2.cgn");
+	fs::copy(origCgnsName, "case_solasync2.cgn");
+
+	writeSolution("case_solasync.cgn", &fid, false);
+
+	int fid2;
+	ier = cg_iRIC_Open("case_solasync2.cgn", IRIC_MODE_MODIFY, &fid2);
+	VERIFY_LOG("cg_iRIC_Open() for second file ier == 0", ier == 0);
+	ier = cg_iRIC_Set_Sol_AsyncWrite(fid2, threadSafe ? 2 : 0);
+	VERIFY_LOG("cg_iRIC_Set_Sol_AsyncWrite() for second file ier == 0", ier == 0);
+	writeSolution("case_solasync2.cgn", &fid2, false);
+	ier = cg_iRIC_Close(fid2);
+	VERIFY_LOG("cg_iRIC_Close() for second file ier == 0", ier == 0);
+
+	int maxQueueDepth;
+	double stallSeconds;
+	ier = cg_iRIC_Read_Sol_AsyncWriteStats(fid, &maxQueueDepth, &stallSeconds);
+	VERIFY_LOG("cg_iRIC_Read_Sol_AsyncWriteStats() ier == 0", ier == 0);
+	if (threadSafe) {
+		VERIFY_LOG("cg_iRIC_Read_Sol_AsyncWriteStats() maxQueueDepth >= 1", maxQueueDepth >= 1);
+	} else {
+		VERIFY_LOG("cg_iRIC_Read_Sol_AsyncWriteStats() maxQueueDepth == 0 without thread-safe HDF5", maxQueueDepth == 0);
+	}
+	VERIFY_LOG("cg_iRIC_Read_Sol_AsyncWriteStats() maxQueueDepth <= 2", maxQueueDepth <= 2);
+	VERIFY_LOG("cg_iRIC_Read_Sol_AsyncWriteStats() stallSeconds >= 0", stallSeconds >= 0);
+
+	// writing to a grid that does not exist fails when the grid is looked up, before it is queued
+	std::vector<double> dummy(1, 0);
+	ier = cg_iRIC_Write_Sol_Node_Real_WithGridId(fid, 100, "Dummy", dummy.data());
+	VERIFY_LOG("cg_iRIC_Write_Sol_Node_Real_WithGridId() ier != 0 for invalid gid", ier != 0);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Open("case_solasync.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() ier == 0", ier == 0);
+	VERIFY_LOG("cg_iRIC_Open() fid != 0", fid != 0);
+
+	readSolution(fid);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() ier == 0", ier == 0);
+
+	ier = cg_iRIC_Open("case_solasync2.cgn", IRIC_MODE_READ, &fid);
+	VERIFY_LOG("cg_iRIC_Open() for second file ier == 0", ier == 0);
+
+	readSolution(fid);
+
+	ier = cg_iRIC_Close(fid);
+	VERIFY_LOG("cg_iRIC_Close() for second file ier == 0", ier == 0);
+
+	VERIFY_REMOVE("case_solasync.cgn", hdf);
+	VERIFY_REMOVE("case_solasync2.cgn", hdf);
+}
+
+void case_SolWriteStd_adf()
+{
+	case_SolWriteStd("case_init.cgn");
+}
+
+void case_SolWriteStd_hdf5()
+{
+	case_SolWriteStd("case_init_hdf5.cgn");
+}
+
+void case_SolWriteDivide_adf()
+{
+	case_SolWriteDivide("case_init.cgn");
+}
+
+void case_SolWriteDivide_hdf5()
+{
+	case_SolWriteDivide("case_init_hdf5.cgn");
+}
+
+void case_SolWriteSharedGrid_hdf5()
+{
+	case_SolWriteSharedGrid("case_init_hdf5.cgn");
+}
+
+void case_SolCombine_hdf5()
+{
+	case_SolCombine("case_init_hdf5.cgn");
+}
+
+void case_SolIndex_hdf5()
+{
+	case_SolIndex("case_init_hdf5.cgn");
+}
+
+void case_SolReadCached_hdf5()
+{
+	case_SolReadCached("case_init_hdf5.cgn");
+}
+
+void case_SolWriteCompressed_hdf5()
+{
+	case_SolWriteCompressed("case_init_hdf5.cgn");
+}
+
+void case_SolWriteAccessProfile_hdf5()
+{
+	case_SolWriteAccessProfile("case_init_hdf5.cgn");
+}
+
+void case_SolWriteParticleGroupMulti_hdf5()
+{
+	case_SolWriteParticleGroupMulti("case_init_hdf5.cgn");
+}
+
+void case_SolWritePolyDataMulti_hdf5()
+{
+	case_SolWritePolyDataMulti("case_init_hdf5.cgn");
+}
+
+void case_SolWriteParticleGroupTrajectory_hdf5()
+{
+	case_SolWriteParticleGroupTrajectory("case_init_hdf5.cgn");
+}
+
+void case_SolWriteParticleBins_hdf5()
+{
+	case_SolWriteParticleBins("case_init_hdf5.cgn");
+}
+
+void case_SolWriteAppend_hdf5()
+{
+	case_SolWriteAppend("case_init_hdf5.cgn");
+}
+
+void case_SolWriteSwmr_hdf5()
+{
+	case_SolWriteSwmr("case_init_hdf5.cgn");
+}
+
+void case_SolWriteAsync_hdf5()
+{
+	case_SolWriteAsync("case_init_hdf5.cgn");
 }
 
 } // extern "C"
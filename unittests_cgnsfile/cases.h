@@ -6,6 +6,8 @@ void case_InitOptionCheck();
 
 void case_CheckCancel();
 
+void case_GeoRead();
+
 void case_CalcCondRead();
 void case_CalcCondWrite();
 
@@ -26,6 +28,19 @@ void case_SolWriteStd_adf();
 void case_SolWriteStd_hdf5();
 void case_SolWriteDivide_adf();
 void case_SolWriteDivide_hdf5();
+void case_SolWriteSharedGrid_hdf5();
+void case_SolCombine_hdf5();
+void case_SolIndex_hdf5();
+void case_SolReadCached_hdf5();
+void case_SolWriteCompressed_hdf5();
+void case_SolWriteAccessProfile_hdf5();
+void case_SolWriteParticleGroupMulti_hdf5();
+void case_SolWritePolyDataMulti_hdf5();
+void case_SolWriteParticleGroupTrajectory_hdf5();
+void case_SolWriteParticleBins_hdf5();
+void case_SolWriteAppend_hdf5();
+void case_SolWriteSwmr_hdf5();
+void case_SolWriteAsync_hdf5();
 
 void case_addGridAndResult();
 
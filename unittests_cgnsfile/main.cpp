@@ -11,6 +11,8 @@ int main(int argc, char* argv[])
 
 	case_CheckCancel();
 
+	case_GeoRead();
+
 	case_CalcCondRead();
 	case_CalcCondWrite();
 
@@ -32,6 +34,19 @@ int main(int argc, char* argv[])
 
 	case_SolWriteStd_hdf5();
 	case_SolWriteDivide_hdf5();
+	case_SolWriteSharedGrid_hdf5();
+	case_SolCombine_hdf5();
+	case_SolIndex_hdf5();
+	case_SolReadCached_hdf5();
+	case_SolWriteCompressed_hdf5();
+	case_SolWriteAccessProfile_hdf5();
+	case_SolWriteParticleGroupMulti_hdf5();
+	case_SolWritePolyDataMulti_hdf5();
+	case_SolWriteParticleGroupTrajectory_hdf5();
+	case_SolWriteParticleBins_hdf5();
+	case_SolWriteAppend_hdf5();
+	case_SolWriteSwmr_hdf5();
+	case_SolWriteAsync_hdf5();
 
 	case_addGridAndResult();
 
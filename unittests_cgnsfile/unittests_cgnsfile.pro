@@ -13,6 +13,17 @@ else {
 }
 LIBS += -liriclib
 
+win32 {
+	CONFIG(debug, debug|release) {
+		LIBS += -lhdf5_D
+	} else {
+		LIBS += -lhdf5
+	}
+}
+unix {
+	LIBS += -lhdf5
+}
+
 # iriclib
 INCLUDEPATH += ".."
 
@@ -23,6 +34,7 @@ SOURCES += case_add_grid_and_result.cpp \
            case_calccond.cpp \
            case_check.cpp \
            case_complex.cpp \
+           case_geo.cpp \
            case_grid.cpp \
            case_init.cpp \
            case_initoption_check.cpp \
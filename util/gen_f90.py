@@ -51,9 +51,17 @@ def gen_f90_interface_content(fdef):
         return ""
     if fname_lower == 'cg_iric_read_grid2d_findcell':
         return ""
+    if fname_lower == 'cg_iric_read_grid2d_findcellmulti':
+        return ""
+    if fname_lower == 'cg_iric_read_grid2d_findcellwithhint':
+        return ""
     if fname_lower == 'cg_iric_read_grid2d_interpolatewithcell':
         return ""
 
+    # values of series are (points, steps) arrays
+    if '_series' in fname_lower:
+        return _gen_f90_interface_content(fname_lower, [1, 2])
+
     if ('node' in fname_lower or 'cell' in fname_lower or 'iface' in fname_lower or 'jface' in fname_lower or 'kface' in fname_lower) and not ('count' in fname_lower or 'celltype' in fname_lower):
         return _gen_f90_interface_content(fname_lower, range(1, 4))
 
@@ -74,6 +82,30 @@ def gen_f90_interface_content(fdef):
     return ""
 
 
+# free-form Fortran source lines must not be longer than 132 characters
+F90_MAX_LINE_LENGTH = 132
+
+
+def _f90_arglist(head, argNames, tail, indent):
+    line = head + ", ".join(argNames) + tail
+    if len(line) <= F90_MAX_LINE_LENGTH:
+        return line + "\n"
+
+    # break the argument list into "&" continuation lines
+    lines = list()
+    line = head
+    for i, aname in enumerate(argNames):
+        frag = aname + (tail if i == len(argNames) - 1 else ",")
+        if line != head and line != indent and len(line) + 1 + len(frag) + 2 > F90_MAX_LINE_LENGTH:
+            lines.append(line + " &")
+            line = indent
+        if line != head and line != indent:
+            line += " "
+        line += frag
+    lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
 def _gen_f90_source_content(fdef, dim):
     ret_is_void = 'void ' in fdef
 
@@ -151,6 +183,12 @@ def _gen_f90_source_content(fdef, dim):
             else:
                 argDefs.append('double precision, intent(out):: ' + aname)
 
+        elif f == 'const int*':
+            argDefs.append('integer, dimension(:), intent(in):: ' + aname)
+
+        elif f == 'const double*':
+            argDefs.append('double precision, dimension(:), intent(in):: ' + aname)
+
         elif f == 'char*':
             argDefs.append('character(*), intent(out):: ' + aname)
 
@@ -167,17 +205,17 @@ def _gen_f90_source_content(fdef, dim):
         argNames.append('ier')
         argDefs.append('integer, intent(out):: ier')
 
-    content = "  " + "subroutine " + fname_lower
+    subname = fname_lower
     if not dim is None:
-        content += '_{0}d'.format(dim)
-    content += "(" + ", ".join(argNames) + ")\n"
+        subname += '_{0}d'.format(dim)
+    content = _f90_arglist("  " + "subroutine " + subname + "(", argNames, ")", "      ")
 
     for argDef in argDefs:
         content += "    " + argDef + "\n"
 
     content += "\n"
     content += "    " + "call " + fname_lower + "_f2c &\n"
-    content += "      (" + ", ".join(argNames) + ")\n"
+    content += _f90_arglist("      (", argNames, ")", "      ")
     content += "\n"
     content += "  " + "end subroutine\n"
     content += "\n"
@@ -199,10 +237,18 @@ def gen_f90_source_content(fdef):
     if \
             fname_lower == 'cg_iric_read_grid2d_cellarea' or \
             fname_lower == 'cg_iric_read_grid2d_findcell' or \
+            fname_lower == 'cg_iric_read_grid2d_findcellmulti' or \
+            fname_lower == 'cg_iric_read_grid2d_findcellwithhint' or \
             fname_lower == 'cg_iric_read_grid2d_interpolatewithcell':
 
         return _gen_f90_source_content(fdef, None)
 
+    if '_series' in fname_lower:
+        cont = ''
+        for dim in [1, 2]:
+            cont += _gen_f90_source_content(fdef, dim)
+        return cont
+
     if ('node' in fname_lower or 'cell' in fname_lower or 'iface' in fname_lower or 'jface' in fname_lower or 'kface' in fname_lower) and not ('count' in fname_lower or 'celltype' in fname_lower):
         cont = ''
         for dim in range(1, 4):
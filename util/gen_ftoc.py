@@ -82,6 +82,14 @@ def gen_ftoc_source_content(fdef):
             args.append('double* ' + aname)
             iargs.append(aname)
 
+        elif f == 'const int*':
+            args.append('int* ' + aname)
+            iargs.append(aname)
+
+        elif f == 'const double*':
+            args.append('double* ' + aname)
+            iargs.append(aname)
+
         elif f == 'char*':
             args.append('STR_PSTR(' + aname + ')')
             iargs.append('c_' + aname)
@@ -3,6 +3,7 @@ import os
 import re
 
 from gen_code_util import build_call_line
+from gen_wrapper import TARGET_FILES_WRAPPER
 
 TARGET_FILES_SWIG = [
     'iriclib_bc.h',
@@ -25,7 +26,24 @@ TARGET_FILES_SWIG = [
 ]
 
 
-def gen_swig_i_content(fdef):
+def input_array_args():
+    # array arguments declared const (e.g. the point indices of Series functions) are inputs
+    ret = set()
+    for filename in TARGET_FILES_WRAPPER:
+        with open(os.path.join('..', filename), 'r', encoding='utf-8') as f:
+            for line in f:
+                m = re.search(r'IRICLIBDLL (\w+)\((.*)\)', line)
+                if not m:
+                    continue
+                fname, args = m.groups()
+                for a in args.split(','):
+                    a = a.strip()
+                    if a.startswith('const ') and a.endswith('_arr'):
+                        ret.add((fname, a.split(' ').pop()))
+    return ret
+
+
+def gen_swig_i_content(fdef, input_arrays):
     fdef2 = fdef
     fdef2 = fdef2.replace('IRICLIBDLL ', '')
     fdef2 = fdef2.replace(';', '')
@@ -47,6 +65,8 @@ def gen_swig_i_content(fdef):
 
         if atype == "int*" or atype == "double*":
             args.append(atype + " OUTPUT")
+        elif (atype == "IntArrayContainer&" or atype == "RealArrayContainer&") and ("_Write" in fname or (fname, aname) in input_arrays):
+            args.append(atype + " INPUT")
         else:
             args.append(a)
 
@@ -54,6 +74,8 @@ def gen_swig_i_content(fdef):
 
 
 def gen_swig_i():
+    input_arrays = input_array_args()
+
     with open(os.path.join('..', 'python_binding', 'iric.i'), 'w', encoding='utf-8') as f_i:
         with open('iric.i.header.txt', 'r', encoding='utf-8') as f:
             for l in f:
@@ -72,7 +94,7 @@ def gen_swig_i():
                     if filename != 'iriclib_wrapper.h' and '_arr' in line:
                         continue
 
-                    f_i.write(gen_swig_i_content(line))
+                    f_i.write(gen_swig_i_content(line, input_arrays))
 
             f_i.write("\n")
 
@@ -343,6 +365,12 @@ def gen_size_func(fname, args):
     return '@TODO FIX THIS', list()
 
 
+def numpy_dtype(container):
+    if container == "IntArrayContainer":
+        return "np.int32"
+    return "np.float64"
+
+
 def gen_iric_py_content(fdef):
     fdef2 = fdef
     fdef2 = fdef2.replace('IRICLIBDLL ', '')
@@ -353,6 +381,12 @@ def gen_iric_py_content(fdef):
 
     if fname == 'cg_iRIC_Read_Grid2d_Interpolate':
         return ''
+    if fname == 'cg_iRIC_Read_Grid2d_FindCellMulti' or fname == 'cg_iRIC_Read_Grid2d_InterpolateMulti':
+        return ''
+    if fname == 'cg_iRIC_Read_Grid2d_InterpolateWithHint':
+        return ''
+    if '_Series' in fname or '_Region' in fname or '_Trajectory' in fname or '_Rect' in fname:
+        return ''
 
     arglist = args.split(',')
 
@@ -382,7 +416,7 @@ def gen_iric_py_content(fdef):
             if "_Read" in fname or "GetGridCoord" in fname or "GetTriangleElements" in fname:
                 arrays_out[aname] = atype.replace('&', '')
                 w_args.append(aname.replace('_arr', ''))
-                rets.append(aname.replace('_arr', '') + ".get()")
+                rets.append(aname.replace('_arr', ''))
 
             elif "_Write" in fname:
                 arrays_in[aname] = atype.replace('&', '')
@@ -402,12 +436,12 @@ def gen_iric_py_content(fdef):
         size_f, args2 = gen_size_func(fname, args)
         content += "\t" + "size = " + size_f + "(" + ", ".join(args2) + ")\n"
 
+    # NumPy arrays are passed to the C functions directly, without copying
     for n, t in arrays_in.items():
-        content += "\t" + n.replace('_arr', '') + " = " + t + "(" + n + ".size)\n"
-        content += "\t" + n.replace('_arr', '') + ".set(" + n + ")\n"
+        content += "\t" + n.replace('_arr', '') + " = np.ascontiguousarray(" + n + ", dtype=" + numpy_dtype(t) + ")\n"
 
     for n, t in arrays_out.items():
-        content += "\t" + n.replace('_arr', '') + " = " + t + "(size)\n"
+        content += "\t" + n.replace('_arr', '') + " = np.zeros(size, dtype=" + numpy_dtype(t) + ")\n"
 
     content += "\t" + ", ".join(w_rets) + " = _iric." + fname + "(" + ", ".join(w_args) + ")\n"
 
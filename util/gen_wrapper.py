@@ -42,6 +42,7 @@ def gen_wrapper_header_line(fdef):
         aname = frags.pop()
         if '_arr' in aname:
             a2 = a
+            a2 = a2.replace('const ', '')
             a2 = a2.replace('int* ', 'IntArrayContainer& ')
             a2 = a2.replace('double* ', 'RealArrayContainer& ')
 
@@ -50,7 +51,7 @@ def gen_wrapper_header_line(fdef):
             m1 = re.search('cg_iRIC_Write_(.+_|)Functional', fname)
             m2 = re.search('cg_iRIC_Write_(.+_|)FunctionalWithName', fname)
             m3 = re.search('cg_iRIC_Write_BC_Indices', fname)
-            m4 = re.search('cg_iRIC_Write_Sol_Particle_Pos', fname)
+            m4 = re.search('cg_iRIC_Write_Sol_(Particle_Pos|ParticleGroup_.+Multi|ParticleGroupImage_.+Multi|PolyData_.+Multi)', fname)
 
             if (m1 or m2 or m3) and aname == 'length':
                 continue
@@ -98,6 +99,8 @@ def gen_wrapper_source_content(fdef):
     arglist = args.split(',')
     iargs = list()
     oargs = list()
+    oargs_skipped = list()
+    count_added = False
     for a in arglist:
         a = a.strip()
         frags = a.split(' ')
@@ -106,15 +109,17 @@ def gen_wrapper_source_content(fdef):
         m1 = re.search('cg_iRIC_Write_(.+_|)Functional', fname)
         m2 = re.search('cg_iRIC_Write_(.+_|)FunctionalWithName', fname)
         m3 = re.search('cg_iRIC_Write_BC_Indices', fname)
-        m4 = re.search('cg_iRIC_Write_Sol_Particle_Pos', fname)
+        m4 = re.search('cg_iRIC_Write_Sol_(Particle_Pos|ParticleGroup_.+Multi|ParticleGroupImage_.+Multi|PolyData_.+Multi)', fname)
 
         if (m1 or m2 or m3) and aname == 'length':
             continue
         if (m4) and aname == 'count':
+            oargs_skipped.append(aname)
             continue
 
         if '_arr' in aname:
             a2 = a
+            a2 = a2.replace('const ', '')
             a2 = a2.replace('int* ', 'IntArrayContainer& ')
             a2 = a2.replace('double* ', 'RealArrayContainer& ')
 
@@ -129,8 +134,9 @@ def gen_wrapper_source_content(fdef):
             if m3 and aname == 'idx_arr':
                 oargs.append('idx_arr.size()')
 
-            if m4 and aname == 'x_arr':
-                oargs.append('x_arr.size()')
+            if m4 and 'count' in oargs_skipped and not count_added:
+                oargs.append(aname + '.size()')
+                count_added = True
 
             oargs.append(aname + '.pointer()')
         else:
@@ -140,6 +146,13 @@ def gen_wrapper_source_content(fdef):
     content = retval + " " + fname + "(" + ", ".join(iargs) + ")\n"
     content += "{\n"
 
+    # the C function reads offsets_arr[count] points from x_arr and y_arr, so it should match their sizes
+    if 'cg_iRIC_Write_Sol_PolyData_GeometryMulti' in fname:
+        content += "\t" + "if (offsets_arr.size() != types_arr.size() + 1 || offsets_arr.pointer()[types_arr.size()] != x_arr.size() || y_arr.size() != x_arr.size()) {\n"
+        content += "\t\t" + "_iric_logger_error(\"In " + fname + "(), sizes of offsets_arr, x_arr and y_arr do not match\");\n"
+        content += "\t\t" + "return IRIC_INVALID_ARGUMENT;\n"
+        content += "\t" + "}\n\n"
+
     if 'cg_iRIC_Write_BC_Indices' in fname and not ('cg_iRIC_Write_BC_Indices2' in fname):
         fname = fname.replace('cg_iRIC_Write_BC_Indices', 'cg_iRIC_Write_BC_Indices2')
 